@@ -0,0 +1,731 @@
+/** sapien_bench: latency and throughput of the hot paths of the C++ API
+ *
+ *  Every scenario times one operation per iteration after a warmup and reports percentiles and
+ *  throughput. The results are written as JSON (--output) so runs can be compared with
+ *  manualtest/bench_compare.py.
+ *
+ *  sapien_bench [--filter <substring>] [--iterations <n>] [--warmup <n>] [--output <file>]
+ *               [--assets <dir>] [--list]
+ */
+#include "sapien/actor_builder.h"
+#include "sapien/articulation/pinocchio_model.h"
+#include "sapien/articulation/sapien_articulation.h"
+#include "sapien/articulation/sapien_link.h"
+#include "sapien/articulation/urdf_loader.h"
+#include "sapien/mesh_manager.h"
+#include "sapien/renderer/server/shared_memory.h"
+#include "sapien/sapien_actor.h"
+#include "sapien/sapien_scene.h"
+#include "sapien/simulation.h"
+#include "sapien/task_scheduler.h"
+
+#include "renderer/server/protos/render_server.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SAPIEN_ASSET_DIR
+#define SAPIEN_ASSET_DIR "assets"
+#endif
+
+using namespace sapien;
+using namespace physx;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+  std::string filter;
+  uint32_t iterations{200};
+  uint32_t warmup{20};
+  std::string output;
+  std::string assets{SAPIEN_ASSET_DIR};
+  bool list{false};
+};
+
+/** what one iteration of a scenario runs */
+struct Workload {
+  /** untimed, run before every iteration */
+  std::function<void()> prepare;
+  /** timed */
+  std::function<void()> run;
+  /** items processed by one run, e.g. steps or scenes */
+  double itemsPerRun{1};
+  std::string itemUnit{"op"};
+  /** keeps the scenario state alive while it is measured */
+  std::shared_ptr<void> state;
+};
+
+struct Scenario {
+  std::string name;
+  std::vector<std::pair<std::string, int>> params;
+  std::function<Workload(Simulation &, Options const &)> setup;
+  /** overrides Options::iterations for expensive scenarios, 0: use the option */
+  uint32_t iterations{0};
+
+  std::string id() const {
+    std::string result = name;
+    for (auto &[key, value] : params) {
+      result += "/" + key + "=" + std::to_string(value);
+    }
+    return result;
+  }
+};
+
+struct Result {
+  std::string id;
+  Scenario const *scenario;
+  std::string itemUnit;
+  uint32_t iterations;
+  double minUs, meanUs, p50Us, p90Us, p99Us, maxUs;
+  double throughput;
+};
+
+Result measure(Scenario const &scenario, Simulation &sim, Options const &options) {
+  auto workload = scenario.setup(sim, options);
+  uint32_t iterations = scenario.iterations ? std::min(scenario.iterations, options.iterations)
+                                            : options.iterations;
+
+  for (uint32_t i = 0; i < options.warmup; ++i) {
+    if (workload.prepare) {
+      workload.prepare();
+    }
+    workload.run();
+  }
+
+  std::vector<double> samples;
+  samples.reserve(iterations);
+  double total = 0;
+  for (uint32_t i = 0; i < iterations; ++i) {
+    if (workload.prepare) {
+      workload.prepare();
+    }
+    auto start = Clock::now();
+    workload.run();
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    samples.push_back(us);
+    total += us;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&](double p) {
+    return samples[std::min<size_t>(samples.size() - 1, p * samples.size())];
+  };
+
+  Result result;
+  result.id = scenario.id();
+  result.scenario = &scenario;
+  result.itemUnit = workload.itemUnit;
+  result.iterations = iterations;
+  result.minUs = samples.front();
+  result.meanUs = total / iterations;
+  result.p50Us = percentile(0.5);
+  result.p90Us = percentile(0.9);
+  result.p99Us = percentile(0.99);
+  result.maxUs = samples.back();
+  result.throughput = total > 0 ? workload.itemsPerRun * iterations / (total * 1e-6) : 0;
+  return result;
+}
+
+/** boxes on a grid, with spacing 0 they touch each other and are stacked four high */
+void addBoxes(SScene &scene, int count, float spacing) {
+  auto builder = scene.createActorBuilder();
+  builder->addBoxShape({{0, 0, 0}, PxIdentity}, {0.05, 0.05, 0.05});
+  int layers = spacing == 0 ? 4 : 1;
+  int side = std::max(1, static_cast<int>(std::ceil(std::sqrt(count / float(layers)))));
+  float pitch = 0.1f + spacing;
+  for (int i = 0; i < count; ++i) {
+    int layer = i / (side * side);
+    int cell = i % (side * side);
+    auto actor = builder->build();
+    actor->setPose({{(cell % side) * pitch, (cell / side) * pitch, 0.05f + layer * 0.1f},
+                    PxIdentity});
+  }
+}
+
+std::unique_ptr<SScene> createScene(Simulation &sim) {
+  auto scene = sim.createScene();
+  scene->addGround(0, false);
+  return scene;
+}
+
+/** panda robots in a row */
+std::vector<SArticulation *> addRobots(SScene &scene, Options const &options, int count) {
+  auto loader = scene.createURDFLoader();
+  std::vector<SArticulation *> robots;
+  for (int i = 0; i < count; ++i) {
+    auto robot = loader->load(options.assets + "/robot/panda/panda.urdf");
+    robot->setRootPose({{0, i * 1.f, 0}, PxIdentity});
+    robots.push_back(robot);
+  }
+  return robots;
+}
+
+/** MeshManager keeps its meshes for the lifetime of the simulation, the benchmark releases them */
+struct MeshLoadState {
+  std::unique_ptr<MeshManager> manager;
+  PxConvexMesh *mesh{};
+
+  void release() {
+    if (mesh) {
+      mesh->release();
+      mesh = nullptr;
+    }
+  }
+  ~MeshLoadState() { release(); }
+};
+
+/** baseline for the task scheduler: one mutex-protected queue of std::function shared by all
+ *  threads, every submit allocates the function, a packaged_task and a wrapper */
+class MutexQueuePool {
+public:
+  explicit MutexQueuePool(uint32_t threadCount) {
+    for (uint32_t i = 0; i < threadCount; ++i) {
+      mThreads.emplace_back([this]() {
+        while (true) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mStop || !mQueue.empty(); });
+            if (mStop && mQueue.empty()) {
+              return;
+            }
+            task = std::move(mQueue.front());
+            mQueue.pop();
+          }
+          task();
+        }
+      });
+    }
+  }
+
+  ~MutexQueuePool() {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStop = true;
+    }
+    mCondition.notify_all();
+    for (auto &t : mThreads) {
+      t.join();
+    }
+  }
+
+  template <typename F> std::future<void> submit(F &&f) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::function<void()>(f));
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mQueue.push([task]() { (*task)(); });
+    }
+    mCondition.notify_one();
+    return task->get_future();
+  }
+
+private:
+  std::vector<std::thread> mThreads;
+  std::queue<std::function<void()>> mQueue;
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  bool mStop{false};
+};
+
+namespace rs = Renderer::server;
+
+/** render server that only copies the poses out, isolates the transport cost of a frame */
+class StubRenderService final : public rs::proto::RenderService::Service {
+  grpc::Status UpdateRender(grpc::ServerContext *c, const rs::proto::UpdateRenderReq *req,
+                            rs::proto::Empty *res) override {
+    poses.assign(req->body_pose_data().begin(), req->body_pose_data().end());
+    return grpc::Status::OK;
+  }
+
+public:
+  std::vector<float> poses;
+};
+
+struct GrpcTransportState {
+  StubRenderService service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<rs::proto::RenderService::Stub> stub;
+  rs::proto::UpdateRenderReq req;
+
+  ~GrpcTransportState() { server->Shutdown(); }
+};
+
+struct ShmTransportState {
+  std::vector<float> poses;
+  std::unique_ptr<rs::ShmRing> ring;
+  // declared last, stops before the poses it writes go away
+  std::unique_ptr<rs::ShmRingServer> server;
+};
+
+template <typename T> std::shared_ptr<void> hold(T value) {
+  return std::make_shared<T>(std::move(value));
+}
+
+std::vector<Scenario> createScenarios() {
+  std::vector<Scenario> scenarios;
+
+  for (int bodies : {10, 100, 1000}) {
+    scenarios.push_back(
+        {"step_bodies", {{"bodies", bodies}}, [=](Simulation &sim, auto &) {
+           auto scene = createScene(sim);
+           addBoxes(*scene, bodies, 0.1f);
+           auto s = scene.get();
+           return Workload{{}, [s] { s->step(); }, 1, "step", hold(std::move(scene))};
+         }});
+  }
+
+  // the same bodies spread out or piled up, the pile generates contacts between the bodies
+  for (int dense : {0, 1}) {
+    scenarios.push_back(
+        {"step_contacts", {{"bodies", 400}, {"dense", dense}}, [=](Simulation &sim, auto &) {
+           auto scene = createScene(sim);
+           addBoxes(*scene, 400, dense ? 0.f : 0.2f);
+           auto s = scene.get();
+           return Workload{{}, [s] { s->step(); }, 1, "step", hold(std::move(scene))};
+         }});
+  }
+
+  for (int articulations : {1, 8, 32}) {
+    scenarios.push_back(
+        {"step_articulations",
+         {{"articulations", articulations}},
+         [=](Simulation &sim, Options const &options) {
+           auto scene = createScene(sim);
+           addRobots(*scene, options, articulations);
+           auto s = scene.get();
+           return Workload{{}, [s] { s->step(); }, 1, "step", hold(std::move(scene))};
+         }});
+  }
+
+  // independent scenes stepped concurrently, each scene steps on its own runner thread
+  for (int threads : {1, 2, 4, 8}) {
+    scenarios.push_back(
+        {"step_async", {{"threads", threads}, {"bodies", 200}}, [=](Simulation &sim, auto &) {
+           std::vector<std::shared_ptr<SScene>> scenes;
+           for (int i = 0; i < threads; ++i) {
+             auto scene = createScene(sim);
+             addBoxes(*scene, 200, 0.f);
+             scenes.push_back(std::move(scene));
+           }
+           return Workload{{},
+                           [scenes] {
+                             std::vector<std::future<void>> futures;
+                             for (auto &scene : scenes) {
+                               futures.push_back(scene->stepAsync());
+                             }
+                             for (auto &f : futures) {
+                               f.get();
+                             }
+                           },
+                           static_cast<double>(threads), "step", hold(scenes)};
+         }});
+  }
+
+  for (int bodies : {100, 1000}) {
+    scenarios.push_back({"pack_scene", {{"bodies", bodies}}, [=](Simulation &sim, auto &) {
+                           auto scene = createScene(sim);
+                           addBoxes(*scene, bodies, 0.1f);
+                           auto s = scene.get();
+                           return Workload{{}, [s] { s->packScene(); }, 1, "scene",
+                                           hold(std::move(scene))};
+                         }});
+    scenarios.push_back({"unpack_scene", {{"bodies", bodies}}, [=](Simulation &sim, auto &) {
+                           auto scene = createScene(sim);
+                           addBoxes(*scene, bodies, 0.1f);
+                           auto s = scene.get();
+                           auto data = std::make_shared<SceneData>(s->packScene());
+                           return Workload{{}, [s, data] { s->unpackScene(*data); }, 1, "scene",
+                                           hold(std::move(scene))};
+                         }});
+  }
+
+  // resting bodies fall asleep, only the pushed ones are active; the full pack visits all bodies
+  for (int bodies : {1000, 10000}) {
+    for (int active : {0, 10, 100}) {
+      for (int incremental : {0, 1}) {
+        scenarios.push_back(
+            {"pack_scene_active",
+             {{"bodies", bodies}, {"active", active}, {"incremental", incremental}},
+             [=](Simulation &sim, auto &) {
+               auto scene = createScene(sim);
+               addBoxes(*scene, bodies, 0.1f);
+               auto s = scene.get();
+               for (int i = 0; i < 500; ++i) {
+                 s->step();
+               }
+               s->packSceneIncremental();
+               std::vector<SActor *> pushed;
+               for (auto actor : s->getAllActors()) {
+                 if (actor->getType() == EActorType::DYNAMIC &&
+                     static_cast<int>(pushed.size()) < active) {
+                   pushed.push_back(static_cast<SActor *>(actor));
+                 }
+               }
+               auto prepare = [s, pushed] {
+                 for (auto actor : pushed) {
+                   actor->setVelocity({0, 0, 0.1f});
+                 }
+                 s->step();
+               };
+               auto run = [s, incremental] {
+                 incremental ? s->packSceneIncremental() : s->packScene();
+               };
+               return Workload{prepare, run, 1, "scene", hold(std::move(scene))};
+             },
+             100});
+      }
+    }
+  }
+
+  scenarios.push_back(
+      {"get_contacts", {{"bodies", 400}}, [](Simulation &sim, auto &) {
+         auto scene = createScene(sim);
+         addBoxes(*scene, 400, 0.f);
+         auto s = scene.get();
+         for (int i = 0; i < 50; ++i) {
+           s->step();
+         }
+         return Workload{{}, [s] { s->getContacts(); }, 1, "call", hold(std::move(scene))};
+       }});
+
+  // the state cache is invalidated by the untimed step
+  scenarios.push_back({"get_qpos",
+                       {{"articulations", 1}},
+                       [](Simulation &sim, Options const &options) {
+                         auto scene = createScene(sim);
+                         auto robot = addRobots(*scene, options, 1)[0];
+                         auto s = scene.get();
+                         return Workload{[s] { s->step(); }, [robot] { robot->getQpos(); }, 1,
+                                         "call", hold(std::move(scene))};
+                       }});
+
+  scenarios.push_back({"urdf_load", {}, [](Simulation &sim, Options const &options) {
+                         auto scene = createScene(sim);
+                         auto s = scene.get();
+                         auto loader = std::shared_ptr(s->createURDFLoader());
+                         auto filename = options.assets + "/robot/panda/panda.urdf";
+                         auto robot = std::make_shared<SArticulation *>(nullptr);
+                         return Workload{[s, robot] {
+                                           if (*robot) {
+                                             s->removeArticulation(*robot);
+                                             s->step();
+                                           }
+                                         },
+                                         [loader, filename, robot] {
+                                           *robot = loader->load(filename);
+                                         },
+                                         1, "articulation", hold(std::move(scene))};
+                       },
+                       50});
+
+  scenarios.push_back({"mesh_load", {}, [](Simulation &sim, Options const &options) {
+                         auto filename = options.assets + "/aligned/beer_can/visual_mesh.obj";
+                         auto state = std::make_shared<MeshLoadState>();
+                         // a fresh manager without disk cache, so the convex hull is cooked
+                         return Workload{[state, &sim] {
+                                           state->release();
+                                           state->manager = std::make_unique<MeshManager>(&sim);
+                                         },
+                                         [state, filename] {
+                                           state->mesh =
+                                               state->manager->loadMesh(filename, false, false);
+                                         },
+                                         1, "mesh", state};
+                       },
+                       50});
+
+  scenarios.push_back({"inverse_kinematics", {}, [](Simulation &sim, Options const &options) {
+                         auto scene = createScene(sim);
+                         auto robot = addRobots(*scene, options, 1)[0];
+                         auto model = std::shared_ptr(robot->createPinocchioModel());
+                         uint32_t link = robot->getBaseLinks().size() - 1;
+                         uint32_t dof = robot->dof();
+                         auto limits = robot->getQlimits();
+                         auto rng = std::make_shared<std::mt19937>(0);
+                         auto target = std::make_shared<PxTransform>();
+                         return Workload{[=] {
+                                           // a reachable target from a random configuration
+                                           Eigen::VectorXd qpos(dof);
+                                           for (uint32_t i = 0; i < dof; ++i) {
+                                             std::uniform_real_distribution<double> d(
+                                                 std::max(limits[i][0], -PxPi),
+                                                 std::min(limits[i][1], PxPi));
+                                             qpos[i] = d(*rng);
+                                           }
+                                           model->computeForwardKinematics(qpos);
+                                           *target = model->getLinkPose(link);
+                                         },
+                                         [=] {
+                                           model->computeInverseKinematics(
+                                               link, *target, Eigen::VectorXd::Zero(dof));
+                                         },
+                                         1, "solve", hold(std::move(scene))};
+                       },
+                       100});
+
+  // one pose update round trip to a stub render server on the same host, gRPC compared to the
+  // shared memory ring; nothing is rendered
+  for (int bodies : {100, 1000, 10000}) {
+    scenarios.push_back(
+        {"render_update_grpc", {{"bodies", bodies}}, [=](Simulation &, auto &) {
+           auto s = std::make_shared<GrpcTransportState>();
+           grpc::ServerBuilder builder;
+           int port = 0;
+           builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+           builder.RegisterService(&s->service);
+           s->server = builder.BuildAndStart();
+           s->stub = rs::proto::RenderService::NewStub(grpc::CreateChannel(
+               "127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials()));
+           s->req.mutable_body_pose_data()->Resize(bodies * 7, 0.f);
+           return Workload{{},
+                           [s, frame = 0.f]() mutable {
+                             auto data = s->req.mutable_body_pose_data();
+                             std::fill(data->begin(), data->end(), ++frame);
+                             grpc::ClientContext context;
+                             rs::proto::Empty res;
+                             auto status = s->stub->UpdateRender(&context, s->req, &res);
+                             if (!status.ok()) {
+                               throw std::runtime_error(status.error_message());
+                             }
+                           },
+                           1, "frame", s};
+         }});
+    scenarios.push_back(
+        {"render_update_shm", {{"bodies", bodies}}, [=](Simulation &, auto &) {
+           auto s = std::make_shared<ShmTransportState>();
+           std::string name =
+               "/sapien_bench_" + std::to_string(getpid()) + "_" + std::to_string(bodies);
+           s->ring = rs::ShmRing::Create(name, 2, bodies, 0);
+           s->server = std::make_unique<rs::ShmRingServer>(
+               rs::ShmRing::Open(name), [poses = &s->poses](rs::ShmRing &ring, uint32_t n) {
+                 poses->assign(ring.poses(n), ring.poses(n) + ring.frame(n).bodyCount * 7);
+               });
+           s->ring->unlink();
+           return Workload{{},
+                           [s, bodies] {
+                             auto &ring = *s->ring;
+                             uint32_t n = ring.beginFrame(1000);
+                             ring.frame(n) = {static_cast<uint32_t>(bodies), 0, 0, 0};
+                             std::fill(ring.poses(n), ring.poses(n) + bodies * 7, float(n));
+                             ring.endFrame(n);
+                             ring.waitCompleted(n, 1000);
+                           },
+                           1, "frame", s};
+         }});
+  }
+
+  // scheduling overhead of empty tasks, the mutex pool is the design the scheduler replaced
+  constexpr int kTasks = 10000;
+  scenarios.push_back({"tasks_mutex_pool", {{"tasks", kTasks}}, [](Simulation &, auto &) {
+                         auto threads = TaskScheduler::Get().getWorkerCount();
+                         auto pool = std::make_shared<MutexQueuePool>(threads);
+                         return Workload{{},
+                                         [pool] {
+                                           std::vector<std::future<void>> futures;
+                                           futures.reserve(kTasks);
+                                           for (int i = 0; i < kTasks; ++i) {
+                                             futures.push_back(pool->submit([] {}));
+                                           }
+                                           for (auto &f : futures) {
+                                             f.get();
+                                           }
+                                         },
+                                         kTasks, "task", pool};
+                       }});
+  scenarios.push_back({"tasks_scheduler_submit", {{"tasks", kTasks}}, [](Simulation &, auto &) {
+                         return Workload{{},
+                                         [] {
+                                           auto &scheduler = TaskScheduler::Get();
+                                           std::vector<std::future<void>> futures;
+                                           futures.reserve(kTasks);
+                                           for (int i = 0; i < kTasks; ++i) {
+                                             futures.push_back(scheduler.submit([] {}));
+                                           }
+                                           for (auto &f : futures) {
+                                             f.get();
+                                           }
+                                         },
+                                         kTasks, "task", nullptr};
+                       }});
+  scenarios.push_back({"tasks_scheduler_group", {{"tasks", kTasks}}, [](Simulation &, auto &) {
+                         return Workload{{},
+                                         [] {
+                                           TaskGroup group;
+                                           for (int i = 0; i < kTasks; ++i) {
+                                             group.run([] {});
+                                           }
+                                           group.wait();
+                                         },
+                                         kTasks, "task", nullptr};
+                       }});
+  // tasks spawned by a worker go to its own deque and are stolen by the others
+  scenarios.push_back({"tasks_scheduler_nested", {{"tasks", kTasks}}, [](Simulation &, auto &) {
+                         return Workload{{},
+                                         [] {
+                                           TaskScheduler::Get()
+                                               .submit([] {
+                                                 TaskGroup group;
+                                                 for (int i = 0; i < kTasks; ++i) {
+                                                   group.run([] {});
+                                                 }
+                                                 group.wait();
+                                               })
+                                               .get();
+                                         },
+                                         kTasks, "task", nullptr};
+                       }});
+  scenarios.push_back(
+      {"parallel_for", {{"elements", 1 << 20}}, [](Simulation &, auto &) {
+         auto data = std::make_shared<std::vector<float>>(1 << 20, 1.f);
+         return Workload{{},
+                         [data] {
+                           TaskScheduler::Get().parallelFor(0, data->size(), [&](int64_t i) {
+                             (*data)[i] = std::sqrt((*data)[i] + 1.f);
+                           });
+                         },
+                         static_cast<double>(data->size()), "element", data};
+       }});
+
+  return scenarios;
+}
+
+std::string escape(std::string const &s) {
+  std::string result;
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+void writeJson(std::ostream &out, std::vector<Result> const &results, Options const &options) {
+  auto now = std::time(nullptr);
+  char date[32];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+  out << std::fixed << std::setprecision(3);
+  out << "{\n  \"context\": {\"date\": \"" << date << "\", \"hardware_concurrency\": "
+      << std::thread::hardware_concurrency() << ", \"iterations\": " << options.iterations
+      << ", \"warmup\": " << options.warmup << ", \"build\": \""
+#ifdef NDEBUG
+      << "release"
+#else
+      << "debug"
+#endif
+      << "\"},\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto &r = results[i];
+    out << (i ? ",\n" : "\n") << "    {\"id\": \"" << escape(r.id) << "\", \"name\": \""
+        << escape(r.scenario->name) << "\", \"params\": {";
+    for (size_t j = 0; j < r.scenario->params.size(); ++j) {
+      out << (j ? ", " : "") << "\"" << escape(r.scenario->params[j].first)
+          << "\": " << r.scenario->params[j].second;
+    }
+    out << "}, \"iterations\": " << r.iterations << ", \"min_us\": " << r.minUs
+        << ", \"mean_us\": " << r.meanUs << ", \"p50_us\": " << r.p50Us
+        << ", \"p90_us\": " << r.p90Us << ", \"p99_us\": " << r.p99Us
+        << ", \"max_us\": " << r.maxUs << ", \"throughput\": " << r.throughput
+        << ", \"throughput_unit\": \"" << escape(r.itemUnit) << "/s\"}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+Options parseOptions(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + arg);
+      }
+      return argv[++i];
+    };
+    if (arg == "--filter") {
+      options.filter = value();
+    } else if (arg == "--iterations") {
+      options.iterations = std::max(1, std::stoi(value()));
+    } else if (arg == "--warmup") {
+      options.warmup = std::stoi(value());
+    } else if (arg == "--output") {
+      options.output = value();
+    } else if (arg == "--assets") {
+      options.assets = value();
+    } else if (arg == "--list") {
+      options.list = true;
+    } else {
+      throw std::runtime_error("unknown argument " + arg);
+    }
+  }
+  return options;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  try {
+    options = parseOptions(argc, argv);
+  } catch (std::exception const &e) {
+    std::cerr << e.what() << "\nusage: sapien_bench [--filter <substring>] [--iterations <n>] "
+                             "[--warmup <n>] [--output <file>] [--assets <dir>] [--list]\n";
+    return 2;
+  }
+
+  auto scenarios = createScenarios();
+  std::erase_if(scenarios, [&](Scenario const &s) {
+    return s.id().find(options.filter) == std::string::npos;
+  });
+  if (options.list) {
+    for (auto &s : scenarios) {
+      std::cout << s.id() << "\n";
+    }
+    return 0;
+  }
+
+  auto sim = Simulation::getInstance();
+  sim->setLogLevel("error");
+
+  std::vector<Result> results;
+  std::cerr << std::fixed << std::setprecision(1);
+  for (auto &scenario : scenarios) {
+    try {
+      results.push_back(measure(scenario, *sim, options));
+    } catch (std::exception const &e) {
+      std::cerr << scenario.id() << " failed: " << e.what() << "\n";
+      return 1;
+    }
+    auto &r = results.back();
+    std::cerr << std::left << std::setw(44) << r.id << std::right << " p50 " << std::setw(10)
+              << r.p50Us << " us  p99 " << std::setw(10) << r.p99Us << " us  " << std::setw(12)
+              << r.throughput << " " << r.itemUnit << "/s\n";
+  }
+
+  if (options.output.empty()) {
+    writeJson(std::cout, results, options);
+  } else {
+    std::ofstream file(options.output);
+    if (!file) {
+      std::cerr << "failed to open " << options.output << "\n";
+      return 1;
+    }
+    writeJson(file, results, options);
+  }
+  return 0;
+}
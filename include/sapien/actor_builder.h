@@ -4,6 +4,7 @@
 #include "sapien_material.h"
 #include <PxPhysicsAPI.h>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace sapien {
@@ -72,6 +73,8 @@ protected:
     uint32_t w0 = 1, w1 = 1, w2 = 0, w3 = 0;
   } mCollisionGroup;
 
+  std::optional<bool> mUseAggregate;
+
 public:
   explicit ActorBuilder(SScene *scene = nullptr);
   ActorBuilder(ActorBuilder const &other) = delete;
@@ -166,6 +169,11 @@ public:
                                                   uint32_t g3);
   std::shared_ptr<ActorBuilder> resetCollisionGroup();
 
+  /* put all shapes of the built actor in a single broadphase entry (PxAggregate)
+   * when not set, the scene decides by the shape count, see SceneConfig::aggregateShapeThreshold
+   */
+  std::shared_ptr<ActorBuilder> setUseAggregate(bool enabled);
+
   // calling this function will overwrite the densities
   std::shared_ptr<ActorBuilder> setMassAndInertia(PxReal mass, PxTransform const &cMassPose,
                                                   PxVec3 const &inertia);
@@ -0,0 +1,78 @@
+#pragma once
+#include <PxPhysicsAPI.h>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sapien {
+using namespace physx;
+
+/** memory used by one arena, sizes are the bytes requested by PhysX */
+struct ArenaMemoryStats {
+  std::string name;
+  uint64_t bytesInUse{0};
+  uint64_t peakBytesInUse{0};
+  /** pooled chunks and large blocks obtained from the system */
+  uint64_t bytesReserved{0};
+  uint64_t allocationCount{0};
+  /** bytes in use by category: mesh, contact, solver, articulation, broadphase, other */
+  std::map<std::string, uint64_t> bytesByCategory;
+};
+
+struct MemoryStats {
+  uint64_t bytesInUse{0};
+  uint64_t bytesReserved{0};
+  /** the global arena first, then one arena per scene */
+  std::vector<ArenaMemoryStats> arenas;
+};
+
+/** PhysX allocator with size-class pools and per-scene arenas
+ *
+ *  Small allocations are served from free lists of 64 KiB chunks owned by an arena, large ones
+ *  go to the system. Each SScene owns an arena and makes the allocations of its thread go to it
+ *  with a Scope. Allocations outside any scope, e.g. the SDK and cooked meshes, go to the global
+ *  arena. When a scene is destroyed its chunks are freed in bulk. Allocations are categorized
+ *  from the PhysX source file and type name, so the categories are a best effort.
+ */
+class ArenaAllocator : public PxAllocatorCallback {
+public:
+  struct Arena;
+
+  /** never destroyed, PhysX may still free memory during static destruction */
+  static ArenaAllocator &Get();
+
+  void *allocate(size_t size, const char *typeName, const char *filename, int line) override;
+  void deallocate(void *ptr) override;
+
+  Arena *createArena(std::string const &name);
+  void setArenaName(Arena *arena, std::string const &name);
+  /** free the arena once all its allocations are returned, the arena must not be used after */
+  void releaseArena(Arena *arena);
+
+  ArenaMemoryStats getArenaStats(Arena *arena);
+  MemoryStats getMemoryStats();
+
+  /** allocations of the calling thread go to arena while the scope is alive, nullptr: global */
+  class Scope {
+  public:
+    explicit Scope(Arena *arena);
+    ~Scope();
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+
+  private:
+    Arena *mPrevious;
+  };
+
+private:
+  ArenaAllocator();
+  void destroyArena(Arena *arena);
+
+  std::mutex mMutex;
+  Arena *mGlobalArena;
+  std::vector<Arena *> mArenas;
+};
+
+} // namespace sapien
@@ -2,6 +2,7 @@
 #include "sapien/actor_builder.h"
 #include <PxPhysicsAPI.h>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <vector>
 
@@ -74,6 +75,8 @@ class ArticulationBuilder : public std::enable_shared_from_this<ArticulationBuil
 
   SScene *mScene;
 
+  std::optional<bool> mUseAggregate;
+
 public:
   ArticulationBuilder(SScene *scene = nullptr);
 
@@ -88,6 +91,16 @@ public:
   std::shared_ptr<LinkBuilder> createLinkBuilder(std::shared_ptr<LinkBuilder> parent = nullptr);
   std::shared_ptr<LinkBuilder> createLinkBuilder(int parentIdx);
 
+  /** put all links in a single broadphase entry (PxAggregate), self-collision in the aggregate
+   *  is enabled only if the collision groups allow any non-adjacent links to collide
+   *  when not set, follows SceneConfig::aggregateArticulations
+   *
+   *  The self-collision flag is decided when the articulation is added to the scene, changing
+   *  collision groups later does not update it. Articulations with more links than PhysX
+   *  allows in an aggregate (128) are added without aggregate.
+   */
+  inline void setUseAggregate(bool enabled) { mUseAggregate = enabled; }
+
   SArticulation *build(bool fixBase = false) const;
   SKArticulation *buildKinematic() const;
 
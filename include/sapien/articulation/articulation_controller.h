@@ -0,0 +1,120 @@
+#pragma once
+#include "sapien/control_step.h"
+#include <PxPhysicsAPI.h>
+#include <vector>
+
+namespace sapien {
+using namespace physx;
+
+class SArticulation;
+
+/** Joint positions over time, preloaded for on-board tracking
+ *
+ *  positions and velocities hold one row of dof values per waypoint. Between waypoints eHOLD
+ *  keeps the previous waypoint, eLINEAR interpolates linearly and eCUBIC uses cubic Hermite
+ *  segments. Without velocities, cubic tangents are finite differences of the neighbouring
+ *  waypoints and zero at both ends. Before the first and after the last waypoint the trajectory
+ *  holds still.
+ */
+class JointTrajectory {
+public:
+  struct Sample {
+    std::vector<PxReal> position;
+    std::vector<PxReal> velocity;
+    std::vector<PxReal> acceleration;
+  };
+
+  JointTrajectory(uint32_t dof, std::vector<PxReal> times, std::vector<PxReal> positions,
+                  std::vector<PxReal> velocities = {},
+                  ActionInterpolation interpolation = ActionInterpolation::eCUBIC);
+
+  inline uint32_t dof() const { return mDof; }
+  inline PxReal getStartTime() const { return mTimes.front(); }
+  inline PxReal getEndTime() const { return mTimes.back(); }
+  inline std::vector<PxReal> const &getTimes() const { return mTimes; }
+  inline ActionInterpolation getInterpolation() const { return mInterpolation; }
+
+  /** evaluate at time t, sample vectors are resized to dof */
+  void sample(PxReal t, Sample &out) const;
+
+private:
+  uint32_t mDof;
+  std::vector<PxReal> mTimes;
+  std::vector<PxReal> mPositions;
+  std::vector<PxReal> mVelocities;
+  ActionInterpolation mInterpolation;
+};
+
+/** Tracks a JointTrajectory from SArticulation::prestep, once per physics step
+ *
+ *  The controller keeps its own clock, which starts at 0 and advances by the scene timestep on
+ *  every step, so a trajectory attached to an articulation runs without calls from the host.
+ */
+class ArticulationController {
+public:
+  explicit ArticulationController(JointTrajectory trajectory);
+  virtual ~ArticulationController() = default;
+
+  /** called by SArticulation::prestep, evaluates the controller and advances the clock */
+  void step(SArticulation &articulation, PxReal timestep);
+
+  inline PxReal getTime() const { return mTime; }
+  inline void setTime(PxReal time) { mTime = time; }
+  inline bool isFinished() const { return mTime >= mTrajectory.getEndTime(); }
+  inline JointTrajectory const &getTrajectory() const { return mTrajectory; }
+
+protected:
+  /** apply the controller for the step from time to time + timestep */
+  virtual void update(SArticulation &articulation, PxReal time, PxReal timestep) = 0;
+
+  JointTrajectory mTrajectory;
+  JointTrajectory::Sample mReference;
+  PxReal mTime{0};
+};
+
+/** sets drive targets and drive velocity targets to the reference at the end of every step,
+ * the joint drives do the tracking */
+class TrajectoryController : public ArticulationController {
+public:
+  using ArticulationController::ArticulationController;
+
+protected:
+  void update(SArticulation &articulation, PxReal time, PxReal timestep) override;
+};
+
+/** qf = M(q) (qacc_ref + kp (q_ref - q) + kd (qvel_ref - qvel)) + gravity + Coriolis
+ *
+ *  Joint drives should have zero stiffness and damping so they do not fight the torques.
+ */
+class ComputedTorqueController : public ArticulationController {
+public:
+  ComputedTorqueController(JointTrajectory trajectory, std::vector<PxReal> kp,
+                           std::vector<PxReal> kd);
+
+protected:
+  void update(SArticulation &articulation, PxReal time, PxReal timestep) override;
+
+private:
+  std::vector<PxReal> mKp;
+  std::vector<PxReal> mKd;
+};
+
+/** qf = stiffness (q_ref - q) + damping (qvel_ref - qvel), plus gravity if compensated
+ *
+ *  A trajectory with a single waypoint makes a fixed set point.
+ */
+class JointImpedanceController : public ArticulationController {
+public:
+  JointImpedanceController(JointTrajectory trajectory, std::vector<PxReal> stiffness,
+                           std::vector<PxReal> damping, bool gravityCompensation = true);
+
+protected:
+  void update(SArticulation &articulation, PxReal time, PxReal timestep) override;
+
+private:
+  std::vector<PxReal> mStiffness;
+  std::vector<PxReal> mDamping;
+  bool mGravityCompensation;
+};
+
+} // namespace sapien
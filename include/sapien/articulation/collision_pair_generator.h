@@ -0,0 +1,65 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sapien {
+class SArticulation;
+
+/** Link pairs of an articulation whose collisions can be ignored
+ *
+ *  Generated by sampling random configurations, in the spirit of the MoveIt setup assistant.
+ *  Pairs are given by link names.
+ */
+struct DisabledCollisionPairs {
+  /** links connected by a joint, PhysX already ignores these */
+  std::vector<std::pair<std::string, std::string>> adjacent;
+  /** links colliding in nearly every sampled configuration */
+  std::vector<std::pair<std::string, std::string>> alwaysColliding;
+  /** links that never collided in any sampled configuration */
+  std::vector<std::pair<std::string, std::string>> neverColliding;
+
+  uint32_t sampleCount{0};
+
+  /** non-adjacent link pairs with collision shapes, i.e. pairs reaching the narrowphase */
+  uint32_t candidatePairs{0};
+  uint32_t candidateShapePairs{0};
+  /** pairs removed from the narrowphase by applyDisabledCollisionPairs */
+  uint32_t disabledPairs{0};
+  uint32_t disabledShapePairs{0};
+
+  /** SRDF document with one disable_collisions entry per pair */
+  std::string toSRDF(std::string const &robotName) const;
+  static DisabledCollisionPairs fromSRDF(std::string const &srdf);
+};
+
+/** Sample random configurations and classify all link pairs of the articulation
+ *
+ *  Shape overlaps are tested with PxGeometryQuery on poses from the pinocchio model, the
+ *  articulation itself is not moved. Samples are split into threadCount chunks that run on the
+ *  task scheduler, 0 means one chunk per scheduler worker and one for the calling thread.
+ */
+DisabledCollisionPairs computeDisabledCollisionPairs(SArticulation &articulation,
+                                                     uint32_t sampleCount = 1000,
+                                                     uint32_t threadCount = 0,
+                                                     float alwaysCollidingRatio = 0.95f);
+
+/** Same as computeDisabledCollisionPairs, cached in memory by key (e.g. a hash of the URDF) */
+DisabledCollisionPairs const &getDisabledCollisionPairs(size_t key, SArticulation &articulation,
+                                                        uint32_t sampleCount = 1000);
+
+/** Assign collision groups so the always-colliding and never-colliding pairs are ignored
+ *
+ *  Each collision group bit (word 2 of the filter data) is given to a clique of links in which
+ *  every pair may be ignored. When the 32 bits run out, the remaining pairs stay enabled. The low
+ *  half of word 3 is set to an id unique to the articulation so the bits never affect other
+ *  actors. Links with a shape that already has ignore bits or an id (set_collision_groups, an
+ *  SRDF with reason "Default" or an earlier call) keep their groups, pairs involving them stay
+ *  enabled with a warning.
+ *  Fills disabledPairs and disabledShapePairs and returns the number of disabled link pairs.
+ */
+uint32_t applyDisabledCollisionPairs(SArticulation &articulation, DisabledCollisionPairs &pairs);
+
+} // namespace sapien
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <pinocchio/multibody/model.hpp>
+#include <string>
+#include <vector>
+
+namespace sapien {
+
+/** Analytic inverse kinematics for one link of a kinematic model
+ *
+ *  Solvers are created for a (model, link) pair by an IKSolverFactory and are shared between
+ *  all PinocchioModels with the same kinematic structure, so they must be immutable after
+ *  construction.
+ */
+class IIKSolver {
+public:
+  virtual std::string getName() const = 0;
+
+  /** all solutions reaching pose, sorted by distance to seed
+   *
+   *  pose: target pose of the link in the articulation base frame
+   *  seed: qpos in SAPIEN order, joints not handled by the solver keep their seed value
+   *  Solutions outside the joint limits are dropped. Returns an empty vector if the pose is
+   *  unreachable.
+   */
+  virtual std::vector<Eigen::VectorXd> solve(physx::PxTransform const &pose,
+                                             Eigen::VectorXd const &seed) const = 0;
+
+  virtual ~IIKSolver() = default;
+};
+
+/** Create a solver for the link at frameIdx, or return nullptr if the structure is not supported
+ *
+ *  indexS2P: for SAPIEN joint index s, indexS2P[s] is the pinocchio velocity index
+ */
+using IKSolverFactory = std::function<std::shared_ptr<IIKSolver>(
+    pinocchio::Model const &model, Eigen::VectorXi const &indexS2P, int frameIdx)>;
+
+/** everything that affects the kinematics of a frame: joint types, axes, placements, limits and
+ *  the SAPIEN joint order, with lengths and angles rounded to 1e-6 */
+using KinematicStructure = std::vector<int64_t>;
+
+/** Registry of analytic IK solver factories
+ *
+ *  Factories are tried from the most recently registered one. The result of the lookup,
+ *  including the absence of a solver, is cached by the kinematic structure, so loading the
+ *  same robot many times analyzes its geometry only once.
+ */
+class IKSolverRegistry {
+public:
+  static IKSolverRegistry &Get();
+
+  void registerFactory(std::string const &name, IKSolverFactory factory);
+  std::vector<std::string> getFactoryNames();
+
+  std::shared_ptr<IIKSolver> findSolver(pinocchio::Model const &model,
+                                        Eigen::VectorXi const &indexS2P, int frameIdx);
+
+  void clearCache();
+  size_t getCacheSize();
+
+private:
+  IKSolverRegistry();
+
+  std::mutex mMutex;
+  std::vector<std::pair<std::string, IKSolverFactory>> mFactories;
+  // structures with the same hash, a lookup compares the full structure
+  std::map<size_t, std::vector<std::pair<KinematicStructure, std::shared_ptr<IIKSolver>>>>
+      mCache;
+};
+
+KinematicStructure computeKinematicStructure(pinocchio::Model const &model,
+                                             Eigen::VectorXi const &indexS2P, int frameIdx);
+size_t hashKinematicStructure(KinematicStructure const &structure);
+
+/** Closed-form solver for 6R arms with a spherical wrist
+ *
+ *  Requires the link to be driven by a chain of exactly 6 revolute joints where the axes of the
+ *  first 2 joints intersect and the axes of the last 3 joints meet at one point. The solution is
+ *  obtained with Paden-Kahan subproblems and has up to 8 branches.
+ */
+std::shared_ptr<IIKSolver> createWristPartitionedIKSolver(pinocchio::Model const &model,
+                                                          Eigen::VectorXi const &indexS2P,
+                                                          int frameIdx);
+
+} // namespace sapien
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <memory>
+#include <pinocchio/multibody/model.hpp>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace sapien {
+
+/** Kinematics kernel used by PinocchioModel
+ *
+ *  Inputs and outputs follow the SAPIEN joint and link order, exactly like the
+ *  corresponding PinocchioModel functions.
+ */
+class IKinematicsKernel {
+public:
+  virtual std::string getName() const = 0;
+
+  virtual void computeForwardKinematics(Eigen::VectorXd const &qpos) = 0;
+  virtual physx::PxTransform getLinkPose(uint32_t index) const = 0;
+
+  virtual void computeFullJacobian(Eigen::VectorXd const &qpos) = 0;
+  virtual Eigen::Matrix<double, 6, Eigen::Dynamic> getLinkJacobian(uint32_t index,
+                                                                    bool local) const = 0;
+  virtual Eigen::Matrix<double, 6, Eigen::Dynamic>
+  computeSingleLinkLocalJacobian(Eigen::VectorXd const &qpos, uint32_t index) = 0;
+
+  virtual std::tuple<Eigen::VectorXd, bool, Eigen::Matrix<double, 6, 1>>
+  computeInverseKinematics(uint32_t linkIdx, physx::PxTransform const &pose,
+                           Eigen::VectorXd const &initialQpos,
+                           Eigen::VectorXi const &activeQMask, double eps, int maxIter,
+                           double dt, double damp) = 0;
+
+  virtual ~IKinematicsKernel() = default;
+};
+
+/** Create a kernel specialized at compile time for the DOF of the model
+ *
+ *  Supported: 6, 7 and 9 DOF models made only of revolute, continuous and prismatic joints.
+ *  The kernel uses fixed-size Eigen types and does not allocate inside the IK loop.
+ *  Returns nullptr if the model is not supported, the caller should fall back to pinocchio.
+ *
+ *  indexS2P: for SAPIEN joint index s, indexS2P[s] is the pinocchio velocity index
+ *  linkIdx2FrameIdx: for SAPIEN link index l, the pinocchio frame of this link
+ */
+std::unique_ptr<IKinematicsKernel>
+createFixedDofKinematicsKernel(pinocchio::Model const &model, Eigen::VectorXi const &indexS2P,
+                               std::vector<int> const &linkIdx2FrameIdx, bool singlePrecision);
+
+} // namespace sapien
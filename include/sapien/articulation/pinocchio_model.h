@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ik_solver.h"
+#include "pinocchio_kernel.h"
 #include <PxPhysicsAPI.h>
 #include <pinocchio/algorithm/jacobian.hpp>
 #include <pinocchio/algorithm/joint-configuration.hpp>
@@ -27,6 +29,28 @@ class PinocchioModel {
 
   std::vector<int> linkIdx2FrameIdx;
 
+  /** compile-time specialized kinematics for common DOF counts, nullptr if not applicable */
+  std::unique_ptr<IKinematicsKernel> kernel;
+  bool fixedDofKernelEnabled{false};
+  bool singlePrecisionKernel{false};
+  void updateKinematicsKernel();
+
+  /** what the kernel computed without writing data, replayed by getInternalData */
+  enum class KernelDataState { eNone, eForwardKinematics, eJacobian };
+  KernelDataState kernelDataState{KernelDataState::eNone};
+  Eigen::VectorXd kernelQpos;
+  void markKernelData(Eigen::VectorXd const &qpos, KernelDataState state);
+
+  /** analytic IK solver for each link, a null solver means CLIK only */
+  std::map<uint32_t, std::shared_ptr<IIKSolver>> ikSolvers;
+  bool analyticIKEnabled{true};
+
+  std::tuple<Eigen::VectorXd, bool, Eigen::Matrix<double, 6, 1>>
+  computeInverseKinematicsCLIK(uint32_t linkIdx, physx::PxTransform const &pose,
+                               Eigen::VectorXd const &initialQpos,
+                               Eigen::VectorXi const &activeQMask, double eps, int maxIter,
+                               double dt, double damp);
+
 public:
   static std::unique_ptr<PinocchioModel> fromURDFXML(std::string const &urdf,
                                                      Eigen::Vector3d gravity);
@@ -36,7 +60,8 @@ public:
   ~PinocchioModel() = default;
 
   inline pinocchio::Model &getInternalModel() { return model; }
-  inline pinocchio::Data &getInternalData() { return data; }
+  /** internal data, brought up to date with the last kinematics computed by the kernel */
+  pinocchio::Data &getInternalData();
 
 private:
   inline PinocchioModel(){};
@@ -46,6 +71,31 @@ public:
   void setJointOrder(std::vector<std::string> names);
   void setLinkOrder(std::vector<std::string> names);
 
+  /** use the fixed-DOF kernel for forward kinematics, Jacobians and IK, disabled by default
+   *
+   *  The kernel is used for 6, 7 and 9 DOF models of revolute, continuous and prismatic joints,
+   *  other models always use pinocchio. While the kernel is active, getInternalData() recomputes
+   *  the kinematics of the last kernel call with pinocchio.
+   */
+  void setFixedDofKernelEnabled(bool enabled, bool singlePrecision = false);
+  /** name of the kinematics kernel in use, "pinocchio" if the fixed-DOF kernel is not used */
+  std::string getKinematicsKernelName() const;
+
+  /** try analytic IK solvers before CLIK in computeInverseKinematics
+   *
+   *  Solvers are looked up in IKSolverRegistry the first time IK is requested for a link.
+   *  An analytic solution is polished by a few CLIK iterations, CLIK from the initial qpos is
+   *  used when no analytic solution satisfies the joint limits and the active joint mask.
+   */
+  void setAnalyticIKEnabled(bool enabled);
+  inline bool getAnalyticIKEnabled() const { return analyticIKEnabled; }
+
+  /** override the analytic IK solver of a link, nullptr forces CLIK */
+  void setIKSolver(uint32_t linkIdx, std::shared_ptr<IIKSolver> solver);
+  std::shared_ptr<IIKSolver> getIKSolver(uint32_t linkIdx);
+  /** name of the analytic IK solver for a link, "clik" if there is none */
+  std::string getIKSolverName(uint32_t linkIdx);
+
   /** generate a random qpos */
   Eigen::MatrixXd getRandomConfiguration();
 
@@ -103,6 +153,7 @@ public:
 
   /** Numerical IK clik algorithm
    *  computes the numerical IK for a given link
+   *  an analytic solver is used instead when one is available, see setAnalyticIKEnabled
    *  https://gepettoweb.laas.fr/doc/stack-of-tasks/pinocchio/master/doxygen-html/md_doc_b-examples_i-inverse-kinematics.html
    *
    */
@@ -7,6 +7,7 @@
 #include <eigen3/Eigen/Dense>
 #endif
 
+#include <map>
 #include <memory>
 
 namespace sapien {
@@ -16,6 +17,7 @@ using namespace Eigen;
 class SScene;
 class SLink;
 class SJoint;
+class ArticulationController;
 
 class SArticulation : public SArticulationDrivable {
   friend class ArticulationBuilder;
@@ -37,6 +39,52 @@ class SArticulation : public SArticulationDrivable {
   std::vector<float>
       mDriveMultiplier; // due to physx bug, some drive target needs to be multiplied -1
 
+  std::shared_ptr<ArticulationController> mController;
+
+  /** Kinematics cache
+   *  Every cached quantity remembers the state version it was computed at. The version is
+   *  bumped whenever the articulation state may have changed (scene step, setQpos, setQvel,
+   *  setRootPose, unpackData, ...), so repeated queries within one step are computed once.
+   *  The gravity force is also recomputed when the scene gravity changes.
+   */
+  template <typename T> struct CachedValue {
+    uint64_t version{0}; // 0 is never a valid state version
+    T value;
+  };
+  using DiffIKCacheKey = std::pair<uint32_t, std::vector<uint32_t>>;
+
+  uint64_t mStateVersion{1};
+  bool mKinematicsCacheEnabled{true};
+
+  CachedValue<Matrix<PxReal, Dynamic, Dynamic, RowMajor>> mCachedCartesianJacobian;
+  CachedValue<Matrix<PxReal, Dynamic, Dynamic, RowMajor>> mCachedTwistJacobian;
+  CachedValue<Matrix<PxReal, Dynamic, Dynamic, RowMajor>> mCachedMassMatrix;
+  CachedValue<Eigen::VectorXf> mCachedGravityForce;  // internal order
+  PxVec3 mCachedGravity{0.f, 0.f, 0.f};              // scene gravity of mCachedGravityForce
+  CachedValue<Eigen::VectorXf> mCachedCoriolisForce; // internal order
+  CachedValue<std::vector<PxTransform>> mCachedLinkPoses;
+  std::map<DiffIKCacheKey, CachedValue<Eigen::MatrixXf>> mCachedTwistPinv;
+  std::map<DiffIKCacheKey, CachedValue<Eigen::MatrixXf>> mCachedCartesianPinv;
+
+public:
+  struct KinematicsCacheStats {
+    uint64_t hits{0};
+    uint64_t misses{0};
+  };
+
+private:
+  KinematicsCacheStats mKinematicsCacheStats;
+  // nesting of cached calls, lookups made while computing another entry are not counted
+  uint32_t mCacheDepth{0};
+
+  template <typename T, typename F> T const &cached(CachedValue<T> &entry, F &&compute);
+
+  Matrix<PxReal, Dynamic, Dynamic, RowMajor> computeDenseJacobianExternal(bool twist);
+  Eigen::MatrixXf const &getDiffIKPseudoInverse(bool twist, uint32_t commandedLinkId,
+                                                 const std::vector<uint32_t> &activeQIds);
+  // state was written from outside the simulation, render and pack the links again
+  void markLinksMoved();
+
 public:
   std::vector<SLinkBase *> getBaseLinks() override;
   std::vector<SJointBase *> getBaseJoints() override;
@@ -75,12 +123,33 @@ public:
 
   void prestep() override;
 
+  /** Evaluate controller in every prestep, nullptr detaches the current controller */
+  void setController(std::shared_ptr<ArticulationController> controller);
+  inline std::shared_ptr<ArticulationController> getController() const { return mController; }
+
   SLinkBase *getRootLink() const override;
 
   inline PxArticulationReducedCoordinate *getPxArticulation() { return mPxArticulation; }
 
   void resetCache();
 
+  /** Invalidate all cached kinematic and dynamic quantities
+   *  Called automatically after each scene step and by all state setters of this class.
+   *  Call it manually after changing the articulation through PhysX directly.
+   */
+  inline void markStateChanged() { ++mStateVersion; }
+  inline uint64_t getStateVersion() const { return mStateVersion; }
+
+  inline void setKinematicsCacheEnabled(bool enabled) {
+    mKinematicsCacheEnabled = enabled;
+    markStateChanged();
+  }
+  inline bool getKinematicsCacheEnabled() const { return mKinematicsCacheEnabled; }
+  inline KinematicsCacheStats const &getKinematicsCacheStats() const {
+    return mKinematicsCacheStats;
+  }
+  inline void resetKinematicsCacheStats() { mKinematicsCacheStats = {}; }
+
   /* Dynamics Functions */
   std::vector<physx::PxReal> computePassiveForce(bool gravity = true,
                                                  bool coriolisAndCentrifugal = true,
@@ -117,6 +186,8 @@ public:
   /* Save and Load */
   std::vector<PxReal> packData();
   void unpackData(std::vector<PxReal> const &data);
+  /** set qpos in packData order, the internal PhysX joint order setQpos permutes into */
+  void unpackQpos(std::vector<PxReal> const &qpos);
 
   std::vector<PxReal> packDrive();
   void unpackDrive(std::vector<PxReal> const &data);
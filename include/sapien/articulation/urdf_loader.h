@@ -806,6 +806,16 @@ public:
   /* directory for package:// */
   std::string packageDir = "";
 
+  /* Sample random configurations to find link pairs that always or never collide and ignore
+   * them through collision groups. Results are cached by a hash of the URDF and of the path,
+   * size and modification time of its collision mesh files. Skipped when the SRDF has
+   * "Always" or "Never" pairs (as written by DisabledCollisionPairs::toSRDF), those are
+   * applied instead whether or not this is set.
+   * Only applies to dynamic articulations.
+   */
+  bool autoDisableCollisions = false;
+  uint32_t collisionSampleCount = 1000;
+
   explicit URDFLoader(SScene *scene);
 
   SArticulation *load(const std::string &filename, URDFConfig const &config = {});
@@ -821,6 +831,12 @@ public:
   loadFileAsArticulationBuilder(const std::string &filename, URDFConfig const &config = {});
 
 private:
+  /* apply the generated pairs of the SRDF, or sample when there are none */
+  void disableCollisions(SArticulation &articulation, ArticulationBuilder &builder,
+                         XMLDocument const &urdfDoc, XMLDocument const *srdfDoc);
+  void disableCollisionsBySampling(SArticulation &articulation, ArticulationBuilder &builder,
+                                   XMLDocument const &urdfDoc);
+
   std::tuple<std::shared_ptr<ArticulationBuilder>, std::vector<SensorRecord>>
   parseRobotDescription(XMLDocument const &urdfDoc, XMLDocument const *srdfDoc,
                         const std::string &urdfFilename, bool isKinematic,
@@ -0,0 +1,55 @@
+#pragma once
+#include <PxPhysicsAPI.h>
+#include <atomic>
+#include <vector>
+
+namespace sapien {
+
+using namespace physx;
+
+/** Tiles the world of a multi box pruning (MBP) broadphase into a grid of regions
+ *
+ *  MBP only tracks objects inside its regions. The manager keeps a world box containing every
+ *  object of the scene and covers it with subdivisions x subdivisions regions on the ground
+ *  plane. When an actor is added outside the world, or PhysX reports an object leaving all
+ *  regions, the world is grown to fit the scene and the regions are rebuilt before the next
+ *  simulate.
+ */
+class BroadPhaseRegionManager : public PxBroadPhaseCallback {
+public:
+  /** initialBounds: minimum world box, subdivisions: regions per horizontal axis */
+  BroadPhaseRegionManager(PxBounds3 const &initialBounds, uint32_t subdivisions);
+
+  void onObjectOutOfBounds(PxShape &shape, PxActor &actor) override;
+  void onObjectOutOfBounds(PxAggregate &aggregate) override;
+
+  /** must be called once the PxScene using this callback is created */
+  void attach(PxScene *scene);
+
+  /** grow the world to contain the actor, regions are rebuilt on the next update */
+  void include(PxRigidActor const &actor);
+
+  /** rebuild the regions if the world has to grow, must not be called during simulate */
+  void update();
+
+  inline PxBounds3 getWorldBounds() const { return mWorldBounds; }
+  inline uint32_t getRegionCount() const { return mRegionHandles.size(); }
+  inline uint32_t getRetileCount() const { return mRetileCount; }
+  inline uint32_t getOutOfBoundsCount() const { return mOutOfBoundsCount; }
+
+private:
+  PxBounds3 computeSceneBounds() const;
+  void retile(PxBounds3 const &bounds);
+
+  PxScene *mScene{};
+  uint32_t mSubdivisions;
+  PxBounds3 mWorldBounds;
+  PxBounds3 mPendingBounds;
+  std::vector<PxU32> mRegionHandles;
+
+  std::atomic<bool> mDirty{true};
+  std::atomic<uint32_t> mOutOfBoundsCount{0};
+  uint32_t mRetileCount{0};
+};
+
+} // namespace sapien
@@ -0,0 +1,71 @@
+#pragma once
+#include <PxPhysicsAPI.h>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace sapien {
+class SScene;
+class SArticulation;
+
+/** how drive targets move from their current value to the action over the substeps
+ *
+ *  eHOLD sets the action before the first substep. eLINEAR reaches it linearly at the last
+ *  substep. eCUBIC follows a cubic Hermite curve whose end tangents are the current and the new
+ *  drive velocity targets (zero if the action has none), and sets the velocity targets to its
+ *  derivative.
+ */
+enum class ActionInterpolation { eHOLD, eLINEAR, eCUBIC };
+
+/** "hold", "linear" or "cubic", throws otherwise */
+ActionInterpolation getActionInterpolationByName(std::string const &name);
+
+/** drive targets of one articulation for one control step, empty vectors leave drives as they
+ * are */
+struct ArticulationAction {
+  SArticulation *articulation{};
+  std::vector<physx::PxReal> driveTarget;
+  std::vector<physx::PxReal> driveVelocityTarget;
+};
+
+struct ControlStepConfig {
+  /** physics steps per control step */
+  uint32_t substeps{1};
+  ActionInterpolation interpolation{ActionInterpolation::eHOLD};
+
+  bool observeQpos{true};
+  bool observeQvel{true};
+  bool observeRootPose{false};
+  bool observeContactForces{false};
+};
+
+/** state after the last substep, empty when not requested */
+struct ArticulationObservation {
+  std::vector<physx::PxReal> qpos;
+  std::vector<physx::PxReal> qvel;
+  physx::PxTransform rootPose{physx::PxIdentity};
+  /** mean net contact force on every link over the substeps, 3 values per link */
+  std::vector<physx::PxReal> linkContactForces;
+};
+
+struct ControlStepResult {
+  uint32_t substeps{0};
+  /** in the order of the actions */
+  std::vector<ArticulationObservation> articulations;
+};
+
+/** Apply one action per articulation and advance the scene by config.substeps steps
+ *
+ *  Drive targets are interpolated between substeps and observations are accumulated in C++, so
+ *  a policy running at a fraction of the physics rate crosses the language boundary once per
+ *  control step. Every substep is a regular SScene::step.
+ */
+ControlStepResult controlStep(SScene &scene, std::vector<ArticulationAction> const &actions,
+                              ControlStepConfig const &config);
+
+/** controlStep on the scene task queue */
+std::future<ControlStepResult> controlStepAsync(SScene &scene,
+                                                std::vector<ArticulationAction> actions,
+                                                ControlStepConfig const &config);
+
+} // namespace sapien
@@ -4,6 +4,16 @@
 namespace sapien {
 using namespace physx;
 
+/** whether TypeAffinityIgnoreFilterShader lets shapes with these collision groups collide */
+inline bool collisionGroupsMayCollide(PxFilterData const &filterData0,
+                                      PxFilterData const &filterData1) {
+  if ((filterData0.word2 & filterData1.word2) &&
+      ((filterData0.word3 & 0xffff) == (filterData1.word3 & 0xffff))) {
+    return false;
+  }
+  return (filterData0.word0 & filterData1.word1) || (filterData1.word0 & filterData0.word1);
+}
+
 inline PxFilterFlags
 TypeAffinityIgnoreFilterShader(PxFilterObjectAttributes attributes0, PxFilterData filterData0,
                                PxFilterObjectAttributes attributes1, PxFilterData filterData1,
@@ -15,12 +25,7 @@ TypeAffinityIgnoreFilterShader(PxFilterObjectAttributes attributes0, PxFilterDat
     return PxFilterFlag::eDEFAULT;
   }
 
-  if ((filterData0.word2 & filterData1.word2) &&
-      ((filterData0.word3 & 0xffff) == (filterData1.word3 & 0xffff))) {
-    return PxFilterFlag::eKILL;
-  }
-
-  if ((filterData0.word0 & filterData1.word1) || (filterData1.word0 & filterData0.word1)) {
+  if (collisionGroupsMayCollide(filterData0, filterData1)) {
     pairFlags = PxPairFlag::eCONTACT_DEFAULT | PxPairFlag::eNOTIFY_CONTACT_POINTS |
                 PxPairFlag::eNOTIFY_TOUCH_PERSISTS | PxPairFlag::eNOTIFY_TOUCH_FOUND |
                 PxPairFlag::eNOTIFY_TOUCH_LOST | PxPairFlag::ePRE_SOLVER_VELOCITY |
@@ -0,0 +1,532 @@
+#pragma once
+#include "render_interface.h"
+#include "render_log.h"
+
+namespace sapien {
+namespace Renderer {
+
+class RecordRenderer;
+class RecordScene;
+
+class RecordTexture : public IPxrTexture {
+public:
+  /** a texture with id 0 only carries the filename of a material texture set from a file */
+  RecordTexture(std::shared_ptr<RenderLogWriter> writer, uint32_t id, std::string filename,
+                int width, int height, int channels, uint32_t mipLevels,
+                FilterMode::Enum filterMode, AddressMode::Enum addressMode);
+  ~RecordTexture();
+
+  [[nodiscard]] int getWidth() const override { return mWidth; }
+  [[nodiscard]] int getHeight() const override { return mHeight; }
+  [[nodiscard]] int getChannels() const override { return mChannels; }
+  [[nodiscard]] int getMipmapLevels() const override { return mMipLevels; }
+  [[nodiscard]] Type::Enum getType() const override {
+    return mFilename.empty() ? Type::eBYTE : Type::eOTHER;
+  }
+  [[nodiscard]] AddressMode::Enum getAddressMode() const override { return mAddressMode; }
+  [[nodiscard]] FilterMode::Enum getFilterMode() const override { return mFilterMode; }
+  [[nodiscard]] std::string getFilename() const override { return mFilename; }
+
+  inline uint32_t getId() const { return mId; }
+
+private:
+  std::shared_ptr<RenderLogWriter> mWriter;
+  uint32_t mId;
+  std::string mFilename;
+  int mWidth;
+  int mHeight;
+  int mChannels;
+  uint32_t mMipLevels;
+  FilterMode::Enum mFilterMode;
+  AddressMode::Enum mAddressMode;
+};
+
+/** Written to the log when a body first uses it, again if it changed since */
+class RecordMesh : public IRenderMesh {
+public:
+  RecordMesh(std::shared_ptr<RenderLogWriter> writer, uint32_t id, std::vector<float> vertices,
+             std::vector<uint32_t> indices);
+  ~RecordMesh();
+
+  std::vector<float> getVertices() override { return mVertices; }
+  std::vector<float> getNormals() override { return mNormals; }
+  std::vector<float> getUVs() override { return mUVs; }
+  std::vector<float> getTangents() override { return mTangents; }
+  std::vector<float> getBitangents() override { return mBitangents; }
+  std::vector<uint32_t> getIndices() override { return mIndices; }
+
+  void setVertices(std::vector<float> const &vertices) override;
+  void setNormals(std::vector<float> const &normals) override;
+  void setUVs(std::vector<float> const &uvs) override;
+  void setTangents(std::vector<float> const &tangents) override;
+  void setBitangents(std::vector<float> const &bitangents) override;
+  void setIndices(std::vector<uint32_t> const &indices) override;
+
+  void write();
+  inline uint32_t getId() const { return mId; }
+
+private:
+  std::shared_ptr<RenderLogWriter> mWriter;
+  uint32_t mId;
+  std::mutex mMutex;
+  bool mWritten{false};
+  bool mChanged{true};
+
+  std::vector<float> mVertices;
+  std::vector<float> mNormals;
+  std::vector<float> mUVs;
+  std::vector<float> mTangents;
+  std::vector<float> mBitangents;
+  std::vector<uint32_t> mIndices;
+};
+
+/** Getters return the values set on the material, a new material is white */
+class RecordMaterial : public IPxrMaterial {
+public:
+  RecordMaterial(std::shared_ptr<RenderLogWriter> writer, uint32_t id);
+  ~RecordMaterial();
+
+  void setBaseColor(std::array<float, 4> color) override;
+  [[nodiscard]] std::array<float, 4> getBaseColor() const override { return mBaseColor; }
+  void setRoughness(float roughness) override;
+  [[nodiscard]] float getRoughness() const override { return mRoughness; }
+  void setSpecular(float specular) override;
+  [[nodiscard]] float getSpecular() const override { return mSpecular; }
+  void setMetallic(float metallic) override;
+  [[nodiscard]] float getMetallic() const override { return mMetallic; }
+  void setEmission(std::array<float, 4> color) override;
+  [[nodiscard]] std::array<float, 4> getEmission() const override { return mEmission; }
+  void setIOR(float ior) override;
+  [[nodiscard]] float getIOR() const override { return mIOR; }
+  void setTransmission(float transmission) override;
+  [[nodiscard]] float getTransmission() const override { return mTransmission; }
+  void setTransmissionRoughness(float roughness) override;
+  [[nodiscard]] float getTransmissionRoughness() const override {
+    return mTransmissionRoughness;
+  }
+
+  void setEmissionTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getEmissionTexture() const override;
+  void setDiffuseTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getDiffuseTexture() const override;
+  void setMetallicTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getMetallicTexture() const override;
+  void setRoughnessTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getRoughnessTexture() const override;
+  void setNormalTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getNormalTexture() const override;
+  void setTransmissionTexture(std::shared_ptr<IPxrTexture> texture) override;
+  [[nodiscard]] std::shared_ptr<IPxrTexture> getTransmissionTexture() const override;
+
+  void setEmissionTextureFromFilename(std::string_view path) override;
+  void setDiffuseTextureFromFilename(std::string_view path) override;
+  void setMetallicTextureFromFilename(std::string_view path) override;
+  [[nodiscard]] std::string getMetallicTextureFilename() const override;
+  void setRoughnessTextureFromFilename(std::string_view path) override;
+  void setNormalTextureFromFilename(std::string_view path) override;
+  void setTransmissionTextureFromFilename(std::string_view path) override;
+
+  inline uint32_t getId() const { return mId; }
+
+private:
+  template <typename T> void write(RenderLogMaterialOp op, T value) {
+    RenderLogWriter::Record(*mWriter, RenderLogRecord::eMATERIAL_SET, mId, op).put(value);
+  }
+  void setTexture(RenderLogTextureSlot slot, std::shared_ptr<IPxrTexture> texture);
+  void setTextureFromFilename(RenderLogTextureSlot slot, std::string_view path);
+
+  std::shared_ptr<RenderLogWriter> mWriter;
+  uint32_t mId;
+
+  std::array<float, 4> mBaseColor{1.f, 1.f, 1.f, 1.f};
+  float mRoughness{1.f};
+  float mSpecular{0.f};
+  float mMetallic{0.f};
+  std::array<float, 4> mEmission{0.f, 0.f, 0.f, 0.f};
+  float mIOR{1.01f};
+  float mTransmission{0.f};
+  float mTransmissionRoughness{0.f};
+  std::array<std::shared_ptr<IPxrTexture>, 6> mTextures;
+};
+
+class RecordShape : public IPxrRenderShape {
+public:
+  RecordShape(std::shared_ptr<IRenderMesh> mesh, std::shared_ptr<IPxrMaterial> material)
+      : mMesh(std::move(mesh)), mMaterial(std::move(material)) {}
+  [[nodiscard]] std::shared_ptr<IRenderMesh> getGeometry() const override { return mMesh; }
+  [[nodiscard]] std::shared_ptr<IPxrMaterial> getMaterial() const override { return mMaterial; }
+
+private:
+  std::shared_ptr<IRenderMesh> mMesh;
+  std::shared_ptr<IPxrMaterial> mMaterial;
+};
+
+class RecordRigidbody : public IPxrRigidbody {
+public:
+  RecordRigidbody(RecordScene *scene, uint32_t id, physx::PxGeometryType::Enum type,
+                  physx::PxVec3 scale, std::shared_ptr<IRenderMesh> mesh,
+                  std::shared_ptr<IPxrMaterial> material);
+
+  void setName(std::string const &name) override;
+  std::string getName() const override { return mName; }
+  void setUniqueId(uint32_t uniqueId) override;
+  uint32_t getUniqueId() const override { return mUniqueId; }
+  void setSegmentationId(uint32_t segmentationId) override;
+  uint32_t getSegmentationId() const override { return mSegmentationId; }
+  void setSegmentationCustomData(std::vector<float> const &customData) override;
+  void setInitialPose(const physx::PxTransform &transform) override;
+  /** only poses that changed go into the next frame */
+  void update(const physx::PxTransform &transform) override;
+  void setVisibility(float visibility) override;
+  void setVisible(bool visible) override;
+  void setRenderMode(uint32_t mode) override;
+  void setShadeFlat(bool shadeFlat) override;
+  bool getShadeFlat() override { return mShadeFlat; }
+
+  void destroy() override;
+
+  physx::PxGeometryType::Enum getType() const override { return mType; }
+  physx::PxTransform getInitialPose() const override { return mInitialPose; }
+  /** bodies loaded from files have no shapes, the recorder does not read mesh files */
+  std::vector<std::shared_ptr<IPxrRenderShape>> getRenderShapes() override;
+  physx::PxVec3 getScale() const override { return mScale; }
+  void rescale(float factor) override;
+
+  inline uint32_t getId() const { return mId; }
+  inline physx::PxTransform const &getPose() const { return mPose; }
+
+private:
+  friend class RecordScene;
+
+  template <typename T> void write(RenderLogBodyOp op, T value);
+
+  RecordScene *mScene;
+  uint32_t mId;
+  std::string mName;
+  uint32_t mUniqueId{0};
+  uint32_t mSegmentationId{0};
+  physx::PxTransform mInitialPose{physx::PxIdentity};
+  physx::PxTransform mPose{physx::PxIdentity};
+  bool mShadeFlat{false};
+  physx::PxGeometryType::Enum mType;
+  physx::PxVec3 mScale;
+  std::shared_ptr<IRenderMesh> mMesh;
+  std::shared_ptr<IPxrMaterial> mMaterial;
+
+  // queued in the moved bodies of the scene
+  bool mMoved{false};
+};
+
+class RecordCamera : public ICamera {
+public:
+  RecordCamera(RecordScene *scene, uint32_t id, uint32_t width, uint32_t height, float fovy,
+               float near, float far);
+
+  [[nodiscard]] physx::PxTransform getPose() const override { return mPose; }
+  void setPose(physx::PxTransform const &pose) override;
+  IPxrScene *getScene() override;
+
+  uint32_t getWidth() const override { return mWidth; }
+  uint32_t getHeight() const override { return mHeight; }
+
+  [[nodiscard]] float getPrincipalPointX() const override { return mCx; }
+  [[nodiscard]] float getPrincipalPointY() const override { return mCy; }
+  [[nodiscard]] float getFocalX() const override { return mFx; }
+  [[nodiscard]] float getFocalY() const override { return mFy; }
+  [[nodiscard]] float getNear() const override { return mNear; }
+  [[nodiscard]] float getFar() const override { return mFar; }
+  [[nodiscard]] float getSkew() const override { return mSkew; }
+
+  void setPerspectiveCameraParameters(float near, float far, float fx, float fy, float cx,
+                                      float cy, float skew) override;
+
+  std::vector<float> getFloatImage(std::string const &name) override {
+    throw std::runtime_error("images are not rendered while recording, replay the render log "
+                             "with a renderer to get them");
+  }
+  std::vector<uint32_t> getUintImage(std::string const &name) override {
+    throw std::runtime_error("images are not rendered while recording, replay the render log "
+                             "with a renderer to get them");
+  }
+
+  void takePicture() override;
+
+  inline uint32_t getId() const { return mId; }
+
+private:
+  friend class RecordScene;
+
+  RecordScene *mScene;
+  uint32_t mId;
+  physx::PxTransform mPose{physx::PxIdentity};
+  bool mMoved{true};
+  uint32_t mWidth;
+  uint32_t mHeight;
+  float mCx;
+  float mCy;
+  float mFx;
+  float mFy;
+  float mNear;
+  float mFar;
+  float mSkew{0.f};
+};
+
+/** Common state of the recorded lights, setters are logged when they change something */
+template <typename Base> class RecordLight : public Base {
+public:
+  RecordLight(std::shared_ptr<RenderLogWriter> writer, uint32_t id, physx::PxTransform pose,
+              physx::PxVec3 color, bool shadow, float near, float far)
+      : mWriter(std::move(writer)), mId(id), mPose(pose), mColor(color), mShadow(shadow),
+        mNear(near), mFar(far) {}
+
+  physx::PxTransform getPose() const override { return mPose; }
+  void setPose(physx::PxTransform const &pose) override {
+    // lights follow their parents every frame, most of them never move
+    if (!(pose == mPose)) {
+      mPose = pose;
+      record(RenderLogLightOp::ePOSE).putPose(pose);
+    }
+  }
+  physx::PxVec3 getColor() const override { return mColor; }
+  void setColor(physx::PxVec3 color) override {
+    mColor = color;
+    record(RenderLogLightOp::eCOLOR).putVec3(color);
+  }
+  bool getShadowEnabled() const override { return mShadow; }
+  void setShadowEnabled(bool enabled) override {
+    mShadow = enabled;
+    record(RenderLogLightOp::eSHADOW).put(static_cast<uint8_t>(enabled));
+  }
+  float getShadowNear() const override { return mNear; }
+  float getShadowFar() const override { return mFar; }
+
+  inline uint32_t getId() const { return mId; }
+
+protected:
+  RenderLogWriter::Record record(RenderLogLightOp op) {
+    return RenderLogWriter::Record(*mWriter, RenderLogRecord::eLIGHT_SET, mId, op);
+  }
+  void setPosition_(physx::PxVec3 position) {
+    mPose.p = position;
+    record(RenderLogLightOp::ePOSITION).putVec3(position);
+  }
+  void setDirection_(physx::PxVec3 direction) {
+    mDirection = direction;
+    record(RenderLogLightOp::eDIRECTION).putVec3(direction);
+  }
+  void setShadowParameters_(float halfSize, float near, float far) {
+    mNear = near;
+    mFar = far;
+    record(RenderLogLightOp::eSHADOW_PARAMETERS).put(halfSize).put(near).put(far);
+  }
+  void setFov_(float fov) {
+    mFov = fov;
+    record(RenderLogLightOp::eFOV).put(fov);
+  }
+
+  std::shared_ptr<RenderLogWriter> mWriter;
+  uint32_t mId;
+  physx::PxTransform mPose;
+  physx::PxVec3 mColor;
+  bool mShadow;
+  float mNear;
+  float mFar;
+  physx::PxVec3 mDirection{0.f, 0.f, -1.f};
+  float mFov{0.f};
+};
+
+class RecordPointLight : public RecordLight<IPointLight> {
+public:
+  using RecordLight::RecordLight;
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { setPosition_(position); }
+  void setShadowParameters(float near, float far) override {
+    setShadowParameters_(0.f, near, far);
+  }
+};
+
+class RecordDirectionalLight : public RecordLight<IDirectionalLight> {
+public:
+  RecordDirectionalLight(std::shared_ptr<RenderLogWriter> writer, uint32_t id,
+                         physx::PxTransform pose, physx::PxVec3 color, bool shadow,
+                         physx::PxVec3 direction, float halfSize, float near, float far)
+      : RecordLight(std::move(writer), id, pose, color, shadow, near, far),
+        mHalfSize(halfSize) {
+    mDirection = direction;
+  }
+  physx::PxVec3 getDirection() const override { return mDirection; }
+  void setDirection(physx::PxVec3 direction) override { setDirection_(direction); }
+  void setShadowParameters(float halfSize, float near, float far) override {
+    mHalfSize = halfSize;
+    setShadowParameters_(halfSize, near, far);
+  }
+  float getShadowHalfSize() const override { return mHalfSize; }
+
+private:
+  float mHalfSize;
+};
+
+class RecordSpotLight : public RecordLight<ISpotLight> {
+public:
+  RecordSpotLight(std::shared_ptr<RenderLogWriter> writer, uint32_t id, physx::PxTransform pose,
+                  physx::PxVec3 color, bool shadow, physx::PxVec3 direction, float fov,
+                  float near, float far)
+      : RecordLight(std::move(writer), id, pose, color, shadow, near, far) {
+    mDirection = direction;
+    mFov = fov;
+  }
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { setPosition_(position); }
+  physx::PxVec3 getDirection() const override { return mDirection; }
+  void setDirection(physx::PxVec3 direction) override { setDirection_(direction); }
+  void setShadowParameters(float near, float far) override {
+    setShadowParameters_(0.f, near, far);
+  }
+  void setFov(float fov) override { setFov_(fov); }
+  float getFov() const override { return mFov; }
+};
+
+class RecordActiveLight : public RecordLight<IActiveLight> {
+public:
+  RecordActiveLight(std::shared_ptr<RenderLogWriter> writer, uint32_t id, physx::PxTransform pose,
+                    physx::PxVec3 color, float fov, std::string_view texture, float near,
+                    float far)
+      : RecordLight(std::move(writer), id, pose, color, true, near, far), mTexture(texture) {
+    mFov = fov;
+  }
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { setPosition_(position); }
+  void setFov(float fov) override { setFov_(fov); }
+  float getFov() const override { return mFov; }
+  void setShadowParameters(float near, float far) override {
+    setShadowParameters_(0.f, near, far);
+  }
+  void setTexture(std::string_view path) override {
+    mTexture = path;
+    record(RenderLogLightOp::eTEXTURE).putString(path);
+  }
+  std::string_view getTexture() override { return mTexture; }
+
+private:
+  std::string mTexture;
+};
+
+class RecordScene : public IPxrScene {
+public:
+  RecordScene(RecordRenderer *renderer, uint32_t id, std::string const &name);
+
+  //========== Body ==========//
+  IPxrRigidbody *addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale) override;
+  IPxrRigidbody *addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(std::shared_ptr<IRenderMesh> mesh, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(physx::PxGeometryType::Enum type, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(physx::PxGeometryType::Enum type, const physx::PxVec3 &scale,
+                              const physx::PxVec3 &color) override;
+  IPxrRigidbody *addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                              std::vector<physx::PxVec3> const &normals,
+                              std::vector<uint32_t> const &indices, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                              std::vector<physx::PxVec3> const &normals,
+                              std::vector<uint32_t> const &indices, const physx::PxVec3 &scale,
+                              const physx::PxVec3 &color) override;
+  void removeRigidbody(IPxrRigidbody *body) override;
+
+  //========== Camera ==========//
+  ICamera *addCamera(uint32_t width, uint32_t height, float fovy, float near, float far,
+                     std::string const &shaderDir) override;
+  void removeCamera(ICamera *camera) override;
+  std::vector<ICamera *> getCameras() override;
+
+  //========== Light ==========//
+  void setAmbientLight(std::array<float, 3> const &color) override;
+  std::array<float, 3> getAmbientLight() const override { return mAmbientLight; }
+  IPointLight *addPointLight(std::array<float, 3> const &position,
+                             std::array<float, 3> const &color, bool enableShadow,
+                             float shadowNear, float shadowFar, uint32_t shadowMapSize) override;
+  IDirectionalLight *addDirectionalLight(std::array<float, 3> const &direction,
+                                         std::array<float, 3> const &color, bool enableShadow,
+                                         std::array<float, 3> const &position, float shadowScale,
+                                         float shadowNear, float shadowFar,
+                                         uint32_t shadowMapSize) override;
+  ISpotLight *addSpotLight(std::array<float, 3> const &position,
+                           std::array<float, 3> const &direction, float fovInner,
+                           float fovOuter, std::array<float, 3> const &color, bool enableShadow,
+                           float shadowNear, float shadowFar, uint32_t shadowMapSize) override;
+  IActiveLight *addActiveLight(physx::PxTransform const &pose, std::array<float, 3> const &color,
+                               float fov, std::string_view texPath, float shadowNear,
+                               float shadowFar, uint32_t shadowMapSize) override;
+  void removeLight(ILight *light) override;
+
+  void setEnvironmentMap(std::string_view path) override;
+  void setEnvironmentMap(std::array<std::string_view, 6> paths) override;
+
+  /** writes a frame with the bodies and cameras that moved since the previous one */
+  void updateRender() override;
+  void updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) override;
+
+  void destroy() override;
+
+  inline RecordRenderer *getRenderer() const { return mRenderer; }
+  inline RenderLogWriter &getWriter() const { return *mWriter; }
+  inline uint32_t getId() const { return mId; }
+  inline uint64_t getFrameCount() const { return mFrameCount; }
+
+private:
+  friend class RecordRigidbody;
+
+  IPxrRigidbody *addBody(std::unique_ptr<RecordRigidbody> body);
+  void writeFrame(std::vector<ICamera *> const &pictures);
+
+  RecordRenderer *mRenderer;
+  std::shared_ptr<RenderLogWriter> mWriter;
+  uint32_t mId;
+  std::string mName;
+  uint64_t mFrameCount{0};
+  std::array<float, 3> mAmbientLight{0.f, 0.f, 0.f};
+
+  std::vector<std::unique_ptr<RecordRigidbody>> mBodies;
+  std::vector<std::unique_ptr<RecordCamera>> mCameras;
+  std::vector<std::unique_ptr<ILight>> mLights;
+  std::vector<RecordRigidbody *> mMovedBodies;
+};
+
+/** Renderer that records everything the simulation sends to it into a render log and renders
+ *  nothing, so it needs no GPU. RenderLogReplayer plays the log into another renderer later.
+ *
+ *  Frames hold the poses of bodies and cameras that changed since the previous frame of their
+ *  scene. Reading images from cameras throws. */
+class RecordRenderer : public IPxrRenderer {
+public:
+  explicit RecordRenderer(std::string const &filename);
+
+  IPxrScene *createScene(std::string const &name) override;
+  void removeScene(IPxrScene *scene) override;
+  std::shared_ptr<IPxrMaterial> createMaterial() override;
+  std::shared_ptr<IRenderMesh> createMesh(std::vector<float> const &vertices,
+                                          std::vector<uint32_t> const &indices) override;
+  std::shared_ptr<IPxrTexture> createTexture(std::string_view filename, uint32_t mipLevels,
+                                             IPxrTexture::FilterMode::Enum filterMode,
+                                             IPxrTexture::AddressMode::Enum addressMode) override;
+  std::shared_ptr<IPxrTexture> createTexture(std::vector<uint8_t> const &data, int width,
+                                             int height, uint32_t mipLevels,
+                                             IPxrTexture::FilterMode::Enum filterMode,
+                                             IPxrTexture::AddressMode::Enum addressMode,
+                                             bool srgb) override;
+
+  /** write buffered records to the file */
+  void flush() { mWriter->flush(); }
+  inline std::string const &getFilename() const { return mWriter->getFilename(); }
+  inline uint64_t getBytesWritten() const { return mWriter->getBytesWritten(); }
+  inline std::shared_ptr<RenderLogWriter> getWriter() const { return mWriter; }
+
+private:
+  std::shared_ptr<RenderLogWriter> mWriter;
+  std::vector<std::unique_ptr<RecordScene>> mScenes;
+};
+
+} // namespace Renderer
+} // namespace sapien
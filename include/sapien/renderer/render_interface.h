@@ -1,7 +1,7 @@
 #pragma once
 #include "dlpack.hpp"
 #include "sapien/awaitable.hpp"
-#include "sapien/thread_pool.hpp"
+#include "sapien/task_scheduler.h"
 #include <PxPhysicsAPI.h>
 #include <array>
 #include <eigen3/Eigen/Eigen>
@@ -284,7 +284,7 @@ public:
 
 #ifdef SAPIEN_DLPACK
   virtual std::shared_ptr<IAwaitable<std::vector<DLManagedTensor *>>>
-  takePictureAndGetDLTensorsAsync(ThreadPool &thread, std::vector<std::string> const &names) {
+  takePictureAndGetDLTensorsAsync(TaskQueue &thread, std::vector<std::string> const &names) {
     throw std::runtime_error("async take picture is not implemented");
   };
 #endif
@@ -413,6 +413,9 @@ public:
   virtual physx::PxVec3 getScale() const {
     throw std::runtime_error("getScale is not implemented");
   }
+
+  /** scale the body and its initial position uniformly */
+  virtual void rescale(float factor) { throw std::runtime_error("rescale is not implemented"); }
 };
 
 class IPxrScene {
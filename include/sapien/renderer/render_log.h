@@ -0,0 +1,253 @@
+#pragma once
+#include "render_interface.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace sapien {
+namespace Renderer {
+
+/** A render log is a header followed by records of a kind byte, the payload size (uint32) and the
+ *  payload. Objects are referred to by ids assigned by the recorder, 0 is none. Values are written
+ *  in host byte order, poses as p.xyz, q.xyzw. */
+enum class RenderLogRecord : uint8_t {
+  eCREATE_SCENE,
+  eREMOVE_SCENE,
+  eSCENE_SET,
+  eCREATE_MATERIAL,
+  eMATERIAL_SET,
+  eREMOVE_MATERIAL,
+  eCREATE_TEXTURE_FILE,
+  eCREATE_TEXTURE_DATA,
+  eREMOVE_TEXTURE,
+  eCREATE_MESH,
+  eREMOVE_MESH,
+  eADD_BODY,
+  eBODY_SET,
+  eREMOVE_BODY,
+  eADD_CAMERA,
+  eCAMERA_SET,
+  eREMOVE_CAMERA,
+  eADD_LIGHT,
+  eLIGHT_SET,
+  eREMOVE_LIGHT,
+  // scene, frame index, moved bodies, moved cameras and the cameras to take pictures with
+  eFRAME,
+  eTAKE_PICTURE
+};
+
+// the *_SET records carry one setter call: object id, operation and its arguments
+enum class RenderLogSceneOp : uint8_t { eAMBIENT_LIGHT, eENVIRONMENT_MAP, eENVIRONMENT_CUBE };
+
+enum class RenderLogMaterialOp : uint8_t {
+  eBASE_COLOR,
+  eROUGHNESS,
+  eSPECULAR,
+  eMETALLIC,
+  eEMISSION,
+  eIOR,
+  eTRANSMISSION,
+  eTRANSMISSION_ROUGHNESS,
+  // texture slot and texture id
+  eTEXTURE,
+  // texture slot and filename
+  eTEXTURE_FILE
+};
+
+enum class RenderLogTextureSlot : uint8_t {
+  eEMISSION,
+  eDIFFUSE,
+  eMETALLIC,
+  eROUGHNESS,
+  eNORMAL,
+  eTRANSMISSION
+};
+
+enum class RenderLogBodyKind : uint8_t { eFILE, eMESH, ePRIMITIVE, eVERTICES };
+
+enum class RenderLogBodyOp : uint8_t {
+  eNAME,
+  eUNIQUE_ID,
+  eSEGMENTATION_ID,
+  eCUSTOM_DATA,
+  eINITIAL_POSE,
+  eVISIBILITY,
+  eVISIBLE,
+  eRENDER_MODE,
+  eSHADE_FLAT,
+  eRESCALE
+};
+
+enum class RenderLogLightKind : uint8_t { ePOINT, eDIRECTIONAL, eSPOT, eACTIVE };
+
+enum class RenderLogLightOp : uint8_t {
+  ePOSE,
+  eCOLOR,
+  eSHADOW,
+  ePOSITION,
+  eDIRECTION,
+  // half size (directional lights only), near and far
+  eSHADOW_PARAMETERS,
+  eFOV,
+  eTEXTURE
+};
+
+/** Append-only writer of a render log, safe to use from several threads. Records are buffered
+ *  and reach the file when the buffer is full, on flush and on destruction. */
+class RenderLogWriter {
+public:
+  /** Builds one record while holding the writer, the size is filled in on destruction */
+  class Record {
+  public:
+    Record(RenderLogWriter &writer, RenderLogRecord kind);
+    /** starts a *_SET record with the object id and operation */
+    template <typename Op>
+    Record(RenderLogWriter &writer, RenderLogRecord kind, uint32_t id, Op op)
+        : Record(writer, kind) {
+      put(id).put(op);
+    }
+    ~Record();
+    Record(Record const &) = delete;
+    Record &operator=(Record const &) = delete;
+
+    template <typename T> Record &put(T value) {
+      static_assert(std::is_trivially_copyable_v<T>);
+      return putBytes(&value, sizeof(T));
+    }
+    template <typename T> Record &putArray(T const *values, size_t count) {
+      put<uint32_t>(count);
+      return putBytes(values, count * sizeof(T));
+    }
+    template <typename T> Record &putArray(std::vector<T> const &values) {
+      return putArray(values.data(), values.size());
+    }
+    Record &putString(std::string_view value) { return putArray(value.data(), value.size()); }
+    Record &putVec3(physx::PxVec3 const &value);
+    Record &putPose(physx::PxTransform const &pose);
+
+  private:
+    Record &putBytes(void const *data, size_t size);
+
+    RenderLogWriter &mWriter;
+    std::lock_guard<std::mutex> mLock;
+    size_t mStart;
+  };
+
+  explicit RenderLogWriter(std::string const &filename);
+  ~RenderLogWriter();
+  RenderLogWriter(RenderLogWriter const &) = delete;
+  RenderLogWriter &operator=(RenderLogWriter const &) = delete;
+
+  /** objects of all scenes share one id space */
+  inline uint32_t nextId() { return mNextId.fetch_add(1, std::memory_order_relaxed); }
+
+  void flush();
+  inline std::string const &getFilename() const { return mFilename; }
+  /** bytes handed to the file so far, buffered records excluded */
+  inline uint64_t getBytesWritten() const { return mBytesWritten; }
+
+private:
+  static constexpr size_t kFlushSize = 1 << 20;
+
+  void writeBuffer();
+
+  std::string mFilename;
+  std::ofstream mFile;
+  std::mutex mMutex;
+  std::vector<uint8_t> mBuffer;
+  std::atomic<uint64_t> mBytesWritten{0};
+  std::atomic<uint32_t> mNextId{1};
+};
+
+class RenderLogReader;
+
+/** Plays a render log into another renderer, e.g. SVulkan2Renderer or a render client
+ *
+ *  Scenes are numbered in the order they were created in the log and cameras in the order they
+ *  were added to their scene, removed ones keep their numbers. A frame replays as updateRender
+ *  of its scene followed by takePicture of the cameras the recording took pictures with. Logs
+ *  are independent of each other, several can be replayed at the same time by separate
+ *  replayers. */
+class RenderLogReplayer {
+public:
+  using PictureCallback =
+      std::function<void(uint32_t sceneIndex, uint32_t cameraIndex, uint64_t frame)>;
+
+  RenderLogReplayer(std::string const &filename, std::shared_ptr<IPxrRenderer> renderer);
+  ~RenderLogReplayer();
+  RenderLogReplayer(RenderLogReplayer const &) = delete;
+  RenderLogReplayer &operator=(RenderLogReplayer const &) = delete;
+
+  /** called after every picture, the camera is available through getCamera */
+  inline void setPictureCallback(PictureCallback callback) {
+    mPictureCallback = std::move(callback);
+  }
+
+  /** replay up to the next frame and the pictures taken after it, false at the end of the log */
+  bool step();
+  /** replay the rest of the log, returns the number of frames replayed */
+  uint64_t run();
+
+  IPxrScene *getScene(uint32_t sceneIndex) const;
+  ICamera *getCamera(uint32_t sceneIndex, uint32_t cameraIndex) const;
+  inline uint64_t getFrameCount() const { return mFrameCount; }
+  inline std::shared_ptr<IPxrRenderer> getRenderer() const { return mRenderer; }
+
+private:
+  struct SceneEntry {
+    IPxrScene *scene;
+    uint32_t index;
+  };
+  struct CameraEntry {
+    ICamera *camera;
+    uint32_t sceneIndex;
+    uint32_t cameraIndex;
+  };
+
+  /** false at the end of the log, a truncated last record counts as the end */
+  bool readRecord(RenderLogRecord &kind, std::vector<uint8_t> &payload);
+  void apply(RenderLogRecord kind, std::vector<uint8_t> const &payload);
+
+  void applyMaterial(RenderLogReader &reader);
+  void applyAddBody(RenderLogReader &reader);
+  void applyBody(RenderLogReader &reader);
+  void applyAddLight(RenderLogReader &reader);
+  void applyLight(RenderLogReader &reader);
+  void applyFrame(RenderLogReader &reader);
+  void takePicture(CameraEntry const &entry);
+
+  IPxrScene *scene(uint32_t id) const;
+  std::shared_ptr<IPxrMaterial> material(uint32_t id) const;
+
+  std::string mFilename;
+  std::ifstream mFile;
+  std::shared_ptr<IPxrRenderer> mRenderer;
+  PictureCallback mPictureCallback;
+
+  // one record of lookahead so step ends right before the next frame
+  bool mHasNext{false};
+  RenderLogRecord mNextKind{};
+  std::vector<uint8_t> mNextPayload;
+
+  uint64_t mFrameCount{0};
+  uint64_t mCurrentFrame{0};
+
+  std::unordered_map<uint32_t, SceneEntry> mScenes;
+  std::vector<IPxrScene *> mSceneList;
+  std::unordered_map<uint32_t, CameraEntry> mCameras;
+  std::vector<std::vector<ICamera *>> mSceneCameras;
+  std::unordered_map<uint32_t, IPxrRigidbody *> mBodies;
+  std::unordered_map<uint32_t, ILight *> mLights;
+  std::unordered_map<uint32_t, std::shared_ptr<IPxrMaterial>> mMaterials;
+  std::unordered_map<uint32_t, std::shared_ptr<IPxrTexture>> mTextures;
+  std::unordered_map<uint32_t, std::shared_ptr<IRenderMesh>> mMeshes;
+};
+
+} // namespace Renderer
+} // namespace sapien
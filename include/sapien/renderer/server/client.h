@@ -1,10 +1,18 @@
 #pragma once
 
 #include "common.h"
+#include "metrics.h"
 #include "renderer/server/protos/render_server.grpc.pb.h"
+#include "sapien/awaitable.hpp"
 #include "sapien/renderer/render_interface.h"
+#include "shared_memory.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <grpc/grpc.h>
 #include <grpcpp/grpcpp.h>
+#include <mutex>
+#include <thread>
 
 namespace sapien {
 namespace Renderer {
@@ -48,6 +56,9 @@ public:
   rs_id_t getId() const { return mId; }
 
 private:
+  // replaces provisional ids after a command batch
+  friend class ClientRenderer;
+
   std::shared_ptr<ClientRenderer> mRenderer;
   rs_id_t mId;
 };
@@ -344,6 +355,18 @@ public:
 
   void updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) override;
 
+  /** Send the current poses without waiting for the server. Frames of this scene reach the
+   *  server in order with one call on the wire at a time; at most
+   *  ClientRenderer::getMaxFramesInFlight are queued and further calls block until the oldest
+   *  one is done. */
+  std::shared_ptr<IAwaitable<void>> updateRenderAsync();
+  std::shared_ptr<IAwaitable<void>>
+  updateRenderAndTakePicturesAsync(std::vector<ICamera *> const &cameras);
+
+  /** wait until every frame sent without waiting is done, throws the first error of frames
+   *  sent by updateRender in pipelined mode */
+  void waitFrames();
+
   void destroy() override;
 
   inline rs_id_t getId() const { return mId; }
@@ -351,20 +374,66 @@ public:
   ClientRenderer *getRenderer() { return mRenderer; }
 
 private:
+  friend class ClientRenderer;
+
   void syncId();
 
+  // create a ring large enough for the current entities and attach it to the server scene
+  void attachSharedMemory(size_t pictureCount);
+  void updateSharedMemory(std::vector<ICamera *> const &cameras);
+
+  /** an UpdateRenderAndTakePictures call on the completion queue of the renderer */
+  struct AsyncFrame {
+    grpc::ClientContext context;
+    proto::UpdateRenderAndTakePicturesReq req;
+    proto::Empty res;
+    grpc::Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<proto::Empty>> reader;
+    std::promise<void> promise;
+    // errors of frames nobody holds an awaitable for are rethrown by the scene
+    bool keepError{false};
+  };
+
+  std::future<void> submitFrame(std::vector<ICamera *> const &cameras, bool keepError);
+  // called on the completion queue thread
+  void completeFrame(bool ok);
+
   ClientRenderer *mRenderer;
   rs_id_t mId;
   std::string mName;
   std::vector<std::unique_ptr<ClientRigidbody>> mBodies;
+  // bodies of a failed command batch, kept alive until destroyed but never sent to the server
+  std::vector<std::unique_ptr<ClientRigidbody>> mFailedBodies;
   std::vector<std::unique_ptr<ClientCamera>> mCameras;
   std::vector<std::unique_ptr<ILight>> mLights;
   bool mIdSynced{false};
+
+  // pose update requests live on the arena and are reused every frame
+  google::protobuf::Arena mArena;
+  proto::UpdateRenderReq *mUpdateRenderReq{};
+  proto::UpdateRenderAndTakePicturesReq *mUpdateRenderAndTakePicturesReq{};
+
+  // update deferred to the next ClientRenderer::flush
+  bool mBatchPending{false};
+  std::vector<rs_id_t> mBatchCameraIds;
+
+  std::unique_ptr<ShmRing> mRing;
+
+  // frames sent without waiting, the front one is on the wire
+  std::mutex mFrameMutex;
+  std::condition_variable mFrameCondition;
+  std::deque<std::unique_ptr<AsyncFrame>> mFrames;
+  std::exception_ptr mFrameError;
+
+  // pose updates and pictures issued, whatever the transport
+  std::atomic<uint64_t> mFrameCount{0};
+  std::atomic<uint64_t> mPictureCount{0};
 };
 
 class ClientRenderer : public IPxrRenderer, public std::enable_shared_from_this<ClientRenderer> {
 public:
   ClientRenderer(std::string const &address, uint64_t processIndex);
+  ~ClientRenderer();
 
   ClientScene *createScene(std::string const &name) override;
   void removeScene(IPxrScene *scene) override;
@@ -378,13 +447,101 @@ public:
   proto::RenderService::Stub &getStub() const { return *mStub; }
 
   inline uint64_t getProcessIndex() const { return mProcessIndex; }
+  inline std::string const &getAddress() const { return mAddress; }
+
+  /** try to connect within timeout, false if the server cannot be reached */
+  bool isConnected(uint32_t timeoutMs);
+  inline uint32_t getSceneCount() const { return mScenes.size(); }
+  /** queued frames of all scenes */
+  uint32_t getFramesInFlight() const;
+  inline uint32_t getPendingCommandCount() const { return mCommands.commands_size(); }
+
+  /** calls made by this client, client-side stages and per-scene counters with the frames in
+   *  flight as pending, see MetricsRes in render_server.proto */
+  proto::MetricsRes getMetrics() const;
+  /** the metrics of the server from a GetMetrics call */
+  proto::MetricsRes getServerMetrics();
+
+  /** When enabled, updateRender and updateRenderAndTakePictures of the scenes only mark them
+   *  and flush sends every marked scene in one UpdateRenderBatch call */
+  inline void setBatchUpdates(bool enable) { mBatchUpdates = enable; }
+  inline bool getBatchUpdates() const { return mBatchUpdates; }
+  /** submit recorded commands, send batched updates and wait for the frames in flight of
+   *  every scene */
+  void flush();
+
+  /** When enabled, materials and bodies are created with provisional ids and their setup calls
+   *  are recorded instead of sent. submitCommands sends them in one SubmitCommands call and
+   *  replaces the provisional ids; calls that need a server result or refer to body ids submit
+   *  first. Objects of a batch that failed leave the entity order and throw when used, destroying
+   *  them sends nothing. Disabling submits. */
+  void setCommandBatching(bool enable);
+  inline bool getCommandBatching() const { return mCommandBatching; }
+  void submitCommands();
+
+  /** the command to fill when recording, nullptr otherwise */
+  inline proto::Command *recordCommand() {
+    return mCommandBatching ? mCommands.add_commands() : nullptr;
+  }
+  inline rs_id_t generateProvisionalId() {
+    return kProvisionalIdBit | mProvisionalIdGenerator++;
+  }
+  /** whether id is a provisional id of a failed batch, the server never created the object */
+  inline bool isFailedId(rs_id_t id) const {
+    return (id & kProvisionalIdBit) && (id & ~kProvisionalIdBit) < mBatchProvisionalIdStart;
+  }
+
+  /** Frames a scene may queue without waiting. With a value above 0, updateRender and
+   *  updateRenderAndTakePictures of the scenes return before the server is done, their errors
+   *  are thrown by a later call on the scene or by flush. 0 keeps them synchronous.
+   *
+   *  Queued frames of a scene are sent one RPC at a time, because the server does not run calls
+   *  of a scene concurrently, so this bounds the client-side queue and only different scenes
+   *  overlap on the wire. ClientCamera::takePicture and setPerspectiveCameraParameters wait for
+   *  the queue and stay blocking, use updateRenderAndTakePictures to keep pictures queued. */
+  inline void setMaxFramesInFlight(uint32_t count) { mMaxFramesInFlight = count; }
+  inline uint32_t getMaxFramesInFlight() const { return mMaxFramesInFlight; }
+
+  /** When enabled, scenes send pose updates through a ShmRing instead of gRPC. The server must
+   *  run on the same host. Linux only. Batched updates still go through UpdateRenderBatch. */
+  inline void setSharedMemory(bool enable) { mSharedMemory = enable; }
+  inline bool getSharedMemory() const { return mSharedMemory; }
 
 private:
+  friend class ClientScene;
+
+  // start the call of a frame, the completion queue thread reports it done to its scene
+  void startFrame(ClientScene *scene, ClientScene::AsyncFrame &frame);
+
   uint64_t mProcessIndex;
+  std::string mAddress;
+  // the channel interceptors record into it
+  std::shared_ptr<MetricsRegistry> mMetrics;
+  struct Stages {
+    LatencyHistogram *packPoses;
+    LatencyHistogram *frameSlotWait;
+    LatencyHistogram *sharedMemoryWait;
+  } mStages;
   std::shared_ptr<grpc::Channel> mChannel;
   std::unique_ptr<proto::RenderService::Stub> mStub;
 
+  grpc::CompletionQueue mQueue;
+  std::thread mQueueThread;
+  uint32_t mMaxFramesInFlight{0};
+
   std::vector<std::unique_ptr<ClientScene>> mScenes;
+
+  bool mCommandBatching{false};
+  proto::CommandBatchReq mCommands;
+  rs_id_t mProvisionalIdGenerator{0};
+  // provisional ids below it were generated for batches already submitted
+  rs_id_t mBatchProvisionalIdStart{0};
+  std::vector<std::weak_ptr<ClientMaterial>> mProvisionalMaterials;
+
+  bool mBatchUpdates{false};
+  bool mSharedMemory{false};
+  google::protobuf::Arena mArena;
+  proto::UpdateRenderBatchReq *mBatchReq{};
 };
 
 } // namespace server
@@ -7,6 +7,10 @@ namespace server {
 
 using rs_id_t = uint64_t;
 
+// ids assigned by a client to objects created by recorded commands, the server generates ids
+// counting up from 0 and never sets this bit
+constexpr rs_id_t kProvisionalIdBit = rs_id_t(1) << 63;
+
 }
 } // namespace renderer
 } // namespace sapien
@@ -0,0 +1,109 @@
+#pragma once
+#include "common.h"
+#include "renderer/server/protos/render_server.pb.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <grpcpp/support/client_interceptor.h>
+#include <grpcpp/support/server_interceptor.h>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+/** Latency histogram, bucket i counts durations below 2^i microseconds and the last bucket
+ *  everything longer. Recording is lock free. */
+class LatencyHistogram {
+public:
+  static constexpr uint32_t kBucketCount = 24;
+
+  void record(std::chrono::steady_clock::duration duration);
+  void fill(proto::Histogram &histogram) const;
+
+private:
+  std::atomic<uint64_t> mCount{0};
+  std::atomic<uint64_t> mSumUs{0};
+  std::atomic<uint64_t> mMaxUs{0};
+  std::array<std::atomic<uint64_t>, kBucketCount> mBuckets{};
+};
+
+/** records the lifetime of the scope */
+class ScopedLatency {
+public:
+  explicit ScopedLatency(LatencyHistogram &histogram)
+      : mHistogram(histogram), mStart(std::chrono::steady_clock::now()) {}
+  ~ScopedLatency() { mHistogram.record(std::chrono::steady_clock::now() - mStart); }
+  ScopedLatency(ScopedLatency const &) = delete;
+  ScopedLatency &operator=(ScopedLatency const &) = delete;
+
+private:
+  LatencyHistogram &mHistogram;
+  std::chrono::steady_clock::time_point mStart;
+};
+
+struct MethodMetrics {
+  // call start to status sent (server) or received (client)
+  LatencyHistogram latency;
+  // server only: request decoded to response ready
+  LatencyHistogram handler;
+  std::atomic<uint64_t> errors{0};
+  std::atomic<uint64_t> bytesIn{0};
+  std::atomic<uint64_t> bytesOut{0};
+};
+
+/** Per-method and per-stage counters of one side of the render service. Entries are created on
+ *  first use and never removed, references to them stay valid. */
+class MetricsRegistry {
+public:
+  MetricsRegistry();
+
+  MethodMetrics &method(std::string_view name);
+  LatencyHistogram &stage(std::string_view name);
+
+  /** fills uptime, methods and stages; scenes are up to the owner */
+  void fill(proto::MetricsRes &res) const;
+
+private:
+  std::chrono::steady_clock::time_point mStart;
+  mutable std::shared_mutex mMutex;
+  std::map<std::string, std::unique_ptr<MethodMetrics>, std::less<>> mMethods;
+  std::map<std::string, std::unique_ptr<LatencyHistogram>, std::less<>> mStages;
+};
+
+/** one line of JSON, used for the periodic dump and the Python bindings */
+std::string metricsToJson(proto::MetricsRes const &metrics);
+
+/** records every call of a server in the registry */
+class ServerMetricsInterceptorFactory
+    : public grpc::experimental::ServerInterceptorFactoryInterface {
+public:
+  explicit ServerMetricsInterceptorFactory(std::shared_ptr<MetricsRegistry> registry)
+      : mRegistry(std::move(registry)) {}
+  grpc::experimental::Interceptor *
+  CreateServerInterceptor(grpc::experimental::ServerRpcInfo *info) override;
+
+private:
+  std::shared_ptr<MetricsRegistry> mRegistry;
+};
+
+/** records every call made on a channel in the registry */
+class ClientMetricsInterceptorFactory
+    : public grpc::experimental::ClientInterceptorFactoryInterface {
+public:
+  explicit ClientMetricsInterceptorFactory(std::shared_ptr<MetricsRegistry> registry)
+      : mRegistry(std::move(registry)) {}
+  grpc::experimental::Interceptor *
+  CreateClientInterceptor(grpc::experimental::ClientRpcInfo *info) override;
+
+private:
+  std::shared_ptr<MetricsRegistry> mRegistry;
+};
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
@@ -1,17 +1,22 @@
 #pragma once
 #include "common.h"
 #include "renderer/server/protos/render_server.grpc.pb.h"
+#include "metrics.h"
 #include "safe_map.h"
-#include "sapien/thread_pool.hpp"
+#include "shared_memory.h"
+#include "sapien/task_scheduler.h"
+#include <condition_variable>
 #include <grpc/grpc.h>
 #include <grpcpp/grpcpp.h>
 #include <memory>
 #include <shared_mutex>
+#include <span>
 #include <svulkan2/core/context.h>
 #include <svulkan2/renderer/renderer.h>
 #include <svulkan2/resource/manager.h>
 #include <svulkan2/resource/material.h>
 #include <svulkan2/scene/scene.h>
+#include <thread>
 #include <unordered_map>
 
 namespace sapien {
@@ -72,6 +77,17 @@ class RenderServiceImpl final : public proto::RenderService::Service {
                      proto::Empty *res) override;
   Status SetCameraParameters(ServerContext *c, const proto::CameraParamsReq *req,
                              proto::Empty *res) override;
+  // ========== Batch ==========//
+  Status UpdateRenderBatch(ServerContext *c, const proto::UpdateRenderBatchReq *req,
+                           proto::Empty *res) override;
+  // ========== Shared memory ==========//
+  Status AttachSharedMemory(ServerContext *c, const proto::AttachSharedMemoryReq *req,
+                            proto::Empty *res) override;
+  // ========== Commands ==========//
+  Status SubmitCommands(ServerContext *c, const proto::CommandBatchReq *req,
+                        proto::CommandBatchRes *res) override;
+  // ========== Metrics ==========//
+  Status GetMetrics(ServerContext *c, const proto::Empty *req, proto::MetricsRes *res) override;
 
 public:
   RenderServiceImpl(std::shared_ptr<svulkan2::core::Context> context,
@@ -85,6 +101,17 @@ private:
   std::shared_ptr<svulkan2::core::Context> mContext;
   std::shared_ptr<svulkan2::resource::SVResourceManager> mResourceManager;
 
+  // declared before the scenes, tasks still queued on a scene record into it while the scene is
+  // destroyed
+  std::shared_ptr<MetricsRegistry> mMetrics;
+  struct Stages {
+    LatencyHistogram *applyPoses;
+    LatencyHistogram *updateMatrices;
+    LatencyHistogram *semaphoreWait;
+    LatencyHistogram *render;
+    LatencyHistogram *submit;
+  } mStages;
+
   std::atomic<uint64_t> mIdGenerator{0};
 
   struct CameraInfo {
@@ -117,7 +144,15 @@ private:
     std::vector<svulkan2::scene::Object *> orderedObjects;
     std::vector<svulkan2::scene::Camera *> orderedCameras;
 
-    std::unique_ptr<ThreadPool> threadRunner;
+    // pose updates applied and pictures queued
+    std::atomic<uint64_t> frameCount{0};
+    std::atomic<uint64_t> pictureCount{0};
+
+    std::unique_ptr<TaskQueue> threadRunner;
+
+    // serves frames from a client on the same host, declared last so its thread stops before
+    // the rest of the scene is destroyed
+    std::unique_ptr<ShmRingServer> sharedMemory;
   };
 
   // store materials on an object
@@ -131,6 +166,17 @@ private:
   // refresh the object material map to remove expired weak ptr
   void updateObjectMaterialMap();
 
+  // apply the body and camera poses of an UpdateRender* request in entity order
+  template <typename Req> Status updatePoses(SceneInfo &info, Req const &req);
+
+  // queue rendering and copying to the render target buffers on the scene task queue
+  void submitPictures(SceneInfo &info, std::span<uint64_t const> cameraIds);
+
+  // apply frame n of a shared memory ring, throws when it does not match the scene
+  void applySharedMemoryFrame(SceneInfo &info, ShmRing &ring, uint32_t n);
+
+  void fillMetrics(proto::MetricsRes &res);
+
   std::shared_mutex mSceneListLock;
   std::vector<std::shared_ptr<SceneInfo>> mSceneList;
 
@@ -210,6 +256,16 @@ public:
 
   std::string summary() const;
 
+  /** request counts and latencies, per-stage latencies and per-scene counters as JSON, see
+   *  MetricsRes in render_server.proto */
+  std::string getMetricsJson() const;
+  /** append getMetricsJson to filename every intervalMs on a background thread, replaces a
+   *  dump started before */
+  void startMetricsDump(std::string const &filename, uint32_t intervalMs);
+  void stopMetricsDump();
+
+  ~RenderServer();
+
 private:
   VulkanCudaBuffer *allocateBuffer(std::string const &type, std::vector<int> const &shape);
 
@@ -220,6 +276,11 @@ private:
   std::shared_ptr<svulkan2::resource::SVResourceManager> mResourceManager;
 
   std::vector<std::unique_ptr<VulkanCudaBuffer>> mBuffers;
+
+  std::thread mDumpThread;
+  std::mutex mDumpMutex;
+  std::condition_variable mDumpCondition;
+  bool mDumpStop{false};
 };
 
 } // namespace server
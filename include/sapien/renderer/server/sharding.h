@@ -0,0 +1,128 @@
+#pragma once
+#include "client.h"
+#include <functional>
+#include <optional>
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+enum class ShardPlacement {
+  // fewest scenes, then fewest frames in flight
+  eLEAST_LOADED,
+  // hash ring over the shard addresses, a scene keeps its shard when other shards come and go
+  eCONSISTENT_HASH
+};
+
+struct ShardStats {
+  std::string address;
+  bool healthy;
+  uint32_t sceneCount;
+  // queued frames of all scenes of the shard
+  uint32_t framesInFlight;
+  // recorded setup commands not submitted yet
+  uint32_t pendingCommands;
+};
+
+/** Chooses the shard of a new scene and tracks which shards are healthy. It knows shards only by
+ *  address and index, so it does not depend on how they are reached. */
+class ShardPlacer {
+public:
+  ShardPlacer(std::vector<std::string> const &addresses, ShardPlacement placement);
+
+  /** shards in the order they should be tried for key, load holds (scenes, frames in flight)
+   *  of every shard and is only used by eLEAST_LOADED */
+  std::vector<uint32_t> order(std::string const &key,
+                              std::vector<std::pair<uint32_t, uint32_t>> const &load) const;
+
+  /** call create on healthy shards in order until it returns, a shard whose create throws is
+   *  marked unhealthy. Returns the index of the shard, throws if every shard failed */
+  uint32_t place(std::string const &key, std::vector<std::pair<uint32_t, uint32_t>> const &load,
+                 std::function<void(uint32_t)> const &create);
+
+  inline bool isHealthy(uint32_t index) const { return mHealthy.at(index); }
+  inline void setHealthy(uint32_t index, bool healthy) { mHealthy.at(index) = healthy; }
+  inline uint32_t getShardCount() const { return mAddresses.size(); }
+
+private:
+  std::vector<std::string> mAddresses;
+  ShardPlacement mPlacement;
+  std::vector<bool> mHealthy;
+
+  // sorted points of the hash ring and their shards
+  std::vector<std::pair<uint64_t, uint32_t>> mRing;
+};
+
+/** Material of a ShardedRenderer. Its properties are kept on the client, a ClientMaterial is
+ *  created on a shard when a body of one of its scenes first uses it and later changes go to
+ *  every shard that has it. */
+class ShardedMaterial : public IPxrMaterial {
+public:
+  void setBaseColor(std::array<float, 4> color) override;
+  [[nodiscard]] std::array<float, 4> getBaseColor() const override;
+  void setRoughness(float roughness) override;
+  [[nodiscard]] float getRoughness() const override;
+  void setSpecular(float specular) override;
+  [[nodiscard]] float getSpecular() const override;
+  void setMetallic(float metallic) override;
+  [[nodiscard]] float getMetallic() const override;
+
+  /** the material on the server of renderer */
+  std::shared_ptr<ClientMaterial> getShardMaterial(ClientRenderer &renderer);
+
+private:
+  std::optional<std::array<float, 4>> mBaseColor;
+  std::optional<float> mRoughness;
+  std::optional<float> mSpecular;
+  std::optional<float> mMetallic;
+
+  std::vector<std::pair<ClientRenderer *, std::shared_ptr<ClientMaterial>>> mShardMaterials;
+};
+
+/** Spreads scenes over several render servers, each scene lives on one shard and talks to it
+ *  through its own ClientRenderer. Shards that fail a health check or scene creation get no new
+ *  scenes until a later checkHealth finds them reachable. */
+class ShardedRenderer : public IPxrRenderer {
+public:
+  ShardedRenderer(std::vector<std::string> const &addresses, uint64_t processIndex,
+                  ShardPlacement placement);
+
+  ClientScene *createScene(std::string const &name) override;
+  void removeScene(IPxrScene *scene) override;
+  std::shared_ptr<IPxrMaterial> createMaterial() override;
+
+  std::shared_ptr<IRenderMesh> createMesh(std::vector<float> const &vertices,
+                                          std::vector<uint32_t> const &indices) override {
+    throw std::runtime_error("Mesh creation is not supported for rendering client");
+  };
+
+  /** try to connect to every shard within timeout, returns the number of healthy shards */
+  uint32_t checkHealth(uint32_t timeoutMs);
+  std::vector<ShardStats> getShardStats() const;
+  inline std::vector<std::shared_ptr<ClientRenderer>> const &getShards() const {
+    return mShards;
+  }
+
+  // ========== Forwarded to every shard ==========//
+  void setBatchUpdates(bool enable);
+  inline bool getBatchUpdates() const { return mBatchUpdates; }
+  void setMaxFramesInFlight(uint32_t count);
+  inline uint32_t getMaxFramesInFlight() const { return mMaxFramesInFlight; }
+  void setCommandBatching(bool enable);
+  inline bool getCommandBatching() const { return mCommandBatching; }
+  void flush();
+
+private:
+  uint64_t mProcessIndex;
+  std::vector<std::shared_ptr<ClientRenderer>> mShards;
+  ShardPlacer mPlacer;
+  uint64_t mSceneSerial{0};
+
+  bool mBatchUpdates{false};
+  uint32_t mMaxFramesInFlight{0};
+  bool mCommandBatching{false};
+};
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
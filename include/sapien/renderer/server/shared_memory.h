@@ -0,0 +1,114 @@
+#pragma once
+#include "common.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+/** Header of a shared memory pose ring.
+ *
+ *  The client publishes frame n by writing slot n % slotCount and storing n to `requested`.
+ *  The server applies it, stores n to `completed` and reports a failure in `error`. Both
+ *  counters are futex words, neither side polls. Counters wrap around, compare them with
+ *  ShmRing::reached. */
+struct ShmRingHeader {
+  uint32_t magic;
+  uint32_t slotCount;
+  uint32_t maxBodies;
+  uint32_t maxCameras;
+  uint64_t slotSize;
+  std::atomic<uint32_t> requested;
+  std::atomic<uint32_t> completed;
+  std::atomic<uint32_t> error;
+};
+
+/** One frame: header, camera ids to take pictures with, then body and camera poses packed as
+ *  p.xyz, q.wxyz in entity order (the layout of UpdateRenderReq::body_pose_data) */
+struct ShmFrameHeader {
+  uint32_t bodyCount;
+  uint32_t cameraCount;
+  uint32_t pictureCount;
+  uint32_t padding;
+};
+
+/** A pose ring in POSIX shared memory, shared by a ClientScene and the render server running
+ *  on the same host. Only available on Linux. */
+class ShmRing {
+public:
+  static constexpr uint32_t kMagic = 0x52534d53; // "SMSR"
+
+  /** create a new segment, the creating side unlinks it on destruction unless unlink was
+   *  already called */
+  static std::unique_ptr<ShmRing> Create(std::string const &name, uint32_t slotCount,
+                                         uint32_t maxBodies, uint32_t maxCameras);
+  /** map a segment created by another process */
+  static std::unique_ptr<ShmRing> Open(std::string const &name);
+
+  ShmRing(ShmRing const &) = delete;
+  ShmRing &operator=(ShmRing const &) = delete;
+  ~ShmRing();
+
+  /** remove the name, the mapping stays valid in every process that has it */
+  void unlink();
+
+  inline std::string const &getName() const { return mName; }
+  inline ShmRingHeader &header() const { return *reinterpret_cast<ShmRingHeader *>(mData); }
+  ShmFrameHeader &frame(uint32_t n) const;
+  uint64_t *pictures(uint32_t n) const;
+  float *poses(uint32_t n) const;
+
+  // ========== Client ==========//
+  /** wait until the slot of the next frame is free and return the frame number */
+  uint32_t beginFrame(uint32_t timeoutMs);
+  /** publish a frame written to its slot and ring the doorbell */
+  void endFrame(uint32_t n);
+  /** wait until the server completed frame n, throws if the server reported an error */
+  void waitCompleted(uint32_t n, uint32_t timeoutMs);
+
+  /** true when counter has reached n */
+  static inline bool reached(uint32_t counter, uint32_t n) {
+    return static_cast<int32_t>(counter - n) >= 0;
+  }
+  /** block while word still holds value, returns false on timeout */
+  static bool wait(std::atomic<uint32_t> &word, uint32_t value, uint32_t timeoutMs);
+  static void wake(std::atomic<uint32_t> &word);
+
+private:
+  ShmRing(std::string const &name, void *data, size_t size, bool owner);
+
+  std::string mName;
+  void *mData;
+  size_t mSize;
+  bool mOwner;
+};
+
+/** Server side of a ShmRing: calls the handler for every published frame on a dedicated
+ *  thread. A handler that throws marks the frame failed; the frame is completed either way so
+ *  the client never waits forever. */
+class ShmRingServer {
+public:
+  using Handler = std::function<void(ShmRing &ring, uint32_t frame)>;
+
+  ShmRingServer(std::unique_ptr<ShmRing> ring, Handler handler);
+  ShmRingServer(ShmRingServer const &) = delete;
+  ShmRingServer &operator=(ShmRingServer const &) = delete;
+  /** stops and joins the thread */
+  ~ShmRingServer();
+
+private:
+  void run();
+
+  std::unique_ptr<ShmRing> mRing;
+  Handler mHandler;
+  std::atomic<bool> mStop{false};
+  std::thread mThread;
+};
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
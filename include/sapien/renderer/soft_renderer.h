@@ -0,0 +1,411 @@
+#pragma once
+#include "render_interface.h"
+#include <map>
+#include <mutex>
+
+namespace sapien {
+namespace Renderer {
+
+class SoftRenderer;
+class SoftScene;
+struct SoftRasterBuffers;
+
+/** Triangle mesh kept in memory, bodies read it every picture so changes show up at once */
+class SoftMesh : public IRenderMesh {
+public:
+  SoftMesh(std::vector<float> vertices, std::vector<float> normals,
+           std::vector<uint32_t> indices);
+
+  std::vector<float> getVertices() override { return mVertices; }
+  std::vector<float> getNormals() override { return mNormals; }
+  std::vector<float> getUVs() override { return mUVs; }
+  std::vector<float> getTangents() override { return mTangents; }
+  std::vector<float> getBitangents() override { return mBitangents; }
+  std::vector<uint32_t> getIndices() override { return mIndices; }
+
+  void setVertices(std::vector<float> const &vertices) override { mVertices = vertices; }
+  void setNormals(std::vector<float> const &normals) override { mNormals = normals; }
+  void setUVs(std::vector<float> const &uvs) override { mUVs = uvs; }
+  void setTangents(std::vector<float> const &tangents) override { mTangents = tangents; }
+  void setBitangents(std::vector<float> const &bitangents) override {
+    mBitangents = bitangents;
+  }
+  void setIndices(std::vector<uint32_t> const &indices) override { mIndices = indices; }
+
+  inline std::vector<float> const &vertices() const { return mVertices; }
+  inline std::vector<float> const &normals() const { return mNormals; }
+  inline std::vector<uint32_t> const &indices() const { return mIndices; }
+
+private:
+  std::vector<float> mVertices;
+  std::vector<float> mNormals;
+  std::vector<float> mUVs;
+  std::vector<float> mTangents;
+  std::vector<float> mBitangents;
+  std::vector<uint32_t> mIndices;
+};
+
+/** Only the base color is rendered, the other values are kept for the getters */
+class SoftMaterial : public IPxrMaterial {
+public:
+  void setBaseColor(std::array<float, 4> color) override { mBaseColor = color; }
+  [[nodiscard]] std::array<float, 4> getBaseColor() const override { return mBaseColor; }
+  void setRoughness(float roughness) override { mRoughness = roughness; }
+  [[nodiscard]] float getRoughness() const override { return mRoughness; }
+  void setSpecular(float specular) override { mSpecular = specular; }
+  [[nodiscard]] float getSpecular() const override { return mSpecular; }
+  void setMetallic(float metallic) override { mMetallic = metallic; }
+  [[nodiscard]] float getMetallic() const override { return mMetallic; }
+
+private:
+  std::array<float, 4> mBaseColor{1.f, 1.f, 1.f, 1.f};
+  float mRoughness{1.f};
+  float mSpecular{0.f};
+  float mMetallic{0.f};
+};
+
+class SoftShape : public IPxrRenderShape {
+public:
+  SoftShape(std::shared_ptr<SoftMesh> mesh, std::shared_ptr<IPxrMaterial> material)
+      : mMesh(std::move(mesh)), mMaterial(std::move(material)) {}
+  [[nodiscard]] std::shared_ptr<IRenderMesh> getGeometry() const override { return mMesh; }
+  [[nodiscard]] std::shared_ptr<IPxrMaterial> getMaterial() const override { return mMaterial; }
+  void setMaterial(std::shared_ptr<IPxrMaterial> material) override {
+    mMaterial = std::move(material);
+  }
+
+  inline SoftMesh const &mesh() const { return *mMesh; }
+
+private:
+  std::shared_ptr<SoftMesh> mMesh;
+  std::shared_ptr<IPxrMaterial> mMaterial;
+};
+
+class SoftRigidbody : public IPxrRigidbody {
+public:
+  SoftRigidbody(SoftScene *scene, std::vector<std::shared_ptr<SoftShape>> shapes,
+                physx::PxGeometryType::Enum type, physx::PxVec3 scale);
+
+  void setName(std::string const &name) override { mName = name; }
+  std::string getName() const override { return mName; }
+  void setUniqueId(uint32_t uniqueId) override { mUniqueId = uniqueId; }
+  uint32_t getUniqueId() const override { return mUniqueId; }
+  void setSegmentationId(uint32_t segmentationId) override { mSegmentationId = segmentationId; }
+  uint32_t getSegmentationId() const override { return mSegmentationId; }
+  /** custom data has no image target here */
+  void setSegmentationCustomData(std::vector<float> const &customData) override {}
+  void setInitialPose(const physx::PxTransform &transform) override;
+  void update(const physx::PxTransform &transform) override;
+  /** there is no transparency, bodies with visibility 0 are skipped and the rest are opaque */
+  void setVisibility(float visibility) override { mVisibility = visibility; }
+  void setVisible(bool visible) override { mVisibility = visible ? 1.f : 0.f; }
+  void setRenderMode(uint32_t mode) override;
+  void setShadeFlat(bool shadeFlat) override { mShadeFlat = shadeFlat; }
+  bool getShadeFlat() override { return mShadeFlat; }
+
+  void destroy() override;
+
+  physx::PxGeometryType::Enum getType() const override { return mType; }
+  physx::PxTransform getInitialPose() const override { return mInitialPose; }
+  std::vector<std::shared_ptr<IPxrRenderShape>> getRenderShapes() override;
+  physx::PxVec3 getScale() const override { return mScale; }
+  void rescale(float factor) override;
+
+  /** body pose times initial pose */
+  inline physx::PxTransform const &getPose() const { return mPose; }
+  /** scale applied to the meshes, capsule meshes are built at their size */
+  inline physx::PxVec3 const &getRenderScale() const { return mRenderScale; }
+  inline float getVisibility() const { return mVisibility; }
+  inline std::vector<std::shared_ptr<SoftShape>> const &getShapes() const { return mShapes; }
+
+private:
+  SoftScene *mScene;
+  std::vector<std::shared_ptr<SoftShape>> mShapes;
+  physx::PxGeometryType::Enum mType;
+  physx::PxVec3 mScale;
+  physx::PxVec3 mRenderScale;
+  std::string mName;
+  uint32_t mUniqueId{0};
+  uint32_t mSegmentationId{0};
+  physx::PxTransform mInitialPose{physx::PxIdentity};
+  physx::PxTransform mPose{physx::PxIdentity};
+  float mVisibility{1.f};
+  bool mShadeFlat{false};
+};
+
+/** Image targets, all of them are rendered by takePicture
+ *  Position (float4): OpenGL camera space xyz and depth in [0, 1], background is (0, 0, 0, 1)
+ *  Segmentation (uint32 x4): unique id, segmentation id, 0, 0
+ *  Normal (float4): camera space normal, 0
+ *  Albedo (float4): base color
+ *  Color (float4): base color lit by the ambient light and the lights without shadows
+ *  Depth (float): distance along the view direction, 0 for the background */
+class SoftCamera : public ICamera {
+public:
+  SoftCamera(SoftScene *scene, uint32_t width, uint32_t height, float fovy, float near,
+             float far);
+  ~SoftCamera();
+
+  [[nodiscard]] physx::PxTransform getPose() const override { return mPose; }
+  void setPose(physx::PxTransform const &pose) override { mPose = pose; }
+  IPxrScene *getScene() override;
+
+  uint32_t getWidth() const override { return mWidth; }
+  uint32_t getHeight() const override { return mHeight; }
+
+  [[nodiscard]] float getPrincipalPointX() const override { return mCx; }
+  [[nodiscard]] float getPrincipalPointY() const override { return mCy; }
+  [[nodiscard]] float getFocalX() const override { return mFx; }
+  [[nodiscard]] float getFocalY() const override { return mFy; }
+  [[nodiscard]] float getNear() const override { return mNear; }
+  [[nodiscard]] float getFar() const override { return mFar; }
+  [[nodiscard]] float getSkew() const override { return mSkew; }
+
+  void setPerspectiveCameraParameters(float near, float far, float fx, float fy, float cx,
+                                      float cy, float skew) override;
+
+  std::vector<float> getFloatImage(std::string const &name) override;
+  std::vector<uint32_t> getUintImage(std::string const &name) override;
+  std::string getImageFormat(std::string const &name) override;
+
+  void takePicture() override;
+
+private:
+  friend class SoftScene;
+
+  SoftScene *mScene;
+  physx::PxTransform mPose{physx::PxIdentity};
+  uint32_t mWidth;
+  uint32_t mHeight;
+  float mCx;
+  float mCy;
+  float mFx;
+  float mFy;
+  float mNear;
+  float mFar;
+  float mSkew{0.f};
+
+  std::vector<float> mPosition;
+  std::vector<uint32_t> mSegmentation;
+  std::vector<float> mNormal;
+  std::vector<float> mAlbedo;
+  std::vector<float> mColor;
+  std::vector<float> mDepth;
+
+  // triangles and tile bins of the last picture, kept to reuse their memory
+  std::unique_ptr<SoftRasterBuffers> mBuffers;
+};
+
+/** Light state, used to shade the Color target */
+template <typename Base> class SoftLight : public Base {
+public:
+  SoftLight(physx::PxTransform pose, physx::PxVec3 color, bool shadow, float near, float far)
+      : mPose(pose), mColor(color), mShadow(shadow), mNear(near), mFar(far) {}
+
+  physx::PxTransform getPose() const override { return mPose; }
+  /** lights look down -z of their pose like the cameras */
+  void setPose(physx::PxTransform const &pose) override {
+    mPose = pose;
+    mDirection = pose.q.rotate({0.f, 0.f, -1.f});
+  }
+  physx::PxVec3 getColor() const override { return mColor; }
+  void setColor(physx::PxVec3 color) override { mColor = color; }
+  bool getShadowEnabled() const override { return mShadow; }
+  void setShadowEnabled(bool enabled) override { mShadow = enabled; }
+  float getShadowNear() const override { return mNear; }
+  float getShadowFar() const override { return mFar; }
+
+protected:
+  physx::PxTransform mPose;
+  physx::PxVec3 mColor;
+  bool mShadow;
+  float mNear;
+  float mFar;
+  physx::PxVec3 mDirection{0.f, 0.f, -1.f};
+  float mFov{0.f};
+};
+
+class SoftPointLight : public SoftLight<IPointLight> {
+public:
+  using SoftLight::SoftLight;
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { mPose.p = position; }
+  void setShadowParameters(float near, float far) override {
+    mNear = near;
+    mFar = far;
+  }
+};
+
+class SoftDirectionalLight : public SoftLight<IDirectionalLight> {
+public:
+  SoftDirectionalLight(physx::PxTransform pose, physx::PxVec3 color, bool shadow,
+                       physx::PxVec3 direction, float halfSize, float near, float far)
+      : SoftLight(pose, color, shadow, near, far), mHalfSize(halfSize) {
+    mDirection = direction.getNormalized();
+  }
+  physx::PxVec3 getDirection() const override { return mDirection; }
+  void setDirection(physx::PxVec3 direction) override { mDirection = direction.getNormalized(); }
+  void setShadowParameters(float halfSize, float near, float far) override {
+    mHalfSize = halfSize;
+    mNear = near;
+    mFar = far;
+  }
+  float getShadowHalfSize() const override { return mHalfSize; }
+
+private:
+  float mHalfSize;
+};
+
+class SoftSpotLight : public SoftLight<ISpotLight> {
+public:
+  SoftSpotLight(physx::PxTransform pose, physx::PxVec3 color, bool shadow,
+                physx::PxVec3 direction, float fov, float near, float far)
+      : SoftLight(pose, color, shadow, near, far) {
+    mDirection = direction.getNormalized();
+    mFov = fov;
+  }
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { mPose.p = position; }
+  physx::PxVec3 getDirection() const override { return mDirection; }
+  void setDirection(physx::PxVec3 direction) override { mDirection = direction.getNormalized(); }
+  void setShadowParameters(float near, float far) override {
+    mNear = near;
+    mFar = far;
+  }
+  void setFov(float fov) override { mFov = fov; }
+  float getFov() const override { return mFov; }
+};
+
+/** shaded like a spot light, the texture is not projected */
+class SoftActiveLight : public SoftLight<IActiveLight> {
+public:
+  SoftActiveLight(physx::PxTransform pose, physx::PxVec3 color, float fov,
+                  std::string_view texture, float near, float far)
+      : SoftLight(pose, color, true, near, far), mTexture(texture) {
+    setPose(pose);
+    mFov = fov;
+  }
+  physx::PxVec3 getPosition() const override { return mPose.p; }
+  void setPosition(physx::PxVec3 position) override { mPose.p = position; }
+  void setFov(float fov) override { mFov = fov; }
+  float getFov() const override { return mFov; }
+  void setShadowParameters(float near, float far) override {
+    mNear = near;
+    mFar = far;
+  }
+  void setTexture(std::string_view path) override { mTexture = path; }
+  std::string_view getTexture() override { return mTexture; }
+
+private:
+  std::string mTexture;
+};
+
+class SoftScene : public IPxrScene {
+public:
+  SoftScene(SoftRenderer *renderer, std::string const &name);
+
+  //========== Body ==========//
+  IPxrRigidbody *addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale) override;
+  IPxrRigidbody *addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(std::shared_ptr<IRenderMesh> mesh, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(physx::PxGeometryType::Enum type, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(physx::PxGeometryType::Enum type, const physx::PxVec3 &scale,
+                              const physx::PxVec3 &color) override;
+  IPxrRigidbody *addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                              std::vector<physx::PxVec3> const &normals,
+                              std::vector<uint32_t> const &indices, const physx::PxVec3 &scale,
+                              std::shared_ptr<IPxrMaterial> material) override;
+  IPxrRigidbody *addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                              std::vector<physx::PxVec3> const &normals,
+                              std::vector<uint32_t> const &indices, const physx::PxVec3 &scale,
+                              const physx::PxVec3 &color) override;
+  void removeRigidbody(IPxrRigidbody *body) override;
+
+  //========== Camera ==========//
+  ICamera *addCamera(uint32_t width, uint32_t height, float fovy, float near, float far,
+                     std::string const &shaderDir) override;
+  void removeCamera(ICamera *camera) override;
+  std::vector<ICamera *> getCameras() override;
+
+  //========== Light ==========//
+  void setAmbientLight(std::array<float, 3> const &color) override { mAmbientLight = color; }
+  std::array<float, 3> getAmbientLight() const override { return mAmbientLight; }
+  IPointLight *addPointLight(std::array<float, 3> const &position,
+                             std::array<float, 3> const &color, bool enableShadow,
+                             float shadowNear, float shadowFar, uint32_t shadowMapSize) override;
+  IDirectionalLight *addDirectionalLight(std::array<float, 3> const &direction,
+                                         std::array<float, 3> const &color, bool enableShadow,
+                                         std::array<float, 3> const &position, float shadowScale,
+                                         float shadowNear, float shadowFar,
+                                         uint32_t shadowMapSize) override;
+  ISpotLight *addSpotLight(std::array<float, 3> const &position,
+                           std::array<float, 3> const &direction, float fovInner,
+                           float fovOuter, std::array<float, 3> const &color, bool enableShadow,
+                           float shadowNear, float shadowFar, uint32_t shadowMapSize) override;
+  IActiveLight *addActiveLight(physx::PxTransform const &pose, std::array<float, 3> const &color,
+                               float fov, std::string_view texPath, float shadowNear,
+                               float shadowFar, uint32_t shadowMapSize) override;
+  void removeLight(ILight *light) override;
+
+  /** poses are read when a picture is taken, there is nothing to upload */
+  void updateRender() override {}
+  void updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) override;
+
+  void destroy() override;
+
+  inline SoftRenderer *getRenderer() const { return mRenderer; }
+
+  /** rasterize the scene into the images of the camera */
+  void render(SoftCamera &camera);
+
+private:
+  IPxrRigidbody *addBody(std::unique_ptr<SoftRigidbody> body);
+
+  SoftRenderer *mRenderer;
+  std::string mName;
+  std::array<float, 3> mAmbientLight{0.f, 0.f, 0.f};
+
+  std::vector<std::unique_ptr<SoftRigidbody>> mBodies;
+  std::vector<std::unique_ptr<SoftCamera>> mCameras;
+  std::vector<std::unique_ptr<ILight>> mLights;
+};
+
+/** CPU rasterizer for headless machines, renders depth, segmentation, normals and flat lit
+ *  color without a GPU.
+ *
+ *  Each picture transforms and clips the triangles of the visible bodies, sorts them into
+ *  screen tiles and rasterizes the tiles in parallel on the TaskScheduler. Textures, shadows,
+ *  transparency and point bodies are not supported. */
+class SoftRenderer : public IPxrRenderer {
+public:
+  SoftRenderer();
+
+  IPxrScene *createScene(std::string const &name) override;
+  void removeScene(IPxrScene *scene) override;
+  std::shared_ptr<IPxrMaterial> createMaterial() override;
+  std::shared_ptr<IRenderMesh> createMesh(std::vector<float> const &vertices,
+                                          std::vector<uint32_t> const &indices) override;
+
+  /** unit primitive meshes, the capsule depends on its proportions */
+  std::shared_ptr<SoftMesh> getPrimitiveMesh(physx::PxGeometryType::Enum type,
+                                             physx::PxVec3 const &scale);
+  /** shapes of a mesh file with new materials, the meshes are loaded once per renderer */
+  std::vector<std::shared_ptr<SoftShape>> loadFile(std::string const &filename);
+
+private:
+  std::vector<std::unique_ptr<SoftScene>> mScenes;
+
+  std::shared_ptr<SoftMesh> mCube;
+  std::shared_ptr<SoftMesh> mSphere;
+  std::shared_ptr<SoftMesh> mPlane;
+
+  std::mutex mFileMutex;
+  std::map<std::string, std::vector<std::pair<std::shared_ptr<SoftMesh>, std::array<float, 4>>>>
+      mFiles;
+};
+
+} // namespace Renderer
+} // namespace sapien
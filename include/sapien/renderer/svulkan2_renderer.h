@@ -117,7 +117,7 @@ public:
 
 #ifdef SAPIEN_DLPACK
   std::shared_ptr<IAwaitable<std::vector<DLManagedTensor *>>>
-  takePictureAndGetDLTensorsAsync(ThreadPool &thread,
+  takePictureAndGetDLTensorsAsync(TaskQueue &thread,
                                   std::vector<std::string> const &names) override;
 #endif
 
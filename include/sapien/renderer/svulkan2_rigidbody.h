@@ -48,6 +48,7 @@ public:
 
   physx::PxGeometryType::Enum getType() const override { return mType; }
   physx::PxVec3 getScale() const override;
+  void rescale(float factor) override;
 
   /** internal use only */
   void destroyVisualObjects();
@@ -54,8 +54,10 @@ protected:
   bool collisionRender{false};
   bool mHidden{false};
   float mDisplayVisibility{1.f};
+  PxReal mScale{1.f};
 
   int mDestroyedState{0};
+  uint8_t mPoseDirtyFlags{0};
 
   std::vector<StepCallback> mOnStepCallback;
   std::vector<ContactCallback> mOnContactCallback;
@@ -106,11 +108,24 @@ public:
   /** internal use only, destroy has several stages, check which stage it is in */
   inline int getDestroyedState() const { return mDestroyedState; }
 
+  /** the pose changed since the last updateRender (eRENDER) or packSceneIncremental (ePACK) */
+  enum PoseDirtyFlag : uint8_t { eRENDER = 1, ePACK = 2 };
+  /** internal use only, the scene keeps the moved actors in lists, the flags avoid duplicates */
+  inline uint8_t getPoseDirtyFlags() const { return mPoseDirtyFlags; }
+  inline void setPoseDirtyFlags(uint8_t flags) { mPoseDirtyFlags = flags; }
+  /** internal use only, called after the pose or velocity is set from outside the simulation */
+  void markPoseChanged();
+
   inline virtual std::vector<PxReal> packData() { return {}; };
   inline virtual void unpackData(std::vector<PxReal> const &data){};
 
   inline std::shared_ptr<ActorBuilder const> getBuilder() const { return mBuilder; }
 
+  /** uniform scale relative to the size given by the builder */
+  inline PxReal getScale() const { return mScale; }
+  /** internal use only, scale shapes, render bodies and mass, used by the actor pool */
+  virtual void rescale(PxReal factor);
+
   // callback from python
   void onContact(ContactCallback callback);
   void onStep(StepCallback callback);
@@ -142,6 +157,8 @@ public:
   void setCCDEnabled(bool enable);
   bool getCCDEnabled() const;
 
+  void rescale(PxReal factor) override;
+
 protected:
   using SActorBase::SActorBase;
 };
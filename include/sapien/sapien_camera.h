@@ -14,6 +14,10 @@ public:
 
   /** call update to sync camera pose to renderer */
   void update();
+  /** recompute the pose from the parent without syncing it to the renderer */
+  physx::PxTransform updatePose();
+  /** sync a pose returned by updatePose to the renderer */
+  void updateRender(physx::PxTransform const &pose);
 
   inline physx::PxTransform getPose() const override { return mPose; }
   inline physx::PxTransform getLocalPose(PxTransform const &pose) { return mLocalPose; }
@@ -31,6 +31,8 @@ public:
 
   /** call update to sync light pose to renderer */
   void update();
+  /** sync a pose returned by getPose to the renderer */
+  void updateRender(physx::PxTransform const &pose);
 
 private:
   PxTransform getParentPose() const;
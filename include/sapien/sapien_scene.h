@@ -19,10 +19,12 @@
 #include <thread>
 #include <vector>
 
+#include <condition_variable>
 #include <future>
 
 #include <PxPhysicsAPI.h>
 
+#include "arena_allocator.h"
 #include "event_system/event_system.h"
 #include "extension.h"
 #include "id_generator.h"
@@ -32,8 +34,9 @@
 #include "sapien_material.h"
 #include "sapien_scene_config.h"
 #include "simulation_callback.h"
+#include "telemetry.h"
 
-#include "thread_pool.hpp"
+#include "task_scheduler.h"
 
 namespace sapien {
 class SActor;
@@ -51,6 +54,7 @@ class ArticulationBuilder;
 class SDrive6D;
 class SDrive;
 class SGear;
+class BroadPhaseRegionManager;
 struct SContact;
 
 namespace Renderer {
@@ -122,7 +126,7 @@ private:
   std::shared_ptr<SPhysicalMaterial> mDefaultMaterial;
 
 public:
-  inline void setName(std::string const &name) { mName = name; }
+  void setName(std::string const &name);
   inline std::string getName() { return mName; }
   inline void setTimestep(PxReal step) { mTimestep = step; }
   inline PxReal getTimestep() { return mTimestep; }
@@ -131,9 +135,20 @@ public:
   std::future<void> stepAsync();
   std::future<void> multistepAsync(int steps, SceneMultistepCallback *callback);
 
+  /** memory PhysX currently holds for this scene */
+  ArenaMemoryStats getMemoryStats() const;
+  /** internal use only, PhysX allocations made in an ArenaAllocator::Scope of this arena are
+   * accounted to the scene */
+  inline ArenaAllocator::Arena *getMemoryArena() const { return mArena; }
+
+  /** step phase timers and contact counters, disabled until enabled */
+  inline SceneTelemetry &getTelemetry() { return mTelemetry; }
+
 private:
   PxReal mTimestep = 1 / 500.f;
   std::string mName;
+  ArenaAllocator::Arena *mArena{};
+  SceneTelemetry mTelemetry;
 
   /************************************************
    * Physical Objects
@@ -187,16 +202,71 @@ public:
 
   void wakeUpActor(SActorBase *actor);
 
+  /** scene policy for builders without an explicit aggregate setting */
+  inline bool getAggregateArticulations() const { return mConfig.aggregateArticulations; }
+  inline bool shouldAggregateActor(uint32_t shapeCount) const {
+    return mConfig.aggregateShapeThreshold && shapeCount >= mConfig.aggregateShapeThreshold;
+  }
+  /** number of PxAggregates owned by the scene */
+  inline uint32_t getAggregateCount() const {
+    return mActorAggregates.size() + mArticulationAggregates.size();
+  }
+
+  /** Actor pool
+   *
+   *  A parked actor or articulation is removed from the PxScene and its render bodies are
+   *  hidden, but its shapes, meshes and render bodies are kept. Unparking puts it back with a
+   *  new pose, which is much cheaper than building it again. Objects are pooled by a user tag,
+   *  all objects parked with the same tag should come from the same builder. Drives and gears
+   *  on parked objects are removed. Cameras mounted on a parked object stay where they are until
+   *  it is unparked, visuals hidden by hideVisual stay hidden after unparking. Removing a parked
+   *  object releases it and takes it out of the pool. Must not be called during a step.
+   */
+  void parkActor(SActorBase *actor, std::string const &tag);
+  /** returns nullptr if no actor is parked with tag
+   *  scale: uniform scale relative to the builder, material: applied to all collision shapes */
+  SActorBase *unparkActor(std::string const &tag, PxTransform const &pose, PxReal scale = 1.f,
+                          std::shared_ptr<SPhysicalMaterial> material = nullptr);
+  void parkArticulation(SArticulation *articulation, std::string const &tag);
+  /** returns nullptr if no articulation is parked with tag, joint velocities are reset */
+  SArticulation *unparkArticulation(std::string const &tag, PxTransform const &pose);
+  uint32_t getParkedCount(std::string const &tag) const;
+  /** release all parked objects */
+  void clearActorPool();
+
+  /** internal use only, the actor is updated by the next updateRender and packed by the next
+   * packSceneIncremental */
+  void markActorMoved(SActorBase *actor);
+  /** number of bodies the next updateRender will update */
+  inline uint32_t getMovedActorCount() const { return mRenderDirtyActors.size(); }
+
+  /** number of MBP regions, 0 for other broadphase types */
+  uint32_t getBroadPhaseRegionCount() const;
+  /** box covered by the MBP regions, empty for other broadphase types */
+  PxBounds3 getBroadPhaseWorldBounds() const;
+
 private:
-  void addActor(std::unique_ptr<SActorBase> actor); // called by actor builder
-  void
-  addArticulation(std::unique_ptr<SArticulation> articulation); // called by articulation builder
+  // called by actor builder, aggregate puts all shapes of the actor in a single broadphase entry
+  void addActor(std::unique_ptr<SActorBase> actor, bool aggregate = false);
+  // called by articulation builder, aggregate puts all links in a single broadphase entry
+  void addArticulation(std::unique_ptr<SArticulation> articulation, bool aggregate = false);
   void addKinematicArticulation(
       std::unique_ptr<SKArticulation> articulation); // called by articulation builder
 
   bool mRequiresRemoveCleanUp{false};
 
   void removeCleanUp();
+  void removeDrivesAndGears(SActorBase *actor);
+  // grow the MBP regions to fit the scene, called before simulate
+  void updateBroadPhaseRegions();
+  // wait for simulate, PhysX tasks may need the scheduler worker running the step
+  void fetchResults();
+  // mark the bodies PhysX reports as active and the links of awake articulations
+  void collectMovedActors();
+  // remove an actor leaving the scene from the moved lists
+  void forgetMovedActor(SActorBase *actor);
+  // update render bodies of moved actors, called by updateRender
+  void updateMovedRenderBodies();
 
   IDGenerator mActorIdGenerator;  // unique id generator for actors (including links)
   IDGenerator mRenderIdGenerator; //  unique id generator for visuals
@@ -209,11 +279,23 @@ private:
   std::vector<std::unique_ptr<SKArticulation>> mKinematicArticulations;
   std::vector<std::unique_ptr<SEntityParticle>> mParticlesEntities;
 
+  // actors moved since the last updateRender and packSceneIncremental, flagged in the actor
+  std::vector<SActorBase *> mRenderDirtyActors;
+  std::vector<SActorBase *> mPackDirtyActors;
+
   std::vector<std::unique_ptr<SLight>> mLights;
 
   std::vector<std::unique_ptr<SDrive>> mDrives;
   std::vector<std::unique_ptr<SGear>> mGears;
 
+  std::map<SActorBase *, PxAggregate *> mActorAggregates;
+  std::map<SArticulation *, PxAggregate *> mArticulationAggregates;
+
+  std::unique_ptr<BroadPhaseRegionManager> mBroadPhaseRegions;
+
+  std::map<std::string, std::vector<std::unique_ptr<SActorBase>>> mParkedActors;
+  std::map<std::string, std::vector<std::unique_ptr<SArticulation>>> mParkedArticulations;
+
   /************************************************
    * Sensor
    ***********************************************/
@@ -260,6 +342,31 @@ public:
   void updateRender();
   void updateRenderAndTakePictures(std::vector<SCamera *> const &cameras);
   std::future<void> updateRenderAsync();
+
+  /** with pipelining enabled, every step ends with captureRenderSnapshot so a frame can render
+   * from the snapshot while the next step runs. updateRender throws while enabled. */
+  void setRenderPipelining(bool enabled);
+  inline bool getRenderPipelining() const { return mRenderPipelining; }
+  /** copy the poses of the moved actors and links, the cameras and the lights into the back
+   * snapshot and make it the front one, waits while frames in flight still read the back one
+   *
+   *  A front snapshot no frame was submitted for is updated in place instead, so skipping frames
+   *  neither waits nor loses motion. Call it after moving cameras or lights between steps.
+   */
+  void captureRenderSnapshot();
+  /** render the front snapshot on the render queue: update the render bodies, cameras and lights
+   * from it, then take pictures with cameras. Returns the snapshot number, counted from 1.
+   *
+   *  Frames render in submission order. Read the pictures of a frame before submitting the next
+   *  one. Removing or parking objects waits for the frames in flight; wait for the returned
+   *  future before building objects or changing visuals.
+   */
+  std::future<uint64_t> renderSnapshotAsync(std::vector<SCamera *> const &cameras);
+  /** blocks until every frame submitted by renderSnapshotAsync is rendered */
+  void waitForRenderSnapshots();
+  /** number of the front snapshot, 0 before the first capture */
+  uint64_t getRenderSnapshotCount();
+
   SActorStatic *addGround(PxReal altitude, bool render = true,
                           std::shared_ptr<SPhysicalMaterial> material = nullptr,
                           std::shared_ptr<Renderer::IPxrMaterial> renderMaterial = nullptr,
@@ -267,14 +374,44 @@ public:
 
   std::map<physx_id_t, std::string> findRenderId2VisualName() const;
 
-  ThreadPool &getThread();
+  /** tasks of the scene (stepAsync, updateRenderAsync, camera readbacks) run in order here */
+  TaskQueue &getThread();
 
   SceneConfig getConfig() const { return mConfig; }
 
 private:
   void removeCameraByParent(SActorBase *actor);
+  // detach cameras mounted on a parked actor and mount them again when it is unparked
+  void parkCameras(SActorBase *actor);
+  void unparkCameras(SActorBase *actor);
+  // remove the cameras detached from a parked actor, as removeCameraByParent would
+  void removeParkedCameras(SActorBase *actor);
+  // release the PhysX objects and bodies of a parked object, the caller erases it from the pool
+  void releaseParkedActor(SActorBase *actor);
+  void releaseParkedArticulation(SArticulation *articulation);
 
   std::vector<std::unique_ptr<SCamera>> mCameras;
+  // cameras detached from parked actors, with their pose relative to the actor
+  std::map<SActorBase *, std::vector<std::pair<SCamera *, PxTransform>>> mParkedCameras;
+
+  struct RenderSnapshot {
+    uint64_t number{};
+    std::vector<std::pair<SActorBase *, PxTransform>> bodies;
+    std::vector<std::pair<SCamera *, PxTransform>> cameras;
+    std::vector<std::pair<SLight *, PxTransform>> lights;
+    uint32_t readers{};   // frames in flight rendering this snapshot
+    bool submitted{true}; // a frame was submitted for this snapshot
+  };
+  // drop an object leaving the scene from both snapshots, wait for the frames in flight first
+  void forgetSnapshotEntity(SEntity *entity);
+
+  bool mRenderPipelining{};
+  RenderSnapshot mRenderSnapshots[2];
+  uint32_t mFrontRenderSnapshot{};
+  uint64_t mRenderSnapshotCount{};
+  std::mutex mRenderSnapshotMutex;
+  std::condition_variable mRenderSnapshotReleased;
+  TaskQueue mRenderQueue;
 
   /************************************************
    * Contact
@@ -284,6 +421,13 @@ public:
   std::vector<SContact *> getContacts() const;
 
   SceneData packScene();
+  /** pack only the bodies that moved or were written since the previous call
+   *
+   *  Newly added bodies count as moved. An articulation is packed whole, with its drives, when
+   *  any link moved. Unpacking the result on a scene in the previously packed state gives the
+   *  current state, so the first call on a new scene packs everything.
+   */
+  SceneData packSceneIncremental();
   void unpackScene(SceneData const &data);
 
 private:
@@ -291,10 +435,12 @@ private:
 
   std::map<std::pair<PxShape *, PxShape *>, std::unique_ptr<SContact>> mContacts;
 
-  ThreadPool mRunnerThread{1};
+  TaskQueue mRunnerQueue;
   std::mutex mUpdateRenderMutex;
 
+  /** PhysX tasks run on the calling thread, or on the task scheduler with Engine thread_count */
   PxDefaultCpuDispatcher *mCpuDispatcher = nullptr;
+  std::unique_ptr<PxCpuDispatcher> mTaskDispatcher;
   bool mDisableCollisionVisual{};
 };
 } // namespace sapien
@@ -1,5 +1,6 @@
 #pragma once
 #include <eigen3/Eigen/Eigen>
+#include <string>
 
 namespace sapien {
 
@@ -21,5 +22,11 @@ struct SceneConfig {
       true;                         // better friction calculation, recommended for robotics
   bool enableAdaptiveForce = false; // improve solver convergence
   bool disableCollisionVisual = false;   // do not create visual shapes for collisions
+  bool aggregateArticulations = false;   // one broadphase entry (PxAggregate) per articulation
+  uint32_t aggregateShapeThreshold = 0;  // aggregate actors with at least this many shapes, 0: off
+  std::string broadPhase = "sap";        // "sap" (sweep and prune), "mbp" (multi box) or "abp"
+  Eigen::Vector3f mbpWorldLower = {-50, -50, -10}; // minimum MBP world, grown to fit the scene
+  Eigen::Vector3f mbpWorldUpper = {50, 50, 10};
+  uint32_t mbpSubdivisions = 8; // MBP regions per horizontal axis, at most 11
 };
 } // namespace sapien
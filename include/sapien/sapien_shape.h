@@ -88,6 +88,9 @@ public:
   std::string getType() const;
   std::shared_ptr<SGeometry> getGeometry() const;
 
+  /** scale the geometry and the local position, used by the actor pool */
+  void rescale(physx::PxReal factor);
+
   SCollisionShape(SCollisionShape const &) = delete;
   SCollisionShape(SCollisionShape &&) = default;
   SCollisionShape &operator=(SCollisionShape const &) = delete;
@@ -0,0 +1,72 @@
+#pragma once
+#include "id_generator.h"
+#include <PxPhysicsAPI.h>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace sapien {
+class SScene;
+struct SceneData;
+
+struct SceneDeltaConfig {
+  /** positions as integer multiples of positionResolution, rotations as 16 bit smallest-three */
+  bool quantize{false};
+  physx::PxReal positionResolution{1e-4f};
+  /** actor poses, articulation root poses and qpos only, enough for visualization; otherwise
+   * the full packScene state including velocities and drives */
+  bool poseOnly{false};
+};
+
+/** Produces compact binary diffs of the state of a scene between snapshot generations
+ *
+ *  capture() takes the bodies that moved or were written since the previous capture (see
+ *  SScene::packSceneIncremental), so sleeping bodies cost nothing. A body whose encoded state
+ *  did not change, e.g. below the quantization resolution, keeps its generation. encode(base)
+ *  writes every body changed after generation base with its latest state, so a receiver that
+ *  applied any earlier diff catches up with one diff and no history is kept.
+ *
+ *  The encoder takes over the incremental pack of the scene, use one encoder per scene. The
+ *  receiving scene must contain the same objects with the same ids, e.g. a copy built in the
+ *  same order. Removed bodies are not reported. Values are written in host byte order.
+ */
+class SceneDeltaEncoder {
+public:
+  /** the current state of all bodies becomes generation 1 */
+  explicit SceneDeltaEncoder(SScene &scene, SceneDeltaConfig const &config = {});
+
+  /** record the changes since the previous capture as a new generation and return it */
+  uint64_t capture();
+  inline uint64_t getGeneration() const { return mGeneration; }
+  /** number of bodies changed in the last capture */
+  inline uint32_t getLastChangedCount() const { return mLastChangedCount; }
+
+  /** diff from generation base to the current generation, base 0 encodes every body */
+  std::vector<uint8_t> encode(uint64_t base) const;
+
+private:
+  struct Record {
+    uint64_t generation;
+    /** kind, id and payload as written to the diff */
+    std::vector<uint8_t> bytes;
+  };
+
+  void ingest(SceneData const &data);
+  void update(uint64_t key, std::vector<uint8_t> bytes);
+
+  SScene &mScene;
+  SceneDeltaConfig mConfig;
+  uint64_t mGeneration{0};
+  uint32_t mLastChangedCount{0};
+
+  /** ordered by generation, the latest last, so encode visits changed records only */
+  std::list<Record> mRecords;
+  std::unordered_map<uint64_t, std::list<Record>::iterator> mRecordIndex;
+};
+
+/** Apply a diff made by SceneDeltaEncoder::encode, returns the generation it brings the scene
+ *  to. Throws on malformed input; bodies missing from the scene are skipped. */
+uint64_t applySceneDelta(SScene &scene, uint8_t const *data, size_t size);
+
+} // namespace sapien
@@ -63,6 +63,11 @@ public:
   void setRenderer(std::shared_ptr<Renderer::IPxrRenderer> renderer);
 
   inline MeshManager &getMeshManager() { return mMeshManager; }
+  /** threads PhysX may use for one scene step, 0: the stepping thread only */
+  inline uint32_t getThreadCount() const { return mThreadCount; }
+
+  /** memory held by PhysX, per scene and in total */
+  MemoryStats getMemoryStats() const;
   void setLogLevel(std::string const &level);
 
 #ifdef _PVD
@@ -0,0 +1,289 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sapien {
+
+/** move-only void() callable, callables up to kInlineSize bytes are stored without allocating */
+class Task {
+public:
+  static constexpr size_t kInlineSize = 48;
+
+  Task() = default;
+
+  template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+  Task(F &&f) {
+    using T = std::decay_t<F>;
+    if constexpr (sizeof(T) <= kInlineSize && alignof(T) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<T>) {
+      new (mStorage) T(std::forward<F>(f));
+      mOps = &InlineOps<T>::ops;
+    } else {
+      *reinterpret_cast<T **>(mStorage) = new T(std::forward<F>(f));
+      mOps = &HeapOps<T>::ops;
+    }
+  }
+
+  Task(Task &&other) noexcept : mOps(other.mOps) {
+    if (mOps) {
+      mOps->move(mStorage, other.mStorage);
+      other.mOps = nullptr;
+    }
+  }
+
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      reset();
+      mOps = other.mOps;
+      if (mOps) {
+        mOps->move(mStorage, other.mStorage);
+        other.mOps = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  Task(Task const &) = delete;
+  Task &operator=(Task const &) = delete;
+  ~Task() { reset(); }
+
+  inline explicit operator bool() const { return mOps; }
+  inline void operator()() { mOps->invoke(mStorage); }
+
+  void reset() {
+    if (mOps) {
+      mOps->destroy(mStorage);
+      mOps = nullptr;
+    }
+  }
+
+private:
+  struct Ops {
+    void (*invoke)(void *);
+    void (*move)(void *dst, void *src);
+    void (*destroy)(void *);
+  };
+
+  template <typename T> struct InlineOps {
+    static constexpr Ops ops = {
+        [](void *p) { (*static_cast<T *>(p))(); },
+        [](void *dst, void *src) {
+          new (dst) T(std::move(*static_cast<T *>(src)));
+          static_cast<T *>(src)->~T();
+        },
+        [](void *p) { static_cast<T *>(p)->~T(); }};
+  };
+
+  template <typename T> struct HeapOps {
+    static constexpr Ops ops = {
+        [](void *p) { (**static_cast<T **>(p))(); },
+        [](void *dst, void *src) { *static_cast<T **>(dst) = *static_cast<T **>(src); },
+        [](void *p) { delete *static_cast<T **>(p); }};
+  };
+
+  alignas(std::max_align_t) unsigned char mStorage[kInlineSize];
+  Ops const *mOps{nullptr};
+};
+
+struct TaskSchedulerConfig {
+  /** worker threads, 0: one per hardware thread */
+  uint32_t threadCount{0};
+  /** pin worker i to CPU i (Linux only) */
+  bool pinThreads{false};
+};
+
+/** Work-stealing task scheduler shared by the whole process
+ *
+ *  Each worker owns a lock-free deque (Chase-Lev), pushes the tasks it spawns to the bottom and
+ *  pops them LIFO; idle workers steal from the top of other deques. Tasks submitted from
+ *  threads outside the scheduler go to a shared injection queue. Idle workers sleep on an
+ *  atomic wait. Waiting on a TaskGroup or parallelFor from a worker runs other tasks meanwhile,
+ *  so nested parallelism does not deadlock.
+ */
+class TaskScheduler {
+public:
+  /** the process-wide scheduler, started on first use and never destroyed */
+  static TaskScheduler &Get();
+  /** configures Get(), throws if it is already started */
+  static void Configure(TaskSchedulerConfig const &config);
+
+  explicit TaskScheduler(TaskSchedulerConfig const &config = {});
+  ~TaskScheduler();
+  TaskScheduler(TaskScheduler const &) = delete;
+  TaskScheduler &operator=(TaskScheduler const &) = delete;
+
+  inline uint32_t getWorkerCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+  /** index of the calling worker of this scheduler, -1 on other threads */
+  int getCurrentWorkerIndex() const;
+
+  /** run task on some worker, fire and forget */
+  void spawn(Task task);
+
+  template <typename F, typename... Args>
+  auto submit(F &&f, Args &&...args) -> std::future<std::invoke_result_t<F, Args...>> {
+    using R = std::invoke_result_t<F, Args...>;
+    std::packaged_task<R()> task(
+        [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable {
+          return std::invoke(std::move(f), std::move(args)...);
+        });
+    auto future = task.get_future();
+    spawn(std::move(task));
+    return future;
+  }
+
+  /** run one pending task on the calling thread, returns false if none was found */
+  bool runPendingTask();
+
+  /** calls f(i) for i in [begin, end), chunks of grainSize indices run in parallel
+   *  grainSize 0 picks about 4 chunks per worker, the calling thread takes part */
+  template <typename F>
+  void parallelFor(int64_t begin, int64_t end, F const &f, int64_t grainSize = 0);
+
+private:
+  struct Worker;
+  struct Queue;
+
+  void workerMain(uint32_t index);
+  Task *findTask(int self);
+  void wake();
+
+  std::vector<std::unique_ptr<Worker>> mWorkers;
+  std::unique_ptr<Queue> mInjection;
+
+  std::atomic<uint32_t> mEpoch{0};
+  std::atomic<uint32_t> mSleeping{0};
+  std::atomic<bool> mStop{false};
+};
+
+/** Tasks run through a TaskScheduler, wait() blocks until all of them completed
+ *
+ *  The first exception thrown by a task is rethrown by wait().
+ */
+class TaskGroup {
+public:
+  explicit TaskGroup(TaskScheduler &scheduler = TaskScheduler::Get()) : mScheduler(scheduler) {}
+  ~TaskGroup() { waitNoThrow(); }
+  TaskGroup(TaskGroup const &) = delete;
+  TaskGroup &operator=(TaskGroup const &) = delete;
+
+  template <typename F> void run(F &&f) {
+    mPending.fetch_add(1, std::memory_order_relaxed);
+    mScheduler.spawn([this, f = std::forward<F>(f)]() mutable {
+      std::exception_ptr exception;
+      try {
+        f();
+      } catch (...) {
+        exception = std::current_exception();
+      }
+      finish(exception);
+    });
+  }
+
+  void wait();
+
+private:
+  void finish(std::exception_ptr exception);
+  void waitNoThrow();
+
+  TaskScheduler &mScheduler;
+  std::atomic<uint32_t> mPending{0};
+  std::mutex mMutex;
+  std::condition_variable mDone;
+  std::exception_ptr mException;
+};
+
+/** Runs submitted tasks one at a time in submission order on a TaskScheduler
+ *
+ *  Replaces a dedicated thread per scene, the tasks of many queues share the scheduler workers.
+ *  The destructor waits for the submitted tasks.
+ */
+class TaskQueue {
+public:
+  explicit TaskQueue(TaskScheduler &scheduler = TaskScheduler::Get()) : mScheduler(scheduler) {}
+  ~TaskQueue() { wait(); }
+  TaskQueue(TaskQueue const &) = delete;
+  TaskQueue &operator=(TaskQueue const &) = delete;
+
+  /** blocks until every submitted task completed */
+  void wait();
+  /** submitted tasks not started yet */
+  size_t getPendingCount();
+
+  template <typename F, typename... Args>
+  auto submit(F &&f, Args &&...args) -> std::future<std::invoke_result_t<F, Args...>> {
+    using R = std::invoke_result_t<F, Args...>;
+    std::packaged_task<R()> task(
+        [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable {
+          return std::invoke(std::move(f), std::move(args)...);
+        });
+    auto future = task.get_future();
+    enqueue(std::move(task));
+    return future;
+  }
+
+private:
+  void enqueue(Task task);
+  void drain();
+
+  TaskScheduler &mScheduler;
+  std::mutex mMutex;
+  std::condition_variable mIdle;
+  std::deque<Task> mTasks;
+  bool mRunning{false};
+};
+
+template <typename F>
+void TaskScheduler::parallelFor(int64_t begin, int64_t end, F const &f, int64_t grainSize) {
+  if (end <= begin) {
+    return;
+  }
+  int64_t count = end - begin;
+  if (grainSize <= 0) {
+    grainSize = std::max<int64_t>(1, count / (4 * (getWorkerCount() + 1)));
+  }
+  if (count <= grainSize) {
+    for (int64_t i = begin; i < end; ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  TaskGroup group(*this);
+  // the first chunk runs on the calling thread
+  for (int64_t b = begin + grainSize; b < end; b += grainSize) {
+    int64_t e = std::min(end, b + grainSize);
+    group.run([&f, b, e]() {
+      for (int64_t i = b; i < e; ++i) {
+        f(i);
+      }
+    });
+  }
+  std::exception_ptr exception;
+  try {
+    for (int64_t i = begin; i < begin + grainSize; ++i) {
+      f(i);
+    }
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  group.wait();
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+} // namespace sapien
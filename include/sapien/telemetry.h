@@ -0,0 +1,148 @@
+#pragma once
+#include <PxPhysicsAPI.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sapien {
+
+enum class TelemetryPhase : uint32_t {
+  ePRESTEP,
+  eCLEANUP,
+  eSIMULATE,
+  eFETCH_RESULTS,
+  eEVENT_DISPATCH,
+  eUPDATE_RENDER,
+  ePACK_SCENE,
+  eUNPACK_SCENE,
+  eCOUNT
+};
+
+char const *getTelemetryPhaseName(TelemetryPhase phase);
+/** throws if name is not a phase name */
+TelemetryPhase getTelemetryPhaseByName(std::string const &name);
+
+struct TelemetryPhaseStats {
+  uint64_t count{0};
+  uint64_t totalNs{0};
+  uint64_t lastNs{0};
+  uint64_t maxNs{0};
+  /** percentiles over the rolling window */
+  uint64_t p50Ns{0};
+  uint64_t p90Ns{0};
+  uint64_t p99Ns{0};
+};
+
+struct TelemetrySnapshot {
+  uint64_t steps{0};
+  /** reported through the contact callback, in total and in the last step */
+  uint64_t contactPairs{0};
+  uint64_t contactPoints{0};
+  uint64_t lastStepContactPairs{0};
+  uint64_t lastStepContactPoints{0};
+  std::map<std::string, TelemetryPhaseStats> phases;
+  /** PxSimulationStatistics of the last step */
+  std::map<std::string, uint64_t> simulationStatistics;
+};
+
+/** Per-scene counters, timers and trace events
+ *
+ *  Disabled by default. When disabled every hook is a single relaxed atomic load, no clock is
+ *  read. Timers keep a rolling window of the last kWindowSize durations per phase for
+ *  percentiles and histograms. With tracing enabled the last kTraceCapacity timed sections are
+ *  kept and can be written as a Chrome trace (chrome://tracing, Perfetto).
+ */
+class SceneTelemetry {
+  using Clock = std::chrono::steady_clock;
+
+public:
+  static constexpr uint32_t kWindowSize = 1024;
+  static constexpr uint32_t kTraceCapacity = 1 << 16;
+  static constexpr uint32_t kHistogramBuckets = 40;
+
+  /** times the enclosing block as phase */
+  class Timer {
+  public:
+    inline Timer(SceneTelemetry &telemetry, TelemetryPhase phase)
+        : mTelemetry(telemetry.isEnabled() ? &telemetry : nullptr), mPhase(phase) {
+      if (mTelemetry) {
+        mStart = Clock::now();
+      }
+    }
+    inline ~Timer() {
+      if (mTelemetry) {
+        mTelemetry->record(mPhase, mStart, Clock::now());
+      }
+    }
+    Timer(Timer const &) = delete;
+    Timer &operator=(Timer const &) = delete;
+
+  private:
+    SceneTelemetry *mTelemetry;
+    TelemetryPhase mPhase;
+    Clock::time_point mStart;
+  };
+
+  SceneTelemetry();
+
+  inline bool isEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+  void setEnabled(bool enabled, bool trace = false);
+  void reset();
+
+  inline void addContacts(uint64_t pairs, uint64_t points) {
+    if (isEnabled()) {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStepContactPairs += pairs;
+      mStepContactPoints += points;
+    }
+  }
+  /** called after fetchResults, counts the step and reads the simulation statistics */
+  void endStep(physx::PxScene &scene);
+
+  TelemetrySnapshot getSnapshot() const;
+  /** rolling window of phase, bucket i counts durations in [2^i, 2^(i+1)) nanoseconds */
+  std::vector<uint64_t> getHistogram(TelemetryPhase phase) const;
+  void exportChromeTrace(std::string const &filename, std::string const &processName) const;
+
+private:
+  struct PhaseData {
+    TelemetryPhaseStats stats;
+    std::array<uint64_t, kWindowSize> window{};
+    uint32_t windowSize{0};
+    uint32_t windowNext{0};
+  };
+  struct TraceEvent {
+    TelemetryPhase phase;
+    uint32_t thread;
+    uint64_t startNs;
+    uint64_t durationNs;
+  };
+
+  void record(TelemetryPhase phase, Clock::time_point start, Clock::time_point end);
+
+  std::atomic<bool> mEnabled{false};
+  bool mTrace{false};
+  Clock::time_point mEpoch;
+
+  mutable std::mutex mMutex;
+  std::array<PhaseData, static_cast<size_t>(TelemetryPhase::eCOUNT)> mPhases;
+  uint64_t mSteps{0};
+  uint64_t mContactPairs{0};
+  uint64_t mContactPoints{0};
+  uint64_t mStepContactPairs{0};
+  uint64_t mStepContactPoints{0};
+  uint64_t mLastStepContactPairs{0};
+  uint64_t mLastStepContactPoints{0};
+  physx::PxSimulationStatistics mSimulationStatistics{};
+
+  /** ring buffer of kTraceCapacity events */
+  std::vector<TraceEvent> mTraceEvents;
+  uint32_t mTraceNext{0};
+};
+
+} // namespace sapien
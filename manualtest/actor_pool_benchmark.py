@@ -0,0 +1,73 @@
+"""Episode reset time when objects are destroyed and rebuilt, compared to parking and
+unparking them with the actor pool.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+ROBOT = "../assets/robot/panda/panda.urdf"
+N_OBJECTS = 50
+EPISODES = 50
+
+
+def make_builder(scene):
+    builder = scene.create_actor_builder()
+    for j in range(8):
+        builder.add_box_collision(sapien.Pose([0, 0, j * 0.05]), [0.02, 0.02, 0.02])
+        builder.add_box_visual(sapien.Pose([0, 0, j * 0.05]), [0.02, 0.02, 0.02])
+    return builder
+
+
+def random_pose():
+    return sapien.Pose([*np.random.uniform(-1, 1, 2), 0.2])
+
+
+def rebuild(scene, builder, loader):
+    actors = [builder.build() for _ in range(N_OBJECTS)]
+    robot = loader.load(ROBOT)
+    for _ in range(EPISODES):
+        for actor in actors:
+            scene.remove_actor(actor)
+        scene.remove_articulation(robot)
+        actors = [builder.build() for _ in range(N_OBJECTS)]
+        for actor in actors:
+            actor.set_pose(random_pose())
+        robot = loader.load(ROBOT)
+        scene.step()
+
+
+def pooled(scene, builder, loader):
+    actors = [builder.build() for _ in range(N_OBJECTS)]
+    robot = loader.load(ROBOT)
+    for _ in range(EPISODES):
+        for actor in actors:
+            scene.park_actor(actor, "object")
+        scene.park_articulation(robot, "robot")
+        actors = [
+            scene.unpark_actor("object", random_pose(), np.random.uniform(0.8, 1.2))
+            for _ in range(N_OBJECTS)
+        ]
+        robot = scene.unpark_articulation("robot", sapien.Pose())
+        scene.step()
+
+
+def main():
+    engine = sapien.Engine()
+    renderer = sapien.VulkanRenderer(offscreen_only=True)
+    engine.set_renderer(renderer)
+    for name, reset in [("rebuild", rebuild), ("pool", pooled)]:
+        scene = engine.create_scene()
+        scene.add_ground(0)
+        builder = make_builder(scene)
+        loader = scene.create_urdf_loader()
+        start = time.perf_counter()
+        reset(scene, builder, loader)
+        elapsed = time.perf_counter() - start
+        print("{:<8} reset {:.3f} ms".format(name, elapsed / EPISODES * 1e3))
+
+
+if __name__ == "__main__":
+    main()
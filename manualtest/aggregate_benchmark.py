@@ -0,0 +1,65 @@
+"""Step time of a scene with 100 robots and 100 convex-decomposed objects, with and without
+PxAggregate grouping.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+ROBOT = "../assets/robot/panda/panda.urdf"
+N_ROBOTS = 100
+N_OBJECTS = 100
+N_PIECES = 20
+STEPS = 500
+
+
+def build_scene(engine, aggregate):
+    config = sapien.SceneConfig()
+    config.aggregate_articulations = aggregate
+    config.aggregate_shape_threshold = 2 if aggregate else 0
+    scene = engine.create_scene(config)
+    scene.set_timestep(1 / 240)
+    scene.add_ground(0)
+
+    loader = scene.create_urdf_loader()
+    loader.fix_root_link = True
+    side = int(np.ceil(np.sqrt(N_ROBOTS)))
+    for i in range(N_ROBOTS):
+        robot = loader.load(ROBOT)
+        robot.set_root_pose(sapien.Pose([i % side * 1.5, i // side * 1.5, 0]))
+        robot.set_qpos(np.random.uniform(-0.5, 0.5, robot.dof))
+        robot.set_drive_target(robot.get_qpos())
+
+    # an object split into many small boxes, like a convex decomposition
+    builder = scene.create_actor_builder()
+    for j in range(N_PIECES):
+        builder.add_box_collision(
+            sapien.Pose([j % 5 * 0.02, j // 5 * 0.02, 0]), [0.01, 0.01, 0.01]
+        )
+    for i in range(N_OBJECTS):
+        actor = builder.build()
+        actor.set_pose(sapien.Pose([i % side * 1.5 + 0.5, i // side * 1.5 + 0.5, 0.05]))
+    return scene
+
+
+def main():
+    engine = sapien.Engine()
+    for aggregate in [False, True]:
+        scene = build_scene(engine, aggregate)
+        for _ in range(10):
+            scene.step()
+        start = time.perf_counter()
+        for _ in range(STEPS):
+            scene.step()
+        elapsed = time.perf_counter() - start
+        print(
+            "aggregate={:<5} aggregates={:<4} step {:.3f} ms".format(
+                str(aggregate), scene.aggregate_count, elapsed / STEPS * 1e3
+            )
+        )
+
+
+if __name__ == "__main__":
+    main()
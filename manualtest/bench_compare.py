@@ -0,0 +1,50 @@
+"""Compare two sapien_bench JSON outputs and report the change of every benchmark.
+
+    python bench_compare.py baseline.json current.json [--metric p50_us] [--threshold 0.1]
+
+Exits with status 1 when a benchmark is slower than the baseline by more than the threshold.
+
+Run from the manualtest directory.
+"""
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        return {b["id"]: b for b in json.load(f)["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--metric", default="p50_us")
+    parser.add_argument("--threshold", type=float, default=0.1)
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    for id, b in current.items():
+        if id not in baseline:
+            print("{:<44} {:>12.1f} (new)".format(id, b[args.metric]))
+            continue
+        before = baseline[id][args.metric]
+        after = b[args.metric]
+        change = (after - before) / before if before > 0 else 0
+        flag = ""
+        if change > args.threshold:
+            flag = "REGRESSION"
+            regressions += 1
+        print("{:<44} {:>12.1f} {:>12.1f} {:>+8.1%} {}".format(id, before, after, change, flag))
+    for id in baseline.keys() - current.keys():
+        print("{:<44} (missing)".format(id))
+
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
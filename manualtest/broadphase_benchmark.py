@@ -0,0 +1,57 @@
+"""Step time of sweep and prune, multi box pruning and automatic box pruning broadphases, for
+boxes packed in a small area and spread over a warehouse-sized floor.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+N_BOXES = 4000
+STEPS = 300
+LAYOUTS = {"clustered": 20, "spread": 400}
+
+
+def build_scene(engine, broadphase, size):
+    config = sapien.SceneConfig()
+    config.broadphase = broadphase
+    scene = engine.create_scene(config)
+    scene.set_timestep(1 / 240)
+    scene.add_ground(0)
+
+    builder = scene.create_actor_builder()
+    builder.add_box_collision(half_size=[0.1, 0.1, 0.1])
+    rng = np.random.RandomState(0)
+    for _ in range(N_BOXES):
+        box = builder.build()
+        x, y = rng.uniform(-size / 2, size / 2, 2)
+        box.set_pose(sapien.Pose([x, y, rng.uniform(0.1, 5)]))
+        # keep the boxes awake so the broadphase sees moving objects
+        box.set_velocity(rng.uniform(-2, 2, 3))
+    return scene
+
+
+def main():
+    engine = sapien.Engine()
+    for layout, size in LAYOUTS.items():
+        for broadphase in ["sap", "mbp", "abp"]:
+            scene = build_scene(engine, broadphase, size)
+            for _ in range(10):
+                scene.step()
+            start = time.perf_counter()
+            for _ in range(STEPS):
+                scene.step()
+            elapsed = time.perf_counter() - start
+            print(
+                "{:<10} {}  regions={:<4} step {:.3f} ms".format(
+                    layout,
+                    broadphase,
+                    scene.broadphase_region_count,
+                    elapsed / STEPS * 1e3,
+                )
+            )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,48 @@
+"""Generate an SRDF with disabled collision pairs for a URDF.
+
+The SRDF is written next to the URDF, where the URDF loader picks it up. Prints the reduction of
+link and shape pairs reaching the narrowphase.
+
+Usage: python generate_srdf.py robot.urdf [sample_count]
+"""
+import os
+import sys
+import time
+
+import sapien.core as sapien
+
+
+def main():
+    urdf = sys.argv[1]
+    sample_count = int(sys.argv[2]) if len(sys.argv) > 2 else 1000
+
+    engine = sapien.Engine()
+    scene = engine.create_scene()
+    loader = scene.create_urdf_loader()
+    robot = loader.load(urdf)
+
+    start = time.perf_counter()
+    pairs = robot.generate_disabled_collision_pairs(sample_count=sample_count)
+    elapsed = time.perf_counter() - start
+    robot.apply_disabled_collision_pairs(pairs)
+
+    print("samples:          {} ({:.2f}s)".format(pairs.sample_count, elapsed))
+    print("adjacent:         {}".format(len(pairs.adjacent)))
+    print("always colliding: {}".format(len(pairs.always_colliding)))
+    print("never colliding:  {}".format(len(pairs.never_colliding)))
+    print("link pairs:       {} -> {}".format(
+        pairs.candidate_pairs, pairs.candidate_pairs - pairs.disabled_pairs))
+    print("shape pairs:      {} -> {}".format(
+        pairs.candidate_shape_pairs, pairs.candidate_shape_pairs - pairs.disabled_shape_pairs))
+
+    srdf = os.path.splitext(urdf)[0] + ".srdf"
+    if os.path.exists(srdf):
+        print("{} exists, not overwriting".format(srdf))
+        return
+    with open(srdf, "w") as f:
+        f.write(pairs.to_srdf(robot.name))
+    print("written to {}".format(srdf))
+
+
+if __name__ == "__main__":
+    main()
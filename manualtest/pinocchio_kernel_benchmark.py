@@ -0,0 +1,59 @@
+"""Per-call latency of PinocchioModel kinematics with and without the fixed-DOF kernel.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+ROBOTS = [
+    "../assets/robot/xarm7/xarm7.urdf",
+    "../assets/robot/panda/panda.urdf",
+    "../assets/robot/kinova_gen3/kinova_gen3.urdf",
+]
+N = 10000
+
+
+def timeit(fn, n=N):
+    fn()
+    start = time.perf_counter()
+    for _ in range(n):
+        fn()
+    return (time.perf_counter() - start) / n * 1e6
+
+
+def benchmark(model, robot):
+    dof = robot.dof
+    ee = len(robot.get_links()) - 1
+    limits = np.clip(robot.get_qlimits(), -np.pi, np.pi)
+    qpos = np.random.uniform(limits[:, 0], limits[:, 1])
+    model.compute_forward_kinematics(qpos)
+    target = model.get_link_pose(ee)
+    init = qpos + np.random.uniform(-0.05, 0.05, dof)
+
+    fk = timeit(lambda: model.compute_forward_kinematics(qpos))
+    jac = timeit(lambda: model.compute_single_link_local_jacobian(qpos, ee))
+    clik = timeit(
+        lambda: model.compute_inverse_kinematics(
+            ee, target, initial_qpos=init, eps=0, max_iterations=1
+        )
+    )
+    return fk, jac, clik
+
+
+engine = sapien.Engine()
+scene = engine.create_scene()
+loader = scene.create_urdf_loader()
+loader.fix_root_link = True
+
+print(f"{'robot':<16}{'kernel':<20}{'FK (us)':>10}{'Jac (us)':>10}{'CLIK it (us)':>14}")
+for filename in ROBOTS:
+    robot = loader.load(filename)
+    model = robot.create_pinocchio_model()
+    name = filename.split("/")[-1].split(".")[0]
+    for enabled, single in [(False, False), (True, False), (True, True)]:
+        model.set_fixed_dof_kernel_enabled(enabled, single)
+        fk, jac, clik = benchmark(model, robot)
+        print(f"{name:<16}{model.kinematics_kernel:<20}{fk:>10.2f}{jac:>10.2f}{clik:>14.2f}")
+    scene.remove_articulation(robot)
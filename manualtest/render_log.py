@@ -0,0 +1,71 @@
+"""Simulate falling boxes with a render log recorder instead of a renderer, then replay the log
+into a SapienRenderer and count the segmentation pixels of every picture.
+
+Recording needs no GPU, so the two halves can run on different machines.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+LOG = "render_log.bin"
+N_BOXES = 50
+N_STEPS = 600
+PICTURE_EVERY = 20
+
+
+def record():
+    engine = sapien.Engine()
+    recorder = sapien.RenderLogRecorder(LOG)
+    engine.set_renderer(recorder)
+
+    scene = engine.create_scene()
+    scene.set_timestep(1 / 240)
+    scene.add_ground(0)
+    scene.set_ambient_light([0.5, 0.5, 0.5])
+    scene.add_directional_light([0, 1, -1], [0.5, 0.5, 0.5])
+    for i in range(N_BOXES):
+        builder = scene.create_actor_builder()
+        builder.add_box_collision(half_size=[0.05, 0.05, 0.05])
+        builder.add_box_visual(half_size=[0.05, 0.05, 0.05], color=[1, i / N_BOXES, 0])
+        box = builder.build()
+        box.set_pose(sapien.Pose([(i % 10) * 0.12, (i // 10) * 0.12, 0.5 + i * 0.01]))
+    camera = scene.add_camera("cam", 256, 256, 1, 0.01, 10)
+    camera.set_local_pose(sapien.Pose([-2, 0.5, 1], [0.9659, 0, 0.2588, 0]))
+
+    start = time.time()
+    for step in range(N_STEPS):
+        scene.step()
+        scene.update_render()
+        if step % PICTURE_EVERY == 0:
+            camera.take_picture()
+    elapsed = time.time() - start
+
+    scene = None
+    recorder.flush()
+    print(f"recorded {N_STEPS} steps in {elapsed:.2f}s, {recorder.bytes_written} bytes")
+
+
+def replay():
+    renderer = sapien.SapienRenderer(offscreen_only=True)
+    replayer = sapien.RenderLogReplayer(LOG, renderer)
+
+    pictures = []
+
+    def on_picture(scene_index, camera_index, frame):
+        seg = replayer.get_uint32_texture(scene_index, camera_index, "Segmentation")
+        pictures.append((frame, len(np.unique(seg[..., 1]))))
+
+    replayer.set_picture_callback(on_picture)
+    start = time.time()
+    frames = replayer.run()
+    elapsed = time.time() - start
+    print(f"replayed {frames} frames in {elapsed:.2f}s")
+    for frame, actors in pictures:
+        print(f"  frame {frame}: {actors} actor ids visible")
+
+
+record()
+replay()
@@ -0,0 +1,86 @@
+"""Print the request, stage and scene metrics of a render server and its client after a few
+hundred frames, and dump the server metrics to a file while the frames run.
+
+Starts a render server in this process and connects a render client to it.
+
+Run from the manualtest directory.
+"""
+import json
+
+import sapien.core as sapien
+
+ADDRESS = "localhost:15005"
+DUMP = "render_server_metrics.jsonl"
+N_ACTORS = 100
+N_FRAMES = 300
+
+
+def percentile(histogram, q):
+    """upper bound in microseconds of the bucket holding the q-th quantile"""
+    target = histogram["count"] * q
+    seen = 0
+    for i, n in enumerate(histogram["buckets"]):
+        seen += n
+        if n and seen >= target:
+            return 2**i
+    return 0
+
+
+def show(title, metrics):
+    print(title)
+    for m in metrics["methods"]:
+        h = m["latency"]
+        if h["count"] == 0:
+            continue
+        print(
+            f"  {m['name']:<28} n={h['count']:<6} mean={h['sum_us'] / h['count']:8.1f}us"
+            f" p99<{percentile(h, 0.99)}us in={m['bytes_in']} out={m['bytes_out']}"
+            f" errors={m['errors']}"
+        )
+    for s in metrics["stages"]:
+        h = s["latency"]
+        if h["count"] == 0:
+            continue
+        print(f"  stage {s['name']:<22} n={h['count']:<6} mean={h['sum_us'] / h['count']:8.1f}us")
+    for s in metrics["scenes"]:
+        print(
+            f"  scene {s['scene_id']} frames={s['frames']} pictures={s['pictures']}"
+            f" pending={s['pending']}"
+        )
+
+
+def main():
+    server = sapien.RenderServer()
+    server.start(ADDRESS)
+    server.start_metrics_dump(DUMP, 100)
+
+    engine = sapien.Engine()
+    client = sapien.RenderClient(ADDRESS, 0)
+    engine.set_renderer(client)
+
+    scene = engine.create_scene()
+    for i in range(N_ACTORS):
+        builder = scene.create_actor_builder()
+        builder.add_box_visual(half_size=[0.02, 0.02, 0.02], color=[1, 0, 0])
+        actor = builder.build_kinematic()
+        actor.set_pose(sapien.Pose([i * 0.05, 0, 0]))
+    camera = scene.add_camera("cam", 128, 128, 1, 0.01, 10)
+
+    for frame in range(N_FRAMES):
+        scene.update_render()
+        if frame % 10 == 0:
+            camera.take_picture()
+    server.wait_all()
+
+    server.stop_metrics_dump()
+    show("server", client.get_server_metrics())
+    show("client", client.get_metrics())
+    with open(DUMP) as f:
+        lines = [json.loads(line) for line in f]
+    print(f"{len(lines)} dumps in {DUMP}")
+
+    scene = None
+    server.stop()
+
+
+main()
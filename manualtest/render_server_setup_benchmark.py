@@ -0,0 +1,56 @@
+"""Time to build a scene through the render server with one call per setup operation compared
+to recorded command batches.
+
+Starts a render server in this process and connects a render client to it.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+ADDRESS = "localhost:15004"
+N_ACTORS = 200
+N_PARTS = 10
+
+
+def build(engine):
+    scene = engine.create_scene()
+    for i in range(N_ACTORS):
+        builder = scene.create_actor_builder()
+        for j in range(N_PARTS):
+            builder.add_box_visual(
+                sapien.Pose([0, 0, j * 0.02]),
+                half_size=[0.01, 0.01, 0.01],
+                color=np.random.uniform(0, 1, 3),
+            )
+        actor = builder.build_kinematic()
+        actor.set_pose(sapien.Pose([i * 0.05, 0, 0]))
+    scene.update_render()
+    return scene
+
+
+def main():
+    server = sapien.RenderServer()
+    server.start(ADDRESS)
+
+    engine = sapien.Engine()
+    client = sapien.RenderClient(ADDRESS, 0)
+    engine.set_renderer(client)
+
+    for batching in [False, True]:
+        client.command_batching = batching
+        start = time.perf_counter()
+        scene = build(engine)
+        client.flush()
+        seconds = time.perf_counter() - start
+        name = "batched" if batching else "one by one"
+        print(f"{N_ACTORS} actors x {N_PARTS} parts {name:>10}: {seconds * 1e3:10.1f} ms")
+        client.command_batching = False
+        scene = None
+
+    server.stop()
+
+
+main()
@@ -0,0 +1,51 @@
+"""Spread scenes over several render servers with a sharded render client and print where they
+were placed.
+
+Starts the render servers in this process on consecutive ports.
+
+Run from the manualtest directory.
+"""
+import sapien.core as sapien
+
+PORTS = [15010, 15011, 15012]
+N_SCENES = 12
+
+
+def main():
+    servers = []
+    for port in PORTS:
+        server = sapien.RenderServer()
+        server.start(f"localhost:{port}")
+        servers.append(server)
+
+    addresses = [f"localhost:{port}" for port in PORTS]
+    for placement in ["least_loaded", "consistent_hash"]:
+        engine = sapien.Engine()
+        client = sapien.ShardedRenderClient(addresses, 0, placement)
+        engine.set_renderer(client)
+        print(f"{placement}: {client.check_health(1000)} of {len(addresses)} servers healthy")
+
+        scenes = []
+        for i in range(N_SCENES):
+            scene = engine.create_scene()
+            builder = scene.create_actor_builder()
+            builder.add_box_visual(half_size=[0.1, 0.1, 0.1], color=[1, 0, 0])
+            builder.build_kinematic()
+            scene.update_render()
+            scenes.append(scene)
+
+        for stats in client.get_shard_stats():
+            print(
+                f"  {stats.address} healthy={stats.healthy} scenes={stats.scene_count}"
+                f" frames_in_flight={stats.frames_in_flight}"
+                f" pending_commands={stats.pending_commands}"
+            )
+        scenes = None
+        engine = None
+        client = None
+
+    for server in servers:
+        server.stop()
+
+
+main()
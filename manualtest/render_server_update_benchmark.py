@@ -0,0 +1,97 @@
+"""Round trip time of UpdateRender through the render server for scenes with many bodies over
+gRPC and shared memory, for many scenes updated one by one compared to one batched call, and
+of stepping and updating with frames in flight.
+
+Starts a render server in this process and connects a render client to it.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+ADDRESS = "localhost:15003"
+FRAMES = 200
+
+
+def create_scene(engine, n_bodies):
+    scene = engine.create_scene()
+    builder = scene.create_actor_builder()
+    builder.add_box_visual(half_size=[0.01, 0.01, 0.01])
+    for _ in range(n_bodies):
+        actor = builder.build_kinematic()
+        actor.set_pose(sapien.Pose(np.random.uniform(-1, 1, 3)))
+    scene.update_render()
+    return scene
+
+
+def measure(engine, n_bodies):
+    scene = create_scene(engine, n_bodies)
+
+    samples = []
+    for _ in range(FRAMES):
+        start = time.perf_counter()
+        scene.update_render()
+        samples.append(time.perf_counter() - start)
+    return np.array(samples) * 1e3
+
+
+def measure_scenes(engine, client, scenes, batch):
+    client.batch_updates = batch
+    samples = []
+    for _ in range(FRAMES):
+        start = time.perf_counter()
+        for scene in scenes:
+            scene.update_render()
+        client.flush()
+        samples.append(time.perf_counter() - start)
+    client.batch_updates = False
+    return np.array(samples) * 1e3
+
+
+def measure_pipelined(engine, client, frames_in_flight):
+    scene = create_scene(engine, 1000)
+    client.frames_in_flight = frames_in_flight
+    start = time.perf_counter()
+    for _ in range(FRAMES):
+        scene.step()
+        scene.update_render()
+    client.flush()
+    client.frames_in_flight = 0
+    return (time.perf_counter() - start) / FRAMES * 1e3
+
+
+def main():
+    server = sapien.RenderServer()
+    server.start(ADDRESS)
+
+    engine = sapien.Engine()
+    client = sapien.RenderClient(ADDRESS, 0)
+    engine.set_renderer(client)
+
+    for shared_memory in [False, True]:
+        client.shared_memory = shared_memory
+        name = "shm" if shared_memory else "grpc"
+        for n in [100, 1000, 10000]:
+            ms = measure(engine, n)
+            print(
+                f"{name:>4} {n:6d} bodies: {np.median(ms):8.3f} ms median, "
+                f"{np.percentile(ms, 99):8.3f} ms p99"
+            )
+    client.shared_memory = False
+
+    scenes = [create_scene(engine, 100) for _ in range(64)]
+    for batch in [False, True]:
+        ms = measure_scenes(engine, client, scenes, batch)
+        name = "batched" if batch else "one by one"
+        print(f"64 scenes {name:>10}: {np.median(ms):8.3f} ms median")
+
+    for k in [0, 1, 2, 4]:
+        ms = measure_pipelined(engine, client, k)
+        print(f"step + update, {k} frames in flight: {ms:8.3f} ms per frame")
+
+    server.stop()
+
+
+main()
@@ -0,0 +1,61 @@
+"""Bytes per frame to mirror a manipulation scene, full pack compared to delta snapshots with
+and without quantization.
+
+Run from the manualtest directory.
+"""
+import pickle
+
+import numpy as np
+import sapien.core as sapien
+
+ROBOT = "../assets/robot/panda/panda.urdf"
+N_OBJECTS = 200
+FRAMES = 500
+
+
+def build_scene(engine):
+    scene = engine.create_scene()
+    scene.add_ground(0)
+    builder = scene.create_actor_builder()
+    builder.add_box_collision(half_size=[0.02, 0.02, 0.02])
+    for i in range(N_OBJECTS):
+        actor = builder.build()
+        actor.set_pose(sapien.Pose([0.3 + (i % 20) * 0.05, (i // 20) * 0.05 - 0.25, 0.02]))
+    loader = scene.create_urdf_loader()
+    loader.fix_root_link = True
+    robot = loader.load(ROBOT)
+    for j in robot.get_active_joints():
+        j.set_drive_property(1000, 100)
+    return scene, robot
+
+
+def run(engine, mode):
+    scene, robot = build_scene(engine)
+    encoder = None
+    if mode != "pack":
+        encoder = sapien.SceneDeltaEncoder(
+            scene, quantize=mode.startswith("quantized"), pose_only=mode.endswith("pose")
+        )
+
+    total = 0
+    base = encoder.generation if encoder else 0
+    for frame in range(FRAMES):
+        # the arm sweeps through the objects, most of them stay asleep
+        robot.set_drive_target(np.sin(frame * 0.02) * np.ones(robot.dof) * 0.5)
+        scene.step()
+        if encoder is None:
+            total += len(pickle.dumps(scene.pack()))
+        else:
+            encoder.capture()
+            total += len(encoder.encode(base))
+            base = encoder.generation
+    return total / FRAMES
+
+
+def main():
+    engine = sapien.Engine()
+    for mode in ["pack", "delta", "delta_pose", "quantized", "quantized_pose"]:
+        print(f"{mode:>16}: {run(engine, mode):10.0f} bytes/frame")
+
+
+main()
@@ -0,0 +1,47 @@
+"""Render depth and segmentation of falling boxes with the CPU rasterizer and report the frame
+rate. Needs no GPU.
+
+Run from the manualtest directory.
+"""
+import time
+
+import numpy as np
+import sapien.core as sapien
+
+N_BOXES = 50
+N_STEPS = 300
+WIDTH, HEIGHT = 640, 480
+
+engine = sapien.Engine()
+renderer = sapien.SoftRenderer()
+engine.set_renderer(renderer)
+
+scene = engine.create_scene()
+scene.set_timestep(1 / 240)
+scene.add_ground(0)
+scene.set_ambient_light([0.3, 0.3, 0.3])
+scene.add_directional_light([0, 1, -1], [0.7, 0.7, 0.7])
+for i in range(N_BOXES):
+    builder = scene.create_actor_builder()
+    builder.add_box_collision(half_size=[0.05, 0.05, 0.05])
+    builder.add_box_visual(half_size=[0.05, 0.05, 0.05], color=[1, i / N_BOXES, 0])
+    box = builder.build()
+    box.set_pose(sapien.Pose([(i % 10) * 0.12, (i // 10) * 0.12, 0.5 + i * 0.01]))
+camera = scene.add_camera("cam", WIDTH, HEIGHT, 1, 0.01, 10)
+camera.set_local_pose(sapien.Pose([-2, 0.5, 1], [0.9659, 0, 0.2588, 0]))
+
+render_time = 0
+for step in range(N_STEPS):
+    scene.step()
+    scene.update_render()
+    start = time.time()
+    camera.take_picture()
+    render_time += time.time() - start
+
+position = camera.get_float_texture("Position")
+seg = camera.get_uint32_texture("Segmentation")
+depth = -position[..., 2]
+valid = position[..., 3] < 1
+print(f"{WIDTH}x{HEIGHT}: {N_STEPS / render_time:.1f} pictures/s")
+print(f"depth range {depth[valid].min():.3f} - {depth[valid].max():.3f}")
+print(f"{len(np.unique(seg[..., 1]))} actor ids visible")
@@ -9,6 +9,7 @@
 
 #include "sapien/actor_builder.h"
 #include "sapien/awaitable.hpp"
+#include "sapien/control_step.h"
 #include "sapien/renderer/render_interface.h"
 #include "sapien/sapien_actor.h"
 #include "sapien/sapien_actor_base.h"
@@ -18,11 +19,14 @@
 #include "sapien/sapien_gear.h"
 #include "sapien/sapien_material.h"
 #include "sapien/sapien_scene.h"
+#include "sapien/scene_delta.h"
 #include "sapien/simulation.h"
 
 #include "sapien/articulation/articulation_builder.h"
+#include "sapien/articulation/articulation_controller.h"
 #include "sapien/articulation/sapien_articulation.h"
 #include "sapien/articulation/sapien_articulation_base.h"
+#include "sapien/articulation/collision_pair_generator.h"
 #include "sapien/articulation/sapien_joint.h"
 #include "sapien/articulation/sapien_kinematic_articulation.h"
 #include "sapien/articulation/sapien_kinematic_joint.h"
@@ -34,6 +38,8 @@
 #include "sapien/renderer/kuafu_renderer.hpp"
 #endif
 
+#include "sapien/renderer/record_renderer.h"
+#include "sapien/renderer/soft_renderer.h"
 #include "sapien/renderer/render_config.h"
 #include "sapien/renderer/svulkan2_pointbody.h"
 #include "sapien/renderer/svulkan2_renderer.h"
@@ -44,6 +50,7 @@
 
 #include "sapien/renderer/server/client.h"
 #include "sapien/renderer/server/server.h"
+#include "sapien/renderer/server/sharding.h"
 
 #include "sapien/articulation/pinocchio_model.h"
 #include "sapien/profiler.hpp"
@@ -111,6 +118,19 @@ template <typename T> void declare_awaitable(py::module &m, std::string const &t
       .def("ready", &Class::ready);
 }
 
+ControlStepConfig makeControlStepConfig(uint32_t substeps, std::string const &interpolation,
+                                        bool observeQpos, bool observeQvel,
+                                        bool observeRootPose, bool observeContactForces) {
+  ControlStepConfig config;
+  config.substeps = substeps;
+  config.interpolation = getActionInterpolationByName(interpolation);
+  config.observeQpos = observeQpos;
+  config.observeQvel = observeQvel;
+  config.observeRootPose = observeRootPose;
+  config.observeContactForces = observeContactForces;
+  return config;
+}
+
 py::array_t<float> getFloatImageFromCamera(SCamera &cam, std::string const &name) {
   uint32_t width = cam.getWidth();
   uint32_t height = cam.getHeight();
@@ -147,6 +167,51 @@ py::array_t<uint8_t> getUint8ImageFromCamera(SCamera &cam, std::string const &na
   }
 }
 
+py::tuple readShmFrame(Renderer::server::ShmRing &ring, uint32_t n) {
+  auto &header = ring.header();
+  auto &frame = ring.frame(n);
+  if (frame.bodyCount > header.maxBodies || frame.cameraCount > header.maxCameras ||
+      frame.pictureCount > header.maxCameras) {
+    throw std::runtime_error("failed to read shared memory frame: invalid counts");
+  }
+  float *poses = ring.poses(n);
+  return py::make_tuple(
+      py::array_t<float>({static_cast<py::ssize_t>(frame.bodyCount), py::ssize_t(7)}, poses),
+      py::array_t<float>({static_cast<py::ssize_t>(frame.cameraCount), py::ssize_t(7)},
+                         poses + frame.bodyCount * 7),
+      py::array_t<uint64_t>(frame.pictureCount, ring.pictures(n)));
+}
+
+void writeShmFrame(Renderer::server::ShmRing &ring, uint32_t n,
+                   py::array_t<float, py::array::c_style | py::array::forcecast> bodyPoses,
+                   py::array_t<float, py::array::c_style | py::array::forcecast> cameraPoses,
+                   py::array_t<uint64_t, py::array::c_style | py::array::forcecast> pictureIds) {
+  if (bodyPoses.ndim() != 2 || bodyPoses.shape(1) != 7 || cameraPoses.ndim() != 2 ||
+      cameraPoses.shape(1) != 7 || pictureIds.ndim() != 1) {
+    throw std::invalid_argument("poses must have shape [N, 7] and picture ids shape [N]");
+  }
+  auto &header = ring.header();
+  if (bodyPoses.shape(0) > header.maxBodies || cameraPoses.shape(0) > header.maxCameras ||
+      pictureIds.shape(0) > header.maxCameras) {
+    throw std::invalid_argument("frame does not fit in the shared memory ring");
+  }
+  auto &frame = ring.frame(n);
+  frame.bodyCount = bodyPoses.shape(0);
+  frame.cameraCount = cameraPoses.shape(0);
+  frame.pictureCount = pictureIds.shape(0);
+  std::copy_n(pictureIds.data(), pictureIds.size(), ring.pictures(n));
+  std::copy_n(bodyPoses.data(), bodyPoses.size(), ring.poses(n));
+  std::copy_n(cameraPoses.data(), cameraPoses.size(), ring.poses(n) + bodyPoses.size());
+}
+
+// the server thread may wait for the GIL in the handler, so it is joined without it
+struct ShmRingServerDeleter {
+  void operator()(Renderer::server::ShmRingServer *server) const {
+    py::gil_scoped_release release;
+    delete server;
+  }
+};
+
 py::array getImageFromCamera(SCamera &cam, std::string const &name) {
   std::string format = cam.getRendererCamera()->getImageFormat(name);
   if (format == "i4") {
@@ -159,6 +224,15 @@ py::array getImageFromCamera(SCamera &cam, std::string const &name) {
   throw std::runtime_error("unexpected image format " + format);
 }
 
+template <typename T>
+py::array_t<T> imageToArray(std::vector<T> const &image, uint32_t width, uint32_t height) {
+  uint32_t channel = image.size() / (width * height);
+  if (channel == 1) {
+    return py::array_t<T>({height, width}, image.data());
+  }
+  return py::array_t<T>({height, width, channel}, image.data());
+}
+
 URDF::URDFConfig parseURDFConfig(py::dict &dict) {
   URDF::URDFConfig config;
   if (dict.contains("material")) {
@@ -278,6 +352,8 @@ void buildSapien(py::module &m) {
   m.doc() = "SAPIEN core module";
 
   declare_awaitable<void>(m, "Void");
+  declare_awaitable<ControlStepResult>(m, "ControlStepResult");
+  declare_awaitable<uint64_t>(m, "Int");
 
 #ifdef SAPIEN_DLPACK
   py::class_<AwaitableDLVectorWrapper, std::shared_ptr<AwaitableDLVectorWrapper>>(
@@ -336,6 +412,15 @@ void buildSapien(py::module &m) {
   auto PyEngine = py::class_<Simulation, std::shared_ptr<Simulation>>(m, "Engine");
   auto PySceneConfig = py::class_<SceneConfig>(m, "SceneConfig");
   auto PyScene = py::class_<SScene>(m, "Scene");
+  auto PyArenaMemoryStats = py::class_<ArenaMemoryStats>(m, "ArenaMemoryStats");
+  auto PyMemoryStats = py::class_<MemoryStats>(m, "MemoryStats");
+  auto PyTelemetryPhaseStats = py::class_<TelemetryPhaseStats>(m, "TelemetryPhaseStats");
+  auto PyTelemetrySnapshot = py::class_<TelemetrySnapshot>(m, "TelemetrySnapshot");
+  auto PyArticulationAction = py::class_<ArticulationAction>(m, "ArticulationAction");
+  auto PyArticulationObservation =
+      py::class_<ArticulationObservation>(m, "ArticulationObservation");
+  auto PyControlStepResult = py::class_<ControlStepResult>(m, "ControlStepResult");
+  auto PySceneDeltaEncoder = py::class_<SceneDeltaEncoder>(m, "SceneDeltaEncoder");
   auto PyConstraint = py::class_<SDrive>(m, "Constraint");
   auto PyDrive = py::class_<SDrive6D, SDrive>(m, "Drive");
   auto PyGear = py::class_<SGear>(m, "Gear");
@@ -359,7 +444,21 @@ void buildSapien(py::module &m) {
   auto PyArticulationDrivable =
       py::class_<SArticulationDrivable, SArticulationBase>(m, "ArticulationDrivable");
   auto PyArticulation = py::class_<SArticulation, SArticulationDrivable>(m, "Articulation");
+  auto PyJointTrajectory = py::class_<JointTrajectory>(m, "JointTrajectory");
+  auto PyArticulationController =
+      py::class_<ArticulationController, std::shared_ptr<ArticulationController>>(
+          m, "ArticulationController");
+  auto PyTrajectoryController =
+      py::class_<TrajectoryController, ArticulationController,
+                 std::shared_ptr<TrajectoryController>>(m, "TrajectoryController");
+  auto PyComputedTorqueController =
+      py::class_<ComputedTorqueController, ArticulationController,
+                 std::shared_ptr<ComputedTorqueController>>(m, "ComputedTorqueController");
+  auto PyJointImpedanceController =
+      py::class_<JointImpedanceController, ArticulationController,
+                 std::shared_ptr<JointImpedanceController>>(m, "JointImpedanceController");
   py::class_<SKArticulation, SArticulationDrivable>(m, "KinematicArticulation");
+  auto PyDisabledCollisionPairs = py::class_<DisabledCollisionPairs>(m, "DisabledCollisionPairs");
 
   auto PyContact = py::class_<SContact>(m, "Contact");
   auto PyTrigger = py::class_<STrigger>(m, "Trigger");
@@ -476,12 +575,219 @@ void buildSapien(py::module &m) {
   auto PyRenderClient =
       py::class_<Renderer::server::ClientRenderer, Renderer::IPxrRenderer,
                  std::shared_ptr<Renderer::server::ClientRenderer>>(m, "RenderClient");
+  auto PyShardedRenderClient =
+      py::class_<Renderer::server::ShardedRenderer, Renderer::IPxrRenderer,
+                 std::shared_ptr<Renderer::server::ShardedRenderer>>(m, "ShardedRenderClient");
+  auto PyShardStats = py::class_<Renderer::server::ShardStats>(m, "ShardStats");
+  auto PyShardPlacer = py::class_<Renderer::server::ShardPlacer>(m, "ShardPlacer");
+  auto PyShmRing = py::class_<Renderer::server::ShmRing>(m, "ShmRing");
+  auto PyShmRingServer =
+      py::class_<Renderer::server::ShmRingServer,
+                 std::unique_ptr<Renderer::server::ShmRingServer, ShmRingServerDeleter>>(
+          m, "ShmRingServer");
+  auto PyRenderLogRecorder =
+      py::class_<Renderer::RecordRenderer, Renderer::IPxrRenderer,
+                 std::shared_ptr<Renderer::RecordRenderer>>(m, "RenderLogRecorder");
+  auto PyRenderLogReplayer = py::class_<Renderer::RenderLogReplayer>(m, "RenderLogReplayer");
+  auto PySoftRenderer = py::class_<Renderer::SoftRenderer, Renderer::IPxrRenderer,
+                                   std::shared_ptr<Renderer::SoftRenderer>>(m, "SoftRenderer");
   auto PyRenderServer = py::class_<Renderer::server::RenderServer>(m, "RenderServer");
   auto PyRenderServerBuffer =
       py::class_<Renderer::server::VulkanCudaBuffer>(m, "RenderServerBuffer");
 
-  PyRenderClient.def(py::init<std::string, uint64_t>(), py::arg("address"),
-                     py::arg("process_index"));
+  PyRenderClient
+      .def(py::init<std::string, uint64_t>(), py::arg("address"), py::arg("process_index"))
+      .def_property("batch_updates", &Renderer::server::ClientRenderer::getBatchUpdates,
+                    &Renderer::server::ClientRenderer::setBatchUpdates,
+                    "Defer scene render updates until flush, which sends all of them in one "
+                    "call.")
+      .def("flush", &Renderer::server::ClientRenderer::flush,
+           "Send batched updates and wait for the frames in flight of every scene.")
+      .def_property("shared_memory", &Renderer::server::ClientRenderer::getSharedMemory,
+                    &Renderer::server::ClientRenderer::setSharedMemory,
+                    "Send scene render updates through shared memory instead of gRPC. The "
+                    "render server must run on the same host.")
+      .def_property("frames_in_flight", &Renderer::server::ClientRenderer::getMaxFramesInFlight,
+                    &Renderer::server::ClientRenderer::setMaxFramesInFlight,
+                    "Frames a scene may queue without waiting for the render server, 0 keeps "
+                    "updates synchronous. A scene sends its queued frames one at a time, only "
+                    "different scenes overlap. Camera take_picture still blocks. Errors are "
+                    "raised by a later call on the scene or by flush.")
+      .def_property("command_batching", &Renderer::server::ClientRenderer::getCommandBatching,
+                    &Renderer::server::ClientRenderer::setCommandBatching,
+                    "Record material and body setup calls and send them in one call on "
+                    "submit_commands, flush or the first call that needs a server result.")
+      .def("submit_commands", &Renderer::server::ClientRenderer::submitCommands)
+      .def(
+          "get_metrics",
+          [](Renderer::server::ClientRenderer &c) {
+            return py::module_::import("json").attr("loads")(
+                Renderer::server::metricsToJson(c.getMetrics()));
+          },
+          "Call counts, latency histograms and bytes per method of this client, client-side "
+          "stage latencies and per-scene frame counters.")
+      .def(
+          "get_server_metrics",
+          [](Renderer::server::ClientRenderer &c) {
+            return py::module_::import("json").attr("loads")(
+                Renderer::server::metricsToJson(c.getServerMetrics()));
+          },
+          "Metrics of the render server, see RenderServer.get_metrics.");
+
+  PyShardStats.def_readonly("address", &Renderer::server::ShardStats::address)
+      .def_readonly("healthy", &Renderer::server::ShardStats::healthy)
+      .def_readonly("scene_count", &Renderer::server::ShardStats::sceneCount)
+      .def_readonly("frames_in_flight", &Renderer::server::ShardStats::framesInFlight)
+      .def_readonly("pending_commands", &Renderer::server::ShardStats::pendingCommands);
+
+  auto parseShardPlacement = [](std::string const &placement) {
+    if (placement == "least_loaded") {
+      return Renderer::server::ShardPlacement::eLEAST_LOADED;
+    }
+    if (placement == "consistent_hash") {
+      return Renderer::server::ShardPlacement::eCONSISTENT_HASH;
+    }
+    throw std::invalid_argument("placement must be least_loaded or consistent_hash");
+  };
+
+  PyShardPlacer
+      .def(py::init([=](std::vector<std::string> const &addresses, std::string const &placement) {
+             return Renderer::server::ShardPlacer(addresses, parseShardPlacement(placement));
+           }),
+           "Scene placement of ShardedRenderClient without the servers.", py::arg("addresses"),
+           py::arg("placement") = "least_loaded")
+      .def("order", &Renderer::server::ShardPlacer::order,
+           "Shard indices in the order they are tried for key, load holds (scene count, frames "
+           "in flight) of every shard.",
+           py::arg("key"), py::arg("load"))
+      .def("place", &Renderer::server::ShardPlacer::place,
+           "Call create(index) on healthy shards in order until it returns. A shard whose "
+           "create raises is marked unhealthy. Returns the index of the shard.",
+           py::arg("key"), py::arg("load"), py::arg("create"))
+      .def("is_healthy", &Renderer::server::ShardPlacer::isHealthy, py::arg("index"))
+      .def("set_healthy", &Renderer::server::ShardPlacer::setHealthy, py::arg("index"),
+           py::arg("healthy"))
+      .def_property_readonly("shard_count", &Renderer::server::ShardPlacer::getShardCount);
+
+  PyShmRing
+      .def_static("create", &Renderer::server::ShmRing::Create,
+                  "Create a shared memory pose ring, as a render client does. Linux only.",
+                  py::arg("name"), py::arg("slot_count"), py::arg("max_bodies"),
+                  py::arg("max_cameras"))
+      .def_static("open", &Renderer::server::ShmRing::Open, py::arg("name"))
+      .def("unlink", &Renderer::server::ShmRing::unlink)
+      .def_property_readonly("name", &Renderer::server::ShmRing::getName)
+      .def_property_readonly(
+          "slot_count",
+          [](Renderer::server::ShmRing &ring) { return ring.header().slotCount; })
+      .def_property_readonly(
+          "requested",
+          [](Renderer::server::ShmRing &ring) { return ring.header().requested.load(); })
+      .def_property_readonly(
+          "completed",
+          [](Renderer::server::ShmRing &ring) { return ring.header().completed.load(); })
+      .def("begin_frame", &Renderer::server::ShmRing::beginFrame,
+           "Wait for a free slot and return the number of the next frame.",
+           py::arg("timeout_ms"), py::call_guard<py::gil_scoped_release>())
+      .def("write_frame", &writeShmFrame,
+           "Write [N, 7] body and camera poses and the camera ids to take pictures with to the "
+           "slot of frame.",
+           py::arg("frame"), py::arg("body_poses"), py::arg("camera_poses"),
+           py::arg("picture_ids"))
+      .def("read_frame", &readShmFrame,
+           "Return (body_poses, camera_poses, picture_ids) in the slot of frame.",
+           py::arg("frame"))
+      .def("end_frame", &Renderer::server::ShmRing::endFrame, py::arg("frame"))
+      .def("wait_completed", &Renderer::server::ShmRing::waitCompleted,
+           "Wait until the server completed frame, raise if it reported a failure.",
+           py::arg("frame"), py::arg("timeout_ms"), py::call_guard<py::gil_scoped_release>());
+
+  PyShmRingServer.def(
+      py::init([](std::string const &name, py::function handler) {
+        // the last reference may go away on the server thread
+        auto fn = std::shared_ptr<py::function>(new py::function(std::move(handler)),
+                                                [](py::function *f) {
+                                                  py::gil_scoped_acquire acquire;
+                                                  delete f;
+                                                });
+        return new Renderer::server::ShmRingServer(
+            Renderer::server::ShmRing::Open(name),
+            [fn](Renderer::server::ShmRing &ring, uint32_t n) {
+              py::gil_scoped_acquire acquire;
+              try {
+                auto [bodies, cameras, pictures] =
+                    readShmFrame(ring, n).cast<std::tuple<py::object, py::object, py::object>>();
+                (*fn)(n, bodies, cameras, pictures);
+              } catch (py::error_already_set &e) {
+                throw std::runtime_error(e.what());
+              }
+            });
+      }),
+      "Serve the shared memory ring name on a thread, as the render server does. handler is "
+      "called with (frame, body_poses, camera_poses, picture_ids) of every published frame, "
+      "a frame is reported failed if it raises.",
+      py::arg("name"), py::arg("handler"));
+
+  PyShardedRenderClient
+      .def(py::init([=](std::vector<std::string> const &addresses, uint64_t processIndex,
+                        std::string const &placement) {
+             return std::make_shared<Renderer::server::ShardedRenderer>(
+                 addresses, processIndex, parseShardPlacement(placement));
+           }),
+           "Render client that spreads scenes over several render servers.",
+           py::arg("addresses"), py::arg("process_index"), py::arg("placement") = "least_loaded")
+      .def("check_health", &Renderer::server::ShardedRenderer::checkHealth,
+           "Try to connect to every server, return the number of healthy ones.",
+           py::arg("timeout_ms") = 1000)
+      .def("get_shard_stats", &Renderer::server::ShardedRenderer::getShardStats)
+      .def_property("batch_updates", &Renderer::server::ShardedRenderer::getBatchUpdates,
+                    &Renderer::server::ShardedRenderer::setBatchUpdates)
+      .def_property("frames_in_flight", &Renderer::server::ShardedRenderer::getMaxFramesInFlight,
+                    &Renderer::server::ShardedRenderer::setMaxFramesInFlight)
+      .def_property("command_batching", &Renderer::server::ShardedRenderer::getCommandBatching,
+                    &Renderer::server::ShardedRenderer::setCommandBatching)
+      .def("flush", &Renderer::server::ShardedRenderer::flush);
+
+  PyRenderLogRecorder
+      .def(py::init<std::string>(), py::arg("filename"),
+           "Renderer that records bodies, materials, lights, cameras and per-frame poses into a "
+           "render log without rendering. Replay the log with RenderLogReplayer.")
+      .def("flush", &Renderer::RecordRenderer::flush)
+      .def_property_readonly("filename", &Renderer::RecordRenderer::getFilename)
+      .def_property_readonly("bytes_written", &Renderer::RecordRenderer::getBytesWritten);
+
+  PySoftRenderer.def(py::init<>(),
+                     "CPU rasterizer rendering Position, Segmentation, Normal, Albedo, Color and "
+                     "Depth without a GPU. Textures and shadows are not rendered.");
+
+  PyRenderLogReplayer
+      .def(py::init<std::string, std::shared_ptr<Renderer::IPxrRenderer>>(),
+           py::arg("filename"), py::arg("renderer"))
+      .def("set_picture_callback", &Renderer::RenderLogReplayer::setPictureCallback,
+           "Called as callback(scene_index, camera_index, frame) after every picture.",
+           py::arg("callback"))
+      .def("step", &Renderer::RenderLogReplayer::step,
+           "Replay up to the next frame and the pictures taken after it, False at the end of "
+           "the log.")
+      .def("run", &Renderer::RenderLogReplayer::run,
+           "Replay the rest of the log and return the number of frames.")
+      .def_property_readonly("frame_count", &Renderer::RenderLogReplayer::getFrameCount)
+      .def(
+          "get_float_texture",
+          [](Renderer::RenderLogReplayer &r, uint32_t scene, uint32_t camera,
+             std::string const &name) {
+            auto cam = r.getCamera(scene, camera);
+            return imageToArray(cam->getFloatImage(name), cam->getWidth(), cam->getHeight());
+          },
+          py::arg("scene_index"), py::arg("camera_index"), py::arg("texture_name"))
+      .def(
+          "get_uint32_texture",
+          [](Renderer::RenderLogReplayer &r, uint32_t scene, uint32_t camera,
+             std::string const &name) {
+            auto cam = r.getCamera(scene, camera);
+            return imageToArray(cam->getUintImage(name), cam->getWidth(), cam->getHeight());
+          },
+          py::arg("scene_index"), py::arg("camera_index"), py::arg("texture_name"));
 
   PyRenderServer
       .def_static("_set_shader_dir", &Renderer::server::setDefaultShaderDirectory,
@@ -499,7 +805,19 @@ void buildSapien(py::module &m) {
       //      py::arg("shape"), py::return_value_policy::reference)
       .def("auto_allocate_buffers", &Renderer::server::RenderServer::autoAllocateBuffers,
            py::arg("render_targets"), py::return_value_policy::reference)
-      .def("summary", &Renderer::server::RenderServer::summary);
+      .def("summary", &Renderer::server::RenderServer::summary)
+      .def(
+          "get_metrics",
+          [](Renderer::server::RenderServer &s) {
+            return py::module_::import("json").attr("loads")(s.getMetricsJson());
+          },
+          "Call counts, latency histograms and bytes per method, stage latencies and per-scene "
+          "frame, picture and pending task counts. Histogram bucket i counts durations below "
+          "2^i microseconds.")
+      .def("start_metrics_dump", &Renderer::server::RenderServer::startMetricsDump,
+           "Append the metrics as one JSON line to the file every interval.",
+           py::arg("filename"), py::arg("interval_ms") = 1000)
+      .def("stop_metrics_dump", &Renderer::server::RenderServer::stopMetricsDump);
 
   PyRenderServerBuffer
       .def_property_readonly("nbytes", &Renderer::server::VulkanCudaBuffer::getSize)
@@ -830,9 +1148,108 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
       .def_readwrite("enable_friction_every_iteration", &SceneConfig::enableFrictionEveryIteration)
       .def_readwrite("enable_adaptive_force", &SceneConfig::enableAdaptiveForce)
       .def_readwrite("disable_collision_visual", &SceneConfig::disableCollisionVisual)
+      .def_readwrite("aggregate_articulations", &SceneConfig::aggregateArticulations)
+      .def_readwrite("aggregate_shape_threshold", &SceneConfig::aggregateShapeThreshold)
+      .def_readwrite("broadphase", &SceneConfig::broadPhase)
+      .def_readwrite("mbp_world_lower", &SceneConfig::mbpWorldLower)
+      .def_readwrite("mbp_world_upper", &SceneConfig::mbpWorldUpper)
+      .def_readwrite("mbp_subdivisions", &SceneConfig::mbpSubdivisions)
       .def("__repr__", [](SceneConfig &) { return "SceneConfig()"; });
 
+  PyArenaMemoryStats.def_readonly("name", &ArenaMemoryStats::name)
+      .def_readonly("bytes_in_use", &ArenaMemoryStats::bytesInUse)
+      .def_readonly("peak_bytes_in_use", &ArenaMemoryStats::peakBytesInUse)
+      .def_readonly("bytes_reserved", &ArenaMemoryStats::bytesReserved)
+      .def_readonly("allocation_count", &ArenaMemoryStats::allocationCount)
+      .def_readonly("bytes_by_category", &ArenaMemoryStats::bytesByCategory)
+      .def("__repr__", [](ArenaMemoryStats &s) {
+        return "ArenaMemoryStats(name=" + s.name + ", bytes_in_use=" +
+               std::to_string(s.bytesInUse) + ")";
+      });
+
+  PyMemoryStats.def_readonly("bytes_in_use", &MemoryStats::bytesInUse)
+      .def_readonly("bytes_reserved", &MemoryStats::bytesReserved)
+      .def_readonly("arenas", &MemoryStats::arenas);
+
+  PyTelemetryPhaseStats.def_readonly("count", &TelemetryPhaseStats::count)
+      .def_readonly("total_ns", &TelemetryPhaseStats::totalNs)
+      .def_readonly("last_ns", &TelemetryPhaseStats::lastNs)
+      .def_readonly("max_ns", &TelemetryPhaseStats::maxNs)
+      .def_readonly("p50_ns", &TelemetryPhaseStats::p50Ns)
+      .def_readonly("p90_ns", &TelemetryPhaseStats::p90Ns)
+      .def_readonly("p99_ns", &TelemetryPhaseStats::p99Ns)
+      .def("__repr__", [](TelemetryPhaseStats &s) {
+        return "TelemetryPhaseStats(count=" + std::to_string(s.count) +
+               ", p50_ns=" + std::to_string(s.p50Ns) + ", p99_ns=" + std::to_string(s.p99Ns) + ")";
+      });
+
+  PyTelemetrySnapshot.def_readonly("steps", &TelemetrySnapshot::steps)
+      .def_readonly("contact_pairs", &TelemetrySnapshot::contactPairs)
+      .def_readonly("contact_points", &TelemetrySnapshot::contactPoints)
+      .def_readonly("last_step_contact_pairs", &TelemetrySnapshot::lastStepContactPairs)
+      .def_readonly("last_step_contact_points", &TelemetrySnapshot::lastStepContactPoints)
+      .def_readonly("phases", &TelemetrySnapshot::phases)
+      .def_readonly("simulation_statistics", &TelemetrySnapshot::simulationStatistics);
+
+  PyArticulationAction
+      .def(py::init([](SArticulation *articulation, std::vector<PxReal> const &driveTarget,
+                       std::vector<PxReal> const &driveVelocityTarget) {
+             return ArticulationAction{articulation, driveTarget, driveVelocityTarget};
+           }),
+           py::arg("articulation"), py::arg("drive_target") = std::vector<PxReal>{},
+           py::arg("drive_velocity_target") = std::vector<PxReal>{})
+      .def_readwrite("articulation", &ArticulationAction::articulation)
+      .def_readwrite("drive_target", &ArticulationAction::driveTarget)
+      .def_readwrite("drive_velocity_target", &ArticulationAction::driveVelocityTarget);
+
+  PyArticulationObservation
+      .def_property_readonly("qpos",
+                             [](ArticulationObservation &o) {
+                               return py::array_t<PxReal>(o.qpos.size(), o.qpos.data());
+                             })
+      .def_property_readonly("qvel",
+                             [](ArticulationObservation &o) {
+                               return py::array_t<PxReal>(o.qvel.size(), o.qvel.data());
+                             })
+      .def_readonly("root_pose", &ArticulationObservation::rootPose)
+      .def_property_readonly("link_contact_forces", [](ArticulationObservation &o) {
+        return py::array_t<PxReal>(
+            {static_cast<int>(o.linkContactForces.size() / 3), 3}, o.linkContactForces.data());
+      });
+
+  PyControlStepResult.def_readonly("substeps", &ControlStepResult::substeps)
+      .def_readonly("articulations", &ControlStepResult::articulations);
+
+  PySceneDeltaEncoder
+      .def(py::init([](SScene &scene, bool quantize, PxReal positionResolution, bool poseOnly) {
+             return std::make_unique<SceneDeltaEncoder>(
+                 scene, SceneDeltaConfig{quantize, positionResolution, poseOnly});
+           }),
+           py::arg("scene"), py::arg("quantize") = false, py::arg("position_resolution") = 1e-4f,
+           py::arg("pose_only") = false, py::keep_alive<1, 2>())
+      .def("capture", &SceneDeltaEncoder::capture,
+           "Record the bodies changed since the last capture as a new generation.")
+      .def_property_readonly("generation", &SceneDeltaEncoder::getGeneration)
+      .def_property_readonly("last_changed_count", &SceneDeltaEncoder::getLastChangedCount)
+      .def(
+          "encode",
+          [](SceneDeltaEncoder &encoder, uint64_t base) {
+            auto data = encoder.encode(base);
+            return py::bytes(reinterpret_cast<char const *>(data.data()), data.size());
+          },
+          "Diff bringing a scene at generation base to the current generation, 0 for all bodies.",
+          py::arg("base"));
+
   //======== Simulation ========//
+  m.def(
+      "configure_task_scheduler",
+      [](uint32_t threadCount, bool pinThreads) {
+        TaskScheduler::Configure({threadCount, pinThreads});
+      },
+      "Set the worker threads shared by async steps, rendering tasks and PhysX (Engine "
+      "thread_count). Must be called before the first scene is created.",
+      py::arg("thread_count") = 0, py::arg("pin_threads") = false);
+
   PyEngine
       .def(py::init([](uint32_t nthread, PxReal toleranceLength, PxReal toleranceSpeed) {
              return Simulation::getInstance(nthread, toleranceLength, toleranceSpeed);
@@ -844,6 +1261,7 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
       .def("get_renderer", &Simulation::getRenderer)
       .def("set_renderer", &Simulation::setRenderer, py::arg("renderer"))
       .def("set_log_level", &Simulation::setLogLevel, py::arg("level"))
+      .def("get_memory_stats", &Simulation::getMemoryStats)
       .def("create_physical_material", &Simulation::createPhysicalMaterial,
            py::arg("static_friction"), py::arg("dynamic_friction"), py::arg("restitution"))
       .def(
@@ -886,6 +1304,33 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
       .def("get_timestep", &SScene::getTimestep)
       .def_property("timestep", &SScene::getTimestep, &SScene::setTimestep)
       .def("get_config", &SScene::getConfig)
+      .def_property_readonly("aggregate_count", &SScene::getAggregateCount)
+      .def("get_memory_stats", &SScene::getMemoryStats)
+      .def(
+          "enable_telemetry",
+          [](SScene &s, bool enable, bool trace) { s.getTelemetry().setEnabled(enable, trace); },
+          py::arg("enable") = true, py::arg("trace") = false)
+      .def("reset_telemetry", [](SScene &s) { s.getTelemetry().reset(); })
+      .def("get_telemetry", [](SScene &s) { return s.getTelemetry().getSnapshot(); })
+      .def(
+          "get_telemetry_histogram",
+          [](SScene &s, std::string const &phase) {
+            return s.getTelemetry().getHistogram(getTelemetryPhaseByName(phase));
+          },
+          py::arg("phase"))
+      .def(
+          "export_chrome_trace",
+          [](SScene &s, std::string const &filename) {
+            s.getTelemetry().exportChromeTrace(filename,
+                                               s.getName().empty() ? "scene" : s.getName());
+          },
+          py::arg("filename"))
+      .def_property_readonly("broadphase_region_count", &SScene::getBroadPhaseRegionCount)
+      .def("get_broadphase_world_bounds",
+           [](SScene &s) {
+             auto bounds = s.getBroadPhaseWorldBounds();
+             return std::make_tuple(vec32array(bounds.minimum), vec32array(bounds.maximum));
+           })
       .def_property("default_physical_material", &SScene::getDefaultMaterial,
                     &SScene::setDefaultMaterial)
       .def("create_actor_builder", &SScene::createActorBuilder)
@@ -898,6 +1343,20 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
       .def("remove_kinematic_articulation", &SScene::removeKinematicArticulation,
            py::arg("kinematic_articulation"))
       .def("remove_drive", &SScene::removeDrive, py::arg("drive"))
+      .def("park_actor", &SScene::parkActor, py::arg("actor"), py::arg("tag"),
+           "Remove the actor from the simulation and hide it, keeping its shapes and render "
+           "bodies so unpark_actor can reuse it.")
+      .def("unpark_actor", &SScene::unparkActor, py::arg("tag"), py::arg("pose"),
+           py::arg("scale") = 1.f, py::arg("material") = nullptr,
+           py::return_value_policy::reference,
+           "Put an actor parked with tag back into the simulation, returns None if the pool is "
+           "empty. scale is relative to the size given by the builder.")
+      .def("park_articulation", &SScene::parkArticulation, py::arg("articulation"),
+           py::arg("tag"))
+      .def("unpark_articulation", &SScene::unparkArticulation, py::arg("tag"), py::arg("pose"),
+           py::return_value_policy::reference)
+      .def("get_parked_count", &SScene::getParkedCount, py::arg("tag"))
+      .def("clear_actor_pool", &SScene::clearActorPool)
       .def("find_actor_by_id", &SScene::findActorById, py::arg("id"),
            py::return_value_policy::reference)
       .def("find_articulation_link_by_link_id", &SScene::findArticulationLinkById, py::arg("id"),
@@ -943,6 +1402,36 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
                  std::make_shared<AwaitableFuture<void>>(
                      scene.multistepAsync(steps, (SceneMultistepCallback *)callback)));
            })
+      .def(
+          "control_step",
+          [](SScene &scene, std::vector<ArticulationAction> const &actions, uint32_t substeps,
+             std::string const &interpolation, bool observeQpos, bool observeQvel,
+             bool observeRootPose, bool observeContactForces) {
+            return controlStep(scene, actions,
+                               makeControlStepConfig(substeps, interpolation, observeQpos,
+                                                     observeQvel, observeRootPose,
+                                                     observeContactForces));
+          },
+          "Set the drive targets of the given articulations and step the scene substeps "
+          "times. interpolation is one of hold, linear and cubic.",
+          py::arg("actions"), py::arg("substeps") = 1, py::arg("interpolation") = "hold",
+          py::arg("observe_qpos") = true, py::arg("observe_qvel") = true,
+          py::arg("observe_root_pose") = false, py::arg("observe_contact_forces") = false,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "control_step_async",
+          [](SScene &scene, std::vector<ArticulationAction> const &actions, uint32_t substeps,
+             std::string const &interpolation, bool observeQpos, bool observeQvel,
+             bool observeRootPose, bool observeContactForces) {
+            return std::static_pointer_cast<IAwaitable<ControlStepResult>>(
+                std::make_shared<AwaitableFuture<ControlStepResult>>(controlStepAsync(
+                    scene, actions,
+                    makeControlStepConfig(substeps, interpolation, observeQpos, observeQvel,
+                                          observeRootPose, observeContactForces))));
+          },
+          py::arg("actions"), py::arg("substeps") = 1, py::arg("interpolation") = "hold",
+          py::arg("observe_qpos") = true, py::arg("observe_qvel") = true,
+          py::arg("observe_root_pose") = false, py::arg("observe_contact_forces") = false)
       .def("update_render", &SScene::updateRender)
       .def("_update_render_and_take_pictures", &SScene::updateRenderAndTakePictures)
       .def("update_render_async",
@@ -950,6 +1439,21 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
              return std::static_pointer_cast<IAwaitable<void>>(
                  std::make_shared<AwaitableFuture<void>>(scene.updateRenderAsync()));
            })
+      .def_property("render_pipelining", &SScene::getRenderPipelining,
+                    &SScene::setRenderPipelining)
+      .def("capture_render_snapshot", &SScene::captureRenderSnapshot)
+      .def(
+          "render_snapshot_async",
+          [](SScene &scene, std::vector<SCamera *> const &cameras) {
+            return std::static_pointer_cast<IAwaitable<uint64_t>>(
+                std::make_shared<AwaitableFuture<uint64_t>>(scene.renderSnapshotAsync(cameras)));
+          },
+          "Render the latest pose snapshot on the render queue while the next step runs, "
+          "awaiting gives the snapshot number.",
+          py::arg("cameras"))
+      .def("wait_for_render_snapshots", &SScene::waitForRenderSnapshots,
+           py::call_guard<py::gil_scoped_release>())
+      .def_property_readonly("render_snapshot_count", &SScene::getRenderSnapshotCount)
       .def(
           "add_ground",
           [](SScene &s, float altitude, bool render, std::shared_ptr<SPhysicalMaterial> material,
@@ -1059,6 +1563,18 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
              output["articulation_drive"] = data.mArticulationDriveData;
              return output;
            })
+      .def(
+          "pack_incremental",
+          [](SScene &scene) {
+            auto data = scene.packSceneIncremental();
+            std::map<std::string, std::map<physx_id_t, std::vector<PxReal>>> output;
+            output["actor"] = data.mActorData;
+            output["articulation"] = data.mArticulationData;
+            output["articulation_drive"] = data.mArticulationDriveData;
+            return output;
+          },
+          "Like pack, but only bodies that moved or were set since the last call.")
+      .def_property_readonly("moved_actor_count", &SScene::getMovedActorCount)
       .def(
           "unpack",
           [](SScene &scene,
@@ -1081,7 +1597,16 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
             data.mArticulationDriveData = t3->second;
             scene.unpackScene(data);
           },
-          py::arg("data"));
+          py::arg("data"))
+      .def(
+          "apply_delta",
+          [](SScene &scene, py::bytes const &delta) {
+            std::string data = delta;
+            return applySceneDelta(scene, reinterpret_cast<uint8_t const *>(data.data()),
+                                   data.size());
+          },
+          "Apply a diff made by SceneDeltaEncoder.encode, returns its generation.",
+          py::arg("delta"));
 
   //======= Drive =======//
   PyDrive.def("set_x_limit", &SDrive6D::setXLimit, py::arg("low"), py::arg("high"))
@@ -1170,7 +1695,8 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
       .def("on_step", &SActorBase::onStep, py::arg("func"))
       .def("on_contact", &SActorBase::onContact, py::arg("func"))
       .def("on_trigger", &SActorBase::onTrigger, py::arg("func"))
-      .def("get_builder", &SActorBase::getBuilder);
+      .def("get_builder", &SActorBase::getBuilder)
+      .def_property_readonly("scale", &SActorBase::getScale);
 
   PyActorDynamicBase
       .def_property_readonly("velocity",
@@ -1435,7 +1961,80 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
           },
           py::arg("drive_target"));
 
+  PyDisabledCollisionPairs.def_readonly("adjacent", &DisabledCollisionPairs::adjacent)
+      .def_readonly("always_colliding", &DisabledCollisionPairs::alwaysColliding)
+      .def_readonly("never_colliding", &DisabledCollisionPairs::neverColliding)
+      .def_readonly("sample_count", &DisabledCollisionPairs::sampleCount)
+      .def_readonly("candidate_pairs", &DisabledCollisionPairs::candidatePairs)
+      .def_readonly("candidate_shape_pairs", &DisabledCollisionPairs::candidateShapePairs)
+      .def_readonly("disabled_pairs", &DisabledCollisionPairs::disabledPairs)
+      .def_readonly("disabled_shape_pairs", &DisabledCollisionPairs::disabledShapePairs)
+      .def("to_srdf", &DisabledCollisionPairs::toSRDF, py::arg("robot_name"))
+      .def_static("from_srdf", &DisabledCollisionPairs::fromSRDF, py::arg("srdf"));
+
+  PyJointTrajectory
+      .def(py::init([](std::vector<PxReal> const &times,
+                       Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> const
+                           &positions,
+                       Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> const
+                           &velocities,
+                       std::string const &interpolation) {
+             return JointTrajectory(
+                 positions.cols(), times,
+                 std::vector<PxReal>(positions.data(), positions.data() + positions.size()),
+                 std::vector<PxReal>(velocities.data(), velocities.data() + velocities.size()),
+                 getActionInterpolationByName(interpolation));
+           }),
+           "positions and velocities have one row per waypoint. interpolation is one of hold, "
+           "linear and cubic.",
+           py::arg("times"), py::arg("positions"),
+           py::arg("velocities") =
+               Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>(),
+           py::arg("interpolation") = "cubic")
+      .def_property_readonly("dof", &JointTrajectory::dof)
+      .def_property_readonly("start_time", &JointTrajectory::getStartTime)
+      .def_property_readonly("end_time", &JointTrajectory::getEndTime)
+      .def(
+          "sample",
+          [](JointTrajectory &t, PxReal time) {
+            JointTrajectory::Sample s;
+            t.sample(time, s);
+            return py::make_tuple(py::array_t<PxReal>(s.position.size(), s.position.data()),
+                                  py::array_t<PxReal>(s.velocity.size(), s.velocity.data()),
+                                  py::array_t<PxReal>(s.acceleration.size(),
+                                                      s.acceleration.data()));
+          },
+          "Returns position, velocity and acceleration at time.", py::arg("time"));
+
+  PyArticulationController
+      .def_property("time", &ArticulationController::getTime, &ArticulationController::setTime)
+      .def_property_readonly("finished", &ArticulationController::isFinished)
+      .def_property_readonly("trajectory", &ArticulationController::getTrajectory);
+
+  PyTrajectoryController.def(py::init<JointTrajectory>(), py::arg("trajectory"));
+  PyComputedTorqueController.def(py::init<JointTrajectory, std::vector<PxReal>,
+                                          std::vector<PxReal>>(),
+                                 py::arg("trajectory"), py::arg("kp"), py::arg("kd"));
+  PyJointImpedanceController.def(py::init<JointTrajectory, std::vector<PxReal>,
+                                          std::vector<PxReal>, bool>(),
+                                 py::arg("trajectory"), py::arg("stiffness"), py::arg("damping"),
+                                 py::arg("gravity_compensation") = true);
+
   PyArticulation.def_property_readonly("fixed", &SArticulation::isBaseFixed)
+      .def(
+          "generate_disabled_collision_pairs",
+          [](SArticulation &a, uint32_t sampleCount, uint32_t threadCount, float ratio) {
+            return computeDisabledCollisionPairs(a, sampleCount, threadCount, ratio);
+          },
+          "Sample random configurations to find link pairs that always or never collide. "
+          "The articulation is not moved.",
+          py::arg("sample_count") = 1000, py::arg("thread_count") = 0,
+          py::arg("always_colliding_ratio") = 0.95f)
+      .def("apply_disabled_collision_pairs", &applyDisabledCollisionPairs,
+           "Ignore collisions of always and never colliding pairs through collision groups. "
+           "Links with shapes that already have group 2 bits or a group 3 id keep them and "
+           "their pairs stay enabled. Returns the number of disabled link pairs.",
+           py::arg("pairs"))
       .def("get_drive_velocity_target",
            [](SArticulation &a) {
              auto target = a.getDriveVelocityTarget();
@@ -1451,6 +2050,10 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
 
       .def("get_active_joints", &SArticulation::getActiveJoints,
            py::return_value_policy::reference)
+      .def("set_controller", &SArticulation::setController,
+           "Attach a controller evaluated before every physics step, None detaches it.",
+           py::arg("controller"))
+      .def("get_controller", &SArticulation::getController)
       .def(
           "set_root_velocity",
           [](SArticulation &a, py::array_t<PxReal> v) { a.setRootVelocity(array2vec3(v)); },
@@ -1520,7 +2123,18 @@ If after testing g2 and g3, the objects may collide, g0 and g1 come into play. g
            [](SArticulation &a,
               const py::array_t<PxReal, py::array::c_style | py::array::forcecast> &arr) {
              a.unpackData(std::vector<PxReal>(arr.data(), arr.data() + arr.size()));
-           });
+           })
+      .def_property("kinematics_cache_enabled", &SArticulation::getKinematicsCacheEnabled,
+                    &SArticulation::setKinematicsCacheEnabled)
+      .def("mark_state_changed", &SArticulation::markStateChanged,
+           "Invalidate cached Jacobians, mass matrix and passive forces. Only needed after "
+           "modifying the articulation state outside SAPIEN.")
+      .def("get_kinematics_cache_stats",
+           [](SArticulation &a) {
+             auto &stats = a.getKinematicsCacheStats();
+             return py::dict(py::arg("hits") = stats.hits, py::arg("misses") = stats.misses);
+           })
+      .def("reset_kinematics_cache_stats", &SArticulation::resetKinematicsCacheStats);
 
   //======== End Articulation ========//
 
@@ -1754,6 +2368,10 @@ References:
            "see CollisionShape.set_collision_groups", py::arg("group0"), py::arg("group1"),
            py::arg("group2"), py::arg("group3"))
       .def("reset_collision_groups", &ActorBuilder::resetCollisionGroup)
+      .def("set_use_aggregate", &ActorBuilder::setUseAggregate,
+           "Put all shapes of the actor in a single broadphase entry. Overrides "
+           "SceneConfig.aggregate_shape_threshold.",
+           py::arg("enabled"))
       .def(
           "build", [](ActorBuilder &a, std::string const &name) { return a.build(false, name); },
           py::arg("name") = "", py::return_value_policy::reference)
@@ -1913,7 +2531,12 @@ Args:
       .def("build_kinematic", &ArticulationBuilder::buildKinematic,
            py::return_value_policy::reference)
       .def("get_link_builders", &ArticulationBuilder::getLinkBuilders,
-           py::return_value_policy::reference);
+           py::return_value_policy::reference)
+      .def("set_use_aggregate", &ArticulationBuilder::setUseAggregate,
+           "Put all links in a single broadphase entry. Overrides "
+           "SceneConfig.aggregate_articulations. Self-collision in the entry follows the "
+           "collision groups at build time and is not updated when they change later.",
+           py::arg("enabled"));
 
   PyURDFLoader.def(py::init<SScene *>(), py::arg("scene"))
       .def_readwrite("fix_root_link", &URDF::URDFLoader::fixRootLink)
@@ -1922,6 +2545,8 @@ Args:
       .def_readwrite("collision_is_visual", &URDF::URDFLoader::collisionIsVisual)
       .def_readwrite("scale", &URDF::URDFLoader::scale)
       .def_readwrite("package_dir", &URDF::URDFLoader::packageDir)
+      .def_readwrite("auto_disable_collisions", &URDF::URDFLoader::autoDisableCollisions)
+      .def_readwrite("collision_sample_count", &URDF::URDFLoader::collisionSampleCount)
       .def(
           "load",
           [](URDF::URDFLoader &loader, std::string const &filename, py::dict &dict) {
@@ -1979,6 +2604,16 @@ Args:
   PySubscription.def("unsubscribe", &Subscription::unsubscribe);
 
   PyPinocchioModel
+      .def("set_fixed_dof_kernel_enabled", &PinocchioModel::setFixedDofKernelEnabled,
+           "Use compile-time specialized kinematics for 6, 7 and 9 DOF models when possible. "
+           "Affects forward kinematics, Jacobians and inverse kinematics. Disabled by default.",
+           py::arg("enabled"), py::arg("single_precision") = false)
+      .def_property_readonly("kinematics_kernel", &PinocchioModel::getKinematicsKernelName)
+      .def_property("analytic_ik_enabled", &PinocchioModel::getAnalyticIKEnabled,
+                    &PinocchioModel::setAnalyticIKEnabled)
+      .def("get_ik_solver_name", &PinocchioModel::getIKSolverName,
+           "Name of the analytic IK solver used for a link, \"clik\" if there is none.",
+           py::arg("link_index"))
       .def("compute_forward_kinematics", &PinocchioModel::computeForwardKinematics,
            "Compute and cache forward kinematics. After computation, use get_link_pose to "
            "retrieve the computed pose for a specific link.",
@@ -1990,6 +2625,8 @@ Args:
       .def("compute_inverse_kinematics", &PinocchioModel::computeInverseKinematics,
            R"doc(
 Compute inverse kinematics with CLIK algorithm.
+If an analytic solver exists for the link (see get_ik_solver_name), its solution closest to
+initial_qpos is refined with CLIK instead.
 Details see https://gepettoweb.laas.fr/doc/stack-of-tasks/pinocchio/master/doxygen-html/md_doc_b-examples_i-inverse-kinematics.html
 Args:
     link_index: index of the link
@@ -514,6 +514,11 @@ std::shared_ptr<ActorBuilder> ActorBuilder::addCollisionGroup(uint32_t g0, uint3
   return shared_from_this();
 }
 
+std::shared_ptr<ActorBuilder> ActorBuilder::setUseAggregate(bool enabled) {
+  mUseAggregate = enabled;
+  return shared_from_this();
+}
+
 std::shared_ptr<ActorBuilder> ActorBuilder::resetCollisionGroup() {
   mCollisionGroup.w0 = 1;
   mCollisionGroup.w1 = 1;
@@ -667,11 +672,13 @@ void ActorBuilder::buildCollisionVisuals(
 }
 
 SActor *ActorBuilder::build(bool isKinematic, std::string const &name) const {
+  ArenaAllocator::Scope allocationScope(mScene->getMemoryArena());
   physx_id_t actorId = mScene->mActorIdGenerator.next();
 
   std::vector<std::unique_ptr<SCollisionShape>> shapes;
   std::vector<PxReal> densities;
   buildShapes(shapes, densities);
+  bool aggregate = mUseAggregate.value_or(mScene->shouldAggregateActor(shapes.size()));
 
   std::vector<physx_id_t> renderIds;
   std::vector<Renderer::IPxrRigidbody *> renderBodies;
@@ -740,18 +747,20 @@ SActor *ActorBuilder::build(bool isKinematic, std::string const &name) const {
                                   mScene->mDefaultSolverVelocityIterations);
 
   auto result = sActor.get();
-  mScene->addActor(std::move(sActor));
+  mScene->addActor(std::move(sActor), aggregate);
 
   result->mBuilder = shared_from_this();
   return result;
 }
 
 SActorStatic *ActorBuilder::buildStatic(std::string const &name) const {
+  ArenaAllocator::Scope allocationScope(mScene->getMemoryArena());
   physx_id_t actorId = mScene->mActorIdGenerator.next();
 
   std::vector<std::unique_ptr<SCollisionShape>> shapes;
   std::vector<PxReal> densities;
   buildShapes(shapes, densities);
+  bool aggregate = mUseAggregate.value_or(mScene->shouldAggregateActor(shapes.size()));
 
   std::vector<physx_id_t> renderIds;
   std::vector<Renderer::IPxrRigidbody *> renderBodies;
@@ -791,7 +800,7 @@ SActorStatic *ActorBuilder::buildStatic(std::string const &name) const {
   actor->userData = sActor.get();
 
   auto result = sActor.get();
-  mScene->addActor(std::move(sActor));
+  mScene->addActor(std::move(sActor), aggregate);
 
   result->mBuilder = shared_from_this();
   return result;
@@ -801,6 +810,7 @@ SActorStatic *ActorBuilder::buildGround(PxReal altitude, bool render,
                                         std::shared_ptr<SPhysicalMaterial> material,
                                         std::shared_ptr<Renderer::IPxrMaterial> renderMaterial,
                                         const PxVec2 &renderSize, std::string const &name) {
+  ArenaAllocator::Scope allocationScope(mScene->getMemoryArena());
   physx_id_t actorId = mScene->mActorIdGenerator.next();
   material = material ? material : mScene->mDefaultMaterial;
 
@@ -0,0 +1,272 @@
+#include "sapien/arena_allocator.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <spdlog/spdlog.h>
+#include <string_view>
+#include <unordered_map>
+
+namespace sapien {
+
+namespace {
+
+enum Category : uint8_t {
+  eMESH,
+  eCONTACT,
+  eSOLVER,
+  eARTICULATION,
+  eBROADPHASE,
+  eOTHER,
+  eCATEGORY_COUNT
+};
+
+constexpr std::array<char const *, eCATEGORY_COUNT> kCategoryNames = {
+    "mesh", "contact", "solver", "articulation", "broadphase", "other"};
+
+/** PhysX requires 16 byte alignment, the header keeps it */
+struct alignas(16) BlockHeader {
+  ArenaAllocator::Arena *arena;
+  uint32_t size;
+  uint8_t sizeClass;
+  uint8_t category;
+};
+static_assert(sizeof(BlockHeader) == 16);
+
+constexpr size_t kChunkSize = 64 * 1024;
+constexpr size_t kMinBlockSize = 32;
+constexpr uint32_t kClassCount = 8; // 32 to 4096 bytes including the header
+constexpr uint8_t kLargeClass = 0xff;
+
+inline size_t classSize(uint32_t sizeClass) { return kMinBlockSize << sizeClass; }
+
+inline uint8_t sizeClassOf(size_t blockSize) {
+  uint32_t c = 0;
+  while (classSize(c) < blockSize) {
+    if (++c == kClassCount) {
+      return kLargeClass;
+    }
+  }
+  return c;
+}
+
+Category classify(char const *typeName, char const *filename) {
+  std::string_view type(typeName ? typeName : "");
+  std::string_view file(filename ? filename : "");
+  auto has = [&](std::string_view s) {
+    return type.find(s) != std::string_view::npos || file.find(s) != std::string_view::npos;
+  };
+  if (has("Articulation")) {
+    return eARTICULATION;
+  }
+  if (has("Contact") || has("PxcNp") || has("NpMemBlock") || has("Manifold")) {
+    return eCONTACT;
+  }
+  if (has("Solver") || has("Constraint") || has("lowleveldynamics")) {
+    return eSOLVER;
+  }
+  if (has("Mesh") || has("HeightField") || has("cooking") || has("geomutils")) {
+    return eMESH;
+  }
+  if (has("BroadPhase") || has("lowlevelaabb") || has("Aabb")) {
+    return eBROADPHASE;
+  }
+  return eOTHER;
+}
+
+/** PhysX passes string literals, so the classification is cached by pointer */
+Category classifyCached(char const *typeName, char const *filename) {
+  thread_local std::unordered_map<uint64_t, Category> cache;
+  uint64_t key =
+      reinterpret_cast<uintptr_t>(typeName) * 31 + reinterpret_cast<uintptr_t>(filename);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  return cache[key] = classify(typeName, filename);
+}
+
+thread_local ArenaAllocator::Arena *gCurrentArena = nullptr;
+
+} // namespace
+
+struct ArenaAllocator::Arena {
+  std::string name;
+  std::mutex mutex;
+
+  std::array<void *, kClassCount> freeLists{};
+  std::array<char *, kClassCount> bumpBegin{};
+  std::array<char *, kClassCount> bumpEnd{};
+  std::vector<void *> chunks;
+  std::unordered_map<void *, size_t> largeBlocks;
+
+  uint64_t bytesInUse{0};
+  uint64_t peakBytesInUse{0};
+  uint64_t bytesReserved{0};
+  uint64_t allocationCount{0};
+  std::array<uint64_t, eCATEGORY_COUNT> bytesByCategory{};
+
+  bool released{false};
+};
+
+ArenaAllocator &ArenaAllocator::Get() {
+  static ArenaAllocator *allocator = new ArenaAllocator;
+  return *allocator;
+}
+
+ArenaAllocator::ArenaAllocator() {
+  mGlobalArena = new Arena;
+  mGlobalArena->name = "global";
+  mArenas.push_back(mGlobalArena);
+}
+
+void *ArenaAllocator::allocate(size_t size, const char *typeName, const char *filename, int) {
+  Arena *arena = gCurrentArena ? gCurrentArena : mGlobalArena;
+  auto category = classifyCached(typeName, filename);
+  size_t blockSize = size + sizeof(BlockHeader);
+  uint8_t sizeClass = sizeClassOf(blockSize);
+
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  char *block;
+  if (sizeClass == kLargeClass) {
+    block = static_cast<char *>(std::aligned_alloc(16, (blockSize + 15) & ~size_t(15)));
+    if (!block) {
+      return nullptr;
+    }
+    arena->largeBlocks[block] = size;
+    arena->bytesReserved += blockSize;
+  } else if (arena->freeLists[sizeClass]) {
+    block = static_cast<char *>(arena->freeLists[sizeClass]);
+    arena->freeLists[sizeClass] = *reinterpret_cast<void **>(block);
+  } else {
+    if (arena->bumpBegin[sizeClass] == arena->bumpEnd[sizeClass]) {
+      auto chunk = static_cast<char *>(std::aligned_alloc(16, kChunkSize));
+      if (!chunk) {
+        return nullptr;
+      }
+      arena->chunks.push_back(chunk);
+      arena->bytesReserved += kChunkSize;
+      arena->bumpBegin[sizeClass] = chunk;
+      arena->bumpEnd[sizeClass] = chunk + kChunkSize;
+    }
+    block = arena->bumpBegin[sizeClass];
+    arena->bumpBegin[sizeClass] += classSize(sizeClass);
+  }
+
+  auto header = reinterpret_cast<BlockHeader *>(block);
+  header->arena = arena;
+  header->size = static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX));
+  header->sizeClass = sizeClass;
+  header->category = category;
+
+  arena->bytesInUse += size;
+  arena->peakBytesInUse = std::max(arena->peakBytesInUse, arena->bytesInUse);
+  arena->allocationCount += 1;
+  arena->bytesByCategory[category] += size;
+  return block + sizeof(BlockHeader);
+}
+
+void ArenaAllocator::deallocate(void *ptr) {
+  if (!ptr) {
+    return;
+  }
+  char *block = static_cast<char *>(ptr) - sizeof(BlockHeader);
+  auto header = reinterpret_cast<BlockHeader *>(block);
+  Arena *arena = header->arena;
+
+  bool destroy;
+  {
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    size_t size = header->size;
+    if (header->sizeClass == kLargeClass) {
+      auto it = arena->largeBlocks.find(block);
+      size = it->second;
+      arena->bytesReserved -= size + sizeof(BlockHeader);
+      arena->largeBlocks.erase(it);
+    }
+    arena->bytesInUse -= size;
+    arena->allocationCount -= 1;
+    arena->bytesByCategory[header->category] -= size;
+
+    if (header->sizeClass == kLargeClass) {
+      std::free(block);
+    } else {
+      *reinterpret_cast<void **>(block) = arena->freeLists[header->sizeClass];
+      arena->freeLists[header->sizeClass] = block;
+    }
+    destroy = arena->released && arena->allocationCount == 0;
+  }
+  if (destroy) {
+    destroyArena(arena);
+  }
+}
+
+ArenaAllocator::Arena *ArenaAllocator::createArena(std::string const &name) {
+  auto arena = new Arena;
+  arena->name = name;
+  std::lock_guard<std::mutex> lock(mMutex);
+  mArenas.push_back(arena);
+  return arena;
+}
+
+void ArenaAllocator::setArenaName(Arena *arena, std::string const &name) {
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  arena->name = name;
+}
+
+void ArenaAllocator::releaseArena(Arena *arena) {
+  bool destroy;
+  {
+    std::lock_guard<std::mutex> lock(arena->mutex);
+    arena->released = true;
+    destroy = arena->allocationCount == 0;
+    if (!destroy) {
+      spdlog::get("SAPIEN")->debug("Arena {} released with {} allocations ({} bytes) alive",
+                                   arena->name, arena->allocationCount, arena->bytesInUse);
+    }
+  }
+  if (destroy) {
+    destroyArena(arena);
+  }
+}
+
+void ArenaAllocator::destroyArena(Arena *arena) {
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::erase(mArenas, arena);
+  }
+  // every block is free, so the chunks are returned without visiting the blocks
+  for (auto chunk : arena->chunks) {
+    std::free(chunk);
+  }
+  delete arena;
+}
+
+ArenaMemoryStats ArenaAllocator::getArenaStats(Arena *arena) {
+  std::lock_guard<std::mutex> lock(arena->mutex);
+  ArenaMemoryStats stats;
+  stats.name = arena->name;
+  stats.bytesInUse = arena->bytesInUse;
+  stats.peakBytesInUse = arena->peakBytesInUse;
+  stats.bytesReserved = arena->bytesReserved;
+  stats.allocationCount = arena->allocationCount;
+  for (uint32_t c = 0; c < eCATEGORY_COUNT; ++c) {
+    stats.bytesByCategory[kCategoryNames[c]] = arena->bytesByCategory[c];
+  }
+  return stats;
+}
+
+MemoryStats ArenaAllocator::getMemoryStats() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  MemoryStats stats;
+  for (auto arena : mArenas) {
+    stats.arenas.push_back(getArenaStats(arena));
+    stats.bytesInUse += stats.arenas.back().bytesInUse;
+    stats.bytesReserved += stats.arenas.back().bytesReserved;
+  }
+  return stats;
+}
+
+ArenaAllocator::Scope::Scope(Arena *arena) : mPrevious(gCurrentArena) { gCurrentArena = arena; }
+ArenaAllocator::Scope::~Scope() { gCurrentArena = mPrevious; }
+
+} // namespace sapien
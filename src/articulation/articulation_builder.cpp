@@ -393,6 +393,7 @@ bool ArticulationBuilder::prebuild(std::vector<int> &tosort) const {
 }
 
 SArticulation *ArticulationBuilder::build(bool fixBase) const {
+  ArenaAllocator::Scope allocationScope(mScene->getMemoryArena());
   std::vector<int> sorted;
   if (!prebuild(sorted)) {
     return nullptr;
@@ -415,7 +416,8 @@ SArticulation *ArticulationBuilder::build(bool fixBase) const {
   }
 
   auto result = sArticulation.get();
-  mScene->addArticulation(std::move(sArticulation));
+  mScene->addArticulation(std::move(sArticulation),
+                          mUseAggregate.value_or(mScene->getAggregateArticulations()));
 
   {
     uint32_t totalLinkCount = result->mLinks.size();
@@ -519,6 +521,7 @@ SArticulation *ArticulationBuilder::build(bool fixBase) const {
 }
 
 SKArticulation *ArticulationBuilder::buildKinematic() const {
+  ArenaAllocator::Scope allocationScope(mScene->getMemoryArena());
   std::vector<int> sorted;
   if (!prebuild(sorted)) {
     return nullptr;
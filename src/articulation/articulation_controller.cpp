@@ -0,0 +1,169 @@
+#include "sapien/articulation/articulation_controller.h"
+#include "sapien/articulation/sapien_articulation.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace sapien {
+
+JointTrajectory::JointTrajectory(uint32_t dof, std::vector<PxReal> times,
+                                 std::vector<PxReal> positions, std::vector<PxReal> velocities,
+                                 ActionInterpolation interpolation)
+    : mDof(dof), mTimes(std::move(times)), mPositions(std::move(positions)),
+      mVelocities(std::move(velocities)), mInterpolation(interpolation) {
+  if (mTimes.empty()) {
+    throw std::runtime_error("failed to create joint trajectory: no waypoints");
+  }
+  for (size_t i = 1; i < mTimes.size(); ++i) {
+    if (mTimes[i] <= mTimes[i - 1]) {
+      throw std::runtime_error("failed to create joint trajectory: times must be increasing");
+    }
+  }
+  if (mPositions.size() != mTimes.size() * mDof) {
+    throw std::runtime_error("failed to create joint trajectory: positions must have " +
+                             std::to_string(mDof) + " values per waypoint");
+  }
+  if (!mVelocities.empty() && mVelocities.size() != mPositions.size()) {
+    throw std::runtime_error(
+        "failed to create joint trajectory: velocities must have the size of positions");
+  }
+
+  if (mVelocities.empty() && mInterpolation == ActionInterpolation::eCUBIC) {
+    // finite difference tangents, the trajectory starts and stops at rest
+    size_t n = mTimes.size();
+    mVelocities.assign(mPositions.size(), 0.f);
+    for (size_t i = 1; i + 1 < n; ++i) {
+      PxReal dt = mTimes[i + 1] - mTimes[i - 1];
+      for (uint32_t j = 0; j < mDof; ++j) {
+        mVelocities[i * mDof + j] =
+            (mPositions[(i + 1) * mDof + j] - mPositions[(i - 1) * mDof + j]) / dt;
+      }
+    }
+  }
+}
+
+void JointTrajectory::sample(PxReal t, Sample &out) const {
+  out.position.resize(mDof);
+  out.velocity.assign(mDof, 0.f);
+  out.acceleration.assign(mDof, 0.f);
+
+  if (t <= mTimes.front() || mTimes.size() == 1) {
+    std::copy_n(mPositions.begin(), mDof, out.position.begin());
+    return;
+  }
+  if (t >= mTimes.back()) {
+    std::copy_n(mPositions.end() - mDof, mDof, out.position.begin());
+    return;
+  }
+
+  size_t k = std::upper_bound(mTimes.begin(), mTimes.end(), t) - mTimes.begin() - 1;
+  PxReal h = mTimes[k + 1] - mTimes[k];
+  PxReal a = (t - mTimes[k]) / h;
+  PxReal const *p0 = mPositions.data() + k * mDof;
+  PxReal const *p1 = p0 + mDof;
+
+  switch (mInterpolation) {
+  case ActionInterpolation::eHOLD:
+    std::copy_n(p0, mDof, out.position.begin());
+    return;
+
+  case ActionInterpolation::eLINEAR:
+    for (uint32_t j = 0; j < mDof; ++j) {
+      out.position[j] = p0[j] + a * (p1[j] - p0[j]);
+      out.velocity[j] = (p1[j] - p0[j]) / h;
+    }
+    return;
+
+  case ActionInterpolation::eCUBIC: {
+    PxReal const *v0 = mVelocities.data() + k * mDof;
+    PxReal const *v1 = v0 + mDof;
+    // cubic Hermite basis and its first and second derivatives
+    PxReal a2 = a * a, a3 = a2 * a;
+    PxReal h00 = 2 * a3 - 3 * a2 + 1, h10 = a3 - 2 * a2 + a;
+    PxReal h01 = -2 * a3 + 3 * a2, h11 = a3 - a2;
+    PxReal d00 = 6 * a2 - 6 * a, d10 = 3 * a2 - 4 * a + 1;
+    PxReal d01 = -6 * a2 + 6 * a, d11 = 3 * a2 - 2 * a;
+    PxReal dd00 = 12 * a - 6, dd10 = 6 * a - 4;
+    PxReal dd01 = -12 * a + 6, dd11 = 6 * a - 2;
+    for (uint32_t j = 0; j < mDof; ++j) {
+      PxReal m0 = v0[j] * h;
+      PxReal m1 = v1[j] * h;
+      out.position[j] = h00 * p0[j] + h10 * m0 + h01 * p1[j] + h11 * m1;
+      out.velocity[j] = (d00 * p0[j] + d10 * m0 + d01 * p1[j] + d11 * m1) / h;
+      out.acceleration[j] = (dd00 * p0[j] + dd10 * m0 + dd01 * p1[j] + dd11 * m1) / (h * h);
+    }
+    return;
+  }
+  }
+}
+
+ArticulationController::ArticulationController(JointTrajectory trajectory)
+    : mTrajectory(std::move(trajectory)) {}
+
+void ArticulationController::step(SArticulation &articulation, PxReal timestep) {
+  update(articulation, mTime, timestep);
+  mTime += timestep;
+}
+
+void TrajectoryController::update(SArticulation &articulation, PxReal time, PxReal timestep) {
+  // the drives should reach the reference by the end of the step
+  mTrajectory.sample(time + timestep, mReference);
+  articulation.setDriveTarget(mReference.position);
+  articulation.setDriveVelocityTarget(mReference.velocity);
+}
+
+static void checkGains(JointTrajectory const &trajectory, std::vector<PxReal> const &a,
+                       std::vector<PxReal> const &b) {
+  if (a.size() != trajectory.dof() || b.size() != trajectory.dof()) {
+    throw std::runtime_error("failed to create controller: gains do not match trajectory DOF");
+  }
+}
+
+ComputedTorqueController::ComputedTorqueController(JointTrajectory trajectory,
+                                                   std::vector<PxReal> kp, std::vector<PxReal> kd)
+    : ArticulationController(std::move(trajectory)), mKp(std::move(kp)), mKd(std::move(kd)) {
+  checkGains(mTrajectory, mKp, mKd);
+}
+
+void ComputedTorqueController::update(SArticulation &articulation, PxReal time, PxReal) {
+  mTrajectory.sample(time, mReference);
+  auto qpos = articulation.getQpos();
+  auto qvel = articulation.getQvel();
+  uint32_t n = mTrajectory.dof();
+
+  Eigen::VectorXf qacc(n);
+  for (uint32_t j = 0; j < n; ++j) {
+    qacc[j] = mReference.acceleration[j] + mKp[j] * (mReference.position[j] - qpos[j]) +
+              mKd[j] * (mReference.velocity[j] - qvel[j]);
+  }
+  auto qf = articulation.computePassiveForce(true, true, false);
+  Eigen::Map<Eigen::VectorXf>(qf.data(), n) +=
+      articulation.computeManipulatorInertiaMatrix() * qacc;
+  articulation.setQf(qf);
+}
+
+JointImpedanceController::JointImpedanceController(JointTrajectory trajectory,
+                                                   std::vector<PxReal> stiffness,
+                                                   std::vector<PxReal> damping,
+                                                   bool gravityCompensation)
+    : ArticulationController(std::move(trajectory)), mStiffness(std::move(stiffness)),
+      mDamping(std::move(damping)), mGravityCompensation(gravityCompensation) {
+  checkGains(mTrajectory, mStiffness, mDamping);
+}
+
+void JointImpedanceController::update(SArticulation &articulation, PxReal time, PxReal) {
+  mTrajectory.sample(time, mReference);
+  auto qpos = articulation.getQpos();
+  auto qvel = articulation.getQvel();
+  uint32_t n = mTrajectory.dof();
+
+  std::vector<PxReal> qf = mGravityCompensation
+                               ? articulation.computePassiveForce(true, false, false)
+                               : std::vector<PxReal>(n, 0.f);
+  for (uint32_t j = 0; j < n; ++j) {
+    qf[j] += mStiffness[j] * (mReference.position[j] - qpos[j]) +
+             mDamping[j] * (mReference.velocity[j] - qvel[j]);
+  }
+  articulation.setQf(qf);
+}
+
+} // namespace sapien
@@ -0,0 +1,344 @@
+#include "sapien/articulation/collision_pair_generator.h"
+#include "sapien/articulation/sapien_articulation.h"
+#include "sapien/articulation/sapien_joint.h"
+#include "sapien/articulation/sapien_link.h"
+#include "sapien/articulation/urdf_loader.h"
+#include "sapien/sapien_shape.h"
+#include "sapien/task_scheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <spdlog/spdlog.h>
+
+namespace sapien {
+
+namespace {
+
+struct ShapeInstance {
+  physx::PxGeometryHolder geometry;
+  physx::PxTransform localPose;
+};
+
+bool canQueryOverlap(physx::PxGeometryHolder const &g0, physx::PxGeometryHolder const &g1) {
+  auto supported = [](physx::PxGeometryType::Enum type) {
+    return type == physx::PxGeometryType::eSPHERE || type == physx::PxGeometryType::eCAPSULE ||
+           type == physx::PxGeometryType::eBOX || type == physx::PxGeometryType::eCONVEXMESH ||
+           type == physx::PxGeometryType::eTRIANGLEMESH;
+  };
+  // PhysX has no triangle mesh vs triangle mesh overlap query
+  return supported(g0.getType()) && supported(g1.getType()) &&
+         !(g0.getType() == physx::PxGeometryType::eTRIANGLEMESH &&
+           g1.getType() == physx::PxGeometryType::eTRIANGLEMESH);
+}
+
+std::mutex gCacheMutex;
+std::map<size_t, DisabledCollisionPairs> gCache;
+
+/** word 3 ids for articulations with generated groups, 0 is the shared default */
+std::atomic<uint32_t> gNextArticulationGroupId{1};
+
+} // namespace
+
+std::string DisabledCollisionPairs::toSRDF(std::string const &robotName) const {
+  std::string srdf = "<?xml version=\"1.0\" ?>\n<robot name=\"" + robotName + "\">\n";
+  auto write = [&](std::vector<std::pair<std::string, std::string>> const &pairs,
+                   std::string const &reason) {
+    for (auto &[l1, l2] : pairs) {
+      srdf += "  <disable_collisions link1=\"" + l1 + "\" link2=\"" + l2 + "\" reason=\"" +
+              reason + "\" />\n";
+    }
+  };
+  write(adjacent, "Adjacent");
+  write(alwaysColliding, "Always");
+  write(neverColliding, "Never");
+  srdf += "</robot>\n";
+  return srdf;
+}
+
+DisabledCollisionPairs DisabledCollisionPairs::fromSRDF(std::string const &srdf) {
+  tinyxml2::XMLDocument doc;
+  if (doc.Parse(srdf.c_str(), srdf.length()) || !doc.RootElement()) {
+    throw std::runtime_error("failed to parse SRDF");
+  }
+  URDF::SRDF::Robot robot(*doc.RootElement());
+  DisabledCollisionPairs result;
+  for (auto &dc : robot.disable_collisions_array) {
+    if (dc->reason == "Adjacent") {
+      result.adjacent.push_back({dc->link1, dc->link2});
+    } else if (dc->reason == "Always") {
+      result.alwaysColliding.push_back({dc->link1, dc->link2});
+    } else if (dc->reason == "Never") {
+      result.neverColliding.push_back({dc->link1, dc->link2});
+    }
+  }
+  return result;
+}
+
+DisabledCollisionPairs computeDisabledCollisionPairs(SArticulation &articulation,
+                                                     uint32_t sampleCount, uint32_t threadCount,
+                                                     float alwaysCollidingRatio) {
+  auto links = articulation.getSLinks();
+  uint32_t linkCount = links.size();
+
+  std::vector<std::vector<ShapeInstance>> shapes(linkCount);
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    for (auto shape : links[i]->getCollisionShapes()) {
+      shapes[i].push_back({shape->getPxShape()->getGeometry(), shape->getLocalPose()});
+    }
+  }
+
+  std::vector<std::vector<bool>> adjacent(linkCount, std::vector<bool>(linkCount, false));
+  for (auto joint : articulation.getSJoints()) {
+    auto parent = joint->getParentLink();
+    auto child = joint->getChildLink();
+    if (parent && child) {
+      adjacent[parent->getIndex()][child->getIndex()] = true;
+      adjacent[child->getIndex()][parent->getIndex()] = true;
+    }
+  }
+
+  DisabledCollisionPairs result;
+  result.sampleCount = sampleCount;
+
+  // pairs to test and pairs PhysX cannot answer
+  std::vector<std::pair<uint32_t, uint32_t>> candidates;
+  std::vector<bool> queryable;
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    for (uint32_t j = i + 1; j < linkCount; ++j) {
+      if (adjacent[i][j]) {
+        result.adjacent.push_back({links[i]->getName(), links[j]->getName()});
+        continue;
+      }
+      if (shapes[i].empty() || shapes[j].empty()) {
+        continue;
+      }
+      bool canQuery = true;
+      for (auto &s0 : shapes[i]) {
+        for (auto &s1 : shapes[j]) {
+          canQuery = canQuery && canQueryOverlap(s0.geometry, s1.geometry);
+        }
+      }
+      candidates.push_back({i, j});
+      queryable.push_back(canQuery);
+      result.candidatePairs += 1;
+      result.candidateShapePairs += shapes[i].size() * shapes[j].size();
+    }
+  }
+
+  // forward kinematics is cheap, compute all link poses upfront
+  auto model = articulation.createPinocchioModel();
+  std::vector<std::vector<physx::PxTransform>> poses(sampleCount);
+  for (uint32_t s = 0; s < sampleCount; ++s) {
+    model->computeForwardKinematics(model->getRandomConfiguration());
+    for (uint32_t i = 0; i < linkCount; ++i) {
+      poses[s].push_back(model->getLinkPose(i));
+    }
+  }
+
+  if (threadCount == 0) {
+    threadCount = TaskScheduler::Get().getWorkerCount() + 1;
+  }
+  threadCount = std::min(threadCount, std::max(sampleCount, 1u));
+
+  auto countCollisions = [&](uint32_t begin, uint32_t end) {
+    std::vector<uint32_t> counts(candidates.size(), 0);
+    for (uint32_t s = begin; s < end; ++s) {
+      for (size_t c = 0; c < candidates.size(); ++c) {
+        if (!queryable[c]) {
+          continue;
+        }
+        auto [i, j] = candidates[c];
+        bool hit = false;
+        for (auto &s0 : shapes[i]) {
+          for (auto &s1 : shapes[j]) {
+            if (physx::PxGeometryQuery::overlap(s0.geometry.any(), poses[s][i] * s0.localPose,
+                                                s1.geometry.any(), poses[s][j] * s1.localPose)) {
+              hit = true;
+              break;
+            }
+          }
+          if (hit) {
+            break;
+          }
+        }
+        counts[c] += hit;
+      }
+    }
+    return counts;
+  };
+
+  std::vector<std::vector<uint32_t>> partials(threadCount);
+  TaskScheduler::Get().parallelFor(
+      0, threadCount,
+      [&](int64_t t) {
+        partials[t] = countCollisions(sampleCount * t / threadCount,
+                                      sampleCount * (t + 1) / threadCount);
+      },
+      1);
+  std::vector<uint32_t> counts(candidates.size(), 0);
+  for (auto &partial : partials) {
+    for (size_t c = 0; c < candidates.size(); ++c) {
+      counts[c] += partial[c];
+    }
+  }
+
+  for (size_t c = 0; c < candidates.size(); ++c) {
+    if (!queryable[c] || sampleCount == 0) {
+      continue;
+    }
+    auto [i, j] = candidates[c];
+    std::pair<std::string, std::string> names{links[i]->getName(), links[j]->getName()};
+    if (counts[c] == 0) {
+      result.neverColliding.push_back(names);
+    } else if (counts[c] >= alwaysCollidingRatio * sampleCount) {
+      result.alwaysColliding.push_back(names);
+    }
+  }
+  return result;
+}
+
+DisabledCollisionPairs const &getDisabledCollisionPairs(size_t key, SArticulation &articulation,
+                                                        uint32_t sampleCount) {
+  {
+    std::lock_guard<std::mutex> lock(gCacheMutex);
+    auto it = gCache.find(key);
+    if (it != gCache.end()) {
+      return it->second;
+    }
+  }
+  auto pairs = computeDisabledCollisionPairs(articulation, sampleCount);
+  std::lock_guard<std::mutex> lock(gCacheMutex);
+  return gCache.try_emplace(key, std::move(pairs)).first->second;
+}
+
+uint32_t applyDisabledCollisionPairs(SArticulation &articulation, DisabledCollisionPairs &pairs) {
+  auto links = articulation.getSLinks();
+  uint32_t linkCount = links.size();
+  std::map<std::string, uint32_t> name2index;
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    name2index[links[i]->getName()] = i;
+  }
+
+  // ignore bits and ids set by the user (or an SRDF) must keep their meaning
+  std::vector<bool> userGroups(linkCount, false);
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    for (auto shape : links[i]->getCollisionShapes()) {
+      auto g = shape->getCollisionGroups();
+      if (g[2] || (g[3] & 0xffff)) {
+        userGroups[i] = true;
+      }
+    }
+  }
+
+  std::vector<std::vector<bool>> ignored(linkCount, std::vector<bool>(linkCount, false));
+  std::vector<std::pair<uint32_t, uint32_t>> uncovered;
+  uint32_t userGroupPairs = 0;
+  for (auto list : {&pairs.alwaysColliding, &pairs.neverColliding}) {
+    for (auto &[l1, l2] : *list) {
+      auto it1 = name2index.find(l1);
+      auto it2 = name2index.find(l2);
+      if (it1 == name2index.end() || it2 == name2index.end()) {
+        spdlog::get("SAPIEN")->error("Collision pair link not found: {} {}", l1, l2);
+        continue;
+      }
+      if (userGroups[it1->second] || userGroups[it2->second]) {
+        userGroupPairs += 1;
+        continue;
+      }
+      ignored[it1->second][it2->second] = ignored[it2->second][it1->second] = true;
+      uncovered.push_back({it1->second, it2->second});
+    }
+  }
+
+  // greedy clique cover, every bit marks a set of links that may all ignore each other
+  std::vector<std::vector<bool>> covered(linkCount, std::vector<bool>(linkCount, false));
+  std::vector<uint32_t> groups(linkCount, 0);
+  uint32_t bit = 0;
+  for (auto [u, v] : uncovered) {
+    if (covered[u][v]) {
+      continue;
+    }
+    if (bit == 32) {
+      break;
+    }
+    std::vector<uint32_t> clique{u, v};
+    while (true) {
+      int best = -1;
+      uint32_t bestGain = 0;
+      for (uint32_t w = 0; w < linkCount; ++w) {
+        bool valid = true;
+        uint32_t gain = 0;
+        for (auto m : clique) {
+          if (m == w || !ignored[m][w]) {
+            valid = false;
+            break;
+          }
+          gain += !covered[m][w];
+        }
+        if (valid && gain > bestGain) {
+          best = w;
+          bestGain = gain;
+        }
+      }
+      if (best < 0) {
+        break;
+      }
+      clique.push_back(best);
+    }
+    for (auto m : clique) {
+      groups[m] |= 1u << bit;
+      for (auto n : clique) {
+        covered[m][n] = true;
+      }
+    }
+    bit += 1;
+  }
+
+  pairs.disabledPairs = 0;
+  pairs.disabledShapePairs = 0;
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    for (uint32_t j = i + 1; j < linkCount; ++j) {
+      if (groups[i] & groups[j]) {
+        pairs.disabledPairs += 1;
+        pairs.disabledShapePairs +=
+            links[i]->getCollisionShapes().size() * links[j]->getCollisionShapes().size();
+      }
+    }
+  }
+  if (userGroupPairs) {
+    spdlog::get("SAPIEN")->warn(
+        "{} pairs involve links that already have collision groups and remain enabled",
+        userGroupPairs);
+  }
+  if (pairs.disabledPairs < uncovered.size()) {
+    spdlog::get("SAPIEN")->warn("Collision groups exhausted, {} of {} pairs remain enabled",
+                                uncovered.size() - pairs.disabledPairs, uncovered.size());
+  }
+
+  uint32_t articulationId = 0;
+  for (uint32_t i = 0; i < linkCount; ++i) {
+    if (!groups[i]) {
+      continue;
+    }
+    if (!articulationId) {
+      articulationId = gNextArticulationGroupId++ & 0xffff;
+      if (!articulationId) {
+        articulationId = gNextArticulationGroupId++ & 0xffff;
+      }
+    }
+    for (auto shape : links[i]->getCollisionShapes()) {
+      auto g = shape->getCollisionGroups();
+      // only links without ignore bits or an id get here
+      shape->setCollisionGroups(g[0], g[1], groups[i], (g[3] & ~0xffffu) | articulationId);
+    }
+  }
+
+  spdlog::get("SAPIEN")->info(
+      "Disabled {} of {} link pairs ({} of {} shape pairs) from {} samples", pairs.disabledPairs,
+      pairs.candidatePairs, pairs.disabledShapePairs, pairs.candidateShapePairs,
+      pairs.sampleCount);
+  return pairs.disabledPairs;
+}
+
+} // namespace sapien
@@ -0,0 +1,390 @@
+#include "sapien/articulation/ik_solver.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+
+namespace sapien {
+
+namespace {
+
+/** geometric tolerance in meters used to classify joint axes */
+constexpr double kAxisTolerance = 1e-6;
+
+template <typename T> void hashCombine(size_t &seed, T const &v) {
+  seed ^= std::hash<T>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+void appendReal(KinematicStructure &structure, double v) {
+  if (!std::isfinite(v) || std::abs(v) > 1e9) {
+    v = v > 0 ? 1e9 : -1e9;
+  }
+  structure.push_back(std::llround(v * 1e6));
+}
+
+template <typename Derived>
+void appendMatrix(KinematicStructure &structure, Eigen::MatrixBase<Derived> const &m) {
+  for (Eigen::Index r = 0; r < m.rows(); ++r) {
+    for (Eigen::Index c = 0; c < m.cols(); ++c) {
+      appendReal(structure, m(r, c));
+    }
+  }
+}
+
+/** a joint axis: unit direction w through point r */
+struct Axis {
+  Eigen::Vector3d w;
+  Eigen::Vector3d r;
+};
+
+Eigen::Isometry3d twistExp(Axis const &a, double theta) {
+  Eigen::Isometry3d g = Eigen::Isometry3d::Identity();
+  g.linear() = Eigen::AngleAxisd(theta, a.w).toRotationMatrix();
+  g.translation() = a.r - g.linear() * a.r;
+  return g;
+}
+
+bool isOnAxis(Axis const &a, Eigen::Vector3d const &p) {
+  return (p - a.r).cross(a.w).norm() < kAxisTolerance;
+}
+
+/** intersection of 2 non-parallel axes, false if they are parallel or skew */
+bool intersectAxes(Axis const &a, Axis const &b, Eigen::Vector3d &point) {
+  Eigen::Vector3d n = a.w.cross(b.w);
+  double nn = n.squaredNorm();
+  if (nn < 1e-10) {
+    return false;
+  }
+  Eigen::Vector3d d = b.r - a.r;
+  if (std::abs(d.dot(n)) / std::sqrt(nn) > kAxisTolerance) {
+    return false;
+  }
+  point = a.r + d.cross(b.w).dot(n) / nn * a.w;
+  return true;
+}
+
+/** Paden-Kahan subproblem 1: rotation about a taking p to q */
+double subproblem1(Axis const &a, Eigen::Vector3d const &p, Eigen::Vector3d const &q) {
+  Eigen::Vector3d u = p - a.r;
+  Eigen::Vector3d v = q - a.r;
+  u -= a.w * a.w.dot(u);
+  v -= a.w * a.w.dot(v);
+  return std::atan2(a.w.dot(u.cross(v)), u.dot(v));
+}
+
+/** Paden-Kahan subproblem 2: exp(a1 t1) exp(a2 t2) p = q for axes intersecting at r */
+std::vector<std::array<double, 2>> subproblem2(Axis const &a1, Axis const &a2,
+                                               Eigen::Vector3d const &r, Eigen::Vector3d const &p,
+                                               Eigen::Vector3d const &q) {
+  Eigen::Vector3d u = p - r;
+  Eigen::Vector3d v = q - r;
+  double c = a1.w.dot(a2.w);
+  double alpha = (c * a2.w.dot(u) - a1.w.dot(v)) / (c * c - 1);
+  double beta = (c * a1.w.dot(v) - a2.w.dot(u)) / (c * c - 1);
+  Eigen::Vector3d n = a1.w.cross(a2.w);
+  double gamma2 = (u.squaredNorm() - alpha * alpha - beta * beta - 2 * alpha * beta * c) /
+                  n.squaredNorm();
+  if (gamma2 < -1e-8) {
+    return {};
+  }
+  std::vector<std::array<double, 2>> result;
+  double gamma = std::sqrt(std::max(gamma2, 0.0));
+  for (double g : {gamma, -gamma}) {
+    Eigen::Vector3d m = r + alpha * a1.w + beta * a2.w + g * n;
+    result.push_back({subproblem1(a1, m, q), subproblem1(a2, p, m)});
+    if (gamma < 1e-10) {
+      break;
+    }
+  }
+  return result;
+}
+
+/** Paden-Kahan subproblem 3: |exp(a t) p - q| = delta */
+std::vector<double> subproblem3(Axis const &a, Eigen::Vector3d const &p, Eigen::Vector3d const &q,
+                                double delta) {
+  Eigen::Vector3d u = p - a.r;
+  Eigen::Vector3d v = q - a.r;
+  double h = a.w.dot(p - q);
+  u -= a.w * a.w.dot(u);
+  v -= a.w * a.w.dot(v);
+  double theta0 = std::atan2(a.w.dot(u.cross(v)), u.dot(v));
+  double cosPhi =
+      (u.squaredNorm() + v.squaredNorm() - delta * delta + h * h) / (2 * u.norm() * v.norm());
+  if (std::abs(cosPhi) > 1 + 1e-8) {
+    return {};
+  }
+  double phi = std::acos(std::clamp(cosPhi, -1.0, 1.0));
+  if (phi < 1e-10) {
+    return {theta0};
+  }
+  return {theta0 - phi, theta0 + phi};
+}
+
+class WristPartitionedIKSolver : public IIKSolver {
+  std::array<Axis, 6> mAxes;
+  std::array<int, 6> mIndices; // SAPIEN joint indices of the chain
+  std::array<double, 6> mLower;
+  std::array<double, 6> mUpper;
+  Eigen::Isometry3d mHome; // link pose at zero configuration
+  Eigen::Vector3d mShoulder;
+  Eigen::Vector3d mWrist;
+
+public:
+  WristPartitionedIKSolver(std::array<Axis, 6> const &axes, std::array<int, 6> const &indices,
+                           std::array<double, 6> const &lower, std::array<double, 6> const &upper,
+                           Eigen::Isometry3d const &home, Eigen::Vector3d const &shoulder,
+                           Eigen::Vector3d const &wrist)
+      : mAxes(axes), mIndices(indices), mLower(lower), mUpper(upper), mHome(home),
+        mShoulder(shoulder), mWrist(wrist) {}
+
+  std::string getName() const override { return "wrist_partitioned"; }
+
+  std::vector<Eigen::VectorXd> solve(physx::PxTransform const &pose,
+                                     Eigen::VectorXd const &seed) const override {
+    Eigen::Isometry3d target = Eigen::Isometry3d::Identity();
+    target.linear() = Eigen::Quaterniond(pose.q.w, pose.q.x, pose.q.y, pose.q.z)
+                          .normalized()
+                          .toRotationMatrix();
+    target.translation() = Eigen::Vector3d(pose.p.x, pose.p.y, pose.p.z);
+
+    // exp(a1 t1) ... exp(a6 t6) = g
+    Eigen::Isometry3d g = target * mHome.inverse();
+
+    // the wrist joints do not move the wrist center
+    Eigen::Vector3d wrist = g * mWrist;
+
+    std::vector<std::pair<double, Eigen::VectorXd>> solutions;
+    for (double t3 : subproblem3(mAxes[2], mWrist, mShoulder, (wrist - mShoulder).norm())) {
+      Eigen::Vector3d p = twistExp(mAxes[2], t3) * mWrist;
+      for (auto [t1, t2] : subproblem2(mAxes[0], mAxes[1], mShoulder, p, wrist)) {
+        Eigen::Isometry3d g456 =
+            (twistExp(mAxes[0], t1) * twistExp(mAxes[1], t2) * twistExp(mAxes[2], t3)).inverse() *
+            g;
+        Eigen::Vector3d p6 = mWrist + mAxes[5].w;
+        for (auto [t4, t5] : subproblem2(mAxes[3], mAxes[4], mWrist, p6, g456 * p6)) {
+          Eigen::Isometry3d g6 =
+              (twistExp(mAxes[3], t4) * twistExp(mAxes[4], t5)).inverse() * g456;
+          Eigen::Vector3d p = mWrist + mAxes[5].w.unitOrthogonal();
+          double t6 = subproblem1(mAxes[5], p, g6 * p);
+
+          std::array<double, 6> theta{t1, t2, t3, t4, t5, t6};
+          Eigen::Isometry3d check = Eigen::Isometry3d::Identity();
+          for (int i = 0; i < 6; ++i) {
+            check = check * twistExp(mAxes[i], theta[i]);
+          }
+          check = check * mHome;
+          if ((check.translation() - target.translation()).norm() > 1e-5 ||
+              (check.linear() - target.linear()).norm() > 1e-5) {
+            continue;
+          }
+
+          Eigen::VectorXd q = seed;
+          if (!wrapToLimits(theta, seed)) {
+            continue;
+          }
+          for (int i = 0; i < 6; ++i) {
+            q[mIndices[i]] = theta[i];
+          }
+          solutions.push_back({(q - seed).squaredNorm(), q});
+        }
+      }
+    }
+
+    std::sort(solutions.begin(), solutions.end(),
+              [](auto const &a, auto const &b) { return a.first < b.first; });
+    std::vector<Eigen::VectorXd> result;
+    for (auto &s : solutions) {
+      result.push_back(std::move(s.second));
+    }
+    return result;
+  }
+
+private:
+  /** shift each angle by a multiple of 2 pi towards the seed while staying in the limits */
+  bool wrapToLimits(std::array<double, 6> &theta, Eigen::VectorXd const &seed) const {
+    for (int i = 0; i < 6; ++i) {
+      double t = theta[i] + 2 * M_PI * std::round((seed[mIndices[i]] - theta[i]) / (2 * M_PI));
+      if (t < mLower[i]) {
+        t += 2 * M_PI * std::ceil((mLower[i] - t) / (2 * M_PI));
+      } else if (t > mUpper[i]) {
+        t -= 2 * M_PI * std::ceil((t - mUpper[i]) / (2 * M_PI));
+      }
+      if (t < mLower[i] - 1e-9 || t > mUpper[i] + 1e-9) {
+        return false;
+      }
+      theta[i] = t;
+    }
+    return true;
+  }
+};
+
+} // namespace
+
+KinematicStructure computeKinematicStructure(pinocchio::Model const &model,
+                                             Eigen::VectorXi const &indexS2P, int frameIdx) {
+  pinocchio::Data data(model);
+  pinocchio::forwardKinematics(model, data, pinocchio::neutral(model));
+
+  KinematicStructure structure;
+  structure.push_back(model.njoints);
+  for (int i = 1; i < model.njoints; ++i) {
+    structure.push_back(model.parents[i]);
+    structure.push_back(model.nqs[i]);
+    structure.push_back(model.nvs[i]);
+    structure.push_back(model.idx_vs[i]);
+    appendMatrix(structure, model.jointPlacements[i].rotation());
+    appendMatrix(structure, model.jointPlacements[i].translation());
+    appendMatrix(structure, data.joints[i].S().matrix());
+    for (int k = 0; k < model.nqs[i]; ++k) {
+      appendReal(structure, model.lowerPositionLimit[model.idx_qs[i] + k]);
+      appendReal(structure, model.upperPositionLimit[model.idx_qs[i] + k]);
+    }
+  }
+  structure.push_back(model.frames[frameIdx].parent);
+  appendMatrix(structure, model.frames[frameIdx].placement.rotation());
+  appendMatrix(structure, model.frames[frameIdx].placement.translation());
+  structure.push_back(indexS2P.size());
+  for (Eigen::Index s = 0; s < indexS2P.size(); ++s) {
+    structure.push_back(indexS2P[s]);
+  }
+  return structure;
+}
+
+size_t hashKinematicStructure(KinematicStructure const &structure) {
+  size_t seed = 0;
+  for (int64_t v : structure) {
+    hashCombine(seed, v);
+  }
+  return seed;
+}
+
+std::shared_ptr<IIKSolver> createWristPartitionedIKSolver(pinocchio::Model const &model,
+                                                          Eigen::VectorXi const &indexS2P,
+                                                          int frameIdx) {
+  pinocchio::Data data(model);
+  pinocchio::forwardKinematics(model, data, pinocchio::neutral(model));
+
+  std::vector<pinocchio::JointIndex> chain;
+  for (auto j = model.frames[frameIdx].parent; j > 0; j = model.parents[j]) {
+    chain.insert(chain.begin(), j);
+  }
+  if (chain.size() != 6) {
+    return nullptr;
+  }
+
+  std::array<Axis, 6> axes;
+  std::array<int, 6> indices;
+  std::array<double, 6> lower;
+  std::array<double, 6> upper;
+  for (int i = 0; i < 6; ++i) {
+    auto j = chain[i];
+    if (model.nvs[j] != 1) {
+      return nullptr;
+    }
+    // only revolute joints, the neutral configuration is the zero configuration
+    Eigen::Matrix<double, 6, 1> S = data.joints[j].S().matrix();
+    if (S.head<3>().norm() > 1e-9) {
+      return nullptr;
+    }
+    axes[i] = {data.oMi[j].rotation() * S.tail<3>().normalized(), data.oMi[j].translation()};
+
+    indices[i] = -1;
+    for (Eigen::Index s = 0; s < indexS2P.size(); ++s) {
+      if (indexS2P[s] == model.idx_vs[j]) {
+        indices[i] = s;
+      }
+    }
+    if (indices[i] < 0) {
+      return nullptr;
+    }
+
+    if (model.nqs[j] == 1) {
+      lower[i] = model.lowerPositionLimit[model.idx_qs[j]];
+      upper[i] = model.upperPositionLimit[model.idx_qs[j]];
+    } else {
+      lower[i] = -std::numeric_limits<double>::infinity();
+      upper[i] = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  Eigen::Vector3d shoulder;
+  Eigen::Vector3d wrist;
+  if (!intersectAxes(axes[0], axes[1], shoulder) || !intersectAxes(axes[3], axes[4], wrist) ||
+      !isOnAxis(axes[5], wrist) || axes[4].w.cross(axes[5].w).norm() < 1e-5) {
+    return nullptr;
+  }
+  // the elbow must change the shoulder to wrist distance
+  if (isOnAxis(axes[2], shoulder) || isOnAxis(axes[2], wrist)) {
+    return nullptr;
+  }
+
+  auto const &frame = model.frames[frameIdx];
+  pinocchio::SE3 home = data.oMi[frame.parent] * frame.placement;
+  Eigen::Isometry3d homeIso = Eigen::Isometry3d::Identity();
+  homeIso.linear() = home.rotation();
+  homeIso.translation() = home.translation();
+
+  return std::make_shared<WristPartitionedIKSolver>(axes, indices, lower, upper, homeIso,
+                                                    shoulder, wrist);
+}
+
+IKSolverRegistry &IKSolverRegistry::Get() {
+  static IKSolverRegistry registry;
+  return registry;
+}
+
+IKSolverRegistry::IKSolverRegistry() {
+  mFactories.push_back({"wrist_partitioned", createWristPartitionedIKSolver});
+}
+
+void IKSolverRegistry::registerFactory(std::string const &name, IKSolverFactory factory) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mFactories.push_back({name, factory});
+  mCache.clear();
+}
+
+std::vector<std::string> IKSolverRegistry::getFactoryNames() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  std::vector<std::string> names;
+  for (auto &[name, factory] : mFactories) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+std::shared_ptr<IIKSolver> IKSolverRegistry::findSolver(pinocchio::Model const &model,
+                                                        Eigen::VectorXi const &indexS2P,
+                                                        int frameIdx) {
+  auto structure = computeKinematicStructure(model, indexS2P, frameIdx);
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto &entries = mCache[hashKinematicStructure(structure)];
+  for (auto &[cachedStructure, cachedSolver] : entries) {
+    if (cachedStructure == structure) {
+      return cachedSolver;
+    }
+  }
+  std::shared_ptr<IIKSolver> solver;
+  for (auto f = mFactories.rbegin(); f != mFactories.rend() && !solver; ++f) {
+    solver = f->second(model, indexS2P, frameIdx);
+  }
+  entries.push_back({std::move(structure), solver});
+  return solver;
+}
+
+void IKSolverRegistry::clearCache() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCache.clear();
+}
+
+size_t IKSolverRegistry::getCacheSize() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  size_t size = 0;
+  for (auto &[hash, entries] : mCache) {
+    size += entries.size();
+  }
+  return size;
+}
+
+} // namespace sapien
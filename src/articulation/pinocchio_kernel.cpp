@@ -0,0 +1,364 @@
+#include "sapien/articulation/pinocchio_kernel.h"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+
+namespace sapien {
+
+namespace {
+
+template <typename Scalar> struct KernelSE3 {
+  using Matrix3 = Eigen::Matrix<Scalar, 3, 3>;
+  using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+
+  Matrix3 R{Matrix3::Identity()};
+  Vector3 p{Vector3::Zero()};
+
+  inline KernelSE3 operator*(KernelSE3 const &other) const {
+    return {R * other.R, R * other.p + p};
+  }
+  inline KernelSE3 inverse() const { return {R.transpose(), -(R.transpose() * p)}; }
+
+  static KernelSE3 fromPose(physx::PxTransform const &pose) {
+    KernelSE3 T;
+    T.R = Eigen::Quaternion<Scalar>(pose.q.w, pose.q.x, pose.q.y, pose.q.z).toRotationMatrix();
+    T.p = {pose.p.x, pose.p.y, pose.p.z};
+    return T;
+  }
+  static KernelSE3 fromSE3(pinocchio::SE3 const &M) {
+    return {M.rotation().template cast<Scalar>(), M.translation().template cast<Scalar>()};
+  }
+  physx::PxTransform toPose() const {
+    Eigen::Quaternion<Scalar> q(R);
+    return {physx::PxVec3(p.x(), p.y(), p.z()), physx::PxQuat(q.x(), q.y(), q.z(), q.w())};
+  }
+};
+
+/** same convention as pinocchio::log6, linear part first */
+template <typename Scalar> Eigen::Matrix<Scalar, 6, 1> log6(KernelSE3<Scalar> const &M) {
+  Eigen::AngleAxis<Scalar> aa(M.R);
+  Scalar t = aa.angle();
+  Eigen::Matrix<Scalar, 3, 1> w = aa.axis() * t;
+
+  // below this angle the closed form loses precision, about 1e-4 for double and 2e-2 for float
+  static const Scalar taylorThreshold =
+      std::sqrt(std::sqrt(std::numeric_limits<Scalar>::epsilon()));
+
+  Scalar alpha, beta;
+  Scalar t2 = t * t;
+  if (t < taylorThreshold) {
+    alpha = Scalar(1) - t2 / Scalar(12) - t2 * t2 / Scalar(720);
+    beta = Scalar(1) / Scalar(12) + t2 / Scalar(720);
+  } else {
+    Scalar st = std::sin(t);
+    Scalar ct = std::cos(t);
+    alpha = t * st / (Scalar(2) * (Scalar(1) - ct));
+    beta = Scalar(1) / t2 - st / (Scalar(2) * t * (Scalar(1) - ct));
+  }
+
+  Eigen::Matrix<Scalar, 6, 1> out;
+  out.template head<3>() = alpha * M.p - Scalar(0.5) * w.cross(M.p) + beta * w.dot(M.p) * w;
+  out.template tail<3>() = w;
+  return out;
+}
+
+template <int N, typename Scalar> class FixedDofKinematicsKernel : public IKinematicsKernel {
+  using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+  using Vector6 = Eigen::Matrix<Scalar, 6, 1>;
+  using Matrix6 = Eigen::Matrix<Scalar, 6, 6>;
+  using VectorN = Eigen::Matrix<Scalar, N, 1>;
+  using Matrix6N = Eigen::Matrix<Scalar, 6, N>;
+  using SE3 = KernelSE3<Scalar>;
+
+  // joint tree, in pinocchio order (parents come before children)
+  std::array<int, N> mParent;        // -1 for the universe
+  std::array<SE3, N> mPlacement;     // joint frame in parent joint frame
+  std::array<Vector3, N> mAxis;      // motion axis in joint frame
+  std::array<bool, N> mPrismatic;    // false for revolute
+  std::array<bool, N> mContinuous;   // unbounded revolute, stored as (cos, sin) by pinocchio
+  std::array<uint32_t, N> mSupport;  // bit j is set if joint j moves joint i
+  std::array<int, N> mS2K;           // SAPIEN joint index to kernel index
+
+  std::vector<int> mLinkJoint;       // parent joint of each link, -1 for the universe
+  std::vector<SE3> mLinkPlacement;   // link frame in parent joint frame
+
+  std::array<SE3, N> mJointPose;
+  Matrix6N mWorldJacobian;
+
+public:
+  FixedDofKinematicsKernel(pinocchio::Model const &model, Eigen::VectorXi const &indexS2P,
+                           std::vector<int> const &linkIdx2FrameIdx) {
+    pinocchio::Data data(model);
+    pinocchio::forwardKinematics(model, data, pinocchio::neutral(model));
+
+    for (int i = 1; i < model.njoints; ++i) {
+      int k = i - 1;
+      mParent[k] = static_cast<int>(model.parents[i]) - 1;
+      mPlacement[k] = SE3::fromSE3(model.jointPlacements[i]);
+
+      Eigen::Matrix<double, 6, 1> S = data.joints[i].S().matrix();
+      mPrismatic[k] = S.head<3>().norm() > S.tail<3>().norm();
+      mContinuous[k] = model.nqs[i] == 2;
+      Eigen::Vector3d axis = mPrismatic[k] ? S.head<3>() : S.tail<3>();
+      mAxis[k] = axis.normalized().cast<Scalar>();
+      mSupport[k] = (mParent[k] >= 0 ? mSupport[mParent[k]] : 0u) | (1u << k);
+    }
+    for (int s = 0; s < N; ++s) {
+      mS2K[s] = indexS2P[s];
+    }
+
+    for (auto frameIdx : linkIdx2FrameIdx) {
+      auto const &frame = model.frames[frameIdx];
+      mLinkJoint.push_back(static_cast<int>(frame.parent) - 1);
+      mLinkPlacement.push_back(SE3::fromSE3(frame.placement));
+    }
+  }
+
+  std::string getName() const override {
+    return "fixed<" + std::to_string(N) + ", " +
+           (std::is_same_v<Scalar, float> ? "float" : "double") + ">";
+  }
+
+  void computeForwardKinematics(Eigen::VectorXd const &qpos) override {
+    forwardKinematics(toKernel(qpos));
+  }
+
+  physx::PxTransform getLinkPose(uint32_t index) const override {
+    checkLink(index);
+    return linkPose(index).toPose();
+  }
+
+  void computeFullJacobian(Eigen::VectorXd const &qpos) override {
+    forwardKinematics(toKernel(qpos));
+    computeWorldJacobian();
+  }
+
+  Eigen::Matrix<double, 6, Eigen::Dynamic> getLinkJacobian(uint32_t index,
+                                                           bool local) const override {
+    checkLink(index);
+    Matrix6N J = supportedColumns(mLinkJoint[index]);
+    if (local) {
+      J = actInv(linkPose(index), J);
+    }
+    return toSapien(J);
+  }
+
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  computeSingleLinkLocalJacobian(Eigen::VectorXd const &qpos, uint32_t index) override {
+    checkLink(index);
+    forwardKinematics(toKernel(qpos));
+    computeWorldJacobian();
+    return toSapien(actInv(linkPose(index), supportedColumns(mLinkJoint[index])));
+  }
+
+  std::tuple<Eigen::VectorXd, bool, Eigen::Matrix<double, 6, 1>>
+  computeInverseKinematics(uint32_t linkIdx, physx::PxTransform const &pose,
+                           Eigen::VectorXd const &initialQpos,
+                           Eigen::VectorXi const &activeQMask, double eps, int maxIter,
+                           double dt, double damp) override {
+    checkLink(linkIdx);
+
+    // neutral configuration of revolute and prismatic joints is 0
+    VectorN q = initialQpos.size() == 0 ? VectorN::Zero() : toKernel(initialQpos);
+    VectorN mask = VectorN::Ones();
+    if (activeQMask.size() > 0) {
+      for (int s = 0; s < N; ++s) {
+        mask[mS2K[s]] = static_cast<Scalar>(activeQMask[s]);
+      }
+    }
+
+    int jointIdx = mLinkJoint[linkIdx];
+    SE3 oMdesInv = (SE3::fromPose(pose) * mLinkPlacement[linkIdx].inverse()).inverse();
+
+    bool success = false;
+    Vector6 err;
+    Vector6 bestErr = Vector6::Zero();
+    VectorN bestQ = q;
+    Scalar minError = std::numeric_limits<Scalar>::max();
+    Matrix6N J;
+    Matrix6 JJt;
+    VectorN v;
+
+    for (int i = 0;; i++) {
+      forwardKinematics(q);
+      err = log6(oMdesInv * jointPose(jointIdx));
+      Scalar errNorm = err.norm();
+      if (errNorm < minError) {
+        minError = errNorm;
+        bestQ = q;
+        bestErr = err;
+      }
+      if (errNorm < eps) {
+        success = true;
+        break;
+      }
+      if (i >= maxIter) {
+        success = false;
+        break;
+      }
+      computeWorldJacobian();
+      J.noalias() = actInv(jointPose(jointIdx), supportedColumns(jointIdx)) * mask.asDiagonal();
+
+      JJt.noalias() = J * J.transpose();
+      JJt.diagonal().array() += static_cast<Scalar>(damp);
+      v.noalias() = -J.transpose() * JJt.ldlt().solve(err);
+      q += v * static_cast<Scalar>(dt);
+    }
+
+    // same range as the angle PinocchioModel recovers from (cos, sin)
+    for (int k = 0; k < N; ++k) {
+      if (mContinuous[k]) {
+        bestQ[k] = std::atan2(std::sin(bestQ[k]), std::cos(bestQ[k]));
+      }
+    }
+    return {toSapien(bestQ), success, bestErr.template cast<double>()};
+  }
+
+private:
+  inline void checkLink(uint32_t index) const {
+    if (index >= mLinkJoint.size()) {
+      throw std::runtime_error("link index out of bound");
+    }
+  }
+
+  inline VectorN toKernel(Eigen::VectorXd const &qext) const {
+    if (qext.size() != N) {
+      throw std::runtime_error("qpos size does not match model DOF");
+    }
+    VectorN q;
+    for (int s = 0; s < N; ++s) {
+      q[mS2K[s]] = static_cast<Scalar>(qext[s]);
+    }
+    return q;
+  }
+
+  inline Eigen::VectorXd toSapien(VectorN const &q) const {
+    Eigen::VectorXd qext(N);
+    for (int s = 0; s < N; ++s) {
+      qext[s] = q[mS2K[s]];
+    }
+    return qext;
+  }
+
+  inline Eigen::Matrix<double, 6, Eigen::Dynamic> toSapien(Matrix6N const &J) const {
+    Eigen::Matrix<double, 6, Eigen::Dynamic> Jext(6, N);
+    for (int s = 0; s < N; ++s) {
+      Jext.col(s) = J.col(mS2K[s]).template cast<double>();
+    }
+    return Jext;
+  }
+
+  inline SE3 jointPose(int joint) const { return joint < 0 ? SE3{} : mJointPose[joint]; }
+  inline SE3 linkPose(uint32_t link) const {
+    return jointPose(mLinkJoint[link]) * mLinkPlacement[link];
+  }
+
+  void forwardKinematics(VectorN const &q) {
+    for (int k = 0; k < N; ++k) {
+      SE3 motion;
+      if (mPrismatic[k]) {
+        motion.p = mAxis[k] * q[k];
+      } else {
+        motion.R = Eigen::AngleAxis<Scalar>(q[k], mAxis[k]).toRotationMatrix();
+      }
+      mJointPose[k] =
+          (mParent[k] < 0 ? mPlacement[k] : mJointPose[mParent[k]] * mPlacement[k]) * motion;
+    }
+  }
+
+  /** Jacobian of every joint expressed in the world frame, same as pinocchio WORLD */
+  void computeWorldJacobian() {
+    for (int k = 0; k < N; ++k) {
+      Vector3 axis = mJointPose[k].R * mAxis[k];
+      if (mPrismatic[k]) {
+        mWorldJacobian.col(k) << axis, Vector3::Zero();
+      } else {
+        mWorldJacobian.col(k) << mJointPose[k].p.cross(axis), axis;
+      }
+    }
+  }
+
+  inline Matrix6N supportedColumns(int joint) const {
+    Matrix6N J = Matrix6N::Zero();
+    if (joint < 0) {
+      return J;
+    }
+    for (int k = 0; k < N; ++k) {
+      if (mSupport[joint] & (1u << k)) {
+        J.col(k) = mWorldJacobian.col(k);
+      }
+    }
+    return J;
+  }
+
+  /** express world frame motions in frame M */
+  static inline Matrix6N actInv(SE3 const &M, Matrix6N const &J) {
+    Matrix6N out;
+    auto Rt = M.R.transpose();
+    for (int k = 0; k < N; ++k) {
+      Vector3 v = J.col(k).template head<3>();
+      Vector3 w = J.col(k).template tail<3>();
+      out.col(k) << Rt * (v - M.p.cross(w)), Rt * w;
+    }
+    return out;
+  }
+};
+
+bool isFixedDofSupported(pinocchio::Model const &model) {
+  if (model.njoints - 1 != model.nv) {
+    return false;
+  }
+  pinocchio::Data data(model);
+  pinocchio::forwardKinematics(model, data, pinocchio::neutral(model));
+  for (int i = 1; i < model.njoints; ++i) {
+    if (model.nvs[i] != 1 || model.idx_vs[i] != i - 1 || model.nqs[i] > 2) {
+      return false;
+    }
+    // a pure rotation or a pure translation along one axis
+    Eigen::Matrix<double, 6, 1> S = data.joints[i].S().matrix();
+    double linear = S.head<3>().norm();
+    double angular = S.tail<3>().norm();
+    if ((linear > 1e-9) == (angular > 1e-9)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <int N>
+std::unique_ptr<IKinematicsKernel>
+createKernel(pinocchio::Model const &model, Eigen::VectorXi const &indexS2P,
+             std::vector<int> const &linkIdx2FrameIdx, bool singlePrecision) {
+  if (singlePrecision) {
+    return std::make_unique<FixedDofKinematicsKernel<N, float>>(model, indexS2P,
+                                                                linkIdx2FrameIdx);
+  }
+  return std::make_unique<FixedDofKinematicsKernel<N, double>>(model, indexS2P,
+                                                               linkIdx2FrameIdx);
+}
+
+} // namespace
+
+std::unique_ptr<IKinematicsKernel>
+createFixedDofKinematicsKernel(pinocchio::Model const &model, Eigen::VectorXi const &indexS2P,
+                               std::vector<int> const &linkIdx2FrameIdx, bool singlePrecision) {
+  if (indexS2P.size() != model.nv || !isFixedDofSupported(model)) {
+    return nullptr;
+  }
+  switch (model.nv) {
+  case 6:
+    return createKernel<6>(model, indexS2P, linkIdx2FrameIdx, singlePrecision);
+  case 7:
+    return createKernel<7>(model, indexS2P, linkIdx2FrameIdx, singlePrecision);
+  case 9:
+    return createKernel<9>(model, indexS2P, linkIdx2FrameIdx, singlePrecision);
+  default:
+    return nullptr;
+  }
+}
+
+} // namespace sapien
@@ -10,6 +10,10 @@
   }
 
 namespace sapien {
+
+/** CLIK iterations spent refining an analytic solution */
+static constexpr int kAnalyticIKPolishIterations = 10;
+
 std::unique_ptr<PinocchioModel> PinocchioModel::fromURDFXML(std::string const &urdf,
                                                             Eigen::Vector3d gravity) {
   auto m = std::unique_ptr<PinocchioModel>(new PinocchioModel);
@@ -99,6 +103,8 @@ void PinocchioModel::setJointOrder(std::vector<std::string> names) {
     NV[N] = model.nvs[i];
     QIDX[N] = model.idx_qs[i];
   }
+  ikSolvers.clear();
+  updateKinematicsKernel();
 }
 
 void PinocchioModel::setLinkOrder(std::vector<std::string> names) {
@@ -111,6 +117,72 @@ void PinocchioModel::setLinkOrder(std::vector<std::string> names) {
     }
     linkIdx2FrameIdx.push_back(i);
   }
+  ikSolvers.clear();
+  updateKinematicsKernel();
+}
+
+void PinocchioModel::updateKinematicsKernel() {
+  kernel.reset();
+  kernelDataState = KernelDataState::eNone;
+  if (!fixedDofKernelEnabled || linkIdx2FrameIdx.empty() || QIDX.size() == 0) {
+    return;
+  }
+  kernel = createFixedDofKinematicsKernel(model, indexS2P.indices(), linkIdx2FrameIdx,
+                                          singlePrecisionKernel);
+}
+
+void PinocchioModel::setFixedDofKernelEnabled(bool enabled, bool singlePrecision) {
+  fixedDofKernelEnabled = enabled;
+  singlePrecisionKernel = singlePrecision;
+  updateKinematicsKernel();
+}
+
+void PinocchioModel::markKernelData(Eigen::VectorXd const &qpos, KernelDataState state) {
+  kernelQpos = qpos;
+  kernelDataState = state;
+}
+
+pinocchio::Data &PinocchioModel::getInternalData() {
+  switch (kernelDataState) {
+  case KernelDataState::eNone:
+    break;
+  case KernelDataState::eForwardKinematics:
+    pinocchio::forwardKinematics(model, data, posS2P(kernelQpos));
+    break;
+  case KernelDataState::eJacobian:
+    pinocchio::computeJointJacobians(model, data, posS2P(kernelQpos));
+    break;
+  }
+  kernelDataState = KernelDataState::eNone;
+  return data;
+}
+
+std::string PinocchioModel::getKinematicsKernelName() const {
+  return kernel ? kernel->getName() : "pinocchio";
+}
+
+void PinocchioModel::setAnalyticIKEnabled(bool enabled) { analyticIKEnabled = enabled; }
+
+void PinocchioModel::setIKSolver(uint32_t linkIdx, std::shared_ptr<IIKSolver> solver) {
+  ASSERT(linkIdx < linkIdx2FrameIdx.size(), "link index out of bound");
+  ikSolvers[linkIdx] = solver;
+}
+
+std::shared_ptr<IIKSolver> PinocchioModel::getIKSolver(uint32_t linkIdx) {
+  ASSERT(linkIdx < linkIdx2FrameIdx.size(), "link index out of bound");
+  auto it = ikSolvers.find(linkIdx);
+  if (it != ikSolvers.end()) {
+    return it->second;
+  }
+  auto solver =
+      IKSolverRegistry::Get().findSolver(model, indexS2P.indices(), linkIdx2FrameIdx[linkIdx]);
+  ikSolvers[linkIdx] = solver;
+  return solver;
+}
+
+std::string PinocchioModel::getIKSolverName(uint32_t linkIdx) {
+  auto solver = getIKSolver(linkIdx);
+  return solver ? solver->getName() : "clik";
 }
 
 Eigen::MatrixXd PinocchioModel::getRandomConfiguration() {
@@ -118,11 +190,20 @@ Eigen::MatrixXd PinocchioModel::getRandomConfiguration() {
 }
 
 void PinocchioModel::computeForwardKinematics(const Eigen::VectorXd &qpos) {
+  if (kernel) {
+    kernel->computeForwardKinematics(qpos);
+    markKernelData(qpos, KernelDataState::eForwardKinematics);
+    return;
+  }
+  kernelDataState = KernelDataState::eNone;
   pinocchio::forwardKinematics(model, data, posS2P(qpos));
 }
 
 physx::PxTransform PinocchioModel::getLinkPose(uint32_t index) {
   ASSERT(index < linkIdx2FrameIdx.size(), "link index out of bound");
+  if (kernel) {
+    return kernel->getLinkPose(index);
+  }
   auto frame = linkIdx2FrameIdx[index];
   auto parentJoint = model.frames[frame].parent;
   auto link2joint = model.frames[frame].placement;
@@ -135,12 +216,21 @@ physx::PxTransform PinocchioModel::getLinkPose(uint32_t index) {
 }
 
 void PinocchioModel::computeFullJacobian(const Eigen::VectorXd &qpos) {
+  if (kernel) {
+    kernel->computeFullJacobian(qpos);
+    markKernelData(qpos, KernelDataState::eJacobian);
+    return;
+  }
+  kernelDataState = KernelDataState::eNone;
   pinocchio::computeJointJacobians(model, data, posS2P(qpos));
 }
 
 Eigen::Matrix<double, 6, Eigen::Dynamic> PinocchioModel::getLinkJacobian(uint32_t index,
                                                                          bool local) {
   ASSERT(index < linkIdx2FrameIdx.size(), "link index out of bound");
+  if (kernel) {
+    return kernel->getLinkJacobian(index, local);
+  }
   auto frameIdx = linkIdx2FrameIdx[index];
   auto jointIdx = model.frames[frameIdx].parent;
 
@@ -162,6 +252,11 @@ Eigen::Matrix<double, 6, Eigen::Dynamic> PinocchioModel::getLinkJacobian(uint32_
 Eigen::Matrix<double, 6, Eigen::Dynamic>
 PinocchioModel::computeSingleLinkLocalJacobian(Eigen::VectorXd const &qpos, uint32_t index) {
   ASSERT(index < linkIdx2FrameIdx.size(), "link index out of bound");
+  if (kernel) {
+    markKernelData(qpos, KernelDataState::eJacobian);
+    return kernel->computeSingleLinkLocalJacobian(qpos, index);
+  }
+  kernelDataState = KernelDataState::eNone;
   auto frameIdx = linkIdx2FrameIdx[index];
   auto jointIdx = model.frames[frameIdx].parent;
   auto link2joint = model.frames[frameIdx].placement;
@@ -173,6 +268,7 @@ PinocchioModel::computeSingleLinkLocalJacobian(Eigen::VectorXd const &qpos, uint
 }
 
 Eigen::MatrixXd PinocchioModel::computeGeneralizedMassMatrix(const Eigen::VectorXd &qpos) {
+  kernelDataState = KernelDataState::eNone;
   pinocchio::crba(model, data, posS2P(qpos));
   data.M.triangularView<Eigen::StrictlyLower>() =
       data.M.transpose().triangularView<Eigen::StrictlyLower>();
@@ -181,6 +277,7 @@ Eigen::MatrixXd PinocchioModel::computeGeneralizedMassMatrix(const Eigen::Vector
 
 Eigen::MatrixXd PinocchioModel::computeCoriolisMatrix(const Eigen::VectorXd &qpos,
                                                       const Eigen::VectorXd &qvel) {
+  kernelDataState = KernelDataState::eNone;
   return indexS2P.transpose() *
          pinocchio::computeCoriolisMatrix(model, data, posS2P(qpos), indexS2P * qvel) * indexS2P;
 }
@@ -188,6 +285,7 @@ Eigen::MatrixXd PinocchioModel::computeCoriolisMatrix(const Eigen::VectorXd &qpo
 Eigen::VectorXd PinocchioModel::computeInverseDynamics(const Eigen::VectorXd &qpos,
                                                        const Eigen::VectorXd &qvel,
                                                        const Eigen::VectorXd &qacc) {
+  kernelDataState = KernelDataState::eNone;
   return indexS2P.transpose() *
          pinocchio::rnea(model, data, posS2P(qpos), indexS2P * qvel, indexS2P * qacc);
 }
@@ -195,6 +293,7 @@ Eigen::VectorXd PinocchioModel::computeInverseDynamics(const Eigen::VectorXd &qp
 Eigen::VectorXd PinocchioModel::computeForwardDynamics(const Eigen::VectorXd &qpos,
                                                        const Eigen::VectorXd &qvel,
                                                        const Eigen::VectorXd &qf) {
+  kernelDataState = KernelDataState::eNone;
   return indexS2P.transpose() *
          pinocchio::aba(model, data, posS2P(qpos), indexS2P * qvel, indexS2P * qf);
 }
@@ -205,6 +304,42 @@ PinocchioModel::computeInverseKinematics(uint32_t linkIdx, physx::PxTransform co
                                          Eigen::VectorXi const &activeQMask, double eps,
                                          int maxIter, double dt, double damp) {
   ASSERT(linkIdx < linkIdx2FrameIdx.size(), "link index out of bound");
+  if (analyticIKEnabled) {
+    if (auto solver = getIKSolver(linkIdx)) {
+      Eigen::VectorXd seed =
+          initialQpos.size() == 0 ? posP2S(pinocchio::neutral(model)) : initialQpos;
+      for (auto const &q : solver->solve(pose, seed)) {
+        // inactive joints must keep their initial value
+        if (activeQMask.size() > 0 &&
+            ((q - seed).array().abs() * (activeQMask.array() == 0).cast<double>()).maxCoeff() >
+                1e-9) {
+          continue;
+        }
+        auto result =
+            computeInverseKinematicsCLIK(linkIdx, pose, q, activeQMask, eps,
+                                         std::min(maxIter, kAnalyticIKPolishIterations), dt, damp);
+        if (std::get<1>(result)) {
+          return result;
+        }
+      }
+    }
+  }
+  return computeInverseKinematicsCLIK(linkIdx, pose, initialQpos, activeQMask, eps, maxIter, dt,
+                                      damp);
+}
+
+std::tuple<Eigen::VectorXd, bool, Eigen::Matrix<double, 6, 1>>
+PinocchioModel::computeInverseKinematicsCLIK(uint32_t linkIdx, physx::PxTransform const &pose,
+                                             Eigen::VectorXd const &initialQpos,
+                                             Eigen::VectorXi const &activeQMask, double eps,
+                                             int maxIter, double dt, double damp) {
+  if (kernel) {
+    auto result = kernel->computeInverseKinematics(linkIdx, pose, initialQpos, activeQMask, eps,
+                                                   maxIter, dt, damp);
+    markKernelData(std::get<0>(result), KernelDataState::eJacobian);
+    return result;
+  }
+  kernelDataState = KernelDataState::eNone;
   Eigen::VectorXd q;
   if (initialQpos.size() == 0) {
     q = pinocchio::neutral(model);
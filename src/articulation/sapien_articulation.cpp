@@ -1,4 +1,5 @@
 #include "sapien/articulation/sapien_articulation.h"
+#include "sapien/articulation/articulation_controller.h"
 #include "sapien/articulation/sapien_joint.h"
 #include "sapien/articulation/sapien_link.h"
 #include "sapien/sapien_scene.h"
@@ -22,6 +23,70 @@ static Eigen::Matrix3f skewSymmetric(Eigen::Vector3f t) {
   return hatMatrix;
 };
 
+static Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor>
+relativeTransformation(PxTransform const &s, PxTransform const &t) {
+  auto relative = t.getInverse().transform(s);
+
+  Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor> mat44 =
+      Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor>::Identity(4, 4);
+  Eigen::Quaternionf quat(relative.q.w, relative.q.x, relative.q.y, relative.q.z);
+  mat44.block<3, 3>(0, 0) = quat.normalized().toRotationMatrix();
+  mat44.block<3, 1>(0, 3) = Eigen::Matrix<PxReal, 3, 1>(relative.p.x, relative.p.y, relative.p.z);
+  return mat44;
+}
+
+static Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor>
+adjointMatrix(Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor> const &mat44) {
+  Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor> adjoint =
+      Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor>::Zero(6, 6);
+  adjoint.block<3, 3>(0, 0) = mat44.block<3, 3>(0, 0);
+  adjoint.block<3, 3>(3, 3) = mat44.block<3, 3>(0, 0);
+  Eigen::Vector3f position = mat44.block<3, 1>(0, 3);
+  adjoint.block<3, 3>(0, 3) = skewSymmetric(position) * mat44.block<3, 3>(0, 0);
+  return adjoint;
+}
+
+/** pseudo-inverse of a 6 x Cols Jacobian, small singular values are truncated */
+template <int Cols>
+static Eigen::Matrix<PxReal, Cols, 6> pseudoInverse(Eigen::MatrixXf const &jacobian) {
+  using JacobianType = Eigen::Matrix<PxReal, 6, Cols>;
+  JacobianType J = jacobian;
+
+  // thin decompositions are only available for dynamic sizes
+  constexpr int options = Cols == Eigen::Dynamic ? Eigen::ComputeThinU | Eigen::ComputeThinV
+                                                 : Eigen::ComputeFullU | Eigen::ComputeFullV;
+  Eigen::JacobiSVD<JacobianType> svd_of_j(J, options);
+  auto const &u = svd_of_j.matrixU();
+  auto const &v = svd_of_j.matrixV();
+  auto const &s = svd_of_j.singularValues();
+
+  auto invS = s;
+  static const float epsilon = std::numeric_limits<float>::epsilon();
+  double maxS = s[0];
+  for (std::size_t i = 0; i < static_cast<std::size_t>(s.rows()); ++i) {
+    invS(i) = fabs(s(i)) > maxS * epsilon ? 1.0 / s(i) : 0.0;
+  }
+  auto rank = s.rows();
+  return v.leftCols(rank) * invS.asDiagonal() * u.leftCols(rank).transpose();
+}
+
+template <typename T, typename F>
+T const &SArticulation::cached(CachedValue<T> &entry, F &&compute) {
+  bool outermost = mCacheDepth == 0;
+  if (mKinematicsCacheEnabled && entry.version == mStateVersion) {
+    mKinematicsCacheStats.hits += outermost;
+    return entry.value;
+  }
+  mKinematicsCacheStats.misses += outermost;
+  struct DepthGuard {
+    uint32_t &depth;
+    ~DepthGuard() { --depth; }
+  } guard{++mCacheDepth};
+  entry.value = compute();
+  entry.version = mStateVersion;
+  return entry.value;
+}
+
 std::vector<SLinkBase *> SArticulation::getBaseLinks() {
   std::vector<SLinkBase *> result;
   result.reserve(mLinks.size());
@@ -63,6 +128,16 @@ void SArticulation::setQpos(std::vector<physx::PxReal> const &v) {
   Eigen::Map<Eigen::VectorXf>(mCache->jointPosition, n) =
       mPermutationE2I * Eigen::Map<Eigen::VectorXf const>(v.data(), n);
   mPxArticulation->applyCache(*mCache, PxArticulationCache::ePOSITION);
+  markStateChanged();
+  markLinksMoved();
+}
+
+void SArticulation::unpackQpos(std::vector<PxReal> const &qpos) {
+  CHECK_SIZE(qpos);
+  std::copy(qpos.begin(), qpos.end(), mCache->jointPosition);
+  mPxArticulation->applyCache(*mCache, PxArticulationCache::ePOSITION);
+  markStateChanged();
+  markLinksMoved();
 }
 
 std::vector<physx::PxReal> SArticulation::getQvel() const {
@@ -82,6 +157,8 @@ void SArticulation::setQvel(std::vector<physx::PxReal> const &v) {
   Eigen::Map<Eigen::VectorXf>(mCache->jointVelocity, n) =
       mPermutationE2I * Eigen::Map<Eigen::VectorXf const>(v.data(), n);
   mPxArticulation->applyCache(*mCache, PxArticulationCache::eVELOCITY);
+  markStateChanged();
+  markLinksMoved();
 }
 
 std::vector<physx::PxReal> SArticulation::getQacc() const {
@@ -144,20 +221,32 @@ void SArticulation::setQlimits(std::vector<std::array<physx::PxReal, 2>> const &
 
 void SArticulation::setRootPose(physx::PxTransform const &T) {
   mPxArticulation->teleportRootLink(T, true);
+  markStateChanged();
+  markLinksMoved();
 }
 
 void SArticulation::setRootVelocity(physx::PxVec3 const &v) {
   mRootLink->getPxActor()->setLinearVelocity(v);
+  markStateChanged();
+  markLinksMoved();
 }
 
 void SArticulation::setRootAngularVelocity(physx::PxVec3 const &omega) {
   mRootLink->getPxActor()->setAngularVelocity(omega);
+  markStateChanged();
+  markLinksMoved();
 }
 
 SLinkBase *SArticulation::getRootLink() const { return mRootLink; }
 
 SArticulation::SArticulation(SScene *scene) : SArticulationDrivable(scene) {}
 
+void SArticulation::markLinksMoved() {
+  for (auto &link : mLinks) {
+    link->markPoseChanged();
+  }
+}
+
 void SArticulation::setDriveTarget(std::vector<physx::PxReal> const &v) {
   CHECK_SIZE(v);
   auto n = dof();
@@ -250,24 +339,36 @@ bool SArticulation::isBaseFixed() const {
 void SArticulation::resetCache() {
   mPxArticulation->releaseCache(*mCache);
   mCache = mPxArticulation->createCache();
+  markStateChanged();
 }
 std::vector<physx::PxReal>
 SArticulation::computePassiveForce(bool gravity, bool coriolisAndCentrifugal, bool external) {
-  mPxArticulation->commonInit();
   auto n = dof();
 
   std::vector<physx::PxReal> passiveForce(n, 0);
   Eigen::Map<Eigen::VectorXf> passiveForceVector(passiveForce.data(), n);
 
   if (coriolisAndCentrifugal) {
-    mPxArticulation->copyInternalStateToCache(*mCache, PxArticulationCache::eVELOCITY);
-    mPxArticulation->computeCoriolisAndCentrifugalForce(*mCache);
-    passiveForceVector += Eigen::Map<Eigen::VectorXf>(mCache->jointForce, n);
+    passiveForceVector += cached(mCachedCoriolisForce, [&]() {
+      mPxArticulation->commonInit();
+      mPxArticulation->copyInternalStateToCache(*mCache, PxArticulationCache::eVELOCITY);
+      mPxArticulation->computeCoriolisAndCentrifugalForce(*mCache);
+      return Eigen::VectorXf(Eigen::Map<Eigen::VectorXf>(mCache->jointForce, n));
+    });
   }
 
   if (gravity) {
-    mPxArticulation->computeGeneralizedGravityForce(*mCache);
-    passiveForceVector += Eigen::Map<Eigen::VectorXf>(mCache->jointForce, n);
+    // gravity is not part of the articulation state
+    PxVec3 sceneGravity = getScene()->getPxScene()->getGravity();
+    if (sceneGravity != mCachedGravity) {
+      mCachedGravityForce.version = 0;
+      mCachedGravity = sceneGravity;
+    }
+    passiveForceVector += cached(mCachedGravityForce, [&]() {
+      mPxArticulation->commonInit();
+      mPxArticulation->computeGeneralizedGravityForce(*mCache);
+      return Eigen::VectorXf(Eigen::Map<Eigen::VectorXf>(mCache->jointForce, n));
+    });
   }
 
   if (external) {
@@ -343,15 +444,18 @@ std::vector<physx::PxReal> SArticulation::computeInverseDynamics(const std::vect
 Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
 SArticulation::computeManipulatorInertiaMatrix() {
   using namespace Eigen;
-  mPxArticulation->commonInit();
-  mPxArticulation->computeGeneralizedMassMatrix(*mCache);
+  return cached(mCachedMassMatrix, [&]() {
+    mPxArticulation->commonInit();
+    mPxArticulation->computeGeneralizedMassMatrix(*mCache);
 
-  int mDof = dof();
+    int mDof = dof();
 
-  Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> originMass =
-      Map<Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>>(mCache->massMatrix, mDof, mDof);
+    Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> originMass =
+        Map<Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>>(mCache->massMatrix, mDof, mDof);
 
-  return mPermutationE2I.inverse() * originMass * mPermutationE2I;
+    return Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>(mPermutationE2I.inverse() *
+                                                             originMass * mPermutationE2I);
+  });
 }
 
 void SArticulation::prestep() {
@@ -367,13 +471,24 @@ void SArticulation::prestep() {
     s.time = time;
     l->EventEmitter<EventActorStep>::emit(s);
   }
+
+  if (mController) {
+    mController->step(*this, time);
+  }
+}
+
+void SArticulation::setController(std::shared_ptr<ArticulationController> controller) {
+  if (controller && controller->getTrajectory().dof() != dof()) {
+    throw std::runtime_error("Controller trajectory DOF does not match DOF of articulation");
+  }
+  mController = controller;
 }
 
 Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-SArticulation::computeSpatialTwistJacobianMatrix() {
+SArticulation::computeDenseJacobianExternal(bool twist) {
   // NOTE: 1. PhysX computeDenseJacobian computes Jacobian for the 6D root link
   // motion, which we discard. 2. PhysX computes the Jacobian for Cartesian
-  // velocity, for twist Jacobian, see computeSpatialTwistJacobianMatrix.
+  // velocity, the twist Jacobian is obtained by left multiplying vel2twist.
   using namespace Eigen;
   PxU32 nRows;
   PxU32 nCols;
@@ -384,18 +499,20 @@ SArticulation::computeSpatialTwistJacobianMatrix() {
   Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> eliminatedJacobian(
       originJacobian.block(freeBase, freeBase, nRows - freeBase, nCols - freeBase));
 
-  std::vector<PxArticulationLink *> internalLinks(mPxArticulation->getNbLinks());
-  mPxArticulation->getLinks(internalLinks.data(), mPxArticulation->getNbLinks());
+  if (twist) {
+    std::vector<PxArticulationLink *> internalLinks(mPxArticulation->getNbLinks());
+    mPxArticulation->getLinks(internalLinks.data(), mPxArticulation->getNbLinks());
 
-  Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> vel2twist =
-      Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>::Identity(nRows - freeBase,
-                                                                  nRows - freeBase);
-  for (size_t i = 1; i < internalLinks.size(); ++i) {
-    auto p = internalLinks[i]->getGlobalPose().p;
-    vel2twist.block<3, 3>(6 * i - 6, 6 * i - 3) = skewSymmetric({p[0], p[1], p[2]});
-  }
+    Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> vel2twist =
+        Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>::Identity(nRows - freeBase,
+                                                                    nRows - freeBase);
+    for (size_t i = 1; i < internalLinks.size(); ++i) {
+      auto p = internalLinks[i]->getGlobalPose().p;
+      vel2twist.block<3, 3>(6 * i - 6, 6 * i - 3) = skewSymmetric({p[0], p[1], p[2]});
+    }
 
-  eliminatedJacobian = vel2twist * eliminatedJacobian;
+    eliminatedJacobian = vel2twist * eliminatedJacobian;
+  }
 
   // Switch joint(column) order from internal to external
   eliminatedJacobian = eliminatedJacobian * mPermutationE2I;
@@ -405,24 +522,14 @@ SArticulation::computeSpatialTwistJacobianMatrix() {
 }
 
 Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-SArticulation::computeWorldCartesianJacobianMatrix() {
-  // NOTE: this function computes the Jacobian for twist motion, commonly used
-  // in robotics.
-  using namespace Eigen;
-  PxU32 nRows;
-  PxU32 nCols;
-  mPxArticulation->computeDenseJacobian(*mCache, nRows, nCols);
-  uint32_t freeBase = (nCols == dof()) ? 0 : 6;
-  Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> originJacobian =
-      Map<Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor>>(mCache->denseJacobian, nRows, nCols);
-  Matrix<PxReal, Dynamic, Dynamic, Eigen::RowMajor> eliminatedJacobian(
-      originJacobian.block(freeBase, freeBase, nRows - freeBase, nCols - freeBase));
-
-  // Switch joint(column) order from internal to external
-  eliminatedJacobian = eliminatedJacobian * mPermutationE2I;
+SArticulation::computeSpatialTwistJacobianMatrix() {
+  return cached(mCachedTwistJacobian, [this]() { return computeDenseJacobianExternal(true); });
+}
 
-  // Switch link(row) order from internal to external
-  return mLinkPermutationE2I.inverse() * eliminatedJacobian;
+Eigen::Matrix<PxReal, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+SArticulation::computeWorldCartesianJacobianMatrix() {
+  return cached(mCachedCartesianJacobian,
+                [this]() { return computeDenseJacobianExternal(false); });
 }
 
 #define PUSH_QUAT(data, q)                                                                        \
@@ -536,6 +643,8 @@ void SArticulation::unpackData(std::vector<PxReal> const &data) {
   p += 3;
 
   mPxArticulation->applyCache(*mCache, PxArticulationCache::eALL);
+  markStateChanged();
+  markLinksMoved();
 }
 
 std::vector<PxReal> SArticulation::packDrive() {
@@ -593,6 +702,46 @@ void SArticulation::unpackDrive(std::vector<PxReal> const &data) {
   }
 }
 
+Eigen::MatrixXf const &
+SArticulation::getDiffIKPseudoInverse(bool twist, uint32_t commandedLinkId,
+                                      const std::vector<uint32_t> &activeQIds) {
+  auto &pinvCache = twist ? mCachedTwistPinv : mCachedCartesianPinv;
+  // stale entries are only reused for the same key, keep the table bounded
+  if (pinvCache.size() > 64) {
+    pinvCache.clear();
+  }
+
+  return cached(pinvCache[{commandedLinkId, activeQIds}], [&]() {
+    auto const &denseJacobian =
+        twist ? cached(mCachedTwistJacobian,
+                       [this]() { return computeDenseJacobianExternal(true); })
+              : cached(mCachedCartesianJacobian,
+                       [this]() { return computeDenseJacobianExternal(false); });
+    auto numCol = activeQIds.empty() ? dof() : activeQIds.size();
+
+    Eigen::MatrixXf jacobian = denseJacobian.block(commandedLinkId * 6 - 6, 0, 6, dof());
+    Eigen::MatrixXf reducedJacobian(jacobian);
+    if (!activeQIds.empty()) {
+      reducedJacobian.resize(6, numCol);
+      for (size_t i = 0; i < numCol; ++i) {
+        reducedJacobian.block<6, 1>(0, i) = jacobian.block<6, 1>(0, activeQIds[i]);
+      }
+    }
+
+    // fixed-size SVD for common arms, avoids heap allocation inside the decomposition
+    switch (numCol) {
+    case 6:
+      return Eigen::MatrixXf(pseudoInverse<6>(reducedJacobian));
+    case 7:
+      return Eigen::MatrixXf(pseudoInverse<7>(reducedJacobian));
+    case 9:
+      return Eigen::MatrixXf(pseudoInverse<9>(reducedJacobian));
+    default:
+      return Eigen::MatrixXf(pseudoInverse<Eigen::Dynamic>(reducedJacobian));
+    }
+  });
+}
+
 Matrix<PxReal, Dynamic, 1>
 SArticulation::computeTwistDiffIK(const Eigen::Matrix<PxReal, 6, 1> &spatialTwist,
                                   uint32_t commandedLinkId,
@@ -605,47 +754,20 @@ SArticulation::computeTwistDiffIK(const Eigen::Matrix<PxReal, 6, 1> &spatialTwis
     logger->warn("Link with id 0 (root link) can not be a valid commanded link.");
     return qvel;
   }
-
-  auto denseJacobian = computeSpatialTwistJacobianMatrix();
-  Eigen::MatrixXf jacobian = denseJacobian.block(commandedLinkId * 6 - 6, 0, 6, dof());
-  Eigen::MatrixXf reducedJacobian(jacobian);
-  if (!activeQIds.empty()) {
-    reducedJacobian.resize(6, numCol);
-    for (size_t i = 0; i < numCol; ++i) {
-      if (activeQIds[i] >= dof()) {
-        logger->warn("Articulation has {} joints, but given joint id {}", dof(), activeQIds[i]);
-        return qvel;
-      }
-      reducedJacobian.block<6, 1>(0, i) = jacobian.block<6, 1>(0, activeQIds[i]);
+  for (auto id : activeQIds) {
+    if (id >= dof()) {
+      logger->warn("Articulation has {} joints, but given joint id {}", dof(), id);
+      return qvel;
     }
   }
 
-  Eigen::JacobiSVD<Eigen::MatrixXf> svd_of_j(reducedJacobian,
-                                             Eigen::ComputeThinU | Eigen::ComputeThinV);
-  const Eigen::MatrixXf &u = svd_of_j.matrixU();
-  const Eigen::MatrixXf &v = svd_of_j.matrixV();
-  const Eigen::VectorXf &s = svd_of_j.singularValues();
-
-  Eigen::VectorXf invS = s;
-  static const float epsilon = std::numeric_limits<float>::epsilon();
-  double maxS = s[0];
-  for (std::size_t i = 0; i < static_cast<std::size_t>(s.rows()); ++i) {
-    invS(i) = fabs(s(i)) > maxS * epsilon ? 1.0 / s(i) : 0.0;
-  }
-  qvel = v * invS.asDiagonal() * u.transpose() * spatialTwist;
+  qvel = getDiffIKPseudoInverse(true, commandedLinkId, activeQIds) * spatialTwist;
   return qvel;
 }
 
 Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor>
 SArticulation::computeAdjointMatrix(SLink *sourceFrame, SLink *targetFrame) {
-  auto mat44 = computeRelativeTransformation(sourceFrame, targetFrame);
-  Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor> adjoint =
-      Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor>::Zero(6, 6);
-  adjoint.block<3, 3>(0, 0) = mat44.block<3, 3>(0, 0);
-  adjoint.block<3, 3>(3, 3) = mat44.block<3, 3>(0, 0);
-  Eigen::Vector3f position = mat44.block<3, 1>(0, 3);
-  adjoint.block<3, 3>(0, 3) = skewSymmetric(position) * mat44.block<3, 3>(0, 0);
-  return adjoint;
+  return adjointMatrix(computeRelativeTransformation(sourceFrame, targetFrame));
 }
 
 Matrix<PxReal, Dynamic, 1>
@@ -660,59 +782,36 @@ SArticulation::computeCartesianVelocityDiffIK(const Eigen::Matrix<PxReal, 6, 1>
     logger->warn("Link with id 0 (root link) can not be a valid commanded link.");
     return qvel;
   }
-
-  auto denseJacobian = computeWorldCartesianJacobianMatrix();
-  Eigen::MatrixXf jacobian = denseJacobian.block(commandedLinkId * 6 - 6, 0, 6, dof());
-  Eigen::MatrixXf reducedJacobian(jacobian);
-  if (!activeQIds.empty()) {
-    reducedJacobian.resize(6, numCol);
-    for (size_t i = 0; i < numCol; ++i) {
-      if (activeQIds[i] >= dof()) {
-        logger->warn("Articulation has {} joints, but given joint id {}", dof(), activeQIds[i]);
-        return qvel;
-      }
-      reducedJacobian.block<6, 1>(0, i) = jacobian.block<6, 1>(0, activeQIds[i]);
+  for (auto id : activeQIds) {
+    if (id >= dof()) {
+      logger->warn("Articulation has {} joints, but given joint id {}", dof(), id);
+      return qvel;
     }
   }
 
-  Eigen::JacobiSVD<Eigen::MatrixXf> svd_of_j(reducedJacobian,
-                                             Eigen::ComputeThinU | Eigen::ComputeThinV);
-  const Eigen::MatrixXf &u = svd_of_j.matrixU();
-  const Eigen::MatrixXf &v = svd_of_j.matrixV();
-  const Eigen::VectorXf &s = svd_of_j.singularValues();
-
-  Eigen::VectorXf invS = s;
-  static const float epsilon = std::numeric_limits<float>::epsilon();
-  double maxS = s[0];
-  for (std::size_t i = 0; i < static_cast<std::size_t>(s.rows()); ++i) {
-    invS(i) = fabs(s(i)) > maxS * epsilon ? 1.0 / s(i) : 0.0;
-  }
-  qvel = v * invS.asDiagonal() * u.transpose() * cartesianVelocity;
+  qvel = getDiffIKPseudoInverse(false, commandedLinkId, activeQIds) * cartesianVelocity;
   return qvel;
 }
 
 Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor>
 SArticulation::computeRelativeTransformation(SLink *sourceFrame, SLink *targetFrame) {
-  auto s = sourceFrame->getPose();
-  auto t = targetFrame->getPose();
-  auto relative = t.getInverse().transform(s);
-
-  Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor> mat44 =
-      Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor>::Identity(4, 4);
-  Eigen::Quaternionf quat(relative.q.w, relative.q.x, relative.q.y, relative.q.z);
-  mat44.block<3, 3>(0, 0) = quat.normalized().toRotationMatrix();
-  mat44.block<3, 1>(0, 3) = Eigen::Matrix<PxReal, 3, 1>(relative.p.x, relative.p.y, relative.p.z);
-  return mat44;
+  return relativeTransformation(sourceFrame->getPose(), targetFrame->getPose());
 }
 Eigen::Matrix<PxReal, 4, 4, Eigen::RowMajor>
 SArticulation::computeRelativeTransformation(uint32_t sourceLinkId, uint32_t targetLinkId) {
-  auto links = getSLinks();
-  return computeRelativeTransformation(links.at(sourceLinkId), links.at(targetLinkId));
+  auto const &poses = cached(mCachedLinkPoses, [this]() {
+    std::vector<PxTransform> result;
+    result.reserve(mLinks.size());
+    for (auto &link : mLinks) {
+      result.push_back(link->getPose());
+    }
+    return result;
+  });
+  return relativeTransformation(poses.at(sourceLinkId), poses.at(targetLinkId));
 }
 Eigen::Matrix<PxReal, 6, 6, Eigen::RowMajor>
 SArticulation::computeAdjointMatrix(uint32_t sourceLinkId, uint32_t targetLinkId) {
-  auto links = getSLinks();
-  return computeAdjointMatrix(links.at(sourceLinkId), links.at(targetLinkId));
+  return adjointMatrix(computeRelativeTransformation(sourceLinkId, targetLinkId));
 }
 
 } // namespace sapien
@@ -89,6 +89,7 @@ void SKArticulation::setQf(const std::vector<physx::PxReal> &v) {
 }
 void SKArticulation::setRootPose(const physx::PxTransform &T) {
   mRootLink->getPxActor()->setGlobalPose(T);
+  mRootLink->markPoseChanged();
 }
 
 std::vector<std::array<physx::PxReal, 2>> SKArticulation::getQlimits() const {
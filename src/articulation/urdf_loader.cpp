@@ -1,5 +1,6 @@
 #include "sapien/articulation/urdf_loader.h"
 #include "sapien/articulation/articulation_builder.h"
+#include "sapien/articulation/collision_pair_generator.h"
 #include "sapien/articulation/sapien_articulation.h"
 #include "sapien/articulation/sapien_kinematic_articulation.h"
 #include "sapien/articulation/sapien_link.h"
@@ -60,6 +61,55 @@ std::optional<std::string> findSRDF(const std::string &urdfName) {
 
 URDFLoader::URDFLoader(SScene *scene) : mScene(scene) {}
 
+template <typename T> static void hashCombine(size_t &key, T const &value) {
+  key ^= std::hash<T>{}(value) + 0x9e3779b9 + (key << 6) + (key >> 2);
+}
+
+void URDFLoader::disableCollisionsBySampling(SArticulation &articulation,
+                                             ArticulationBuilder &builder,
+                                             XMLDocument const &urdfDoc) {
+  XMLPrinter printer;
+  urdfDoc.Print(&printer);
+  size_t key = std::hash<std::string>{}(printer.CStr());
+  hashCombine(key, scale);
+  hashCombine(key, collisionSampleCount);
+
+  // the URDF only names the meshes, an edited mesh must not hit the cache
+  for (auto linkBuilder : builder.getLinkBuilders()) {
+    for (auto &shape : linkBuilder->getShapes()) {
+      if (shape.filename.empty()) {
+        continue;
+      }
+      std::error_code ec;
+      hashCombine(key, shape.filename);
+      hashCombine(key, static_cast<uintmax_t>(fs::file_size(shape.filename, ec)));
+      hashCombine(key, static_cast<int64_t>(
+                           fs::last_write_time(shape.filename, ec).time_since_epoch().count()));
+    }
+  }
+
+  auto pairs = getDisabledCollisionPairs(key, articulation, collisionSampleCount);
+  applyDisabledCollisionPairs(articulation, pairs);
+}
+
+void URDFLoader::disableCollisions(SArticulation &articulation, ArticulationBuilder &builder,
+                                   XMLDocument const &urdfDoc, XMLDocument const *srdfDoc) {
+  // "Default" pairs already went into the link builders, "Always" and "Never" pairs are the
+  // ones written by DisabledCollisionPairs::toSRDF
+  if (srdfDoc) {
+    XMLPrinter printer;
+    srdfDoc->Print(&printer);
+    auto pairs = DisabledCollisionPairs::fromSRDF(printer.CStr());
+    if (!pairs.alwaysColliding.empty() || !pairs.neverColliding.empty()) {
+      applyDisabledCollisionPairs(articulation, pairs);
+      return;
+    }
+  }
+  if (autoDisableCollisions) {
+    disableCollisionsBySampling(articulation, builder, urdfDoc);
+  }
+}
+
 struct LinkTreeNode {
   Link *link;
   Joint *joint;
@@ -544,6 +594,9 @@ SArticulation *URDFLoader::load(const std::string &filename, URDFConfig const &c
 
   auto [builder, records] = parseRobotDescription(urdfDoc, srdfDoc.get(), filename, false, config);
   auto articulation = builder->build(fixRootLink);
+  if (articulation) {
+    disableCollisions(*articulation, *builder, urdfDoc, srdfDoc.get());
+  }
 
   for (auto &record : records) {
     if (record.type == "camera") {
@@ -653,12 +706,16 @@ SArticulation *URDFLoader::loadFromXML(const std::string &URDFString,
   if (!SRDFString.empty()) {
     srdfDoc = std::make_unique<XMLDocument>();
     if (srdfDoc->Parse(SRDFString.c_str(), SRDFString.length())) {
+      srdfDoc = nullptr;
       spdlog::get("SAPIEN")->error("Failed parsing given SRDF string.");
     }
   }
 
   auto [builder, records] = parseRobotDescription(urdfDoc, srdfDoc.get(), "", false, config);
   auto articulation = builder->build(fixRootLink);
+  if (articulation) {
+    disableCollisions(*articulation, *builder, urdfDoc, srdfDoc.get());
+  }
 
   for (auto &record : records) {
     if (record.type == "camera") {
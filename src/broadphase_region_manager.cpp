@@ -0,0 +1,136 @@
+#include "sapien/broadphase_region_manager.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace sapien {
+
+/** extents are scaled by this factor when the world grows, so a slowly spreading scene is not
+ * re-tiled every step */
+static constexpr float kWorldGrowth = 1.5f;
+
+/** old and new regions coexist during a re-tile and MBP supports 256 regions */
+static constexpr uint32_t kMaxSubdivisions = 11;
+
+static PxBounds3 computeActorBounds(PxRigidActor const &actor) {
+  PxBounds3 bounds = PxBounds3::empty();
+  std::vector<PxShape *> shapes(actor.getNbShapes());
+  actor.getShapes(shapes.data(), shapes.size());
+  for (auto shape : shapes) {
+    // planes are infinite and live in every region
+    if (shape->getGeometryType() == PxGeometryType::ePLANE) {
+      continue;
+    }
+    bounds.include(PxShapeExt::getWorldBounds(*shape, actor));
+  }
+  return bounds;
+}
+
+BroadPhaseRegionManager::BroadPhaseRegionManager(PxBounds3 const &initialBounds,
+                                                 uint32_t subdivisions)
+    : mSubdivisions(std::clamp(subdivisions, 1u, kMaxSubdivisions)), mWorldBounds(initialBounds),
+      mPendingBounds(PxBounds3::empty()) {
+  if (subdivisions != mSubdivisions) {
+    spdlog::get("SAPIEN")->warn("MBP subdivisions clamped to {}", mSubdivisions);
+  }
+}
+
+void BroadPhaseRegionManager::onObjectOutOfBounds(PxShape &, PxActor &) {
+  mOutOfBoundsCount++;
+  mDirty = true;
+}
+
+void BroadPhaseRegionManager::onObjectOutOfBounds(PxAggregate &) {
+  mOutOfBoundsCount++;
+  mDirty = true;
+}
+
+void BroadPhaseRegionManager::attach(PxScene *scene) {
+  mScene = scene;
+  retile(mWorldBounds);
+}
+
+void BroadPhaseRegionManager::include(PxRigidActor const &actor) {
+  auto bounds = computeActorBounds(actor);
+  if (bounds.isEmpty() || bounds.isInside(mWorldBounds)) {
+    return;
+  }
+  mPendingBounds.include(bounds);
+  mDirty = true;
+}
+
+PxBounds3 BroadPhaseRegionManager::computeSceneBounds() const {
+  PxBounds3 bounds = PxBounds3::empty();
+
+  auto types = PxActorTypeFlag::eRIGID_STATIC | PxActorTypeFlag::eRIGID_DYNAMIC;
+  std::vector<PxActor *> actors(mScene->getNbActors(types));
+  mScene->getActors(types, actors.data(), actors.size());
+  for (auto actor : actors) {
+    bounds.include(computeActorBounds(*actor->is<PxRigidActor>()));
+  }
+
+  std::vector<PxArticulationBase *> articulations(mScene->getNbArticulations());
+  mScene->getArticulations(articulations.data(), articulations.size());
+  for (auto articulation : articulations) {
+    std::vector<PxArticulationLink *> links(articulation->getNbLinks());
+    articulation->getLinks(links.data(), links.size());
+    for (auto link : links) {
+      bounds.include(computeActorBounds(*link));
+    }
+  }
+  return bounds;
+}
+
+void BroadPhaseRegionManager::update() {
+  if (!mScene || !mDirty) {
+    return;
+  }
+  mDirty = false;
+
+  PxBounds3 target = mWorldBounds;
+  target.include(mPendingBounds);
+  auto sceneBounds = computeSceneBounds();
+  if (!sceneBounds.isEmpty()) {
+    target.include(sceneBounds);
+  }
+  mPendingBounds = PxBounds3::empty();
+
+  // an object may leave and re-enter the world within a step
+  if (target.minimum == mWorldBounds.minimum && target.maximum == mWorldBounds.maximum) {
+    return;
+  }
+  target.scaleFast(kWorldGrowth);
+  retile(target);
+}
+
+void BroadPhaseRegionManager::retile(PxBounds3 const &bounds) {
+  std::vector<PxBounds3> tiles(mSubdivisions * mSubdivisions);
+  PxU32 count =
+      PxBroadPhaseExt::createRegionsFromWorldBounds(tiles.data(), bounds, mSubdivisions, 2);
+
+  // add the new regions before removing the old ones so no object is ever outside all regions
+  std::vector<PxU32> handles;
+  for (PxU32 i = 0; i < count; ++i) {
+    PxBroadPhaseRegion region;
+    region.bounds = tiles[i];
+    region.userData = nullptr;
+    PxU32 handle = mScene->addBroadPhaseRegion(region, true);
+    if (handle == 0xffffffff) {
+      spdlog::get("SAPIEN")->error("Failed to add broadphase region");
+      continue;
+    }
+    handles.push_back(handle);
+  }
+  for (auto handle : mRegionHandles) {
+    mScene->removeBroadPhaseRegion(handle);
+  }
+  mRegionHandles = std::move(handles);
+  mWorldBounds = bounds;
+  mRetileCount++;
+
+  spdlog::get("SAPIEN")->debug("Broadphase world [{}, {}, {}] to [{}, {}, {}], {} regions",
+                               bounds.minimum.x, bounds.minimum.y, bounds.minimum.z,
+                               bounds.maximum.x, bounds.maximum.y, bounds.maximum.z,
+                               mRegionHandles.size());
+}
+
+} // namespace sapien
@@ -0,0 +1,212 @@
+#include "sapien/control_step.h"
+#include "sapien/articulation/sapien_articulation.h"
+#include "sapien/articulation/sapien_link.h"
+#include "sapien/sapien_contact.h"
+#include "sapien/sapien_scene.h"
+#include <stdexcept>
+#include <unordered_map>
+
+namespace sapien {
+
+namespace {
+
+/** drive targets of one articulation over a control step */
+struct DriveTrajectory {
+  SArticulation *articulation;
+  bool hasTarget;
+  bool hasVelocity;
+  std::vector<PxReal> startTarget;
+  std::vector<PxReal> startVelocity;
+  std::vector<PxReal> target;
+  std::vector<PxReal> velocity;
+};
+
+void checkAction(SScene &scene, ArticulationAction const &action) {
+  if (!action.articulation) {
+    throw std::runtime_error("control step: articulation is null");
+  }
+  if (action.articulation->getScene() != &scene) {
+    throw std::runtime_error("control step: articulation " + action.articulation->getName() +
+                             " is not in this scene");
+  }
+  auto dof = action.articulation->dof();
+  if ((!action.driveTarget.empty() && action.driveTarget.size() != dof) ||
+      (!action.driveVelocityTarget.empty() && action.driveVelocityTarget.size() != dof)) {
+    throw std::runtime_error("control step: action size does not match DOF of articulation " +
+                             action.articulation->getName());
+  }
+}
+
+/** set the drives for the substep ending at fraction a of the control step */
+void applyDrives(DriveTrajectory const &d, ActionInterpolation interpolation, PxReal a,
+                 PxReal duration) {
+  size_t n = d.startTarget.size();
+  switch (interpolation) {
+  case ActionInterpolation::eHOLD:
+    // constant over the control step, set once
+    if (a == 0) {
+      if (d.hasTarget) {
+        d.articulation->setDriveTarget(d.target);
+      }
+      if (d.hasVelocity) {
+        d.articulation->setDriveVelocityTarget(d.velocity);
+      }
+    }
+    return;
+
+  case ActionInterpolation::eLINEAR: {
+    std::vector<PxReal> v(n);
+    if (d.hasTarget) {
+      for (size_t i = 0; i < n; ++i) {
+        v[i] = d.startTarget[i] + a * (d.target[i] - d.startTarget[i]);
+      }
+      d.articulation->setDriveTarget(v);
+    }
+    if (d.hasVelocity) {
+      for (size_t i = 0; i < n; ++i) {
+        v[i] = d.startVelocity[i] + a * (d.velocity[i] - d.startVelocity[i]);
+      }
+      d.articulation->setDriveVelocityTarget(v);
+    }
+    return;
+  }
+
+  case ActionInterpolation::eCUBIC: {
+    std::vector<PxReal> p(n), v(n);
+    if (d.hasTarget) {
+      // cubic Hermite basis and derivatives
+      PxReal a2 = a * a, a3 = a2 * a;
+      PxReal h00 = 2 * a3 - 3 * a2 + 1, h10 = a3 - 2 * a2 + a;
+      PxReal h01 = -2 * a3 + 3 * a2, h11 = a3 - a2;
+      PxReal d00 = 6 * a2 - 6 * a, d10 = 3 * a2 - 4 * a + 1;
+      PxReal d01 = -6 * a2 + 6 * a, d11 = 3 * a2 - 2 * a;
+      for (size_t i = 0; i < n; ++i) {
+        PxReal m0 = d.startVelocity[i] * duration;
+        PxReal m1 = (d.hasVelocity ? d.velocity[i] : 0.f) * duration;
+        p[i] = h00 * d.startTarget[i] + h10 * m0 + h01 * d.target[i] + h11 * m1;
+        v[i] = (d00 * d.startTarget[i] + d10 * m0 + d01 * d.target[i] + d11 * m1) / duration;
+      }
+      d.articulation->setDriveTarget(p);
+      d.articulation->setDriveVelocityTarget(v);
+    } else if (d.hasVelocity) {
+      for (size_t i = 0; i < n; ++i) {
+        v[i] = d.startVelocity[i] + a * (d.velocity[i] - d.startVelocity[i]);
+      }
+      d.articulation->setDriveVelocityTarget(v);
+    }
+    return;
+  }
+  }
+}
+
+} // namespace
+
+ActionInterpolation getActionInterpolationByName(std::string const &name) {
+  if (name == "hold") {
+    return ActionInterpolation::eHOLD;
+  }
+  if (name == "linear") {
+    return ActionInterpolation::eLINEAR;
+  }
+  if (name == "cubic") {
+    return ActionInterpolation::eCUBIC;
+  }
+  throw std::runtime_error("invalid action interpolation: " + name);
+}
+
+ControlStepResult controlStep(SScene &scene, std::vector<ArticulationAction> const &actions,
+                              ControlStepConfig const &config) {
+  if (config.substeps == 0) {
+    throw std::runtime_error("control step: substeps must be positive");
+  }
+
+  std::vector<DriveTrajectory> trajectories;
+  trajectories.reserve(actions.size());
+  for (auto &action : actions) {
+    checkAction(scene, action);
+    DriveTrajectory d;
+    d.articulation = action.articulation;
+    d.hasTarget = !action.driveTarget.empty();
+    d.hasVelocity = !action.driveVelocityTarget.empty();
+    d.startTarget = action.articulation->getDriveTarget();
+    d.startVelocity = action.articulation->getDriveVelocityTarget();
+    d.target = action.driveTarget;
+    d.velocity = action.driveVelocityTarget;
+    trajectories.push_back(std::move(d));
+  }
+
+  ControlStepResult result;
+  result.substeps = config.substeps;
+  result.articulations.resize(actions.size());
+
+  // links of the acting articulations, to accumulate their contact forces
+  std::unordered_map<SActorBase *, PxReal *> linkForces;
+  if (config.observeContactForces) {
+    for (size_t i = 0; i < actions.size(); ++i) {
+      auto links = actions[i].articulation->getSLinks();
+      auto &forces = result.articulations[i].linkContactForces;
+      forces.assign(3 * links.size(), 0.f);
+      for (auto link : links) {
+        linkForces[link] = forces.data() + 3 * link->getIndex();
+      }
+    }
+  }
+
+  PxReal timestep = scene.getTimestep();
+  PxReal duration = timestep * config.substeps;
+  for (uint32_t s = 0; s < config.substeps; ++s) {
+    PxReal a = config.interpolation == ActionInterpolation::eHOLD
+                   ? static_cast<PxReal>(s)
+                   : static_cast<PxReal>(s + 1) / config.substeps;
+    for (auto &d : trajectories) {
+      applyDrives(d, config.interpolation, a, duration);
+    }
+
+    scene.step();
+
+    if (config.observeContactForces) {
+      // the impulse acts on the first actor of a contact and its opposite on the second
+      for (auto contact : scene.getContacts()) {
+        PxVec3 impulse(0.f);
+        for (auto &point : contact->points) {
+          impulse += point.impulse;
+        }
+        for (int side = 0; side < 2; ++side) {
+          auto it = linkForces.find(contact->actors[side]);
+          if (it == linkForces.end()) {
+            continue;
+          }
+          PxVec3 force = impulse * ((side == 0 ? 1.f : -1.f) / (timestep * config.substeps));
+          it->second[0] += force.x;
+          it->second[1] += force.y;
+          it->second[2] += force.z;
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < actions.size(); ++i) {
+    auto articulation = actions[i].articulation;
+    auto &observation = result.articulations[i];
+    if (config.observeQpos) {
+      observation.qpos = articulation->getQpos();
+    }
+    if (config.observeQvel) {
+      observation.qvel = articulation->getQvel();
+    }
+    if (config.observeRootPose) {
+      observation.rootPose = articulation->getRootPose();
+    }
+  }
+  return result;
+}
+
+std::future<ControlStepResult> controlStepAsync(SScene &scene,
+                                                std::vector<ArticulationAction> actions,
+                                                ControlStepConfig const &config) {
+  return scene.getThread().submit([&scene, actions = std::move(actions), config]() {
+    return controlStep(scene, actions, config);
+  });
+}
+
+} // namespace sapien
@@ -233,6 +233,8 @@ std::string MeshManager::getCachedFilename(const std::string &filename) {
 
 physx::PxTriangleMesh *MeshManager::loadNonConvexMesh(const std::string &filename, bool useCache,
                                                       bool saveCache) {
+  // meshes are cached and shared by all scenes
+  ArenaAllocator::Scope allocationScope(nullptr);
 
   if (!fs::is_regular_file(filename)) {
     spdlog::get("SAPIEN")->error("File not found: {}", filename);
@@ -294,6 +296,8 @@ physx::PxTriangleMesh *MeshManager::loadNonConvexMesh(const std::string &filenam
 
 physx::PxConvexMesh *MeshManager::loadMesh(const std::string &filename, bool useCache,
                                            bool saveCache) {
+  // meshes are cached and shared by all scenes
+  ArenaAllocator::Scope allocationScope(nullptr);
 
   if (!fs::is_regular_file(filename)) {
     spdlog::get("SAPIEN")->error("File not found: {}", filename);
@@ -395,6 +399,8 @@ std::vector<std::vector<int>> splitMesh(aiMesh *mesh) {
 }
 
 std::vector<PxConvexMesh *> MeshManager::loadMeshGroup(const std::string &filename) {
+  // meshes are cached and shared by all scenes
+  ArenaAllocator::Scope allocationScope(nullptr);
   std::vector<PxConvexMesh *> meshes;
 
   if (!fs::is_regular_file(filename)) {
@@ -0,0 +1,772 @@
+#include "sapien/renderer/record_renderer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sapien {
+namespace Renderer {
+
+//========== Texture ==========//
+RecordTexture::RecordTexture(std::shared_ptr<RenderLogWriter> writer, uint32_t id,
+                             std::string filename, int width, int height, int channels,
+                             uint32_t mipLevels, FilterMode::Enum filterMode,
+                             AddressMode::Enum addressMode)
+    : mWriter(std::move(writer)), mId(id), mFilename(std::move(filename)), mWidth(width),
+      mHeight(height), mChannels(channels), mMipLevels(mipLevels), mFilterMode(filterMode),
+      mAddressMode(addressMode) {}
+
+RecordTexture::~RecordTexture() {
+  if (mId) {
+    RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_TEXTURE).put(mId);
+  }
+}
+
+//========== Mesh ==========//
+RecordMesh::RecordMesh(std::shared_ptr<RenderLogWriter> writer, uint32_t id,
+                       std::vector<float> vertices, std::vector<uint32_t> indices)
+    : mWriter(std::move(writer)), mId(id), mVertices(std::move(vertices)),
+      mIndices(std::move(indices)) {}
+
+RecordMesh::~RecordMesh() {
+  if (mWritten) {
+    RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_MESH).put(mId);
+  }
+}
+
+void RecordMesh::setVertices(std::vector<float> const &vertices) {
+  std::lock_guard lock(mMutex);
+  mVertices = vertices;
+  mChanged = true;
+}
+
+void RecordMesh::setNormals(std::vector<float> const &normals) {
+  std::lock_guard lock(mMutex);
+  mNormals = normals;
+  mChanged = true;
+}
+
+void RecordMesh::setUVs(std::vector<float> const &uvs) {
+  std::lock_guard lock(mMutex);
+  mUVs = uvs;
+  mChanged = true;
+}
+
+void RecordMesh::setTangents(std::vector<float> const &tangents) {
+  std::lock_guard lock(mMutex);
+  mTangents = tangents;
+  mChanged = true;
+}
+
+void RecordMesh::setBitangents(std::vector<float> const &bitangents) {
+  std::lock_guard lock(mMutex);
+  mBitangents = bitangents;
+  mChanged = true;
+}
+
+void RecordMesh::setIndices(std::vector<uint32_t> const &indices) {
+  std::lock_guard lock(mMutex);
+  mIndices = indices;
+  mChanged = true;
+}
+
+void RecordMesh::write() {
+  std::lock_guard lock(mMutex);
+  if (!mChanged) {
+    return;
+  }
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eCREATE_MESH)
+      .put(mId)
+      .putArray(mVertices)
+      .putArray(mNormals)
+      .putArray(mUVs)
+      .putArray(mTangents)
+      .putArray(mBitangents)
+      .putArray(mIndices);
+  mWritten = true;
+  mChanged = false;
+}
+
+//========== Material ==========//
+RecordMaterial::RecordMaterial(std::shared_ptr<RenderLogWriter> writer, uint32_t id)
+    : mWriter(std::move(writer)), mId(id) {
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eCREATE_MATERIAL).put(mId);
+}
+
+RecordMaterial::~RecordMaterial() {
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_MATERIAL).put(mId);
+}
+
+void RecordMaterial::setBaseColor(std::array<float, 4> color) {
+  mBaseColor = color;
+  write(RenderLogMaterialOp::eBASE_COLOR, color);
+}
+
+void RecordMaterial::setRoughness(float roughness) {
+  mRoughness = roughness;
+  write(RenderLogMaterialOp::eROUGHNESS, roughness);
+}
+
+void RecordMaterial::setSpecular(float specular) {
+  mSpecular = specular;
+  write(RenderLogMaterialOp::eSPECULAR, specular);
+}
+
+void RecordMaterial::setMetallic(float metallic) {
+  mMetallic = metallic;
+  write(RenderLogMaterialOp::eMETALLIC, metallic);
+}
+
+void RecordMaterial::setEmission(std::array<float, 4> color) {
+  mEmission = color;
+  write(RenderLogMaterialOp::eEMISSION, color);
+}
+
+void RecordMaterial::setIOR(float ior) {
+  mIOR = ior;
+  write(RenderLogMaterialOp::eIOR, ior);
+}
+
+void RecordMaterial::setTransmission(float transmission) {
+  mTransmission = transmission;
+  write(RenderLogMaterialOp::eTRANSMISSION, transmission);
+}
+
+void RecordMaterial::setTransmissionRoughness(float roughness) {
+  mTransmissionRoughness = roughness;
+  write(RenderLogMaterialOp::eTRANSMISSION_ROUGHNESS, roughness);
+}
+
+void RecordMaterial::setTexture(RenderLogTextureSlot slot, std::shared_ptr<IPxrTexture> texture) {
+  uint32_t textureId = 0;
+  if (texture) {
+    auto recorded = std::dynamic_pointer_cast<RecordTexture>(texture);
+    if (!recorded || !recorded->getId()) {
+      throw std::runtime_error("failed to set texture: the texture is not from this renderer");
+    }
+    textureId = recorded->getId();
+  }
+  mTextures[static_cast<size_t>(slot)] = texture;
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eMATERIAL_SET, mId,
+                          RenderLogMaterialOp::eTEXTURE)
+      .put(slot)
+      .put(textureId);
+}
+
+void RecordMaterial::setTextureFromFilename(RenderLogTextureSlot slot, std::string_view path) {
+  // keeps the filename for the getters, the replaying renderer loads the file
+  mTextures[static_cast<size_t>(slot)] = std::make_shared<RecordTexture>(
+      mWriter, 0, std::string(path), 0, 0, 0, 1, IPxrTexture::FilterMode::eLINEAR,
+      IPxrTexture::AddressMode::eREPEAT);
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eMATERIAL_SET, mId,
+                          RenderLogMaterialOp::eTEXTURE_FILE)
+      .put(slot)
+      .putString(path);
+}
+
+void RecordMaterial::setEmissionTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eEMISSION, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getEmissionTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eEMISSION)];
+}
+void RecordMaterial::setDiffuseTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eDIFFUSE, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getDiffuseTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eDIFFUSE)];
+}
+void RecordMaterial::setMetallicTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eMETALLIC, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getMetallicTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eMETALLIC)];
+}
+void RecordMaterial::setRoughnessTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eROUGHNESS, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getRoughnessTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eROUGHNESS)];
+}
+void RecordMaterial::setNormalTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eNORMAL, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getNormalTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eNORMAL)];
+}
+void RecordMaterial::setTransmissionTexture(std::shared_ptr<IPxrTexture> texture) {
+  setTexture(RenderLogTextureSlot::eTRANSMISSION, texture);
+}
+std::shared_ptr<IPxrTexture> RecordMaterial::getTransmissionTexture() const {
+  return mTextures[static_cast<size_t>(RenderLogTextureSlot::eTRANSMISSION)];
+}
+
+void RecordMaterial::setEmissionTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eEMISSION, path);
+}
+void RecordMaterial::setDiffuseTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eDIFFUSE, path);
+}
+void RecordMaterial::setMetallicTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eMETALLIC, path);
+}
+std::string RecordMaterial::getMetallicTextureFilename() const {
+  auto tex = getMetallicTexture();
+  return tex ? tex->getFilename() : "";
+}
+void RecordMaterial::setRoughnessTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eROUGHNESS, path);
+}
+void RecordMaterial::setNormalTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eNORMAL, path);
+}
+void RecordMaterial::setTransmissionTextureFromFilename(std::string_view path) {
+  setTextureFromFilename(RenderLogTextureSlot::eTRANSMISSION, path);
+}
+
+static uint32_t materialId(std::shared_ptr<IPxrMaterial> const &material) {
+  if (!material) {
+    return 0;
+  }
+  auto recorded = std::dynamic_pointer_cast<RecordMaterial>(material);
+  if (!recorded) {
+    throw std::runtime_error("failed to add body: the material is not from this renderer");
+  }
+  return recorded->getId();
+}
+
+//========== Rigidbody ==========//
+RecordRigidbody::RecordRigidbody(RecordScene *scene, uint32_t id,
+                                 physx::PxGeometryType::Enum type, physx::PxVec3 scale,
+                                 std::shared_ptr<IRenderMesh> mesh,
+                                 std::shared_ptr<IPxrMaterial> material)
+    : mScene(scene), mId(id), mType(type), mScale(scale), mMesh(std::move(mesh)),
+      mMaterial(std::move(material)) {}
+
+template <typename T> void RecordRigidbody::write(RenderLogBodyOp op, T value) {
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eBODY_SET, mId, op).put(value);
+}
+
+void RecordRigidbody::setName(std::string const &name) {
+  mName = name;
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eBODY_SET, mId,
+                          RenderLogBodyOp::eNAME)
+      .putString(name);
+}
+
+void RecordRigidbody::setUniqueId(uint32_t uniqueId) {
+  mUniqueId = uniqueId;
+  write(RenderLogBodyOp::eUNIQUE_ID, uniqueId);
+}
+
+void RecordRigidbody::setSegmentationId(uint32_t segmentationId) {
+  mSegmentationId = segmentationId;
+  write(RenderLogBodyOp::eSEGMENTATION_ID, segmentationId);
+}
+
+void RecordRigidbody::setSegmentationCustomData(std::vector<float> const &customData) {
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eBODY_SET, mId,
+                          RenderLogBodyOp::eCUSTOM_DATA)
+      .putArray(customData);
+}
+
+void RecordRigidbody::setInitialPose(const physx::PxTransform &transform) {
+  mInitialPose = transform;
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eBODY_SET, mId,
+                          RenderLogBodyOp::eINITIAL_POSE)
+      .putPose(transform);
+}
+
+void RecordRigidbody::update(const physx::PxTransform &transform) {
+  if (transform == mPose) {
+    return;
+  }
+  mPose = transform;
+  if (!mMoved) {
+    mMoved = true;
+    mScene->mMovedBodies.push_back(this);
+  }
+}
+
+void RecordRigidbody::setVisibility(float visibility) {
+  write(RenderLogBodyOp::eVISIBILITY, visibility);
+}
+
+void RecordRigidbody::setVisible(bool visible) {
+  write(RenderLogBodyOp::eVISIBLE, static_cast<uint8_t>(visible));
+}
+
+void RecordRigidbody::setRenderMode(uint32_t mode) { write(RenderLogBodyOp::eRENDER_MODE, mode); }
+
+void RecordRigidbody::setShadeFlat(bool shadeFlat) {
+  mShadeFlat = shadeFlat;
+  write(RenderLogBodyOp::eSHADE_FLAT, static_cast<uint8_t>(shadeFlat));
+}
+
+void RecordRigidbody::destroy() { mScene->removeRigidbody(this); }
+
+std::vector<std::shared_ptr<IPxrRenderShape>> RecordRigidbody::getRenderShapes() {
+  if (mType == physx::PxGeometryType::eTRIANGLEMESH && !mMesh) {
+    return {};
+  }
+  return {std::make_shared<RecordShape>(mMesh, mMaterial)};
+}
+
+void RecordRigidbody::rescale(float factor) {
+  mInitialPose.p *= factor;
+  mScale *= factor;
+  write(RenderLogBodyOp::eRESCALE, factor);
+}
+
+//========== Camera ==========//
+RecordCamera::RecordCamera(RecordScene *scene, uint32_t id, uint32_t width, uint32_t height,
+                           float fovy, float near, float far)
+    : mScene(scene), mId(id), mWidth(width), mHeight(height), mCx(width / 2.f),
+      mCy(height / 2.f), mFx(height / 2.f / std::tan(fovy / 2.f)), mFy(mFx), mNear(near),
+      mFar(far) {}
+
+void RecordCamera::setPose(physx::PxTransform const &pose) {
+  if (!(pose == mPose)) {
+    mPose = pose;
+    mMoved = true;
+  }
+}
+
+IPxrScene *RecordCamera::getScene() { return mScene; }
+
+void RecordCamera::setPerspectiveCameraParameters(float near, float far, float fx, float fy,
+                                                  float cx, float cy, float skew) {
+  mNear = near;
+  mFar = far;
+  mFx = fx;
+  mFy = fy;
+  mCx = cx;
+  mCy = cy;
+  mSkew = skew;
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eCAMERA_SET)
+      .put(mId)
+      .put(near)
+      .put(far)
+      .put(fx)
+      .put(fy)
+      .put(cx)
+      .put(cy)
+      .put(skew);
+}
+
+void RecordCamera::takePicture() {
+  RenderLogWriter::Record(mScene->getWriter(), RenderLogRecord::eTAKE_PICTURE)
+      .put(mId)
+      .putPose(mPose);
+}
+
+//========== Scene ==========//
+RecordScene::RecordScene(RecordRenderer *renderer, uint32_t id, std::string const &name)
+    : mRenderer(renderer), mWriter(renderer->getWriter()), mId(id), mName(name) {
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eCREATE_SCENE).put(mId).putString(name);
+}
+
+IPxrRigidbody *RecordScene::addBody(std::unique_ptr<RecordRigidbody> body) {
+  mBodies.push_back(std::move(body));
+  return mBodies.back().get();
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(const std::string &meshFile,
+                                         const physx::PxVec3 &scale) {
+  return addRigidbody(meshFile, scale, nullptr);
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale,
+                                         std::shared_ptr<IPxrMaterial> material) {
+  uint32_t matId = materialId(material);
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_BODY)
+      .put(mId)
+      .put(id)
+      .put(RenderLogBodyKind::eFILE)
+      .putVec3(scale)
+      .put(matId)
+      .putString(meshFile);
+  return addBody(std::make_unique<RecordRigidbody>(this, id, physx::PxGeometryType::eTRIANGLEMESH,
+                                                   scale, nullptr, material));
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(std::shared_ptr<IRenderMesh> mesh,
+                                         const physx::PxVec3 &scale,
+                                         std::shared_ptr<IPxrMaterial> material) {
+  auto recorded = std::dynamic_pointer_cast<RecordMesh>(mesh);
+  if (!recorded) {
+    throw std::runtime_error("failed to add body: the mesh is not from this renderer");
+  }
+  uint32_t matId = materialId(material);
+  recorded->write();
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_BODY)
+      .put(mId)
+      .put(id)
+      .put(RenderLogBodyKind::eMESH)
+      .putVec3(scale)
+      .put(matId)
+      .put(recorded->getId());
+  return addBody(std::make_unique<RecordRigidbody>(this, id, physx::PxGeometryType::eTRIANGLEMESH,
+                                                   scale, mesh, material));
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(physx::PxGeometryType::Enum type,
+                                         const physx::PxVec3 &scale,
+                                         std::shared_ptr<IPxrMaterial> material) {
+  uint32_t matId = materialId(material);
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_BODY)
+      .put(mId)
+      .put(id)
+      .put(RenderLogBodyKind::ePRIMITIVE)
+      .putVec3(scale)
+      .put(matId)
+      .put(type);
+  return addBody(std::make_unique<RecordRigidbody>(this, id, type, scale, nullptr, material));
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(physx::PxGeometryType::Enum type,
+                                         const physx::PxVec3 &scale, const physx::PxVec3 &color) {
+  auto material = mRenderer->createMaterial();
+  material->setBaseColor({color.x, color.y, color.z, 1.f});
+  return addRigidbody(type, scale, material);
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                                         std::vector<physx::PxVec3> const &normals,
+                                         std::vector<uint32_t> const &indices,
+                                         const physx::PxVec3 &scale,
+                                         std::shared_ptr<IPxrMaterial> material) {
+  uint32_t matId = materialId(material);
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_BODY)
+      .put(mId)
+      .put(id)
+      .put(RenderLogBodyKind::eVERTICES)
+      .putVec3(scale)
+      .put(matId)
+      .putArray(vertices)
+      .putArray(normals)
+      .putArray(indices);
+  return addBody(std::make_unique<RecordRigidbody>(this, id, physx::PxGeometryType::eTRIANGLEMESH,
+                                                   scale, nullptr, material));
+}
+
+IPxrRigidbody *RecordScene::addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                                         std::vector<physx::PxVec3> const &normals,
+                                         std::vector<uint32_t> const &indices,
+                                         const physx::PxVec3 &scale, const physx::PxVec3 &color) {
+  auto material = mRenderer->createMaterial();
+  material->setBaseColor({color.x, color.y, color.z, 1.f});
+  return addRigidbody(vertices, normals, indices, scale, material);
+}
+
+void RecordScene::removeRigidbody(IPxrRigidbody *body) {
+  auto it = std::find_if(mBodies.begin(), mBodies.end(),
+                         [body](auto &b) { return b.get() == body; });
+  if (it == mBodies.end()) {
+    return;
+  }
+  if ((*it)->mMoved) {
+    mMovedBodies.erase(std::remove(mMovedBodies.begin(), mMovedBodies.end(), it->get()),
+                       mMovedBodies.end());
+  }
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_BODY).put(mId).put((*it)->getId());
+  mBodies.erase(it);
+}
+
+ICamera *RecordScene::addCamera(uint32_t width, uint32_t height, float fovy, float near,
+                                float far, std::string const &shaderDir) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_CAMERA)
+      .put(mId)
+      .put(id)
+      .put(width)
+      .put(height)
+      .put(fovy)
+      .put(near)
+      .put(far)
+      .putString(shaderDir);
+  mCameras.push_back(std::make_unique<RecordCamera>(this, id, width, height, fovy, near, far));
+  return mCameras.back().get();
+}
+
+void RecordScene::removeCamera(ICamera *camera) {
+  auto it = std::find_if(mCameras.begin(), mCameras.end(),
+                         [camera](auto &c) { return c.get() == camera; });
+  if (it == mCameras.end()) {
+    return;
+  }
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_CAMERA)
+      .put(mId)
+      .put((*it)->getId());
+  mCameras.erase(it);
+}
+
+std::vector<ICamera *> RecordScene::getCameras() {
+  std::vector<ICamera *> cameras;
+  for (auto &camera : mCameras) {
+    cameras.push_back(camera.get());
+  }
+  return cameras;
+}
+
+void RecordScene::setAmbientLight(std::array<float, 3> const &color) {
+  mAmbientLight = color;
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eSCENE_SET, mId,
+                          RenderLogSceneOp::eAMBIENT_LIGHT)
+      .put(color);
+}
+
+IPointLight *RecordScene::addPointLight(std::array<float, 3> const &position,
+                                        std::array<float, 3> const &color, bool enableShadow,
+                                        float shadowNear, float shadowFar,
+                                        uint32_t shadowMapSize) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_LIGHT)
+      .put(mId)
+      .put(id)
+      .put(RenderLogLightKind::ePOINT)
+      .put(position)
+      .put(color)
+      .put<uint8_t>(enableShadow)
+      .put(shadowNear)
+      .put(shadowFar)
+      .put(shadowMapSize);
+  auto light = std::make_unique<RecordPointLight>(
+      mWriter, id, physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+IDirectionalLight *RecordScene::addDirectionalLight(
+    std::array<float, 3> const &direction, std::array<float, 3> const &color, bool enableShadow,
+    std::array<float, 3> const &position, float shadowScale, float shadowNear, float shadowFar,
+    uint32_t shadowMapSize) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_LIGHT)
+      .put(mId)
+      .put(id)
+      .put(RenderLogLightKind::eDIRECTIONAL)
+      .put(direction)
+      .put(color)
+      .put<uint8_t>(enableShadow)
+      .put(position)
+      .put(shadowScale)
+      .put(shadowNear)
+      .put(shadowFar)
+      .put(shadowMapSize);
+  auto light = std::make_unique<RecordDirectionalLight>(
+      mWriter, id, physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow,
+      physx::PxVec3{direction[0], direction[1], direction[2]}, shadowScale, shadowNear,
+      shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+ISpotLight *RecordScene::addSpotLight(std::array<float, 3> const &position,
+                                      std::array<float, 3> const &direction, float fovInner,
+                                      float fovOuter, std::array<float, 3> const &color,
+                                      bool enableShadow, float shadowNear, float shadowFar,
+                                      uint32_t shadowMapSize) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_LIGHT)
+      .put(mId)
+      .put(id)
+      .put(RenderLogLightKind::eSPOT)
+      .put(position)
+      .put(direction)
+      .put(fovInner)
+      .put(fovOuter)
+      .put(color)
+      .put<uint8_t>(enableShadow)
+      .put(shadowNear)
+      .put(shadowFar)
+      .put(shadowMapSize);
+  auto light = std::make_unique<RecordSpotLight>(
+      mWriter, id, physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow,
+      physx::PxVec3{direction[0], direction[1], direction[2]}, fovOuter, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+IActiveLight *RecordScene::addActiveLight(physx::PxTransform const &pose,
+                                          std::array<float, 3> const &color, float fov,
+                                          std::string_view texPath, float shadowNear,
+                                          float shadowFar, uint32_t shadowMapSize) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eADD_LIGHT)
+      .put(mId)
+      .put(id)
+      .put(RenderLogLightKind::eACTIVE)
+      .putPose(pose)
+      .put(color)
+      .put(fov)
+      .putString(texPath)
+      .put(shadowNear)
+      .put(shadowFar)
+      .put(shadowMapSize);
+  auto light = std::make_unique<RecordActiveLight>(mWriter, id, pose,
+                                                   physx::PxVec3{color[0], color[1], color[2]},
+                                                   fov, texPath, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+static uint32_t lightId(ILight *light) {
+  if (auto l = dynamic_cast<RecordPointLight *>(light)) {
+    return l->getId();
+  }
+  if (auto l = dynamic_cast<RecordDirectionalLight *>(light)) {
+    return l->getId();
+  }
+  if (auto l = dynamic_cast<RecordSpotLight *>(light)) {
+    return l->getId();
+  }
+  if (auto l = dynamic_cast<RecordActiveLight *>(light)) {
+    return l->getId();
+  }
+  return 0;
+}
+
+void RecordScene::removeLight(ILight *light) {
+  auto it = std::find_if(mLights.begin(), mLights.end(),
+                         [light](auto &l) { return l.get() == light; });
+  if (it == mLights.end()) {
+    return;
+  }
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_LIGHT).put(mId).put(lightId(light));
+  mLights.erase(it);
+}
+
+void RecordScene::setEnvironmentMap(std::string_view path) {
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eSCENE_SET, mId,
+                          RenderLogSceneOp::eENVIRONMENT_MAP)
+      .putString(path);
+}
+
+void RecordScene::setEnvironmentMap(std::array<std::string_view, 6> paths) {
+  RenderLogWriter::Record record(*mWriter, RenderLogRecord::eSCENE_SET, mId,
+                                 RenderLogSceneOp::eENVIRONMENT_CUBE);
+  for (auto path : paths) {
+    record.putString(path);
+  }
+}
+
+void RecordScene::writeFrame(std::vector<ICamera *> const &pictures) {
+  // validate before anything is written or cleared, a throw must not leave half a record
+  std::vector<uint32_t> pictureIds;
+  for (auto camera : pictures) {
+    auto recorded = dynamic_cast<RecordCamera *>(camera);
+    if (!recorded || recorded->mScene != this) {
+      throw std::runtime_error("failed to take picture: the camera is not from this scene");
+    }
+    pictureIds.push_back(recorded->getId());
+  }
+
+  std::vector<RecordCamera *> movedCameras;
+  for (auto &camera : mCameras) {
+    if (camera->mMoved) {
+      movedCameras.push_back(camera.get());
+      camera->mMoved = false;
+    }
+  }
+
+  RenderLogWriter::Record record(*mWriter, RenderLogRecord::eFRAME);
+  record.put(mId).put(mFrameCount++);
+  record.put<uint32_t>(mMovedBodies.size());
+  for (auto body : mMovedBodies) {
+    record.put(body->getId()).putPose(body->getPose());
+    body->mMoved = false;
+  }
+  mMovedBodies.clear();
+  record.put<uint32_t>(movedCameras.size());
+  for (auto camera : movedCameras) {
+    record.put(camera->getId()).putPose(camera->getPose());
+  }
+  record.putArray(pictureIds);
+}
+
+void RecordScene::updateRender() { writeFrame({}); }
+
+void RecordScene::updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) {
+  writeFrame(cameras);
+}
+
+void RecordScene::destroy() { mRenderer->removeScene(this); }
+
+//========== Renderer ==========//
+RecordRenderer::RecordRenderer(std::string const &filename)
+    : mWriter(std::make_shared<RenderLogWriter>(filename)) {}
+
+IPxrScene *RecordRenderer::createScene(std::string const &name) {
+  mScenes.push_back(std::make_unique<RecordScene>(this, mWriter->nextId(), name));
+  return mScenes.back().get();
+}
+
+void RecordRenderer::removeScene(IPxrScene *scene) {
+  auto it = std::find_if(mScenes.begin(), mScenes.end(),
+                         [scene](auto &s) { return s.get() == scene; });
+  if (it == mScenes.end()) {
+    return;
+  }
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eREMOVE_SCENE).put((*it)->getId());
+  mScenes.erase(it);
+}
+
+std::shared_ptr<IPxrMaterial> RecordRenderer::createMaterial() {
+  return std::make_shared<RecordMaterial>(mWriter, mWriter->nextId());
+}
+
+std::shared_ptr<IRenderMesh> RecordRenderer::createMesh(std::vector<float> const &vertices,
+                                                        std::vector<uint32_t> const &indices) {
+  return std::make_shared<RecordMesh>(mWriter, mWriter->nextId(), vertices, indices);
+}
+
+std::shared_ptr<IPxrTexture>
+RecordRenderer::createTexture(std::string_view filename, uint32_t mipLevels,
+                              IPxrTexture::FilterMode::Enum filterMode,
+                              IPxrTexture::AddressMode::Enum addressMode) {
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eCREATE_TEXTURE_FILE)
+      .put(id)
+      .putString(filename)
+      .put(mipLevels)
+      .put(filterMode)
+      .put(addressMode);
+  // the size is unknown without loading the file
+  return std::make_shared<RecordTexture>(mWriter, id, std::string(filename), 0, 0, 0, mipLevels,
+                                         filterMode, addressMode);
+}
+
+std::shared_ptr<IPxrTexture>
+RecordRenderer::createTexture(std::vector<uint8_t> const &data, int width, int height,
+                              uint32_t mipLevels, IPxrTexture::FilterMode::Enum filterMode,
+                              IPxrTexture::AddressMode::Enum addressMode, bool srgb) {
+  if (width <= 0 || height <= 0 || data.size() % (width * height)) {
+    throw std::runtime_error("failed to create texture: invalid size");
+  }
+  uint32_t id = mWriter->nextId();
+  RenderLogWriter::Record(*mWriter, RenderLogRecord::eCREATE_TEXTURE_DATA)
+      .put(id)
+      .put(width)
+      .put(height)
+      .put(mipLevels)
+      .put(filterMode)
+      .put(addressMode)
+      .put<uint8_t>(srgb)
+      .putArray(data);
+  return std::make_shared<RecordTexture>(mWriter, id, "", width, height,
+                                         data.size() / (width * height), mipLevels, filterMode,
+                                         addressMode);
+}
+
+} // namespace Renderer
+} // namespace sapien
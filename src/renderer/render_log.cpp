@@ -0,0 +1,773 @@
+#include "sapien/renderer/render_log.h"
+#include <stdexcept>
+
+namespace sapien {
+namespace Renderer {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'S', 'R', 'L', 'G'};
+constexpr uint8_t kVersion = 1;
+// kind and payload size
+constexpr size_t kRecordHeaderSize = 5;
+
+} // namespace
+
+//========== Writer ==========//
+RenderLogWriter::Record::Record(RenderLogWriter &writer, RenderLogRecord kind)
+    : mWriter(writer), mLock(writer.mMutex), mStart(writer.mBuffer.size()) {
+  mWriter.mBuffer.resize(mStart + kRecordHeaderSize);
+  mWriter.mBuffer[mStart] = static_cast<uint8_t>(kind);
+}
+
+RenderLogWriter::Record::~Record() {
+  auto &buffer = mWriter.mBuffer;
+  uint32_t size = buffer.size() - mStart - kRecordHeaderSize;
+  std::memcpy(buffer.data() + mStart + 1, &size, sizeof(size));
+  if (buffer.size() >= kFlushSize) {
+    mWriter.writeBuffer();
+  }
+}
+
+RenderLogWriter::Record &RenderLogWriter::Record::putBytes(void const *data, size_t size) {
+  auto &buffer = mWriter.mBuffer;
+  auto offset = buffer.size();
+  buffer.resize(offset + size);
+  if (size) {
+    std::memcpy(buffer.data() + offset, data, size);
+  }
+  return *this;
+}
+
+RenderLogWriter::Record &RenderLogWriter::Record::putVec3(physx::PxVec3 const &value) {
+  float values[3] = {value.x, value.y, value.z};
+  return putBytes(values, sizeof(values));
+}
+
+RenderLogWriter::Record &RenderLogWriter::Record::putPose(physx::PxTransform const &pose) {
+  float values[7] = {pose.p.x, pose.p.y, pose.p.z, pose.q.x, pose.q.y, pose.q.z, pose.q.w};
+  return putBytes(values, sizeof(values));
+}
+
+RenderLogWriter::RenderLogWriter(std::string const &filename)
+    : mFilename(filename), mFile(filename, std::ios::binary | std::ios::trunc) {
+  if (!mFile) {
+    throw std::runtime_error("failed to open render log " + filename);
+  }
+  mBuffer.insert(mBuffer.end(), std::begin(kMagic), std::end(kMagic));
+  mBuffer.push_back(kVersion);
+}
+
+RenderLogWriter::~RenderLogWriter() {
+  std::lock_guard lock(mMutex);
+  writeBuffer();
+}
+
+void RenderLogWriter::flush() {
+  std::lock_guard lock(mMutex);
+  writeBuffer();
+  mFile.flush();
+  if (!mFile) {
+    throw std::runtime_error("failed to write render log " + mFilename);
+  }
+}
+
+// called with the mutex held
+void RenderLogWriter::writeBuffer() {
+  if (mBuffer.empty()) {
+    return;
+  }
+  if (mFile) {
+    mFile.write(reinterpret_cast<char const *>(mBuffer.data()), mBuffer.size());
+    if (mFile) {
+      mBytesWritten += mBuffer.size();
+    } else {
+      // records are written from destructors, report once and let flush throw
+      spdlog::get("SAPIEN")->error("failed to write render log {}", mFilename);
+    }
+  }
+  mBuffer.clear();
+}
+
+//========== Reader ==========//
+class RenderLogReader {
+public:
+  explicit RenderLogReader(std::vector<uint8_t> const &data) : mData(data) {}
+
+  template <typename T> T get() {
+    T value;
+    read(&value, sizeof(T));
+    return value;
+  }
+
+  template <typename T> std::vector<T> getArray() {
+    std::vector<T> values(get<uint32_t>());
+    read(values.data(), values.size() * sizeof(T));
+    return values;
+  }
+
+  std::string getString() {
+    auto chars = getArray<char>();
+    return {chars.begin(), chars.end()};
+  }
+
+  physx::PxTransform getPose() {
+    float v[7];
+    read(v, sizeof(v));
+    return {{v[0], v[1], v[2]}, {v[3], v[4], v[5], v[6]}};
+  }
+
+  physx::PxVec3 getVec3() {
+    float v[3];
+    read(v, sizeof(v));
+    return {v[0], v[1], v[2]};
+  }
+
+  std::array<float, 3> getArray3() { return get<std::array<float, 3>>(); }
+
+private:
+  void read(void *out, size_t bytes) {
+    if (mOffset + bytes > mData.size()) {
+      throw std::runtime_error("failed to replay render log: record is truncated");
+    }
+    if (bytes) {
+      std::memcpy(out, mData.data() + mOffset, bytes);
+    }
+    mOffset += bytes;
+  }
+
+  std::vector<uint8_t> const &mData;
+  size_t mOffset{0};
+};
+
+//========== Replayer ==========//
+RenderLogReplayer::RenderLogReplayer(std::string const &filename,
+                                     std::shared_ptr<IPxrRenderer> renderer)
+    : mFilename(filename), mFile(filename, std::ios::binary), mRenderer(std::move(renderer)) {
+  if (!mRenderer) {
+    throw std::runtime_error("failed to replay render log: renderer is null");
+  }
+  if (!mFile) {
+    throw std::runtime_error("failed to open render log " + filename);
+  }
+  uint8_t header[sizeof(kMagic) + 1];
+  mFile.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (!mFile || std::memcmp(header, kMagic, sizeof(kMagic)) != 0) {
+    throw std::runtime_error(filename + " is not a render log");
+  }
+  if (header[sizeof(kMagic)] != kVersion) {
+    throw std::runtime_error("unsupported render log version " +
+                             std::to_string(header[sizeof(kMagic)]) + " in " + filename);
+  }
+}
+
+RenderLogReplayer::~RenderLogReplayer() {
+  // bodies, cameras and lights go with their scenes
+  for (auto scene : mSceneList) {
+    if (scene) {
+      mRenderer->removeScene(scene);
+    }
+  }
+}
+
+bool RenderLogReplayer::readRecord(RenderLogRecord &kind, std::vector<uint8_t> &payload) {
+  uint8_t header[kRecordHeaderSize];
+  mFile.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (mFile.gcount() == 0) {
+    return false;
+  }
+  uint32_t size;
+  std::memcpy(&size, header + 1, sizeof(size));
+  if (mFile.gcount() == sizeof(header)) {
+    payload.resize(size);
+    mFile.read(reinterpret_cast<char *>(payload.data()), size);
+    if (static_cast<uint32_t>(mFile.gcount()) == size) {
+      kind = static_cast<RenderLogRecord>(header[0]);
+      return true;
+    }
+  }
+  // the recording process did not finish its last write
+  spdlog::get("SAPIEN")->warn("render log {} ends with a truncated record", mFilename);
+  return false;
+}
+
+bool RenderLogReplayer::step() {
+  if (!mHasNext) {
+    mHasNext = readRecord(mNextKind, mNextPayload);
+  }
+  bool frame = false;
+  while (mHasNext) {
+    if (mNextKind == RenderLogRecord::eFRAME) {
+      if (frame) {
+        return true;
+      }
+      frame = true;
+    }
+    apply(mNextKind, mNextPayload);
+    mHasNext = readRecord(mNextKind, mNextPayload);
+  }
+  return frame;
+}
+
+uint64_t RenderLogReplayer::run() {
+  uint64_t start = mFrameCount;
+  while (step()) {
+  }
+  return mFrameCount - start;
+}
+
+IPxrScene *RenderLogReplayer::getScene(uint32_t sceneIndex) const {
+  if (sceneIndex >= mSceneList.size() || !mSceneList[sceneIndex]) {
+    throw std::runtime_error("invalid scene index " + std::to_string(sceneIndex));
+  }
+  return mSceneList[sceneIndex];
+}
+
+ICamera *RenderLogReplayer::getCamera(uint32_t sceneIndex, uint32_t cameraIndex) const {
+  if (sceneIndex >= mSceneCameras.size() || cameraIndex >= mSceneCameras[sceneIndex].size() ||
+      !mSceneCameras[sceneIndex][cameraIndex]) {
+    throw std::runtime_error("invalid camera index " + std::to_string(cameraIndex) +
+                             " in scene " + std::to_string(sceneIndex));
+  }
+  return mSceneCameras[sceneIndex][cameraIndex];
+}
+
+IPxrScene *RenderLogReplayer::scene(uint32_t id) const {
+  auto it = mScenes.find(id);
+  if (it == mScenes.end()) {
+    throw std::runtime_error("failed to replay render log: invalid scene id");
+  }
+  return it->second.scene;
+}
+
+std::shared_ptr<IPxrMaterial> RenderLogReplayer::material(uint32_t id) const {
+  auto it = mMaterials.find(id);
+  return it == mMaterials.end() ? nullptr : it->second;
+}
+
+template <typename Map> static auto lookup(Map const &map, uint32_t id) {
+  auto it = map.find(id);
+  return it == map.end() ? typename Map::mapped_type{} : it->second;
+}
+
+void RenderLogReplayer::apply(RenderLogRecord kind, std::vector<uint8_t> const &payload) {
+  RenderLogReader reader(payload);
+  switch (kind) {
+  case RenderLogRecord::eCREATE_SCENE: {
+    uint32_t id = reader.get<uint32_t>();
+    auto s = mRenderer->createScene(reader.getString());
+    uint32_t index = mSceneList.size();
+    mScenes[id] = {s, index};
+    mSceneList.push_back(s);
+    mSceneCameras.emplace_back();
+    break;
+  }
+  case RenderLogRecord::eREMOVE_SCENE: {
+    uint32_t id = reader.get<uint32_t>();
+    auto it = mScenes.find(id);
+    if (it == mScenes.end()) {
+      break;
+    }
+    uint32_t index = it->second.index;
+    mRenderer->removeScene(it->second.scene);
+    mSceneList[index] = nullptr;
+    for (auto &camera : mSceneCameras[index]) {
+      camera = nullptr;
+    }
+    mScenes.erase(it);
+    break;
+  }
+  case RenderLogRecord::eSCENE_SET: {
+    auto s = scene(reader.get<uint32_t>());
+    switch (reader.get<RenderLogSceneOp>()) {
+    case RenderLogSceneOp::eAMBIENT_LIGHT:
+      s->setAmbientLight(reader.getArray3());
+      break;
+    case RenderLogSceneOp::eENVIRONMENT_MAP:
+      s->setEnvironmentMap(std::string_view(reader.getString()));
+      break;
+    case RenderLogSceneOp::eENVIRONMENT_CUBE: {
+      std::array<std::string, 6> files;
+      for (auto &file : files) {
+        file = reader.getString();
+      }
+      s->setEnvironmentMap(std::array<std::string_view, 6>{files[0], files[1], files[2], files[3],
+                                                           files[4], files[5]});
+      break;
+    }
+    }
+    break;
+  }
+  case RenderLogRecord::eCREATE_MATERIAL:
+    mMaterials[reader.get<uint32_t>()] = mRenderer->createMaterial();
+    break;
+  case RenderLogRecord::eMATERIAL_SET:
+    applyMaterial(reader);
+    break;
+  case RenderLogRecord::eREMOVE_MATERIAL:
+    mMaterials.erase(reader.get<uint32_t>());
+    break;
+  case RenderLogRecord::eCREATE_TEXTURE_FILE: {
+    uint32_t id = reader.get<uint32_t>();
+    auto filename = reader.getString();
+    auto mipLevels = reader.get<uint32_t>();
+    auto filter = reader.get<IPxrTexture::FilterMode::Enum>();
+    auto address = reader.get<IPxrTexture::AddressMode::Enum>();
+    mTextures[id] = mRenderer->createTexture(filename, mipLevels, filter, address);
+    break;
+  }
+  case RenderLogRecord::eCREATE_TEXTURE_DATA: {
+    uint32_t id = reader.get<uint32_t>();
+    auto width = reader.get<int>();
+    auto height = reader.get<int>();
+    auto mipLevels = reader.get<uint32_t>();
+    auto filter = reader.get<IPxrTexture::FilterMode::Enum>();
+    auto address = reader.get<IPxrTexture::AddressMode::Enum>();
+    auto srgb = reader.get<uint8_t>();
+    auto data = reader.getArray<uint8_t>();
+    mTextures[id] =
+        mRenderer->createTexture(data, width, height, mipLevels, filter, address, srgb);
+    break;
+  }
+  case RenderLogRecord::eREMOVE_TEXTURE:
+    mTextures.erase(reader.get<uint32_t>());
+    break;
+  case RenderLogRecord::eCREATE_MESH: {
+    uint32_t id = reader.get<uint32_t>();
+    auto vertices = reader.getArray<float>();
+    auto normals = reader.getArray<float>();
+    auto uvs = reader.getArray<float>();
+    auto tangents = reader.getArray<float>();
+    auto bitangents = reader.getArray<float>();
+    auto indices = reader.getArray<uint32_t>();
+    auto mesh = mRenderer->createMesh(vertices, indices);
+    if (!normals.empty()) {
+      mesh->setNormals(normals);
+    }
+    if (!uvs.empty()) {
+      mesh->setUVs(uvs);
+    }
+    if (!tangents.empty()) {
+      mesh->setTangents(tangents);
+    }
+    if (!bitangents.empty()) {
+      mesh->setBitangents(bitangents);
+    }
+    mMeshes[id] = mesh;
+    break;
+  }
+  case RenderLogRecord::eREMOVE_MESH:
+    mMeshes.erase(reader.get<uint32_t>());
+    break;
+  case RenderLogRecord::eADD_BODY:
+    applyAddBody(reader);
+    break;
+  case RenderLogRecord::eBODY_SET:
+    applyBody(reader);
+    break;
+  case RenderLogRecord::eREMOVE_BODY: {
+    auto s = scene(reader.get<uint32_t>());
+    uint32_t id = reader.get<uint32_t>();
+    if (auto body = lookup(mBodies, id)) {
+      s->removeRigidbody(body);
+    }
+    mBodies.erase(id);
+    break;
+  }
+  case RenderLogRecord::eADD_CAMERA: {
+    uint32_t sceneId = reader.get<uint32_t>();
+    uint32_t id = reader.get<uint32_t>();
+    auto width = reader.get<uint32_t>();
+    auto height = reader.get<uint32_t>();
+    auto fovy = reader.get<float>();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    auto shaderDir = reader.getString();
+    auto camera = scene(sceneId)->addCamera(width, height, fovy, near, far, shaderDir);
+    uint32_t sceneIndex = mScenes.at(sceneId).index;
+    auto &cameras = mSceneCameras[sceneIndex];
+    mCameras[id] = {camera, sceneIndex, static_cast<uint32_t>(cameras.size())};
+    cameras.push_back(camera);
+    break;
+  }
+  case RenderLogRecord::eCAMERA_SET: {
+    auto camera = lookup(mCameras, reader.get<uint32_t>()).camera;
+    float v[7];
+    for (auto &value : v) {
+      value = reader.get<float>();
+    }
+    if (camera) {
+      camera->setPerspectiveCameraParameters(v[0], v[1], v[2], v[3], v[4], v[5], v[6]);
+    }
+    break;
+  }
+  case RenderLogRecord::eREMOVE_CAMERA: {
+    auto s = scene(reader.get<uint32_t>());
+    auto it = mCameras.find(reader.get<uint32_t>());
+    if (it == mCameras.end()) {
+      break;
+    }
+    s->removeCamera(it->second.camera);
+    mSceneCameras[it->second.sceneIndex][it->second.cameraIndex] = nullptr;
+    mCameras.erase(it);
+    break;
+  }
+  case RenderLogRecord::eADD_LIGHT:
+    applyAddLight(reader);
+    break;
+  case RenderLogRecord::eLIGHT_SET:
+    applyLight(reader);
+    break;
+  case RenderLogRecord::eREMOVE_LIGHT: {
+    auto s = scene(reader.get<uint32_t>());
+    uint32_t id = reader.get<uint32_t>();
+    if (auto light = lookup(mLights, id)) {
+      s->removeLight(light);
+    }
+    mLights.erase(id);
+    break;
+  }
+  case RenderLogRecord::eFRAME:
+    applyFrame(reader);
+    break;
+  case RenderLogRecord::eTAKE_PICTURE: {
+    auto it = mCameras.find(reader.get<uint32_t>());
+    auto pose = reader.getPose();
+    if (it != mCameras.end()) {
+      it->second.camera->setPose(pose);
+      takePicture(it->second);
+    }
+    break;
+  }
+  default:
+    throw std::runtime_error("failed to replay render log: unknown record kind " +
+                             std::to_string(static_cast<int>(kind)));
+  }
+}
+
+void RenderLogReplayer::applyMaterial(RenderLogReader &reader) {
+  auto mat = material(reader.get<uint32_t>());
+  auto op = reader.get<RenderLogMaterialOp>();
+  if (!mat) {
+    return;
+  }
+  switch (op) {
+  case RenderLogMaterialOp::eBASE_COLOR:
+    mat->setBaseColor(reader.get<std::array<float, 4>>());
+    break;
+  case RenderLogMaterialOp::eROUGHNESS:
+    mat->setRoughness(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eSPECULAR:
+    mat->setSpecular(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eMETALLIC:
+    mat->setMetallic(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eEMISSION:
+    mat->setEmission(reader.get<std::array<float, 4>>());
+    break;
+  case RenderLogMaterialOp::eIOR:
+    mat->setIOR(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eTRANSMISSION:
+    mat->setTransmission(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eTRANSMISSION_ROUGHNESS:
+    mat->setTransmissionRoughness(reader.get<float>());
+    break;
+  case RenderLogMaterialOp::eTEXTURE: {
+    auto slot = reader.get<RenderLogTextureSlot>();
+    auto texture = lookup(mTextures, reader.get<uint32_t>());
+    switch (slot) {
+    case RenderLogTextureSlot::eEMISSION:
+      mat->setEmissionTexture(texture);
+      break;
+    case RenderLogTextureSlot::eDIFFUSE:
+      mat->setDiffuseTexture(texture);
+      break;
+    case RenderLogTextureSlot::eMETALLIC:
+      mat->setMetallicTexture(texture);
+      break;
+    case RenderLogTextureSlot::eROUGHNESS:
+      mat->setRoughnessTexture(texture);
+      break;
+    case RenderLogTextureSlot::eNORMAL:
+      mat->setNormalTexture(texture);
+      break;
+    case RenderLogTextureSlot::eTRANSMISSION:
+      mat->setTransmissionTexture(texture);
+      break;
+    }
+    break;
+  }
+  case RenderLogMaterialOp::eTEXTURE_FILE: {
+    auto slot = reader.get<RenderLogTextureSlot>();
+    auto filename = reader.getString();
+    switch (slot) {
+    case RenderLogTextureSlot::eEMISSION:
+      mat->setEmissionTextureFromFilename(filename);
+      break;
+    case RenderLogTextureSlot::eDIFFUSE:
+      mat->setDiffuseTextureFromFilename(filename);
+      break;
+    case RenderLogTextureSlot::eMETALLIC:
+      mat->setMetallicTextureFromFilename(filename);
+      break;
+    case RenderLogTextureSlot::eROUGHNESS:
+      mat->setRoughnessTextureFromFilename(filename);
+      break;
+    case RenderLogTextureSlot::eNORMAL:
+      mat->setNormalTextureFromFilename(filename);
+      break;
+    case RenderLogTextureSlot::eTRANSMISSION:
+      mat->setTransmissionTextureFromFilename(filename);
+      break;
+    }
+    break;
+  }
+  }
+}
+
+void RenderLogReplayer::applyAddBody(RenderLogReader &reader) {
+  auto s = scene(reader.get<uint32_t>());
+  uint32_t id = reader.get<uint32_t>();
+  auto kind = reader.get<RenderLogBodyKind>();
+  auto scale = reader.getVec3();
+  auto mat = material(reader.get<uint32_t>());
+
+  IPxrRigidbody *body{};
+  switch (kind) {
+  case RenderLogBodyKind::eFILE: {
+    auto filename = reader.getString();
+    body = mat ? s->addRigidbody(filename, scale, mat) : s->addRigidbody(filename, scale);
+    break;
+  }
+  case RenderLogBodyKind::eMESH:
+    body = s->addRigidbody(lookup(mMeshes, reader.get<uint32_t>()), scale, mat);
+    break;
+  case RenderLogBodyKind::ePRIMITIVE:
+    body = s->addRigidbody(reader.get<physx::PxGeometryType::Enum>(), scale, mat);
+    break;
+  case RenderLogBodyKind::eVERTICES: {
+    auto vertices = reader.getArray<physx::PxVec3>();
+    auto normals = reader.getArray<physx::PxVec3>();
+    auto indices = reader.getArray<uint32_t>();
+    body = s->addRigidbody(vertices, normals, indices, scale, mat);
+    break;
+  }
+  default:
+    throw std::runtime_error("failed to replay render log: unknown body kind");
+  }
+  // null when the renderer does not support the kind, its later records are skipped
+  mBodies[id] = body;
+}
+
+void RenderLogReplayer::applyBody(RenderLogReader &reader) {
+  auto body = lookup(mBodies, reader.get<uint32_t>());
+  auto op = reader.get<RenderLogBodyOp>();
+  if (!body) {
+    return;
+  }
+  switch (op) {
+  case RenderLogBodyOp::eNAME:
+    body->setName(reader.getString());
+    break;
+  case RenderLogBodyOp::eUNIQUE_ID:
+    body->setUniqueId(reader.get<uint32_t>());
+    break;
+  case RenderLogBodyOp::eSEGMENTATION_ID:
+    body->setSegmentationId(reader.get<uint32_t>());
+    break;
+  case RenderLogBodyOp::eCUSTOM_DATA:
+    body->setSegmentationCustomData(reader.getArray<float>());
+    break;
+  case RenderLogBodyOp::eINITIAL_POSE:
+    body->setInitialPose(reader.getPose());
+    break;
+  case RenderLogBodyOp::eVISIBILITY:
+    body->setVisibility(reader.get<float>());
+    break;
+  case RenderLogBodyOp::eVISIBLE:
+    body->setVisible(reader.get<uint8_t>());
+    break;
+  case RenderLogBodyOp::eRENDER_MODE:
+    body->setRenderMode(reader.get<uint32_t>());
+    break;
+  case RenderLogBodyOp::eSHADE_FLAT:
+    body->setShadeFlat(reader.get<uint8_t>());
+    break;
+  case RenderLogBodyOp::eRESCALE:
+    body->rescale(reader.get<float>());
+    break;
+  }
+}
+
+void RenderLogReplayer::applyAddLight(RenderLogReader &reader) {
+  auto s = scene(reader.get<uint32_t>());
+  uint32_t id = reader.get<uint32_t>();
+  ILight *light{};
+  switch (reader.get<RenderLogLightKind>()) {
+  case RenderLogLightKind::ePOINT: {
+    auto position = reader.getArray3();
+    auto color = reader.getArray3();
+    auto shadow = reader.get<uint8_t>();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    auto size = reader.get<uint32_t>();
+    light = s->addPointLight(position, color, shadow, near, far, size);
+    break;
+  }
+  case RenderLogLightKind::eDIRECTIONAL: {
+    auto direction = reader.getArray3();
+    auto color = reader.getArray3();
+    auto shadow = reader.get<uint8_t>();
+    auto position = reader.getArray3();
+    auto scale = reader.get<float>();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    auto size = reader.get<uint32_t>();
+    light = s->addDirectionalLight(direction, color, shadow, position, scale, near, far, size);
+    break;
+  }
+  case RenderLogLightKind::eSPOT: {
+    auto position = reader.getArray3();
+    auto direction = reader.getArray3();
+    auto fovInner = reader.get<float>();
+    auto fovOuter = reader.get<float>();
+    auto color = reader.getArray3();
+    auto shadow = reader.get<uint8_t>();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    auto size = reader.get<uint32_t>();
+    light = s->addSpotLight(position, direction, fovInner, fovOuter, color, shadow, near, far,
+                            size);
+    break;
+  }
+  case RenderLogLightKind::eACTIVE: {
+    auto pose = reader.getPose();
+    auto color = reader.getArray3();
+    auto fov = reader.get<float>();
+    auto texture = reader.getString();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    auto size = reader.get<uint32_t>();
+    light = s->addActiveLight(pose, color, fov, texture, near, far, size);
+    break;
+  }
+  default:
+    throw std::runtime_error("failed to replay render log: unknown light kind");
+  }
+  mLights[id] = light;
+}
+
+void RenderLogReplayer::applyLight(RenderLogReader &reader) {
+  auto light = lookup(mLights, reader.get<uint32_t>());
+  auto op = reader.get<RenderLogLightOp>();
+  if (!light) {
+    return;
+  }
+  auto point = dynamic_cast<IPointLight *>(light);
+  auto directional = dynamic_cast<IDirectionalLight *>(light);
+  auto spot = dynamic_cast<ISpotLight *>(light);
+  auto active = dynamic_cast<IActiveLight *>(light);
+  switch (op) {
+  case RenderLogLightOp::ePOSE:
+    light->setPose(reader.getPose());
+    break;
+  case RenderLogLightOp::eCOLOR:
+    light->setColor(reader.getVec3());
+    break;
+  case RenderLogLightOp::eSHADOW:
+    light->setShadowEnabled(reader.get<uint8_t>());
+    break;
+  case RenderLogLightOp::ePOSITION: {
+    auto position = reader.getVec3();
+    if (point) {
+      point->setPosition(position);
+    } else if (spot) {
+      spot->setPosition(position);
+    } else if (active) {
+      active->setPosition(position);
+    }
+    break;
+  }
+  case RenderLogLightOp::eDIRECTION: {
+    auto direction = reader.getVec3();
+    if (directional) {
+      directional->setDirection(direction);
+    } else if (spot) {
+      spot->setDirection(direction);
+    }
+    break;
+  }
+  case RenderLogLightOp::eSHADOW_PARAMETERS: {
+    auto halfSize = reader.get<float>();
+    auto near = reader.get<float>();
+    auto far = reader.get<float>();
+    if (directional) {
+      directional->setShadowParameters(halfSize, near, far);
+    } else if (point) {
+      point->setShadowParameters(near, far);
+    } else if (spot) {
+      spot->setShadowParameters(near, far);
+    } else if (active) {
+      active->setShadowParameters(near, far);
+    }
+    break;
+  }
+  case RenderLogLightOp::eFOV: {
+    auto fov = reader.get<float>();
+    if (spot) {
+      spot->setFov(fov);
+    } else if (active) {
+      active->setFov(fov);
+    }
+    break;
+  }
+  case RenderLogLightOp::eTEXTURE: {
+    auto texture = reader.getString();
+    if (active) {
+      active->setTexture(texture);
+    }
+    break;
+  }
+  }
+}
+
+void RenderLogReplayer::applyFrame(RenderLogReader &reader) {
+  auto s = scene(reader.get<uint32_t>());
+  mCurrentFrame = reader.get<uint64_t>();
+  for (uint32_t i = 0, n = reader.get<uint32_t>(); i < n; ++i) {
+    auto body = lookup(mBodies, reader.get<uint32_t>());
+    auto pose = reader.getPose();
+    if (body) {
+      body->update(pose);
+    }
+  }
+  for (uint32_t i = 0, n = reader.get<uint32_t>(); i < n; ++i) {
+    auto camera = lookup(mCameras, reader.get<uint32_t>()).camera;
+    auto pose = reader.getPose();
+    if (camera) {
+      camera->setPose(pose);
+    }
+  }
+  s->updateRender();
+  ++mFrameCount;
+  for (uint32_t i = 0, n = reader.get<uint32_t>(); i < n; ++i) {
+    auto it = mCameras.find(reader.get<uint32_t>());
+    if (it != mCameras.end()) {
+      takePicture(it->second);
+    }
+  }
+}
+
+void RenderLogReplayer::takePicture(CameraEntry const &entry) {
+  entry.camera->takePicture();
+  if (mPictureCallback) {
+    mPictureCallback(entry.sceneIndex, entry.cameraIndex, mCurrentFrame);
+  }
+}
+
+} // namespace Renderer
+} // namespace sapien
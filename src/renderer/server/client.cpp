@@ -1,6 +1,12 @@
 #include "sapien/renderer/server/client.h"
+#include "sapien/renderer/server/sharding.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 namespace sapien {
 namespace Renderer {
 namespace server {
@@ -8,11 +14,19 @@ namespace server {
 using ::grpc::ClientContext;
 using ::grpc::Status;
 
+// objects of a failed command batch hold ids the server never created
+static void checkNotFailed(ClientRenderer &renderer, rs_id_t id) {
+  if (renderer.isFailedId(id)) {
+    throw std::runtime_error("the object was created by a failed command batch");
+  }
+}
+
 //========== Material ==========//
 ClientMaterial::ClientMaterial(std::shared_ptr<ClientRenderer> renderer, rs_id_t id)
     : mRenderer(renderer), mId(id){};
 
 void ClientMaterial::setBaseColor(std::array<float, 4> color) {
+  checkNotFailed(*mRenderer, mId);
   ClientContext context;
   proto::IdVec4 req;
   proto::Empty res;
@@ -23,6 +37,10 @@ void ClientMaterial::setBaseColor(std::array<float, 4> color) {
   req.mutable_data()->set_y(color[1]);
   req.mutable_data()->set_z(color[2]);
   req.mutable_data()->set_w(color[3]);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_set_base_color() = req;
+    return;
+  }
 
   Status status = mRenderer->getStub().SetBaseColor(&context, req, &res);
   if (!status.ok()) {
@@ -31,11 +49,16 @@ void ClientMaterial::setBaseColor(std::array<float, 4> color) {
 }
 
 void ClientMaterial::setRoughness(float roughness) {
+  checkNotFailed(*mRenderer, mId);
   ClientContext context;
   proto::IdFloat req;
   proto::Empty res;
   req.set_id(mId);
   req.set_data(roughness);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_set_roughness() = req;
+    return;
+  }
 
   Status status = mRenderer->getStub().SetRoughness(&context, req, &res);
   if (!status.ok()) {
@@ -44,11 +67,16 @@ void ClientMaterial::setRoughness(float roughness) {
 }
 
 void ClientMaterial::setSpecular(float specular) {
+  checkNotFailed(*mRenderer, mId);
   ClientContext context;
   proto::IdFloat req;
   proto::Empty res;
   req.set_id(mId);
   req.set_data(specular);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_set_specular() = req;
+    return;
+  }
 
   Status status = mRenderer->getStub().SetSpecular(&context, req, &res);
   if (!status.ok()) {
@@ -57,11 +85,16 @@ void ClientMaterial::setSpecular(float specular) {
 }
 
 void ClientMaterial::setMetallic(float metallic) {
+  checkNotFailed(*mRenderer, mId);
   ClientContext context;
   proto::IdFloat req;
   proto::Empty res;
   req.set_id(mId);
   req.set_data(metallic);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_set_metallic() = req;
+    return;
+  }
 
   Status status = mRenderer->getStub().SetMetallic(&context, req, &res);
   if (!status.ok()) {
@@ -70,10 +103,17 @@ void ClientMaterial::setMetallic(float metallic) {
 }
 
 ClientMaterial::~ClientMaterial() {
+  if (mRenderer->isFailedId(mId)) {
+    return;
+  }
   ClientContext context;
   proto::Id req;
   proto::Empty res;
   req.set_id(mId);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_remove_material() = req;
+    return;
+  }
   Status status = mRenderer->getStub().RemoveMaterial(&context, req, &res);
   if (!status.ok()) {
     spdlog::get("SAPIEN")->error("remove client material failed. Is the server closed?");
@@ -88,6 +128,7 @@ ClientCamera::ClientCamera(ClientScene *scene, rs_id_t id, uint32_t width, uint3
     : mScene(scene), mId(id), mWidth(width), mHeight(height), mCx(cx), mCy(cy), mFx(fy), mFy(fy),
       mNear(near), mFar(far), mSkew(skew) {}
 void ClientCamera::takePicture() {
+  mScene->waitFrames();
   ClientContext context;
   proto::TakePictureReq req;
   proto::Empty res;
@@ -102,6 +143,7 @@ void ClientCamera::takePicture() {
 
 void ClientCamera::setPerspectiveCameraParameters(float near, float far, float fx, float fy,
                                                   float cx, float cy, float skew) {
+  mScene->waitFrames();
   ClientContext context;
   proto::CameraParamsReq req;
   proto::Empty res;
@@ -135,6 +177,7 @@ void ClientCamera::setPerspectiveCameraParameters(float near, float far, float f
 ClientShape::ClientShape(ClientRigidbody *body, uint32_t index) : mBody(body), mIndex(index) {}
 
 std::shared_ptr<IPxrMaterial> ClientShape::getMaterial() const {
+  mBody->getScene()->getRenderer()->submitCommands();
   ClientContext context;
   proto::BodyUint32Req req;
   proto::Id res;
@@ -155,6 +198,7 @@ std::shared_ptr<IPxrMaterial> ClientShape::getMaterial() const {
 ClientRigidbody::ClientRigidbody(ClientScene *scene, rs_id_t id) : mScene(scene), mId(id) {}
 
 void ClientRigidbody::setUniqueId(uint32_t uniqueId) {
+  checkNotFailed(*mScene->getRenderer(), mId);
   mUniqueId = uniqueId;
   ClientContext context;
   proto::BodyIdReq req;
@@ -162,6 +206,10 @@ void ClientRigidbody::setUniqueId(uint32_t uniqueId) {
   req.set_scene_id(mScene->getId());
   req.set_body_id(mId);
   req.set_id(uniqueId);
+  if (auto command = mScene->getRenderer()->recordCommand()) {
+    *command->mutable_set_unique_id() = req;
+    return;
+  }
 
   Status status = mScene->getRenderer()->getStub().SetUniqueId(&context, req, &res);
   if (!status.ok()) {
@@ -170,6 +218,7 @@ void ClientRigidbody::setUniqueId(uint32_t uniqueId) {
 }
 uint32_t ClientRigidbody::getUniqueId() const { return mUniqueId; }
 void ClientRigidbody::setSegmentationId(uint32_t segmentationId) {
+  checkNotFailed(*mScene->getRenderer(), mId);
   mSegmentationId = segmentationId;
 
   ClientContext context;
@@ -178,6 +227,10 @@ void ClientRigidbody::setSegmentationId(uint32_t segmentationId) {
   req.set_scene_id(mScene->getId());
   req.set_body_id(mId);
   req.set_id(segmentationId);
+  if (auto command = mScene->getRenderer()->recordCommand()) {
+    *command->mutable_set_segmentation_id() = req;
+    return;
+  }
 
   Status status = mScene->getRenderer()->getStub().SetSegmentationId(&context, req, &res);
   if (!status.ok()) {
@@ -195,6 +248,7 @@ void ClientRigidbody::update(const physx::PxTransform &transform) {
 }
 
 void ClientRigidbody::setVisibility(float visibility) {
+  checkNotFailed(*mScene->getRenderer(), mId);
   ClientContext context;
   proto::BodyFloat32Req req;
   proto::Empty res;
@@ -202,6 +256,10 @@ void ClientRigidbody::setVisibility(float visibility) {
   req.set_scene_id(mScene->getId());
   req.set_body_id(mId);
   req.set_value(visibility);
+  if (auto command = mScene->getRenderer()->recordCommand()) {
+    *command->mutable_set_visibility() = req;
+    return;
+  }
   Status status = mScene->getRenderer()->getStub().SetVisibility(&context, req, &res);
   if (!status.ok()) {
     throw std::runtime_error(status.error_message());
@@ -211,6 +269,8 @@ void ClientRigidbody::setVisibility(float visibility) {
 void ClientRigidbody::destroy() { mScene->removeRigidbody(this); }
 
 std::vector<std::shared_ptr<IPxrRenderShape>> ClientRigidbody::getRenderShapes() {
+  checkNotFailed(*mScene->getRenderer(), mId);
+  mScene->getRenderer()->submitCommands();
   ClientContext context;
   proto::BodyReq req;
   proto::Uint32 res;
@@ -251,6 +311,12 @@ IPxrRigidbody *ClientScene::addRigidbody(const std::string &meshFile, const phys
   req.mutable_scale()->set_x(scale.x);
   req.mutable_scale()->set_y(scale.y);
   req.mutable_scale()->set_z(scale.z);
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_add_body_mesh() = req;
+    command->set_provisional_id(mRenderer->generateProvisionalId());
+    mBodies.push_back(std::make_unique<ClientRigidbody>(this, command->provisional_id()));
+    return mBodies.back().get();
+  }
 
   Status status = mRenderer->getStub().AddBodyMesh(&context, req, &res);
   if (status.ok()) {
@@ -265,6 +331,9 @@ IPxrRigidbody *ClientScene::addRigidbody(physx::PxGeometryType::Enum type,
   if (!material) {
     material = mRenderer->createMaterial();
   }
+  if (auto sharded = std::dynamic_pointer_cast<ShardedMaterial>(material)) {
+    material = sharded->getShardMaterial(*mRenderer);
+  }
 
   mIdSynced = false;
   ClientContext context;
@@ -298,6 +367,12 @@ IPxrRigidbody *ClientScene::addRigidbody(physx::PxGeometryType::Enum type,
   } else {
     throw std::runtime_error("failed to add primitive body: invalid material");
   }
+  if (auto command = mRenderer->recordCommand()) {
+    *command->mutable_add_body_primitive() = req;
+    command->set_provisional_id(mRenderer->generateProvisionalId());
+    mBodies.push_back(std::make_unique<ClientRigidbody>(this, command->provisional_id()));
+    return mBodies.back().get();
+  }
 
   Status status = mRenderer->getStub().AddBodyPrimitive(&context, req, &res);
   if (status.ok()) {
@@ -308,6 +383,15 @@ IPxrRigidbody *ClientScene::addRigidbody(physx::PxGeometryType::Enum type,
 }
 
 void ClientScene::removeRigidbody(IPxrRigidbody *body) {
+  // frames in flight still pose the body
+  waitFrames();
+  mRenderer->submitCommands();
+  auto failed = std::find_if(mFailedBodies.begin(), mFailedBodies.end(),
+                             [=](auto &b) { return b.get() == body; });
+  if (failed != mFailedBodies.end()) {
+    mFailedBodies.erase(failed);
+    return;
+  }
   mIdSynced = false;
   if (ClientRigidbody *b = dynamic_cast<ClientRigidbody *>(body)) {
     ClientContext context;
@@ -449,40 +533,133 @@ IDirectionalLight *ClientScene::addDirectionalLight(std::array<float, 3> const &
   throw std::runtime_error(status.error_message());
 }
 
-void ClientScene::updateRender() {
-  syncId();
+/** pack poses as p.xyz, q.wxyz in entity order, see UpdateRenderReq */
+static void packPoses(float *bodyOut, float *cameraOut,
+                      std::vector<std::unique_ptr<ClientRigidbody>> const &bodies,
+                      std::vector<std::unique_ptr<ClientCamera>> const &cameras) {
+  auto write = [](float *out, physx::PxTransform const &pose) {
+    out[0] = pose.p.x;
+    out[1] = pose.p.y;
+    out[2] = pose.p.z;
+    out[3] = pose.q.w;
+    out[4] = pose.q.x;
+    out[5] = pose.q.y;
+    out[6] = pose.q.z;
+  };
+  for (auto &body : bodies) {
+    write(bodyOut, body->getCurrentPose());
+    bodyOut += 7;
+  }
+  for (auto &cam : cameras) {
+    write(cameraOut, cam->getPose());
+    cameraOut += 7;
+  }
+}
+
+template <typename Req>
+static void packPoses(Req &req, std::vector<std::unique_ptr<ClientRigidbody>> const &bodies,
+                      std::vector<std::unique_ptr<ClientCamera>> const &cameras,
+                      LatencyHistogram &histogram) {
+  ScopedLatency timer(histogram);
+  // Resize keeps the capacity of the reused request, steady frames do not allocate
+  auto bodyData = req.mutable_body_pose_data();
+  bodyData->Resize(bodies.size() * 7, 0.f);
+  auto cameraData = req.mutable_camera_pose_data();
+  cameraData->Resize(cameras.size() * 7, 0.f);
+  packPoses(bodyData->mutable_data(), cameraData->mutable_data(), bodies, cameras);
+}
+
+// the client waits for every frame, two slots let the next frame be written while the server
+// still wakes up from the last one
+static constexpr uint32_t kSharedMemorySlots = 2;
+static constexpr uint32_t kSharedMemoryTimeoutMs = 10000;
+
+void ClientScene::attachSharedMemory(size_t pictureCount) {
+#ifndef __linux__
+  throw std::runtime_error("shared memory transport is only supported on Linux");
+#else
+  // headroom so adding a few entities does not recreate the ring
+  uint32_t maxBodies = mBodies.size() + mBodies.size() / 4 + 16;
+  uint32_t maxCameras = std::max(mCameras.size(), pictureCount) + 4;
+
+  static std::atomic<uint64_t> ringCount{0};
+  std::string name = "/sapien_rs_" + std::to_string(getpid()) + "_" + std::to_string(mId) + "_" +
+                     std::to_string(ringCount++);
+  auto ring = ShmRing::Create(name, kSharedMemorySlots, maxBodies, maxCameras);
 
   ClientContext context;
-  proto::UpdateRenderReq req;
+  proto::AttachSharedMemoryReq req;
   proto::Empty res;
-
   req.set_scene_id(mId);
-  for (auto &body : mBodies) {
-    auto &pose = body->getCurrentPose();
-    auto p = req.add_body_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+  req.set_name(name);
+  Status status = mRenderer->getStub().AttachSharedMemory(&context, req, &res);
+  if (!status.ok()) {
+    throw std::runtime_error(status.error_message());
+  }
+  // both sides have it mapped, nothing is left behind if either process dies
+  ring->unlink();
+  mRing = std::move(ring);
+#endif
+}
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+void ClientScene::updateSharedMemory(std::vector<ICamera *> const &cameras) {
+  if (!mRing || mRing->header().maxBodies < mBodies.size() ||
+      mRing->header().maxCameras < std::max(mCameras.size(), cameras.size())) {
+    attachSharedMemory(cameras.size());
   }
 
-  for (auto &cam : mCameras) {
-    auto pose = cam->getPose();
-    auto p = req.add_camera_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+  uint32_t n = mRing->beginFrame(kSharedMemoryTimeoutMs);
+  auto &frame = mRing->frame(n);
+  frame.bodyCount = mBodies.size();
+  frame.cameraCount = mCameras.size();
+  frame.pictureCount = cameras.size();
+
+  uint64_t *pictures = mRing->pictures(n);
+  for (auto cam : cameras) {
+    if (auto c = dynamic_cast<ClientCamera *>(cam)) {
+      *pictures++ = c->getId();
+    } else {
+      throw std::runtime_error("invalid camera");
+    }
+  }
+  float *poses = mRing->poses(n);
+  {
+    ScopedLatency timer(*mRenderer->mStages.packPoses);
+    packPoses(poses, poses + mBodies.size() * 7, mBodies, mCameras);
+  }
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+  mRing->endFrame(n);
+  ScopedLatency timer(*mRenderer->mStages.sharedMemoryWait);
+  mRing->waitCompleted(n, kSharedMemoryTimeoutMs);
+}
+
+void ClientScene::updateRender() {
+  mFrameCount.fetch_add(1, std::memory_order_relaxed);
+  if (mRenderer->getBatchUpdates()) {
+    mBatchPending = true;
+    return;
+  }
+  if (mRenderer->getMaxFramesInFlight()) {
+    submitFrame({}, true);
+    return;
+  }
+  waitFrames();
+  syncId();
+  if (mRenderer->getSharedMemory()) {
+    updateSharedMemory({});
+    return;
   }
 
+  ClientContext context;
+  proto::Empty res;
+  if (!mUpdateRenderReq) {
+    mUpdateRenderReq = google::protobuf::Arena::CreateMessage<proto::UpdateRenderReq>(&mArena);
+  }
+  auto &req = *mUpdateRenderReq;
+
+  req.set_scene_id(mId);
+  packPoses(req, mBodies, mCameras, *mRenderer->mStages.packPoses);
+
   Status status = mRenderer->getStub().UpdateRender(&context, req, &res);
   if (!status.ok()) {
     throw std::runtime_error(status.error_message());
@@ -490,49 +667,132 @@ void ClientScene::updateRender() {
 };
 
 void ClientScene::updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) {
+  mFrameCount.fetch_add(1, std::memory_order_relaxed);
+  mPictureCount.fetch_add(cameras.size(), std::memory_order_relaxed);
+  if (mRenderer->getBatchUpdates()) {
+    for (auto cam : cameras) {
+      if (auto c = dynamic_cast<ClientCamera *>(cam)) {
+        mBatchCameraIds.push_back(c->getId());
+      } else {
+        throw std::runtime_error("invalid camera");
+      }
+    }
+    mBatchPending = true;
+    return;
+  }
+  if (mRenderer->getMaxFramesInFlight()) {
+    submitFrame(cameras, true);
+    return;
+  }
+  waitFrames();
   syncId();
+  if (mRenderer->getSharedMemory()) {
+    updateSharedMemory(cameras);
+    return;
+  }
 
   ClientContext context;
-  proto::UpdateRenderAndTakePicturesReq req;
   proto::Empty res;
+  if (!mUpdateRenderAndTakePicturesReq) {
+    mUpdateRenderAndTakePicturesReq =
+        google::protobuf::Arena::CreateMessage<proto::UpdateRenderAndTakePicturesReq>(&mArena);
+  }
+  auto &req = *mUpdateRenderAndTakePicturesReq;
 
   req.set_scene_id(mId);
-  for (auto &body : mBodies) {
-    auto &pose = body->getCurrentPose();
-    auto p = req.add_body_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+  packPoses(req, mBodies, mCameras, *mRenderer->mStages.packPoses);
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+  req.clear_camera_ids();
+  for (auto cam : cameras) {
+    if (auto c = dynamic_cast<ClientCamera *>(cam)) {
+      req.add_camera_ids(c->getId());
+    } else {
+      throw std::runtime_error("invalid camera");
+    }
   }
+  Status status = mRenderer->getStub().UpdateRenderAndTakePictures(&context, req, &res);
+  if (!status.ok()) {
+    throw std::runtime_error(status.error_message());
+  }
+}
 
-  for (auto &cam : mCameras) {
-    auto pose = cam->getPose();
-    auto p = req.add_camera_poses();
-    p->mutable_p()->set_x(pose.p.x);
-    p->mutable_p()->set_y(pose.p.y);
-    p->mutable_p()->set_z(pose.p.z);
+std::shared_ptr<IAwaitable<void>> ClientScene::updateRenderAsync() {
+  mFrameCount.fetch_add(1, std::memory_order_relaxed);
+  return std::make_shared<AwaitableFuture<void>>(submitFrame({}, false));
+}
 
-    p->mutable_q()->set_w(pose.q.w);
-    p->mutable_q()->set_x(pose.q.x);
-    p->mutable_q()->set_y(pose.q.y);
-    p->mutable_q()->set_z(pose.q.z);
+std::shared_ptr<IAwaitable<void>>
+ClientScene::updateRenderAndTakePicturesAsync(std::vector<ICamera *> const &cameras) {
+  mFrameCount.fetch_add(1, std::memory_order_relaxed);
+  mPictureCount.fetch_add(cameras.size(), std::memory_order_relaxed);
+  return std::make_shared<AwaitableFuture<void>>(submitFrame(cameras, false));
+}
+
+std::future<void> ClientScene::submitFrame(std::vector<ICamera *> const &cameras,
+                                           bool keepError) {
+  // a new entity order must not overtake frames packed with the old one
+  if (!mIdSynced) {
+    waitFrames();
+    syncId();
   }
 
+  auto frame = std::make_unique<AsyncFrame>();
+  frame->keepError = keepError;
+  frame->req.set_scene_id(mId);
+  packPoses(frame->req, mBodies, mCameras, *mRenderer->mStages.packPoses);
   for (auto cam : cameras) {
     if (auto c = dynamic_cast<ClientCamera *>(cam)) {
-      req.add_camera_ids(c->getId());
+      frame->req.add_camera_ids(c->getId());
     } else {
       throw std::runtime_error("invalid camera");
     }
   }
-  Status status = mRenderer->getStub().UpdateRenderAndTakePictures(&context, req, &res);
-  if (!status.ok()) {
-    throw std::runtime_error(status.error_message());
+  auto future = frame->promise.get_future();
+
+  std::unique_lock lock(mFrameMutex);
+  if (mFrameError) {
+    std::rethrow_exception(std::exchange(mFrameError, nullptr));
+  }
+  uint32_t maxFrames = std::max(mRenderer->getMaxFramesInFlight(), 1u);
+  if (mFrames.size() >= maxFrames) {
+    ScopedLatency timer(*mRenderer->mStages.frameSlotWait);
+    mFrameCondition.wait(lock, [&]() { return mFrames.size() < maxFrames; });
+  }
+  mFrames.push_back(std::move(frame));
+  // frames are sent one after the other, the server applies them in order
+  if (mFrames.size() == 1) {
+    mRenderer->startFrame(this, *mFrames.front());
+  }
+  return future;
+}
+
+void ClientScene::completeFrame(bool ok) {
+  std::unique_lock lock(mFrameMutex);
+  auto frame = std::move(mFrames.front());
+  mFrames.pop_front();
+  if (!mFrames.empty()) {
+    mRenderer->startFrame(this, *mFrames.front());
+  }
+
+  if (ok && frame->status.ok()) {
+    frame->promise.set_value();
+  } else {
+    auto error = std::make_exception_ptr(std::runtime_error(
+        ok ? frame->status.error_message() : "update render failed: call was cancelled"));
+    if (frame->keepError && !mFrameError) {
+      mFrameError = error;
+    }
+    frame->promise.set_exception(error);
+  }
+  lock.unlock();
+  mFrameCondition.notify_all();
+}
+
+void ClientScene::waitFrames() {
+  std::unique_lock lock(mFrameMutex);
+  mFrameCondition.wait(lock, [this]() { return mFrames.empty(); });
+  if (mFrameError) {
+    std::rethrow_exception(std::exchange(mFrameError, nullptr));
   }
 }
 
@@ -542,6 +802,8 @@ void ClientScene::syncId() {
   if (mIdSynced) {
     return;
   }
+  // the entity order refers to server ids
+  mRenderer->submitCommands();
   ClientContext context;
   proto::EntityOrderReq req;
   proto::Empty res;
@@ -564,11 +826,92 @@ void ClientScene::syncId() {
 
 //========== Renderer ==========//
 ClientRenderer::ClientRenderer(std::string const &address, uint64_t processIndex)
-    : mProcessIndex(processIndex) {
+    : mProcessIndex(processIndex), mAddress(address),
+      mMetrics(std::make_shared<MetricsRegistry>()) {
+  mStages = {&mMetrics->stage("pack_poses"), &mMetrics->stage("frame_slot_wait"),
+             &mMetrics->stage("shared_memory_wait")};
+
   grpc::ChannelArguments args;
   args.SetLoadBalancingPolicyName("round_robin");
-  mChannel = grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+  std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>> creators;
+  creators.push_back(std::make_unique<ClientMetricsInterceptorFactory>(mMetrics));
+  mChannel = grpc::experimental::CreateCustomChannelWithInterceptors(
+      address, grpc::InsecureChannelCredentials(), args, std::move(creators));
   mStub = proto::RenderService::NewStub(mChannel);
+
+  mQueueThread = std::thread([this]() {
+    void *tag;
+    bool ok;
+    while (mQueue.Next(&tag, &ok)) {
+      static_cast<ClientScene *>(tag)->completeFrame(ok);
+    }
+  });
+}
+
+ClientRenderer::~ClientRenderer() {
+  try {
+    submitCommands();
+  } catch (std::exception const &e) {
+    spdlog::get("SAPIEN")->error("Render client commands failed: {}", e.what());
+  }
+  // frames start the next one of their scene when they complete, drain before shutting down
+  for (auto &scene : mScenes) {
+    try {
+      scene->waitFrames();
+    } catch (std::exception const &e) {
+      spdlog::get("SAPIEN")->error("Render client frame failed: {}", e.what());
+    }
+  }
+  mQueue.Shutdown();
+  mQueueThread.join();
+}
+
+bool ClientRenderer::isConnected(uint32_t timeoutMs) {
+  return mChannel->WaitForConnected(std::chrono::system_clock::now() +
+                                    std::chrono::milliseconds(timeoutMs));
+}
+
+uint32_t ClientRenderer::getFramesInFlight() const {
+  uint32_t count = 0;
+  for (auto &scene : mScenes) {
+    std::lock_guard lock(scene->mFrameMutex);
+    count += scene->mFrames.size();
+  }
+  return count;
+}
+
+proto::MetricsRes ClientRenderer::getMetrics() const {
+  proto::MetricsRes res;
+  mMetrics->fill(res);
+  for (auto &scene : mScenes) {
+    auto entry = res.add_scenes();
+    entry->set_scene_id(scene->mId);
+    entry->set_scene_index(mProcessIndex);
+    entry->set_frames(scene->mFrameCount.load(std::memory_order_relaxed));
+    entry->set_pictures(scene->mPictureCount.load(std::memory_order_relaxed));
+    std::lock_guard lock(scene->mFrameMutex);
+    entry->set_pending(scene->mFrames.size());
+  }
+  return res;
+}
+
+proto::MetricsRes ClientRenderer::getServerMetrics() {
+  ClientContext context;
+  proto::Empty req;
+  proto::MetricsRes res;
+  Status status = mStub->GetMetrics(&context, req, &res);
+  if (!status.ok()) {
+    throw std::runtime_error(status.error_message());
+  }
+  return res;
+}
+
+void ClientRenderer::startFrame(ClientScene *scene, ClientScene::AsyncFrame &frame) {
+  // one frame per scene is on the wire, the scene is the tag
+  frame.reader =
+      mStub->PrepareAsyncUpdateRenderAndTakePictures(&frame.context, frame.req, &mQueue);
+  frame.reader->StartCall();
+  frame.reader->Finish(&frame.res, &frame.status, scene);
 }
 
 ClientScene *ClientRenderer::createScene(std::string const &name) {
@@ -588,6 +931,8 @@ ClientScene *ClientRenderer::createScene(std::string const &name) {
 
 void ClientRenderer::removeScene(IPxrScene *scene) {
   if (ClientScene *clientScene = dynamic_cast<ClientScene *>(scene)) {
+    clientScene->waitFrames();
+    submitCommands();
     ClientContext context;
     proto::Id req;
     proto::Empty res;
@@ -602,7 +947,51 @@ void ClientRenderer::removeScene(IPxrScene *scene) {
   }
 }
 
+void ClientRenderer::flush() {
+  submitCommands();
+  if (!mBatchReq) {
+    mBatchReq = google::protobuf::Arena::CreateMessage<proto::UpdateRenderBatchReq>(&mArena);
+  }
+  auto &req = *mBatchReq;
+  // cleared entries are kept and reused by add_scenes
+  req.clear_scenes();
+
+  for (auto &scene : mScenes) {
+    if (!scene->mBatchPending) {
+      continue;
+    }
+    scene->syncId();
+    auto entry = req.add_scenes();
+    entry->set_scene_id(scene->getId());
+    packPoses(*entry, scene->mBodies, scene->mCameras, *mStages.packPoses);
+    for (auto id : scene->mBatchCameraIds) {
+      entry->add_camera_ids(id);
+    }
+    scene->mBatchPending = false;
+    scene->mBatchCameraIds.clear();
+  }
+  if (req.scenes_size() != 0) {
+    ClientContext context;
+    proto::Empty res;
+    Status status = mStub->UpdateRenderBatch(&context, req, &res);
+    if (!status.ok()) {
+      throw std::runtime_error(status.error_message());
+    }
+  }
+
+  for (auto &scene : mScenes) {
+    scene->waitFrames();
+  }
+}
+
 std::shared_ptr<IPxrMaterial> ClientRenderer::createMaterial() {
+  if (auto command = recordCommand()) {
+    command->mutable_create_material();
+    command->set_provisional_id(generateProvisionalId());
+    auto mat = std::make_shared<ClientMaterial>(shared_from_this(), command->provisional_id());
+    mProvisionalMaterials.push_back(mat);
+    return mat;
+  }
   ClientContext context;
   proto::Empty req;
   proto::Id res;
@@ -615,6 +1004,59 @@ std::shared_ptr<IPxrMaterial> ClientRenderer::createMaterial() {
   throw std::runtime_error(status.error_message());
 };
 
+void ClientRenderer::setCommandBatching(bool enable) {
+  if (!enable) {
+    submitCommands();
+  }
+  mCommandBatching = enable;
+}
+
+void ClientRenderer::submitCommands() {
+  if (mCommands.commands_size() == 0) {
+    return;
+  }
+  ClientContext context;
+  proto::CommandBatchRes res;
+  Status status = mStub->SubmitCommands(&context, mCommands, &res);
+  mCommands.clear_commands();
+  mBatchProvisionalIdStart = mProvisionalIdGenerator;
+  if (!status.ok()) {
+    // objects the batch created keep provisional ids the server never resolved, take them out
+    // of the entity order and never record commands for them again
+    for (auto &scene : mScenes) {
+      auto &bodies = scene->mBodies;
+      auto failed = std::stable_partition(bodies.begin(), bodies.end(),
+                                          [this](auto &body) { return !isFailedId(body->mId); });
+      std::move(failed, bodies.end(), std::back_inserter(scene->mFailedBodies));
+      bodies.erase(failed, bodies.end());
+      scene->mIdSynced = false;
+    }
+    mProvisionalMaterials.clear();
+    throw std::runtime_error(status.error_message());
+  }
+
+  std::unordered_map<rs_id_t, rs_id_t> ids;
+  for (int i = 0; i < res.provisional_ids_size(); ++i) {
+    ids[res.provisional_ids(i)] = res.ids(i);
+  }
+  auto remap = [&](rs_id_t &id) {
+    if (auto it = ids.find(id); it != ids.end()) {
+      id = it->second;
+    }
+  };
+  for (auto &scene : mScenes) {
+    for (auto &body : scene->mBodies) {
+      remap(body->mId);
+    }
+  }
+  for (auto &material : mProvisionalMaterials) {
+    if (auto mat = material.lock()) {
+      remap(mat->mId);
+    }
+  }
+  mProvisionalMaterials.clear();
+}
+
 } // namespace server
 } // namespace Renderer
 } // namespace sapien
@@ -0,0 +1,228 @@
+#include "sapien/renderer/server/metrics.h"
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <sstream>
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+using grpc::experimental::InterceptionHookPoints;
+
+//========== Histogram ==========//
+void LatencyHistogram::record(std::chrono::steady_clock::duration duration) {
+  uint64_t us = std::max<int64_t>(
+      0, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  uint32_t bucket = std::min<uint32_t>(std::bit_width(us), kBucketCount - 1);
+  mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  mCount.fetch_add(1, std::memory_order_relaxed);
+  mSumUs.fetch_add(us, std::memory_order_relaxed);
+  uint64_t max = mMaxUs.load(std::memory_order_relaxed);
+  while (us > max && !mMaxUs.compare_exchange_weak(max, us, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::fill(proto::Histogram &histogram) const {
+  histogram.set_count(mCount.load(std::memory_order_relaxed));
+  histogram.set_sum_us(mSumUs.load(std::memory_order_relaxed));
+  histogram.set_max_us(mMaxUs.load(std::memory_order_relaxed));
+  histogram.clear_buckets();
+  for (auto &bucket : mBuckets) {
+    histogram.add_buckets(bucket.load(std::memory_order_relaxed));
+  }
+}
+
+//========== Registry ==========//
+MetricsRegistry::MetricsRegistry() : mStart(std::chrono::steady_clock::now()) {}
+
+template <typename T>
+static T &findOrCreate(std::shared_mutex &mutex,
+                       std::map<std::string, std::unique_ptr<T>, std::less<>> &map,
+                       std::string_view name) {
+  {
+    std::shared_lock lock(mutex);
+    if (auto it = map.find(name); it != map.end()) {
+      return *it->second;
+    }
+  }
+  std::unique_lock lock(mutex);
+  auto &entry = map[std::string(name)];
+  if (!entry) {
+    entry = std::make_unique<T>();
+  }
+  return *entry;
+}
+
+MethodMetrics &MetricsRegistry::method(std::string_view name) {
+  return findOrCreate(mMutex, mMethods, name);
+}
+
+LatencyHistogram &MetricsRegistry::stage(std::string_view name) {
+  return findOrCreate(mMutex, mStages, name);
+}
+
+void MetricsRegistry::fill(proto::MetricsRes &res) const {
+  res.set_uptime_us(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - mStart)
+                        .count());
+  std::shared_lock lock(mMutex);
+  for (auto &[name, method] : mMethods) {
+    auto m = res.add_methods();
+    m->set_name(name);
+    method->latency.fill(*m->mutable_latency());
+    method->handler.fill(*m->mutable_handler());
+    m->set_errors(method->errors.load(std::memory_order_relaxed));
+    m->set_bytes_in(method->bytesIn.load(std::memory_order_relaxed));
+    m->set_bytes_out(method->bytesOut.load(std::memory_order_relaxed));
+  }
+  for (auto &[name, stage] : mStages) {
+    auto s = res.add_stages();
+    s->set_name(name);
+    stage->fill(*s->mutable_latency());
+  }
+}
+
+//========== JSON ==========//
+static void writeHistogram(std::ostream &out, proto::Histogram const &h) {
+  out << "{\"count\":" << h.count() << ",\"sum_us\":" << h.sum_us()
+      << ",\"max_us\":" << h.max_us() << ",\"buckets\":[";
+  for (int i = 0; i < h.buckets_size(); ++i) {
+    out << (i ? "," : "") << h.buckets(i);
+  }
+  out << "]}";
+}
+
+// names are method and stage names, nothing to escape
+std::string metricsToJson(proto::MetricsRes const &metrics) {
+  std::ostringstream out;
+  out << "{\"uptime_us\":" << metrics.uptime_us() << ",\"methods\":[";
+  for (int i = 0; i < metrics.methods_size(); ++i) {
+    auto &m = metrics.methods(i);
+    out << (i ? "," : "") << "{\"name\":\"" << m.name() << "\",\"latency\":";
+    writeHistogram(out, m.latency());
+    out << ",\"handler\":";
+    writeHistogram(out, m.handler());
+    out << ",\"errors\":" << m.errors() << ",\"bytes_in\":" << m.bytes_in()
+        << ",\"bytes_out\":" << m.bytes_out() << "}";
+  }
+  out << "],\"stages\":[";
+  for (int i = 0; i < metrics.stages_size(); ++i) {
+    auto &s = metrics.stages(i);
+    out << (i ? "," : "") << "{\"name\":\"" << s.name() << "\",\"latency\":";
+    writeHistogram(out, s.latency());
+    out << "}";
+  }
+  out << "],\"scenes\":[";
+  for (int i = 0; i < metrics.scenes_size(); ++i) {
+    auto &s = metrics.scenes(i);
+    out << (i ? "," : "") << "{\"scene_id\":" << s.scene_id()
+        << ",\"scene_index\":" << s.scene_index() << ",\"frames\":" << s.frames()
+        << ",\"pictures\":" << s.pictures() << ",\"pending\":" << s.pending() << "}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+//========== Interceptors ==========//
+static std::string_view shortMethodName(char const *method) {
+  // "/package.Service/Method"
+  std::string_view name(method ? method : "");
+  if (auto slash = name.rfind('/'); slash != std::string_view::npos) {
+    name.remove_prefix(slash + 1);
+  }
+  return name;
+}
+
+// both sides use protobuf messages, the hooks hand them out as void pointers
+static uint64_t messageSize(void const *message) {
+  return message ? static_cast<google::protobuf::MessageLite const *>(message)->ByteSizeLong()
+                 : 0;
+}
+
+static uint64_t sendMessageSize(grpc::experimental::InterceptorBatchMethods *methods) {
+  if (auto message = methods->GetSendMessage()) {
+    return messageSize(message);
+  }
+  // async calls serialize the message before the hook runs
+  auto buffer = methods->GetSerializedSendMessage();
+  return buffer ? buffer->Length() : 0;
+}
+
+namespace {
+
+class ServerMetricsInterceptor : public grpc::experimental::Interceptor {
+public:
+  explicit ServerMetricsInterceptor(MethodMetrics &metrics)
+      : mMetrics(metrics), mStart(std::chrono::steady_clock::now()) {}
+
+  void Intercept(grpc::experimental::InterceptorBatchMethods *methods) override {
+    auto now = std::chrono::steady_clock::now();
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_MESSAGE)) {
+      mMetrics.bytesIn.fetch_add(messageSize(methods->GetRecvMessage()),
+                                 std::memory_order_relaxed);
+      mDecoded = now;
+    }
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_MESSAGE)) {
+      mMetrics.bytesOut.fetch_add(sendMessageSize(methods), std::memory_order_relaxed);
+    }
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_STATUS)) {
+      if (!methods->GetSendStatus().ok()) {
+        mMetrics.errors.fetch_add(1, std::memory_order_relaxed);
+      }
+      if (mDecoded != std::chrono::steady_clock::time_point{}) {
+        mMetrics.handler.record(now - mDecoded);
+      }
+      mMetrics.latency.record(now - mStart);
+    }
+    methods->Proceed();
+  }
+
+private:
+  MethodMetrics &mMetrics;
+  std::chrono::steady_clock::time_point mStart;
+  std::chrono::steady_clock::time_point mDecoded{};
+};
+
+class ClientMetricsInterceptor : public grpc::experimental::Interceptor {
+public:
+  explicit ClientMetricsInterceptor(MethodMetrics &metrics)
+      : mMetrics(metrics), mStart(std::chrono::steady_clock::now()) {}
+
+  void Intercept(grpc::experimental::InterceptorBatchMethods *methods) override {
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_MESSAGE)) {
+      mMetrics.bytesOut.fetch_add(sendMessageSize(methods), std::memory_order_relaxed);
+    }
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_MESSAGE)) {
+      mMetrics.bytesIn.fetch_add(messageSize(methods->GetRecvMessage()),
+                                 std::memory_order_relaxed);
+    }
+    if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_STATUS)) {
+      if (!methods->GetRecvStatus()->ok()) {
+        mMetrics.errors.fetch_add(1, std::memory_order_relaxed);
+      }
+      mMetrics.latency.record(std::chrono::steady_clock::now() - mStart);
+    }
+    methods->Proceed();
+  }
+
+private:
+  MethodMetrics &mMetrics;
+  std::chrono::steady_clock::time_point mStart;
+};
+
+} // namespace
+
+grpc::experimental::Interceptor *
+ServerMetricsInterceptorFactory::CreateServerInterceptor(grpc::experimental::ServerRpcInfo *info) {
+  return new ServerMetricsInterceptor(mRegistry->method(shortMethodName(info->method())));
+}
+
+grpc::experimental::Interceptor *
+ClientMetricsInterceptorFactory::CreateClientInterceptor(grpc::experimental::ClientRpcInfo *info) {
+  return new ClientMetricsInterceptor(mRegistry->method(shortMethodName(info->method())));
+}
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
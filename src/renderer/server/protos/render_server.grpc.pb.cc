@@ -50,6 +50,10 @@ static const char* RenderService_method_names[] = {
   "/sapien.Renderer.server.proto.RenderService/GetShapeMaterial",
   "/sapien.Renderer.server.proto.RenderService/TakePicture",
   "/sapien.Renderer.server.proto.RenderService/SetCameraParameters",
+  "/sapien.Renderer.server.proto.RenderService/UpdateRenderBatch",
+  "/sapien.Renderer.server.proto.RenderService/AttachSharedMemory",
+  "/sapien.Renderer.server.proto.RenderService/SubmitCommands",
+  "/sapien.Renderer.server.proto.RenderService/GetMetrics",
 };
 
 std::unique_ptr< RenderService::Stub> RenderService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -84,6 +88,10 @@ RenderService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_GetShapeMaterial_(RenderService_method_names[22], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_TakePicture_(RenderService_method_names[23], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SetCameraParameters_(RenderService_method_names[24], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_UpdateRenderBatch_(RenderService_method_names[25], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_AttachSharedMemory_(RenderService_method_names[26], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SubmitCommands_(RenderService_method_names[27], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetMetrics_(RenderService_method_names[28], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status RenderService::Stub::CreateScene(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Index& request, ::sapien::Renderer::server::proto::Id* response) {
@@ -661,6 +669,98 @@ void RenderService::Stub::async::SetCameraParameters(::grpc::ClientContext* cont
   return result;
 }
 
+::grpc::Status RenderService::Stub::UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::sapien::Renderer::server::proto::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_UpdateRenderBatch_, context, request, response);
+}
+
+void RenderService::Stub::async::UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UpdateRenderBatch_, context, request, response, std::move(f));
+}
+
+void RenderService::Stub::async::UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UpdateRenderBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* RenderService::Stub::PrepareAsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_UpdateRenderBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* RenderService::Stub::AsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncUpdateRenderBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status RenderService::Stub::AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::sapien::Renderer::server::proto::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_AttachSharedMemory_, context, request, response);
+}
+
+void RenderService::Stub::async::AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AttachSharedMemory_, context, request, response, std::move(f));
+}
+
+void RenderService::Stub::async::AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AttachSharedMemory_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* RenderService::Stub::PrepareAsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_AttachSharedMemory_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* RenderService::Stub::AsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncAttachSharedMemoryRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status RenderService::Stub::SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::sapien::Renderer::server::proto::CommandBatchRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SubmitCommands_, context, request, response);
+}
+
+void RenderService::Stub::async::SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitCommands_, context, request, response, std::move(f));
+}
+
+void RenderService::Stub::async::SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SubmitCommands_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>* RenderService::Stub::PrepareAsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::sapien::Renderer::server::proto::CommandBatchRes, ::sapien::Renderer::server::proto::CommandBatchReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SubmitCommands_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>* RenderService::Stub::AsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSubmitCommandsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status RenderService::Stub::GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::sapien::Renderer::server::proto::MetricsRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetMetrics_, context, request, response);
+}
+
+void RenderService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+void RenderService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>* RenderService::Stub::PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::sapien::Renderer::server::proto::MetricsRes, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetMetrics_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>* RenderService::Stub::AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetMetricsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 RenderService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       RenderService_method_names[0],
@@ -912,6 +1012,46 @@ RenderService::Service::Service() {
              ::sapien::Renderer::server::proto::Empty* resp) {
                return service->SetCameraParameters(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      RenderService_method_names[25],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< RenderService::Service, ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](RenderService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* req,
+             ::sapien::Renderer::server::proto::Empty* resp) {
+               return service->UpdateRenderBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      RenderService_method_names[26],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< RenderService::Service, ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](RenderService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* req,
+             ::sapien::Renderer::server::proto::Empty* resp) {
+               return service->AttachSharedMemory(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      RenderService_method_names[27],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< RenderService::Service, ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](RenderService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::sapien::Renderer::server::proto::CommandBatchReq* req,
+             ::sapien::Renderer::server::proto::CommandBatchRes* resp) {
+               return service->SubmitCommands(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      RenderService_method_names[28],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< RenderService::Service, ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](RenderService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::sapien::Renderer::server::proto::Empty* req,
+             ::sapien::Renderer::server::proto::MetricsRes* resp) {
+               return service->GetMetrics(ctx, req, resp);
+             }, this)));
 }
 
 RenderService::Service::~Service() {
@@ -1092,6 +1232,34 @@ RenderService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status RenderService::Service::UpdateRenderBatch(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status RenderService::Service::AttachSharedMemory(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status RenderService::Service::SubmitCommands(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status RenderService::Service::GetMetrics(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace sapien
 }  // namespace Renderer
@@ -219,6 +219,38 @@ class RenderService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncSetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncSetCameraParametersRaw(context, request, cq));
     }
+    // ========== Batch ==========//
+    virtual ::grpc::Status UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::sapien::Renderer::server::proto::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>> AsyncUpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>>(AsyncUpdateRenderBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncUpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncUpdateRenderBatchRaw(context, request, cq));
+    }
+    // ========== Shared memory ==========//
+    virtual ::grpc::Status AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::sapien::Renderer::server::proto::Empty* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>> AsyncAttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>>(AsyncAttachSharedMemoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncAttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncAttachSharedMemoryRaw(context, request, cq));
+    }
+    // ========== Commands ==========//
+    virtual ::grpc::Status SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::sapien::Renderer::server::proto::CommandBatchRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>> AsyncSubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>>(AsyncSubmitCommandsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>> PrepareAsyncSubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>>(PrepareAsyncSubmitCommandsRaw(context, request, cq));
+    }
+    // ========== Metrics ==========//
+    virtual ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::sapien::Renderer::server::proto::MetricsRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>> AsyncGetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -278,6 +310,18 @@ class RenderService final {
       virtual void TakePicture(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::TakePictureReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ========== Batch ==========//
+      virtual void UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ========== Shared memory ==========//
+      virtual void AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ========== Commands ==========//
+      virtual void SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ========== Metrics ==========//
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -333,6 +377,14 @@ class RenderService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncTakePictureRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::TakePictureReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* AsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* AsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* AsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>* AsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::CommandBatchRes>* PrepareAsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::sapien::Renderer::server::proto::MetricsRes>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -512,6 +564,34 @@ class RenderService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncSetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncSetCameraParametersRaw(context, request, cq));
     }
+    ::grpc::Status UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::sapien::Renderer::server::proto::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>> AsyncUpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>>(AsyncUpdateRenderBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncUpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncUpdateRenderBatchRaw(context, request, cq));
+    }
+    ::grpc::Status AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::sapien::Renderer::server::proto::Empty* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>> AsyncAttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>>(AsyncAttachSharedMemoryRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>> PrepareAsyncAttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>>(PrepareAsyncAttachSharedMemoryRaw(context, request, cq));
+    }
+    ::grpc::Status SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::sapien::Renderer::server::proto::CommandBatchRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>> AsyncSubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>>(AsyncSubmitCommandsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>> PrepareAsyncSubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>>(PrepareAsyncSubmitCommandsRaw(context, request, cq));
+    }
+    ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::sapien::Renderer::server::proto::MetricsRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>> AsyncGetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -565,6 +645,14 @@ class RenderService final {
       void TakePicture(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::TakePictureReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) override;
       void SetCameraParameters(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) override;
+      void UpdateRenderBatch(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, std::function<void(::grpc::Status)>) override;
+      void AttachSharedMemory(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, std::function<void(::grpc::Status)>) override;
+      void SubmitCommands(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, std::function<void(::grpc::Status)>) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -626,6 +714,14 @@ class RenderService final {
     ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncTakePictureRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::TakePictureReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* AsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* AsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncUpdateRenderBatchRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* AsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::Empty>* PrepareAsyncAttachSharedMemoryRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>* AsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::CommandBatchRes>* PrepareAsyncSubmitCommandsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::sapien::Renderer::server::proto::MetricsRes>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::sapien::Renderer::server::proto::Empty& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_CreateScene_;
     const ::grpc::internal::RpcMethod rpcmethod_RemoveScene_;
     const ::grpc::internal::RpcMethod rpcmethod_CreateMaterial_;
@@ -651,6 +747,10 @@ class RenderService final {
     const ::grpc::internal::RpcMethod rpcmethod_GetShapeMaterial_;
     const ::grpc::internal::RpcMethod rpcmethod_TakePicture_;
     const ::grpc::internal::RpcMethod rpcmethod_SetCameraParameters_;
+    const ::grpc::internal::RpcMethod rpcmethod_UpdateRenderBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_AttachSharedMemory_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubmitCommands_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMetrics_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -689,6 +789,14 @@ class RenderService final {
     // ========== Camera ==========//
     virtual ::grpc::Status TakePicture(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::TakePictureReq* request, ::sapien::Renderer::server::proto::Empty* response);
     virtual ::grpc::Status SetCameraParameters(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::CameraParamsReq* request, ::sapien::Renderer::server::proto::Empty* response);
+    // ========== Batch ==========//
+    virtual ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response);
+    // ========== Shared memory ==========//
+    virtual ::grpc::Status AttachSharedMemory(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response);
+    // ========== Commands ==========//
+    virtual ::grpc::Status SubmitCommands(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response);
+    // ========== Metrics ==========//
+    virtual ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_CreateScene : public BaseClass {
@@ -1190,7 +1298,87 @@ class RenderService final {
       ::grpc::Service::RequestAsyncUnary(24, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_CreateScene<WithAsyncMethod_RemoveScene<WithAsyncMethod_CreateMaterial<WithAsyncMethod_RemoveMaterial<WithAsyncMethod_AddBodyMesh<WithAsyncMethod_AddBodyPrimitive<WithAsyncMethod_RemoveBody<WithAsyncMethod_AddCamera<WithAsyncMethod_SetAmbientLight<WithAsyncMethod_AddPointLight<WithAsyncMethod_AddDirectionalLight<WithAsyncMethod_SetEntityOrder<WithAsyncMethod_UpdateRender<WithAsyncMethod_UpdateRenderAndTakePictures<WithAsyncMethod_SetBaseColor<WithAsyncMethod_SetRoughness<WithAsyncMethod_SetSpecular<WithAsyncMethod_SetMetallic<WithAsyncMethod_SetUniqueId<WithAsyncMethod_SetSegmentationId<WithAsyncMethod_SetVisibility<WithAsyncMethod_GetShapeCount<WithAsyncMethod_GetShapeMaterial<WithAsyncMethod_TakePicture<WithAsyncMethod_SetCameraParameters<Service > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodAsync(25);
+    }
+    ~WithAsyncMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUpdateRenderBatch(::grpc::ServerContext* context, ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::grpc::ServerAsyncResponseWriter< ::sapien::Renderer::server::proto::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodAsync(26);
+    }
+    ~WithAsyncMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestAttachSharedMemory(::grpc::ServerContext* context, ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::grpc::ServerAsyncResponseWriter< ::sapien::Renderer::server::proto::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodAsync(27);
+    }
+    ~WithAsyncMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubmitCommands(::grpc::ServerContext* context, ::sapien::Renderer::server::proto::CommandBatchReq* request, ::grpc::ServerAsyncResponseWriter< ::sapien::Renderer::server::proto::CommandBatchRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodAsync(28);
+    }
+    ~WithAsyncMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::sapien::Renderer::server::proto::Empty* request, ::grpc::ServerAsyncResponseWriter< ::sapien::Renderer::server::proto::MetricsRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_CreateScene<WithAsyncMethod_RemoveScene<WithAsyncMethod_CreateMaterial<WithAsyncMethod_RemoveMaterial<WithAsyncMethod_AddBodyMesh<WithAsyncMethod_AddBodyPrimitive<WithAsyncMethod_RemoveBody<WithAsyncMethod_AddCamera<WithAsyncMethod_SetAmbientLight<WithAsyncMethod_AddPointLight<WithAsyncMethod_AddDirectionalLight<WithAsyncMethod_SetEntityOrder<WithAsyncMethod_UpdateRender<WithAsyncMethod_UpdateRenderAndTakePictures<WithAsyncMethod_SetBaseColor<WithAsyncMethod_SetRoughness<WithAsyncMethod_SetSpecular<WithAsyncMethod_SetMetallic<WithAsyncMethod_SetUniqueId<WithAsyncMethod_SetSegmentationId<WithAsyncMethod_SetVisibility<WithAsyncMethod_GetShapeCount<WithAsyncMethod_GetShapeMaterial<WithAsyncMethod_TakePicture<WithAsyncMethod_SetCameraParameters<WithAsyncMethod_UpdateRenderBatch<WithAsyncMethod_AttachSharedMemory<WithAsyncMethod_SubmitCommands<WithAsyncMethod_GetMetrics<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_CreateScene : public BaseClass {
    private:
@@ -1866,7 +2054,115 @@ class RenderService final {
     virtual ::grpc::ServerUnaryReactor* SetCameraParameters(
       ::grpc::CallbackServerContext* /*context*/, const ::sapien::Renderer::server::proto::CameraParamsReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_CreateScene<WithCallbackMethod_RemoveScene<WithCallbackMethod_CreateMaterial<WithCallbackMethod_RemoveMaterial<WithCallbackMethod_AddBodyMesh<WithCallbackMethod_AddBodyPrimitive<WithCallbackMethod_RemoveBody<WithCallbackMethod_AddCamera<WithCallbackMethod_SetAmbientLight<WithCallbackMethod_AddPointLight<WithCallbackMethod_AddDirectionalLight<WithCallbackMethod_SetEntityOrder<WithCallbackMethod_UpdateRender<WithCallbackMethod_UpdateRenderAndTakePictures<WithCallbackMethod_SetBaseColor<WithCallbackMethod_SetRoughness<WithCallbackMethod_SetSpecular<WithCallbackMethod_SetMetallic<WithCallbackMethod_SetUniqueId<WithCallbackMethod_SetSegmentationId<WithCallbackMethod_SetVisibility<WithCallbackMethod_GetShapeCount<WithCallbackMethod_GetShapeMaterial<WithCallbackMethod_TakePicture<WithCallbackMethod_SetCameraParameters<Service > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* request, ::sapien::Renderer::server::proto::Empty* response) { return this->UpdateRenderBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_UpdateRenderBatch(
+        ::grpc::MessageAllocator< ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(25);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* UpdateRenderBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodCallback(26,
+          new ::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* request, ::sapien::Renderer::server::proto::Empty* response) { return this->AttachSharedMemory(context, request, response); }));}
+    void SetMessageAllocatorFor_AttachSharedMemory(
+        ::grpc::MessageAllocator< ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(26);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* AttachSharedMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodCallback(27,
+          new ::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::sapien::Renderer::server::proto::CommandBatchReq* request, ::sapien::Renderer::server::proto::CommandBatchRes* response) { return this->SubmitCommands(context, request, response); }));}
+    void SetMessageAllocatorFor_SubmitCommands(
+        ::grpc::MessageAllocator< ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(27);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SubmitCommands(
+      ::grpc::CallbackServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodCallback(28,
+          new ::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::sapien::Renderer::server::proto::Empty* request, ::sapien::Renderer::server::proto::MetricsRes* response) { return this->GetMetrics(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMetrics(
+        ::grpc::MessageAllocator< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(28);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_CreateScene<WithCallbackMethod_RemoveScene<WithCallbackMethod_CreateMaterial<WithCallbackMethod_RemoveMaterial<WithCallbackMethod_AddBodyMesh<WithCallbackMethod_AddBodyPrimitive<WithCallbackMethod_RemoveBody<WithCallbackMethod_AddCamera<WithCallbackMethod_SetAmbientLight<WithCallbackMethod_AddPointLight<WithCallbackMethod_AddDirectionalLight<WithCallbackMethod_SetEntityOrder<WithCallbackMethod_UpdateRender<WithCallbackMethod_UpdateRenderAndTakePictures<WithCallbackMethod_SetBaseColor<WithCallbackMethod_SetRoughness<WithCallbackMethod_SetSpecular<WithCallbackMethod_SetMetallic<WithCallbackMethod_SetUniqueId<WithCallbackMethod_SetSegmentationId<WithCallbackMethod_SetVisibility<WithCallbackMethod_GetShapeCount<WithCallbackMethod_GetShapeMaterial<WithCallbackMethod_TakePicture<WithCallbackMethod_SetCameraParameters<WithCallbackMethod_UpdateRenderBatch<WithCallbackMethod_AttachSharedMemory<WithCallbackMethod_SubmitCommands<WithCallbackMethod_GetMetrics<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_CreateScene : public BaseClass {
@@ -2294,6 +2590,74 @@ class RenderService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodGeneric(25);
+    }
+    ~WithGenericMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodGeneric(26);
+    }
+    ~WithGenericMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodGeneric(27);
+    }
+    ~WithGenericMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodGeneric(28);
+    }
+    ~WithGenericMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_CreateScene : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2794,6 +3158,86 @@ class RenderService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodRaw(25);
+    }
+    ~WithRawMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUpdateRenderBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(25, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodRaw(26);
+    }
+    ~WithRawMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestAttachSharedMemory(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(26, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodRaw(27);
+    }
+    ~WithRawMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubmitCommands(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(27, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRaw(28);
+    }
+    ~WithRawMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(28, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_CreateScene : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3344,6 +3788,94 @@ class RenderService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodRawCallback(25,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->UpdateRenderBatch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* UpdateRenderBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodRawCallback(26,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->AttachSharedMemory(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* AttachSharedMemory(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodRawCallback(27,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SubmitCommands(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SubmitCommands(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRawCallback(28,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMetrics(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_CreateScene : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -4018,9 +4550,117 @@ class RenderService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSetCameraParameters(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::sapien::Renderer::server::proto::CameraParamsReq,::sapien::Renderer::server::proto::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_CreateScene<WithStreamedUnaryMethod_RemoveScene<WithStreamedUnaryMethod_CreateMaterial<WithStreamedUnaryMethod_RemoveMaterial<WithStreamedUnaryMethod_AddBodyMesh<WithStreamedUnaryMethod_AddBodyPrimitive<WithStreamedUnaryMethod_RemoveBody<WithStreamedUnaryMethod_AddCamera<WithStreamedUnaryMethod_SetAmbientLight<WithStreamedUnaryMethod_AddPointLight<WithStreamedUnaryMethod_AddDirectionalLight<WithStreamedUnaryMethod_SetEntityOrder<WithStreamedUnaryMethod_UpdateRender<WithStreamedUnaryMethod_UpdateRenderAndTakePictures<WithStreamedUnaryMethod_SetBaseColor<WithStreamedUnaryMethod_SetRoughness<WithStreamedUnaryMethod_SetSpecular<WithStreamedUnaryMethod_SetMetallic<WithStreamedUnaryMethod_SetUniqueId<WithStreamedUnaryMethod_SetSegmentationId<WithStreamedUnaryMethod_SetVisibility<WithStreamedUnaryMethod_GetShapeCount<WithStreamedUnaryMethod_GetShapeMaterial<WithStreamedUnaryMethod_TakePicture<WithStreamedUnaryMethod_SetCameraParameters<Service > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_UpdateRenderBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_UpdateRenderBatch() {
+      ::grpc::Service::MarkMethodStreamed(25,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::sapien::Renderer::server::proto::UpdateRenderBatchReq, ::sapien::Renderer::server::proto::Empty>* streamer) {
+                       return this->StreamedUpdateRenderBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_UpdateRenderBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status UpdateRenderBatch(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::UpdateRenderBatchReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedUpdateRenderBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::sapien::Renderer::server::proto::UpdateRenderBatchReq,::sapien::Renderer::server::proto::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_AttachSharedMemory : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_AttachSharedMemory() {
+      ::grpc::Service::MarkMethodStreamed(26,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::sapien::Renderer::server::proto::AttachSharedMemoryReq, ::sapien::Renderer::server::proto::Empty>* streamer) {
+                       return this->StreamedAttachSharedMemory(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_AttachSharedMemory() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status AttachSharedMemory(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::AttachSharedMemoryReq* /*request*/, ::sapien::Renderer::server::proto::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedAttachSharedMemory(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::sapien::Renderer::server::proto::AttachSharedMemoryReq,::sapien::Renderer::server::proto::Empty>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SubmitCommands : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SubmitCommands() {
+      ::grpc::Service::MarkMethodStreamed(27,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::sapien::Renderer::server::proto::CommandBatchReq, ::sapien::Renderer::server::proto::CommandBatchRes>* streamer) {
+                       return this->StreamedSubmitCommands(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SubmitCommands() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubmitCommands(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::CommandBatchReq* /*request*/, ::sapien::Renderer::server::proto::CommandBatchRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSubmitCommands(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::sapien::Renderer::server::proto::CommandBatchReq,::sapien::Renderer::server::proto::CommandBatchRes>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodStreamed(28,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::sapien::Renderer::server::proto::Empty, ::sapien::Renderer::server::proto::MetricsRes>* streamer) {
+                       return this->StreamedGetMetrics(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::sapien::Renderer::server::proto::Empty* /*request*/, ::sapien::Renderer::server::proto::MetricsRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMetrics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::sapien::Renderer::server::proto::Empty,::sapien::Renderer::server::proto::MetricsRes>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_CreateScene<WithStreamedUnaryMethod_RemoveScene<WithStreamedUnaryMethod_CreateMaterial<WithStreamedUnaryMethod_RemoveMaterial<WithStreamedUnaryMethod_AddBodyMesh<WithStreamedUnaryMethod_AddBodyPrimitive<WithStreamedUnaryMethod_RemoveBody<WithStreamedUnaryMethod_AddCamera<WithStreamedUnaryMethod_SetAmbientLight<WithStreamedUnaryMethod_AddPointLight<WithStreamedUnaryMethod_AddDirectionalLight<WithStreamedUnaryMethod_SetEntityOrder<WithStreamedUnaryMethod_UpdateRender<WithStreamedUnaryMethod_UpdateRenderAndTakePictures<WithStreamedUnaryMethod_SetBaseColor<WithStreamedUnaryMethod_SetRoughness<WithStreamedUnaryMethod_SetSpecular<WithStreamedUnaryMethod_SetMetallic<WithStreamedUnaryMethod_SetUniqueId<WithStreamedUnaryMethod_SetSegmentationId<WithStreamedUnaryMethod_SetVisibility<WithStreamedUnaryMethod_GetShapeCount<WithStreamedUnaryMethod_GetShapeMaterial<WithStreamedUnaryMethod_TakePicture<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_UpdateRenderBatch<WithStreamedUnaryMethod_AttachSharedMemory<WithStreamedUnaryMethod_SubmitCommands<WithStreamedUnaryMethod_GetMetrics<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_CreateScene<WithStreamedUnaryMethod_RemoveScene<WithStreamedUnaryMethod_CreateMaterial<WithStreamedUnaryMethod_RemoveMaterial<WithStreamedUnaryMethod_AddBodyMesh<WithStreamedUnaryMethod_AddBodyPrimitive<WithStreamedUnaryMethod_RemoveBody<WithStreamedUnaryMethod_AddCamera<WithStreamedUnaryMethod_SetAmbientLight<WithStreamedUnaryMethod_AddPointLight<WithStreamedUnaryMethod_AddDirectionalLight<WithStreamedUnaryMethod_SetEntityOrder<WithStreamedUnaryMethod_UpdateRender<WithStreamedUnaryMethod_UpdateRenderAndTakePictures<WithStreamedUnaryMethod_SetBaseColor<WithStreamedUnaryMethod_SetRoughness<WithStreamedUnaryMethod_SetSpecular<WithStreamedUnaryMethod_SetMetallic<WithStreamedUnaryMethod_SetUniqueId<WithStreamedUnaryMethod_SetSegmentationId<WithStreamedUnaryMethod_SetVisibility<WithStreamedUnaryMethod_GetShapeCount<WithStreamedUnaryMethod_GetShapeMaterial<WithStreamedUnaryMethod_TakePicture<WithStreamedUnaryMethod_SetCameraParameters<Service > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_CreateScene<WithStreamedUnaryMethod_RemoveScene<WithStreamedUnaryMethod_CreateMaterial<WithStreamedUnaryMethod_RemoveMaterial<WithStreamedUnaryMethod_AddBodyMesh<WithStreamedUnaryMethod_AddBodyPrimitive<WithStreamedUnaryMethod_RemoveBody<WithStreamedUnaryMethod_AddCamera<WithStreamedUnaryMethod_SetAmbientLight<WithStreamedUnaryMethod_AddPointLight<WithStreamedUnaryMethod_AddDirectionalLight<WithStreamedUnaryMethod_SetEntityOrder<WithStreamedUnaryMethod_UpdateRender<WithStreamedUnaryMethod_UpdateRenderAndTakePictures<WithStreamedUnaryMethod_SetBaseColor<WithStreamedUnaryMethod_SetRoughness<WithStreamedUnaryMethod_SetSpecular<WithStreamedUnaryMethod_SetMetallic<WithStreamedUnaryMethod_SetUniqueId<WithStreamedUnaryMethod_SetSegmentationId<WithStreamedUnaryMethod_SetVisibility<WithStreamedUnaryMethod_GetShapeCount<WithStreamedUnaryMethod_GetShapeMaterial<WithStreamedUnaryMethod_TakePicture<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_UpdateRenderBatch<WithStreamedUnaryMethod_AttachSharedMemory<WithStreamedUnaryMethod_SubmitCommands<WithStreamedUnaryMethod_GetMetrics<Service > > > > > > > > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace proto
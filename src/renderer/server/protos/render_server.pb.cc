@@ -330,6 +330,8 @@ PROTOBUF_CONSTEXPR UpdateRenderReq::UpdateRenderReq(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.body_poses_)*/{}
   , /*decltype(_impl_.camera_poses_)*/{}
+  , /*decltype(_impl_.body_pose_data_)*/{}
+  , /*decltype(_impl_.camera_pose_data_)*/{}
   , /*decltype(_impl_.scene_id_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct UpdateRenderReqDefaultTypeInternal {
@@ -406,6 +408,8 @@ PROTOBUF_CONSTEXPR UpdateRenderAndTakePicturesReq::UpdateRenderAndTakePicturesRe
   , /*decltype(_impl_.camera_poses_)*/{}
   , /*decltype(_impl_.camera_ids_)*/{}
   , /*decltype(_impl_._camera_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.body_pose_data_)*/{}
+  , /*decltype(_impl_.camera_pose_data_)*/{}
   , /*decltype(_impl_.scene_id_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct UpdateRenderAndTakePicturesReqDefaultTypeInternal {
@@ -452,11 +456,164 @@ struct BodyReqDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BodyReqDefaultTypeInternal _BodyReq_default_instance_;
+PROTOBUF_CONSTEXPR UpdateRenderBatchReq::UpdateRenderBatchReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.scenes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateRenderBatchReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateRenderBatchReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateRenderBatchReqDefaultTypeInternal() {}
+  union {
+    UpdateRenderBatchReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateRenderBatchReqDefaultTypeInternal _UpdateRenderBatchReq_default_instance_;
+PROTOBUF_CONSTEXPR AttachSharedMemoryReq::AttachSharedMemoryReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.scene_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AttachSharedMemoryReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AttachSharedMemoryReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AttachSharedMemoryReqDefaultTypeInternal() {}
+  union {
+    AttachSharedMemoryReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AttachSharedMemoryReqDefaultTypeInternal _AttachSharedMemoryReq_default_instance_;
+PROTOBUF_CONSTEXPR Command::Command(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.provisional_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.command_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct CommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandDefaultTypeInternal() {}
+  union {
+    Command _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandDefaultTypeInternal _Command_default_instance_;
+PROTOBUF_CONSTEXPR CommandBatchReq::CommandBatchReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.commands_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandBatchReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandBatchReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandBatchReqDefaultTypeInternal() {}
+  union {
+    CommandBatchReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandBatchReqDefaultTypeInternal _CommandBatchReq_default_instance_;
+PROTOBUF_CONSTEXPR CommandBatchRes::CommandBatchRes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.provisional_ids_)*/{}
+  , /*decltype(_impl_._provisional_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.ids_)*/{}
+  , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandBatchResDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandBatchResDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandBatchResDefaultTypeInternal() {}
+  union {
+    CommandBatchRes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandBatchResDefaultTypeInternal _CommandBatchRes_default_instance_;
+PROTOBUF_CONSTEXPR Histogram::Histogram(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_._buckets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.sum_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HistogramDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistogramDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistogramDefaultTypeInternal() {}
+  union {
+    Histogram _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistogramDefaultTypeInternal _Histogram_default_instance_;
+PROTOBUF_CONSTEXPR MethodMetrics::MethodMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.latency_)*/nullptr
+  , /*decltype(_impl_.handler_)*/nullptr
+  , /*decltype(_impl_.errors_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_in_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_out_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MethodMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MethodMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MethodMetricsDefaultTypeInternal() {}
+  union {
+    MethodMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MethodMetricsDefaultTypeInternal _MethodMetrics_default_instance_;
+PROTOBUF_CONSTEXPR StageMetrics::StageMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.latency_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StageMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StageMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StageMetricsDefaultTypeInternal() {}
+  union {
+    StageMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StageMetricsDefaultTypeInternal _StageMetrics_default_instance_;
+PROTOBUF_CONSTEXPR SceneMetrics::SceneMetrics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.scene_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.scene_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.pictures_)*/uint64_t{0u}
+  , /*decltype(_impl_.pending_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SceneMetricsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SceneMetricsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SceneMetricsDefaultTypeInternal() {}
+  union {
+    SceneMetrics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SceneMetricsDefaultTypeInternal _SceneMetrics_default_instance_;
+PROTOBUF_CONSTEXPR MetricsRes::MetricsRes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.methods_)*/{}
+  , /*decltype(_impl_.stages_)*/{}
+  , /*decltype(_impl_.scenes_)*/{}
+  , /*decltype(_impl_.uptime_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricsResDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricsResDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricsResDefaultTypeInternal() {}
+  union {
+    MetricsRes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricsResDefaultTypeInternal _MetricsRes_default_instance_;
 }  // namespace proto
 }  // namespace server
 }  // namespace Renderer
 }  // namespace sapien
-static ::_pb::Metadata file_level_metadata_render_5fserver_2eproto[28];
+static ::_pb::Metadata file_level_metadata_render_5fserver_2eproto[38];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_render_5fserver_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_render_5fserver_2eproto = nullptr;
 
@@ -651,6 +808,8 @@ const uint32_t TableStruct_render_5fserver_2eproto::offsets[] PROTOBUF_SECTION_V
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderReq, _impl_.scene_id_),
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderReq, _impl_.body_poses_),
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderReq, _impl_.camera_poses_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderReq, _impl_.body_pose_data_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderReq, _impl_.camera_pose_data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::BodyIdReq, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -696,6 +855,8 @@ const uint32_t TableStruct_render_5fserver_2eproto::offsets[] PROTOBUF_SECTION_V
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq, _impl_.body_poses_),
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq, _impl_.camera_poses_),
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq, _impl_.camera_ids_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq, _impl_.body_pose_data_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq, _impl_.camera_pose_data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CameraParamsReq, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -719,6 +880,106 @@ const uint32_t TableStruct_render_5fserver_2eproto::offsets[] PROTOBUF_SECTION_V
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::BodyReq, _impl_.scene_id_),
   PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::BodyReq, _impl_.body_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderBatchReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::UpdateRenderBatchReq, _impl_.scenes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::AttachSharedMemoryReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::AttachSharedMemoryReq, _impl_.scene_id_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::AttachSharedMemoryReq, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Command, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Command, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Command, _impl_.provisional_id_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Command, _impl_.command_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CommandBatchReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CommandBatchReq, _impl_.commands_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CommandBatchRes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CommandBatchRes, _impl_.provisional_ids_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::CommandBatchRes, _impl_.ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Histogram, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Histogram, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Histogram, _impl_.sum_us_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Histogram, _impl_.max_us_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::Histogram, _impl_.buckets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.latency_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.handler_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.errors_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.bytes_in_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MethodMetrics, _impl_.bytes_out_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::StageMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::StageMetrics, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::StageMetrics, _impl_.latency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _impl_.scene_id_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _impl_.scene_index_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _impl_.frames_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _impl_.pictures_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::SceneMetrics, _impl_.pending_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MetricsRes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MetricsRes, _impl_.uptime_us_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MetricsRes, _impl_.methods_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MetricsRes, _impl_.stages_),
+  PROTOBUF_FIELD_OFFSET(::sapien::Renderer::server::proto::MetricsRes, _impl_.scenes_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::sapien::Renderer::server::proto::Empty)},
@@ -742,13 +1003,23 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 164, -1, -1, sizeof(::sapien::Renderer::server::proto::RemoveLightReq)},
   { 172, -1, -1, sizeof(::sapien::Renderer::server::proto::EntityOrderReq)},
   { 181, -1, -1, sizeof(::sapien::Renderer::server::proto::UpdateRenderReq)},
-  { 190, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyIdReq)},
-  { 199, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyUint32Req)},
-  { 208, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyFloat32Req)},
-  { 217, -1, -1, sizeof(::sapien::Renderer::server::proto::TakePictureReq)},
-  { 225, -1, -1, sizeof(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq)},
-  { 235, -1, -1, sizeof(::sapien::Renderer::server::proto::CameraParamsReq)},
-  { 250, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyReq)},
+  { 192, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyIdReq)},
+  { 201, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyUint32Req)},
+  { 210, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyFloat32Req)},
+  { 219, -1, -1, sizeof(::sapien::Renderer::server::proto::TakePictureReq)},
+  { 227, -1, -1, sizeof(::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq)},
+  { 239, -1, -1, sizeof(::sapien::Renderer::server::proto::CameraParamsReq)},
+  { 254, -1, -1, sizeof(::sapien::Renderer::server::proto::BodyReq)},
+  { 262, -1, -1, sizeof(::sapien::Renderer::server::proto::UpdateRenderBatchReq)},
+  { 269, -1, -1, sizeof(::sapien::Renderer::server::proto::AttachSharedMemoryReq)},
+  { 277, -1, -1, sizeof(::sapien::Renderer::server::proto::Command)},
+  { 296, -1, -1, sizeof(::sapien::Renderer::server::proto::CommandBatchReq)},
+  { 303, -1, -1, sizeof(::sapien::Renderer::server::proto::CommandBatchRes)},
+  { 311, -1, -1, sizeof(::sapien::Renderer::server::proto::Histogram)},
+  { 321, -1, -1, sizeof(::sapien::Renderer::server::proto::MethodMetrics)},
+  { 333, -1, -1, sizeof(::sapien::Renderer::server::proto::StageMetrics)},
+  { 341, -1, -1, sizeof(::sapien::Renderer::server::proto::SceneMetrics)},
+  { 352, -1, -1, sizeof(::sapien::Renderer::server::proto::MetricsRes)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -780,6 +1051,16 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::sapien::Renderer::server::proto::_UpdateRenderAndTakePicturesReq_default_instance_._instance,
   &::sapien::Renderer::server::proto::_CameraParamsReq_default_instance_._instance,
   &::sapien::Renderer::server::proto::_BodyReq_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_UpdateRenderBatchReq_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_AttachSharedMemoryReq_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_Command_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_CommandBatchReq_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_CommandBatchRes_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_Histogram_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_MethodMetrics_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_StageMetrics_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_SceneMetrics_default_instance_._instance,
+  &::sapien::Renderer::server::proto::_MetricsRes_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_render_5fserver_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -826,95 +1107,153 @@ const char descriptor_table_protodef_render_5fserver_2eproto[] PROTOBUF_SECTION_
   "emoveLightReq\022\020\n\010scene_id\030\001 \001(\004\022\020\n\010light"
   "_id\030\002 \001(\004\"P\n\016EntityOrderReq\022\020\n\010scene_id\030"
   "\001 \001(\004\022\024\n\010body_ids\030\002 \003(\004B\002\020\001\022\026\n\ncamera_id"
-  "s\030\003 \003(\004B\002\020\001\"\225\001\n\017UpdateRenderReq\022\020\n\010scene"
+  "s\030\003 \003(\004B\002\020\001\"\307\001\n\017UpdateRenderReq\022\020\n\010scene"
   "_id\030\001 \001(\004\0226\n\nbody_poses\030\002 \003(\0132\".sapien.R"
   "enderer.server.proto.Pose\0228\n\014camera_pose"
   "s\030\003 \003(\0132\".sapien.Renderer.server.proto.P"
-  "ose\":\n\tBodyIdReq\022\020\n\010scene_id\030\001 \001(\004\022\017\n\007bo"
-  "dy_id\030\002 \001(\004\022\n\n\002id\030\003 \001(\r\">\n\rBodyUint32Req"
-  "\022\020\n\010scene_id\030\001 \001(\004\022\017\n\007body_id\030\002 \001(\004\022\n\n\002i"
-  "d\030\003 \001(\r\"B\n\016BodyFloat32Req\022\020\n\010scene_id\030\001 "
-  "\001(\004\022\017\n\007body_id\030\002 \001(\004\022\r\n\005value\030\003 \001(\002\"5\n\016T"
-  "akePictureReq\022\020\n\010scene_id\030\001 \001(\004\022\021\n\tcamer"
-  "a_id\030\002 \001(\004\"\274\001\n\036UpdateRenderAndTakePictur"
-  "esReq\022\020\n\010scene_id\030\001 \001(\004\0226\n\nbody_poses\030\002 "
-  "\003(\0132\".sapien.Renderer.server.proto.Pose\022"
-  "8\n\014camera_poses\030\003 \003(\0132\".sapien.Renderer."
-  "server.proto.Pose\022\026\n\ncamera_ids\030\004 \003(\004B\002\020"
-  "\001\"\217\001\n\017CameraParamsReq\022\020\n\010scene_id\030\001 \001(\004\022"
-  "\021\n\tcamera_id\030\002 \001(\004\022\014\n\004near\030\003 \001(\002\022\013\n\003far\030"
-  "\004 \001(\002\022\n\n\002fx\030\005 \001(\002\022\n\n\002fy\030\006 \001(\002\022\n\n\002cx\030\007 \001("
-  "\002\022\n\n\002cy\030\010 \001(\002\022\014\n\004skew\030\t \001(\002\",\n\007BodyReq\022\020"
-  "\n\010scene_id\030\001 \001(\004\022\017\n\007body_id\030\002 \001(\004*<\n\rPri"
-  "mitiveType\022\n\n\006SPHERE\020\000\022\007\n\003BOX\020\001\022\013\n\007CAPSU"
-  "LE\020\002\022\t\n\005PLANE\020\0032\213\023\n\rRenderService\022T\n\013Cre"
-  "ateScene\022#.sapien.Renderer.server.proto."
-  "Index\032 .sapien.Renderer.server.proto.Id\022"
-  "T\n\013RemoveScene\022 .sapien.Renderer.server."
-  "proto.Id\032#.sapien.Renderer.server.proto."
-  "Empty\022W\n\016CreateMaterial\022#.sapien.Rendere"
-  "r.server.proto.Empty\032 .sapien.Renderer.s"
-  "erver.proto.Id\022W\n\016RemoveMaterial\022 .sapie"
-  "n.Renderer.server.proto.Id\032#.sapien.Rend"
-  "erer.server.proto.Empty\022]\n\013AddBodyMesh\022,"
-  ".sapien.Renderer.server.proto.AddBodyMes"
-  "hReq\032 .sapien.Renderer.server.proto.Id\022g"
-  "\n\020AddBodyPrimitive\0221.sapien.Renderer.ser"
-  "ver.proto.AddBodyPrimitiveReq\032 .sapien.R"
-  "enderer.server.proto.Id\022^\n\nRemoveBody\022+."
-  "sapien.Renderer.server.proto.RemoveBodyR"
+  "ose\022\026\n\016body_pose_data\030\004 \003(\002\022\030\n\020camera_po"
+  "se_data\030\005 \003(\002\":\n\tBodyIdReq\022\020\n\010scene_id\030\001"
+  " \001(\004\022\017\n\007body_id\030\002 \001(\004\022\n\n\002id\030\003 \001(\r\">\n\rBod"
+  "yUint32Req\022\020\n\010scene_id\030\001 \001(\004\022\017\n\007body_id\030"
+  "\002 \001(\004\022\n\n\002id\030\003 \001(\r\"B\n\016BodyFloat32Req\022\020\n\010s"
+  "cene_id\030\001 \001(\004\022\017\n\007body_id\030\002 \001(\004\022\r\n\005value\030"
+  "\003 \001(\002\"5\n\016TakePictureReq\022\020\n\010scene_id\030\001 \001("
+  "\004\022\021\n\tcamera_id\030\002 \001(\004\"\356\001\n\036UpdateRenderAnd"
+  "TakePicturesReq\022\020\n\010scene_id\030\001 \001(\004\0226\n\nbod"
+  "y_poses\030\002 \003(\0132\".sapien.Renderer.server.p"
+  "roto.Pose\0228\n\014camera_poses\030\003 \003(\0132\".sapien"
+  ".Renderer.server.proto.Pose\022\026\n\ncamera_id"
+  "s\030\004 \003(\004B\002\020\001\022\026\n\016body_pose_data\030\005 \003(\002\022\030\n\020c"
+  "amera_pose_data\030\006 \003(\002\"\217\001\n\017CameraParamsRe"
+  "q\022\020\n\010scene_id\030\001 \001(\004\022\021\n\tcamera_id\030\002 \001(\004\022\014"
+  "\n\004near\030\003 \001(\002\022\013\n\003far\030\004 \001(\002\022\n\n\002fx\030\005 \001(\002\022\n\n"
+  "\002fy\030\006 \001(\002\022\n\n\002cx\030\007 \001(\002\022\n\n\002cy\030\010 \001(\002\022\014\n\004ske"
+  "w\030\t \001(\002\",\n\007BodyReq\022\020\n\010scene_id\030\001 \001(\004\022\017\n\007"
+  "body_id\030\002 \001(\004\"d\n\024UpdateRenderBatchReq\022L\n"
+  "\006scenes\030\001 \003(\0132<.sapien.Renderer.server.p"
+  "roto.UpdateRenderAndTakePicturesReq\"7\n\025A"
+  "ttachSharedMemoryReq\022\020\n\010scene_id\030\001 \001(\004\022\014"
+  "\n\004name\030\002 \001(\t\"\221\006\n\007Command\022>\n\017create_mater"
+  "ial\030\001 \001(\0132#.sapien.Renderer.server.proto"
+  ".EmptyH\000\022;\n\017remove_material\030\002 \001(\0132 .sapi"
+  "en.Renderer.server.proto.IdH\000\022>\n\016set_bas"
+  "e_color\030\003 \001(\0132$.sapien.Renderer.server.p"
+  "roto.IdVec4H\000\022>\n\rset_roughness\030\004 \001(\0132%.s"
+  "apien.Renderer.server.proto.IdFloatH\000\022=\n"
+  "\014set_specular\030\005 \001(\0132%.sapien.Renderer.se"
+  "rver.proto.IdFloatH\000\022=\n\014set_metallic\030\006 \001"
+  "(\0132%.sapien.Renderer.server.proto.IdFloa"
+  "tH\000\022E\n\radd_body_mesh\030\007 \001(\0132,.sapien.Rend"
+  "erer.server.proto.AddBodyMeshReqH\000\022O\n\022ad"
+  "d_body_primitive\030\010 \001(\01321.sapien.Renderer"
+  ".server.proto.AddBodyPrimitiveReqH\000\022@\n\rs"
+  "et_unique_id\030\t \001(\0132\'.sapien.Renderer.ser"
+  "ver.proto.BodyIdReqH\000\022F\n\023set_segmentatio"
+  "n_id\030\n \001(\0132\'.sapien.Renderer.server.prot"
+  "o.BodyIdReqH\000\022F\n\016set_visibility\030\013 \001(\0132,."
+  "sapien.Renderer.server.proto.BodyFloat32"
+  "ReqH\000\022\026\n\016provisional_id\030\014 \001(\004B\t\n\007command"
+  "\"J\n\017CommandBatchReq\0227\n\010commands\030\001 \003(\0132%."
+  "sapien.Renderer.server.proto.Command\"7\n\017"
+  "CommandBatchRes\022\027\n\017provisional_ids\030\001 \003(\004"
+  "\022\013\n\003ids\030\002 \003(\004\"K\n\tHistogram\022\r\n\005count\030\001 \001("
+  "\004\022\016\n\006sum_us\030\002 \001(\004\022\016\n\006max_us\030\003 \001(\004\022\017\n\007buc"
+  "kets\030\004 \003(\004\"\306\001\n\rMethodMetrics\022\014\n\004name\030\001 \001"
+  "(\t\0228\n\007latency\030\002 \001(\0132\'.sapien.Renderer.se"
+  "rver.proto.Histogram\0228\n\007handler\030\003 \001(\0132\'."
+  "sapien.Renderer.server.proto.Histogram\022\016"
+  "\n\006errors\030\004 \001(\004\022\020\n\010bytes_in\030\005 \001(\004\022\021\n\tbyte"
+  "s_out\030\006 \001(\004\"V\n\014StageMetrics\022\014\n\004name\030\001 \001("
+  "\t\0228\n\007latency\030\002 \001(\0132\'.sapien.Renderer.ser"
+  "ver.proto.Histogram\"h\n\014SceneMetrics\022\020\n\010s"
+  "cene_id\030\001 \001(\004\022\023\n\013scene_index\030\002 \001(\004\022\016\n\006fr"
+  "ames\030\003 \001(\004\022\020\n\010pictures\030\004 \001(\004\022\017\n\007pending\030"
+  "\005 \001(\r\"\325\001\n\nMetricsRes\022\021\n\tuptime_us\030\001 \001(\004\022"
+  "<\n\007methods\030\002 \003(\0132+.sapien.Renderer.serve"
+  "r.proto.MethodMetrics\022:\n\006stages\030\003 \003(\0132*."
+  "sapien.Renderer.server.proto.StageMetric"
+  "s\022:\n\006scenes\030\004 \003(\0132*.sapien.Renderer.serv"
+  "er.proto.SceneMetrics*<\n\rPrimitiveType\022\n"
+  "\n\006SPHERE\020\000\022\007\n\003BOX\020\001\022\013\n\007CAPSULE\020\002\022\t\n\005PLAN"
+  "E\020\0032\266\026\n\rRenderService\022T\n\013CreateScene\022#.s"
+  "apien.Renderer.server.proto.Index\032 .sapi"
+  "en.Renderer.server.proto.Id\022T\n\013RemoveSce"
+  "ne\022 .sapien.Renderer.server.proto.Id\032#.s"
+  "apien.Renderer.server.proto.Empty\022W\n\016Cre"
+  "ateMaterial\022#.sapien.Renderer.server.pro"
+  "to.Empty\032 .sapien.Renderer.server.proto."
+  "Id\022W\n\016RemoveMaterial\022 .sapien.Renderer.s"
+  "erver.proto.Id\032#.sapien.Renderer.server."
+  "proto.Empty\022]\n\013AddBodyMesh\022,.sapien.Rend"
+  "erer.server.proto.AddBodyMeshReq\032 .sapie"
+  "n.Renderer.server.proto.Id\022g\n\020AddBodyPri"
+  "mitive\0221.sapien.Renderer.server.proto.Ad"
+  "dBodyPrimitiveReq\032 .sapien.Renderer.serv"
+  "er.proto.Id\022^\n\nRemoveBody\022+.sapien.Rende"
+  "rer.server.proto.RemoveBodyReq\032#.sapien."
+  "Renderer.server.proto.Empty\022Y\n\tAddCamera"
+  "\022*.sapien.Renderer.server.proto.AddCamer"
+  "aReq\032 .sapien.Renderer.server.proto.Id\022\\"
+  "\n\017SetAmbientLight\022$.sapien.Renderer.serv"
+  "er.proto.IdVec3\032#.sapien.Renderer.server"
+  ".proto.Empty\022a\n\rAddPointLight\022..sapien.R"
+  "enderer.server.proto.AddPointLightReq\032 ."
+  "sapien.Renderer.server.proto.Id\022m\n\023AddDi"
+  "rectionalLight\0224.sapien.Renderer.server."
+  "proto.AddDirectionalLightReq\032 .sapien.Re"
+  "nderer.server.proto.Id\022c\n\016SetEntityOrder"
+  "\022,.sapien.Renderer.server.proto.EntityOr"
+  "derReq\032#.sapien.Renderer.server.proto.Em"
+  "pty\022b\n\014UpdateRender\022-.sapien.Renderer.se"
+  "rver.proto.UpdateRenderReq\032#.sapien.Rend"
+  "erer.server.proto.Empty\022\200\001\n\033UpdateRender"
+  "AndTakePictures\022<.sapien.Renderer.server"
+  ".proto.UpdateRenderAndTakePicturesReq\032#."
+  "sapien.Renderer.server.proto.Empty\022Y\n\014Se"
+  "tBaseColor\022$.sapien.Renderer.server.prot"
+  "o.IdVec4\032#.sapien.Renderer.server.proto."
+  "Empty\022Z\n\014SetRoughness\022%.sapien.Renderer."
+  "server.proto.IdFloat\032#.sapien.Renderer.s"
+  "erver.proto.Empty\022Y\n\013SetSpecular\022%.sapie"
+  "n.Renderer.server.proto.IdFloat\032#.sapien"
+  ".Renderer.server.proto.Empty\022Y\n\013SetMetal"
+  "lic\022%.sapien.Renderer.server.proto.IdFlo"
+  "at\032#.sapien.Renderer.server.proto.Empty\022"
+  "[\n\013SetUniqueId\022\'.sapien.Renderer.server."
+  "proto.BodyIdReq\032#.sapien.Renderer.server"
+  ".proto.Empty\022a\n\021SetSegmentationId\022\'.sapi"
+  "en.Renderer.server.proto.BodyIdReq\032#.sap"
+  "ien.Renderer.server.proto.Empty\022b\n\rSetVi"
+  "sibility\022,.sapien.Renderer.server.proto."
+  "BodyFloat32Req\032#.sapien.Renderer.server."
+  "proto.Empty\022\\\n\rGetShapeCount\022%.sapien.Re"
+  "nderer.server.proto.BodyReq\032$.sapien.Ren"
+  "derer.server.proto.Uint32\022a\n\020GetShapeMat"
+  "erial\022+.sapien.Renderer.server.proto.Bod"
+  "yUint32Req\032 .sapien.Renderer.server.prot"
+  "o.Id\022`\n\013TakePicture\022,.sapien.Renderer.se"
+  "rver.proto.TakePictureReq\032#.sapien.Rende"
+  "rer.server.proto.Empty\022i\n\023SetCameraParam"
+  "eters\022-.sapien.Renderer.server.proto.Cam"
+  "eraParamsReq\032#.sapien.Renderer.server.pr"
+  "oto.Empty\022l\n\021UpdateRenderBatch\0222.sapien."
+  "Renderer.server.proto.UpdateRenderBatchR"
   "eq\032#.sapien.Renderer.server.proto.Empty\022"
-  "Y\n\tAddCamera\022*.sapien.Renderer.server.pr"
-  "oto.AddCameraReq\032 .sapien.Renderer.serve"
-  "r.proto.Id\022\\\n\017SetAmbientLight\022$.sapien.R"
-  "enderer.server.proto.IdVec3\032#.sapien.Ren"
-  "derer.server.proto.Empty\022a\n\rAddPointLigh"
-  "t\022..sapien.Renderer.server.proto.AddPoin"
-  "tLightReq\032 .sapien.Renderer.server.proto"
-  ".Id\022m\n\023AddDirectionalLight\0224.sapien.Rend"
-  "erer.server.proto.AddDirectionalLightReq"
-  "\032 .sapien.Renderer.server.proto.Id\022c\n\016Se"
-  "tEntityOrder\022,.sapien.Renderer.server.pr"
-  "oto.EntityOrderReq\032#.sapien.Renderer.ser"
-  "ver.proto.Empty\022b\n\014UpdateRender\022-.sapien"
-  ".Renderer.server.proto.UpdateRenderReq\032#"
-  ".sapien.Renderer.server.proto.Empty\022\200\001\n\033"
-  "UpdateRenderAndTakePictures\022<.sapien.Ren"
-  "derer.server.proto.UpdateRenderAndTakePi"
-  "cturesReq\032#.sapien.Renderer.server.proto"
-  ".Empty\022Y\n\014SetBaseColor\022$.sapien.Renderer"
-  ".server.proto.IdVec4\032#.sapien.Renderer.s"
-  "erver.proto.Empty\022Z\n\014SetRoughness\022%.sapi"
-  "en.Renderer.server.proto.IdFloat\032#.sapie"
-  "n.Renderer.server.proto.Empty\022Y\n\013SetSpec"
-  "ular\022%.sapien.Renderer.server.proto.IdFl"
-  "oat\032#.sapien.Renderer.server.proto.Empty"
-  "\022Y\n\013SetMetallic\022%.sapien.Renderer.server"
-  ".proto.IdFloat\032#.sapien.Renderer.server."
-  "proto.Empty\022[\n\013SetUniqueId\022\'.sapien.Rend"
-  "erer.server.proto.BodyIdReq\032#.sapien.Ren"
-  "derer.server.proto.Empty\022a\n\021SetSegmentat"
-  "ionId\022\'.sapien.Renderer.server.proto.Bod"
-  "yIdReq\032#.sapien.Renderer.server.proto.Em"
-  "pty\022b\n\rSetVisibility\022,.sapien.Renderer.s"
-  "erver.proto.BodyFloat32Req\032#.sapien.Rend"
-  "erer.server.proto.Empty\022\\\n\rGetShapeCount"
-  "\022%.sapien.Renderer.server.proto.BodyReq\032"
-  "$.sapien.Renderer.server.proto.Uint32\022a\n"
-  "\020GetShapeMaterial\022+.sapien.Renderer.serv"
-  "er.proto.BodyUint32Req\032 .sapien.Renderer"
-  ".server.proto.Id\022`\n\013TakePicture\022,.sapien"
-  ".Renderer.server.proto.TakePictureReq\032#."
-  "sapien.Renderer.server.proto.Empty\022i\n\023Se"
-  "tCameraParameters\022-.sapien.Renderer.serv"
-  "er.proto.CameraParamsReq\032#.sapien.Render"
-  "er.server.proto.Emptyb\006proto3"
+  "n\n\022AttachSharedMemory\0223.sapien.Renderer."
+  "server.proto.AttachSharedMemoryReq\032#.sap"
+  "ien.Renderer.server.proto.Empty\022n\n\016Submi"
+  "tCommands\022-.sapien.Renderer.server.proto"
+  ".CommandBatchReq\032-.sapien.Renderer.serve"
+  "r.proto.CommandBatchRes\022[\n\nGetMetrics\022#."
+  "sapien.Renderer.server.proto.Empty\032(.sap"
+  "ien.Renderer.server.proto.MetricsResb\006pr"
+  "oto3"
   ;
 static ::_pbi::once_flag descriptor_table_render_5fserver_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_render_5fserver_2eproto = {
-    false, false, 5029, descriptor_table_protodef_render_5fserver_2eproto,
+    false, false, 7324, descriptor_table_protodef_render_5fserver_2eproto,
     "render_server.proto",
-    &descriptor_table_render_5fserver_2eproto_once, nullptr, 0, 28,
+    &descriptor_table_render_5fserver_2eproto_once, nullptr, 0, 38,
     schemas, file_default_instances, TableStruct_render_5fserver_2eproto::offsets,
     file_level_metadata_render_5fserver_2eproto, file_level_enum_descriptors_render_5fserver_2eproto,
     file_level_service_descriptors_render_5fserver_2eproto,
@@ -6033,6 +6372,8 @@ UpdateRenderReq::UpdateRenderReq(const UpdateRenderReq& from)
   new (&_impl_) Impl_{
       decltype(_impl_.body_poses_){from._impl_.body_poses_}
     , decltype(_impl_.camera_poses_){from._impl_.camera_poses_}
+    , decltype(_impl_.body_pose_data_){from._impl_.body_pose_data_}
+    , decltype(_impl_.camera_pose_data_){from._impl_.camera_pose_data_}
     , decltype(_impl_.scene_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
@@ -6048,6 +6389,8 @@ inline void UpdateRenderReq::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.body_poses_){arena}
     , decltype(_impl_.camera_poses_){arena}
+    , decltype(_impl_.body_pose_data_){arena}
+    , decltype(_impl_.camera_pose_data_){arena}
     , decltype(_impl_.scene_id_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
@@ -6066,6 +6409,8 @@ inline void UpdateRenderReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.body_poses_.~RepeatedPtrField();
   _impl_.camera_poses_.~RepeatedPtrField();
+  _impl_.body_pose_data_.~RepeatedField();
+  _impl_.camera_pose_data_.~RepeatedField();
 }
 
 void UpdateRenderReq::SetCachedSize(int size) const {
@@ -6080,6 +6425,8 @@ void UpdateRenderReq::Clear() {
 
   _impl_.body_poses_.Clear();
   _impl_.camera_poses_.Clear();
+  _impl_.body_pose_data_.Clear();
+  _impl_.camera_pose_data_.Clear();
   _impl_.scene_id_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -6124,6 +6471,28 @@ const char* UpdateRenderReq::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // repeated float body_pose_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_body_pose_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_body_pose_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float camera_pose_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_camera_pose_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_camera_pose_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -6175,6 +6544,16 @@ uint8_t* UpdateRenderReq::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // repeated float body_pose_data = 4;
+  if (this->_internal_body_pose_data_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_body_pose_data(), target);
+  }
+
+  // repeated float camera_pose_data = 5;
+  if (this->_internal_camera_pose_data_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_camera_pose_data(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -6205,6 +6584,28 @@ size_t UpdateRenderReq::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated float body_pose_data = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_body_pose_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float camera_pose_data = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_camera_pose_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
   // uint64 scene_id = 1;
   if (this->_internal_scene_id() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scene_id());
@@ -6230,6 +6631,8 @@ void UpdateRenderReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
 
   _this->_impl_.body_poses_.MergeFrom(from._impl_.body_poses_);
   _this->_impl_.camera_poses_.MergeFrom(from._impl_.camera_poses_);
+  _this->_impl_.body_pose_data_.MergeFrom(from._impl_.body_pose_data_);
+  _this->_impl_.camera_pose_data_.MergeFrom(from._impl_.camera_pose_data_);
   if (from._internal_scene_id() != 0) {
     _this->_internal_set_scene_id(from._internal_scene_id());
   }
@@ -6252,6 +6655,8 @@ void UpdateRenderReq::InternalSwap(UpdateRenderReq* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.body_poses_.InternalSwap(&other->_impl_.body_poses_);
   _impl_.camera_poses_.InternalSwap(&other->_impl_.camera_poses_);
+  _impl_.body_pose_data_.InternalSwap(&other->_impl_.body_pose_data_);
+  _impl_.camera_pose_data_.InternalSwap(&other->_impl_.camera_pose_data_);
   swap(_impl_.scene_id_, other->_impl_.scene_id_);
 }
 
@@ -7209,6 +7614,8 @@ UpdateRenderAndTakePicturesReq::UpdateRenderAndTakePicturesReq(const UpdateRende
     , decltype(_impl_.camera_poses_){from._impl_.camera_poses_}
     , decltype(_impl_.camera_ids_){from._impl_.camera_ids_}
     , /*decltype(_impl_._camera_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.body_pose_data_){from._impl_.body_pose_data_}
+    , decltype(_impl_.camera_pose_data_){from._impl_.camera_pose_data_}
     , decltype(_impl_.scene_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
@@ -7226,6 +7633,8 @@ inline void UpdateRenderAndTakePicturesReq::SharedCtor(
     , decltype(_impl_.camera_poses_){arena}
     , decltype(_impl_.camera_ids_){arena}
     , /*decltype(_impl_._camera_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.body_pose_data_){arena}
+    , decltype(_impl_.camera_pose_data_){arena}
     , decltype(_impl_.scene_id_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
@@ -7245,6 +7654,8 @@ inline void UpdateRenderAndTakePicturesReq::SharedDtor() {
   _impl_.body_poses_.~RepeatedPtrField();
   _impl_.camera_poses_.~RepeatedPtrField();
   _impl_.camera_ids_.~RepeatedField();
+  _impl_.body_pose_data_.~RepeatedField();
+  _impl_.camera_pose_data_.~RepeatedField();
 }
 
 void UpdateRenderAndTakePicturesReq::SetCachedSize(int size) const {
@@ -7260,6 +7671,8 @@ void UpdateRenderAndTakePicturesReq::Clear() {
   _impl_.body_poses_.Clear();
   _impl_.camera_poses_.Clear();
   _impl_.camera_ids_.Clear();
+  _impl_.body_pose_data_.Clear();
+  _impl_.camera_pose_data_.Clear();
   _impl_.scene_id_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -7315,6 +7728,28 @@ const char* UpdateRenderAndTakePicturesReq::_InternalParse(const char* ptr, ::_p
         } else
           goto handle_unusual;
         continue;
+      // repeated float body_pose_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_body_pose_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_body_pose_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float camera_pose_data = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_camera_pose_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_camera_pose_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -7375,6 +7810,16 @@ uint8_t* UpdateRenderAndTakePicturesReq::_InternalSerialize(
     }
   }
 
+  // repeated float body_pose_data = 5;
+  if (this->_internal_body_pose_data_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_body_pose_data(), target);
+  }
+
+  // repeated float camera_pose_data = 6;
+  if (this->_internal_camera_pose_data_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_camera_pose_data(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -7419,6 +7864,28 @@ size_t UpdateRenderAndTakePicturesReq::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated float body_pose_data = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_body_pose_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float camera_pose_data = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_camera_pose_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
   // uint64 scene_id = 1;
   if (this->_internal_scene_id() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scene_id());
@@ -7445,6 +7912,8 @@ void UpdateRenderAndTakePicturesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message&
   _this->_impl_.body_poses_.MergeFrom(from._impl_.body_poses_);
   _this->_impl_.camera_poses_.MergeFrom(from._impl_.camera_poses_);
   _this->_impl_.camera_ids_.MergeFrom(from._impl_.camera_ids_);
+  _this->_impl_.body_pose_data_.MergeFrom(from._impl_.body_pose_data_);
+  _this->_impl_.camera_pose_data_.MergeFrom(from._impl_.camera_pose_data_);
   if (from._internal_scene_id() != 0) {
     _this->_internal_set_scene_id(from._internal_scene_id());
   }
@@ -7468,6 +7937,8 @@ void UpdateRenderAndTakePicturesReq::InternalSwap(UpdateRenderAndTakePicturesReq
   _impl_.body_poses_.InternalSwap(&other->_impl_.body_poses_);
   _impl_.camera_poses_.InternalSwap(&other->_impl_.camera_poses_);
   _impl_.camera_ids_.InternalSwap(&other->_impl_.camera_ids_);
+  _impl_.body_pose_data_.InternalSwap(&other->_impl_.body_pose_data_);
+  _impl_.camera_pose_data_.InternalSwap(&other->_impl_.camera_pose_data_);
   swap(_impl_.scene_id_, other->_impl_.scene_id_);
 }
 
@@ -8151,55 +8622,3198 @@ void BodyReq::InternalSwap(BodyReq* other) {
       file_level_metadata_render_5fserver_2eproto[27]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace proto
-}  // namespace server
-}  // namespace Renderer
-}  // namespace sapien
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Empty*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Empty >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Empty >(arena);
-}
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Uint32*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Uint32 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Uint32 >(arena);
-}
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Index*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Index >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Index >(arena);
-}
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Id*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Id >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Id >(arena);
-}
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Vec3*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Vec3 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Vec3 >(arena);
+// ===================================================================
+
+class UpdateRenderBatchReq::_Internal {
+ public:
+};
+
+UpdateRenderBatchReq::UpdateRenderBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.UpdateRenderBatchReq)
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Vec4*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Vec4 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Vec4 >(arena);
+UpdateRenderBatchReq::UpdateRenderBatchReq(const UpdateRenderBatchReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateRenderBatchReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.scenes_){from._impl_.scenes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.UpdateRenderBatchReq)
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Quat*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Quat >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Quat >(arena);
+
+inline void UpdateRenderBatchReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.scenes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Pose*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Pose >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Pose >(arena);
+
+UpdateRenderBatchReq::~UpdateRenderBatchReq() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdVec3*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdVec3 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdVec3 >(arena);
+
+inline void UpdateRenderBatchReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scenes_.~RepeatedPtrField();
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdVec4*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdVec4 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdVec4 >(arena);
+
+void UpdateRenderBatchReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdFloat*
-Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdFloat >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdFloat >(arena);
+
+void UpdateRenderBatchReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.scenes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateRenderBatchReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq scenes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scenes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpdateRenderBatchReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq scenes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scenes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scenes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  return target;
+}
+
+size_t UpdateRenderBatchReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq scenes = 1;
+  total_size += 1UL * this->_internal_scenes_size();
+  for (const auto& msg : this->_impl_.scenes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateRenderBatchReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateRenderBatchReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateRenderBatchReq::GetClassData() const { return &_class_data_; }
+
+
+void UpdateRenderBatchReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateRenderBatchReq*>(&to_msg);
+  auto& from = static_cast<const UpdateRenderBatchReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.scenes_.MergeFrom(from._impl_.scenes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateRenderBatchReq::CopyFrom(const UpdateRenderBatchReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpdateRenderBatchReq::IsInitialized() const {
+  return true;
+}
+
+void UpdateRenderBatchReq::InternalSwap(UpdateRenderBatchReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.scenes_.InternalSwap(&other->_impl_.scenes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateRenderBatchReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[28]);
+}
+
+// ===================================================================
+
+class AttachSharedMemoryReq::_Internal {
+ public:
+};
+
+AttachSharedMemoryReq::AttachSharedMemoryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+}
+AttachSharedMemoryReq::AttachSharedMemoryReq(const AttachSharedMemoryReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AttachSharedMemoryReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.scene_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.scene_id_ = from._impl_.scene_id_;
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+}
+
+inline void AttachSharedMemoryReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.scene_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AttachSharedMemoryReq::~AttachSharedMemoryReq() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AttachSharedMemoryReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void AttachSharedMemoryReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AttachSharedMemoryReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.scene_id_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AttachSharedMemoryReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 scene_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.scene_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sapien.Renderer.server.proto.AttachSharedMemoryReq.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AttachSharedMemoryReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 scene_id = 1;
+  if (this->_internal_scene_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_scene_id(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sapien.Renderer.server.proto.AttachSharedMemoryReq.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  return target;
+}
+
+size_t AttachSharedMemoryReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 scene_id = 1;
+  if (this->_internal_scene_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scene_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AttachSharedMemoryReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AttachSharedMemoryReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AttachSharedMemoryReq::GetClassData() const { return &_class_data_; }
+
+
+void AttachSharedMemoryReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AttachSharedMemoryReq*>(&to_msg);
+  auto& from = static_cast<const AttachSharedMemoryReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_scene_id() != 0) {
+    _this->_internal_set_scene_id(from._internal_scene_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AttachSharedMemoryReq::CopyFrom(const AttachSharedMemoryReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AttachSharedMemoryReq::IsInitialized() const {
+  return true;
+}
+
+void AttachSharedMemoryReq::InternalSwap(AttachSharedMemoryReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.scene_id_, other->_impl_.scene_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AttachSharedMemoryReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[29]);
+}
+
+// ===================================================================
+
+class Command::_Internal {
+ public:
+  static const ::sapien::Renderer::server::proto::Empty& create_material(const Command* msg);
+  static const ::sapien::Renderer::server::proto::Id& remove_material(const Command* msg);
+  static const ::sapien::Renderer::server::proto::IdVec4& set_base_color(const Command* msg);
+  static const ::sapien::Renderer::server::proto::IdFloat& set_roughness(const Command* msg);
+  static const ::sapien::Renderer::server::proto::IdFloat& set_specular(const Command* msg);
+  static const ::sapien::Renderer::server::proto::IdFloat& set_metallic(const Command* msg);
+  static const ::sapien::Renderer::server::proto::AddBodyMeshReq& add_body_mesh(const Command* msg);
+  static const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq& add_body_primitive(const Command* msg);
+  static const ::sapien::Renderer::server::proto::BodyIdReq& set_unique_id(const Command* msg);
+  static const ::sapien::Renderer::server::proto::BodyIdReq& set_segmentation_id(const Command* msg);
+  static const ::sapien::Renderer::server::proto::BodyFloat32Req& set_visibility(const Command* msg);
+};
+
+const ::sapien::Renderer::server::proto::Empty&
+Command::_Internal::create_material(const Command* msg) {
+  return *msg->_impl_.command_.create_material_;
+}
+const ::sapien::Renderer::server::proto::Id&
+Command::_Internal::remove_material(const Command* msg) {
+  return *msg->_impl_.command_.remove_material_;
+}
+const ::sapien::Renderer::server::proto::IdVec4&
+Command::_Internal::set_base_color(const Command* msg) {
+  return *msg->_impl_.command_.set_base_color_;
+}
+const ::sapien::Renderer::server::proto::IdFloat&
+Command::_Internal::set_roughness(const Command* msg) {
+  return *msg->_impl_.command_.set_roughness_;
+}
+const ::sapien::Renderer::server::proto::IdFloat&
+Command::_Internal::set_specular(const Command* msg) {
+  return *msg->_impl_.command_.set_specular_;
+}
+const ::sapien::Renderer::server::proto::IdFloat&
+Command::_Internal::set_metallic(const Command* msg) {
+  return *msg->_impl_.command_.set_metallic_;
+}
+const ::sapien::Renderer::server::proto::AddBodyMeshReq&
+Command::_Internal::add_body_mesh(const Command* msg) {
+  return *msg->_impl_.command_.add_body_mesh_;
+}
+const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq&
+Command::_Internal::add_body_primitive(const Command* msg) {
+  return *msg->_impl_.command_.add_body_primitive_;
+}
+const ::sapien::Renderer::server::proto::BodyIdReq&
+Command::_Internal::set_unique_id(const Command* msg) {
+  return *msg->_impl_.command_.set_unique_id_;
+}
+const ::sapien::Renderer::server::proto::BodyIdReq&
+Command::_Internal::set_segmentation_id(const Command* msg) {
+  return *msg->_impl_.command_.set_segmentation_id_;
+}
+const ::sapien::Renderer::server::proto::BodyFloat32Req&
+Command::_Internal::set_visibility(const Command* msg) {
+  return *msg->_impl_.command_.set_visibility_;
+}
+void Command::set_allocated_create_material(::sapien::Renderer::server::proto::Empty* create_material) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (create_material) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_material);
+    if (message_arena != submessage_arena) {
+      create_material = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, create_material, submessage_arena);
+    }
+    set_has_create_material();
+    _impl_.command_.create_material_ = create_material;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.create_material)
+}
+void Command::set_allocated_remove_material(::sapien::Renderer::server::proto::Id* remove_material) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (remove_material) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(remove_material);
+    if (message_arena != submessage_arena) {
+      remove_material = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, remove_material, submessage_arena);
+    }
+    set_has_remove_material();
+    _impl_.command_.remove_material_ = remove_material;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.remove_material)
+}
+void Command::set_allocated_set_base_color(::sapien::Renderer::server::proto::IdVec4* set_base_color) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_base_color) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_base_color);
+    if (message_arena != submessage_arena) {
+      set_base_color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_base_color, submessage_arena);
+    }
+    set_has_set_base_color();
+    _impl_.command_.set_base_color_ = set_base_color;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_base_color)
+}
+void Command::set_allocated_set_roughness(::sapien::Renderer::server::proto::IdFloat* set_roughness) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_roughness) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_roughness);
+    if (message_arena != submessage_arena) {
+      set_roughness = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_roughness, submessage_arena);
+    }
+    set_has_set_roughness();
+    _impl_.command_.set_roughness_ = set_roughness;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_roughness)
+}
+void Command::set_allocated_set_specular(::sapien::Renderer::server::proto::IdFloat* set_specular) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_specular) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_specular);
+    if (message_arena != submessage_arena) {
+      set_specular = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_specular, submessage_arena);
+    }
+    set_has_set_specular();
+    _impl_.command_.set_specular_ = set_specular;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_specular)
+}
+void Command::set_allocated_set_metallic(::sapien::Renderer::server::proto::IdFloat* set_metallic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_metallic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_metallic);
+    if (message_arena != submessage_arena) {
+      set_metallic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_metallic, submessage_arena);
+    }
+    set_has_set_metallic();
+    _impl_.command_.set_metallic_ = set_metallic;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_metallic)
+}
+void Command::set_allocated_add_body_mesh(::sapien::Renderer::server::proto::AddBodyMeshReq* add_body_mesh) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (add_body_mesh) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(add_body_mesh);
+    if (message_arena != submessage_arena) {
+      add_body_mesh = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, add_body_mesh, submessage_arena);
+    }
+    set_has_add_body_mesh();
+    _impl_.command_.add_body_mesh_ = add_body_mesh;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.add_body_mesh)
+}
+void Command::set_allocated_add_body_primitive(::sapien::Renderer::server::proto::AddBodyPrimitiveReq* add_body_primitive) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (add_body_primitive) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(add_body_primitive);
+    if (message_arena != submessage_arena) {
+      add_body_primitive = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, add_body_primitive, submessage_arena);
+    }
+    set_has_add_body_primitive();
+    _impl_.command_.add_body_primitive_ = add_body_primitive;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.add_body_primitive)
+}
+void Command::set_allocated_set_unique_id(::sapien::Renderer::server::proto::BodyIdReq* set_unique_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_unique_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_unique_id);
+    if (message_arena != submessage_arena) {
+      set_unique_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_unique_id, submessage_arena);
+    }
+    set_has_set_unique_id();
+    _impl_.command_.set_unique_id_ = set_unique_id;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_unique_id)
+}
+void Command::set_allocated_set_segmentation_id(::sapien::Renderer::server::proto::BodyIdReq* set_segmentation_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_segmentation_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_segmentation_id);
+    if (message_arena != submessage_arena) {
+      set_segmentation_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_segmentation_id, submessage_arena);
+    }
+    set_has_set_segmentation_id();
+    _impl_.command_.set_segmentation_id_ = set_segmentation_id;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_segmentation_id)
+}
+void Command::set_allocated_set_visibility(::sapien::Renderer::server::proto::BodyFloat32Req* set_visibility) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_command();
+  if (set_visibility) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_visibility);
+    if (message_arena != submessage_arena) {
+      set_visibility = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_visibility, submessage_arena);
+    }
+    set_has_set_visibility();
+    _impl_.command_.set_visibility_ = set_visibility;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Command.set_visibility)
+}
+Command::Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.Command)
+}
+Command::Command(const Command& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Command* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.provisional_id_){}
+    , decltype(_impl_.command_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.provisional_id_ = from._impl_.provisional_id_;
+  clear_has_command();
+  switch (from.command_case()) {
+    case kCreateMaterial: {
+      _this->_internal_mutable_create_material()->::sapien::Renderer::server::proto::Empty::MergeFrom(
+          from._internal_create_material());
+      break;
+    }
+    case kRemoveMaterial: {
+      _this->_internal_mutable_remove_material()->::sapien::Renderer::server::proto::Id::MergeFrom(
+          from._internal_remove_material());
+      break;
+    }
+    case kSetBaseColor: {
+      _this->_internal_mutable_set_base_color()->::sapien::Renderer::server::proto::IdVec4::MergeFrom(
+          from._internal_set_base_color());
+      break;
+    }
+    case kSetRoughness: {
+      _this->_internal_mutable_set_roughness()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_roughness());
+      break;
+    }
+    case kSetSpecular: {
+      _this->_internal_mutable_set_specular()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_specular());
+      break;
+    }
+    case kSetMetallic: {
+      _this->_internal_mutable_set_metallic()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_metallic());
+      break;
+    }
+    case kAddBodyMesh: {
+      _this->_internal_mutable_add_body_mesh()->::sapien::Renderer::server::proto::AddBodyMeshReq::MergeFrom(
+          from._internal_add_body_mesh());
+      break;
+    }
+    case kAddBodyPrimitive: {
+      _this->_internal_mutable_add_body_primitive()->::sapien::Renderer::server::proto::AddBodyPrimitiveReq::MergeFrom(
+          from._internal_add_body_primitive());
+      break;
+    }
+    case kSetUniqueId: {
+      _this->_internal_mutable_set_unique_id()->::sapien::Renderer::server::proto::BodyIdReq::MergeFrom(
+          from._internal_set_unique_id());
+      break;
+    }
+    case kSetSegmentationId: {
+      _this->_internal_mutable_set_segmentation_id()->::sapien::Renderer::server::proto::BodyIdReq::MergeFrom(
+          from._internal_set_segmentation_id());
+      break;
+    }
+    case kSetVisibility: {
+      _this->_internal_mutable_set_visibility()->::sapien::Renderer::server::proto::BodyFloat32Req::MergeFrom(
+          from._internal_set_visibility());
+      break;
+    }
+    case COMMAND_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.Command)
+}
+
+inline void Command::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.provisional_id_){uint64_t{0u}}
+    , decltype(_impl_.command_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_command();
+}
+
+Command::~Command() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.Command)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Command::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_command()) {
+    clear_command();
+  }
+}
+
+void Command::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Command::clear_command() {
+// @@protoc_insertion_point(one_of_clear_start:sapien.Renderer.server.proto.Command)
+  switch (command_case()) {
+    case kCreateMaterial: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.create_material_;
+      }
+      break;
+    }
+    case kRemoveMaterial: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.remove_material_;
+      }
+      break;
+    }
+    case kSetBaseColor: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_base_color_;
+      }
+      break;
+    }
+    case kSetRoughness: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_roughness_;
+      }
+      break;
+    }
+    case kSetSpecular: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_specular_;
+      }
+      break;
+    }
+    case kSetMetallic: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_metallic_;
+      }
+      break;
+    }
+    case kAddBodyMesh: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.add_body_mesh_;
+      }
+      break;
+    }
+    case kAddBodyPrimitive: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.add_body_primitive_;
+      }
+      break;
+    }
+    case kSetUniqueId: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_unique_id_;
+      }
+      break;
+    }
+    case kSetSegmentationId: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_segmentation_id_;
+      }
+      break;
+    }
+    case kSetVisibility: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.command_.set_visibility_;
+      }
+      break;
+    }
+    case COMMAND_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = COMMAND_NOT_SET;
+}
+
+
+void Command::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.Command)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.provisional_id_ = uint64_t{0u};
+  clear_command();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Command::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .sapien.Renderer.server.proto.Empty create_material = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_create_material(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.Id remove_material = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_remove_material(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.IdVec4 set_base_color = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_base_color(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.IdFloat set_roughness = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_roughness(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.IdFloat set_specular = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_specular(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.IdFloat set_metallic = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_metallic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.AddBodyMeshReq add_body_mesh = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_add_body_mesh(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.AddBodyPrimitiveReq add_body_primitive = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_add_body_primitive(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.BodyIdReq set_unique_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_unique_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.BodyIdReq set_segmentation_id = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_segmentation_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.BodyFloat32Req set_visibility = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_visibility(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 provisional_id = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.provisional_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Command::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.Command)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .sapien.Renderer.server.proto.Empty create_material = 1;
+  if (_internal_has_create_material()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::create_material(this),
+        _Internal::create_material(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.Id remove_material = 2;
+  if (_internal_has_remove_material()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::remove_material(this),
+        _Internal::remove_material(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.IdVec4 set_base_color = 3;
+  if (_internal_has_set_base_color()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::set_base_color(this),
+        _Internal::set_base_color(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.IdFloat set_roughness = 4;
+  if (_internal_has_set_roughness()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::set_roughness(this),
+        _Internal::set_roughness(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.IdFloat set_specular = 5;
+  if (_internal_has_set_specular()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::set_specular(this),
+        _Internal::set_specular(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.IdFloat set_metallic = 6;
+  if (_internal_has_set_metallic()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::set_metallic(this),
+        _Internal::set_metallic(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.AddBodyMeshReq add_body_mesh = 7;
+  if (_internal_has_add_body_mesh()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::add_body_mesh(this),
+        _Internal::add_body_mesh(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.AddBodyPrimitiveReq add_body_primitive = 8;
+  if (_internal_has_add_body_primitive()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::add_body_primitive(this),
+        _Internal::add_body_primitive(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.BodyIdReq set_unique_id = 9;
+  if (_internal_has_set_unique_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::set_unique_id(this),
+        _Internal::set_unique_id(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.BodyIdReq set_segmentation_id = 10;
+  if (_internal_has_set_segmentation_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::set_segmentation_id(this),
+        _Internal::set_segmentation_id(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.BodyFloat32Req set_visibility = 11;
+  if (_internal_has_set_visibility()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::set_visibility(this),
+        _Internal::set_visibility(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 provisional_id = 12;
+  if (this->_internal_provisional_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_provisional_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.Command)
+  return target;
+}
+
+size_t Command::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.Command)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 provisional_id = 12;
+  if (this->_internal_provisional_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_provisional_id());
+  }
+
+  switch (command_case()) {
+    // .sapien.Renderer.server.proto.Empty create_material = 1;
+    case kCreateMaterial: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.create_material_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.Id remove_material = 2;
+    case kRemoveMaterial: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.remove_material_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.IdVec4 set_base_color = 3;
+    case kSetBaseColor: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_base_color_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.IdFloat set_roughness = 4;
+    case kSetRoughness: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_roughness_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.IdFloat set_specular = 5;
+    case kSetSpecular: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_specular_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.IdFloat set_metallic = 6;
+    case kSetMetallic: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_metallic_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.AddBodyMeshReq add_body_mesh = 7;
+    case kAddBodyMesh: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.add_body_mesh_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.AddBodyPrimitiveReq add_body_primitive = 8;
+    case kAddBodyPrimitive: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.add_body_primitive_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.BodyIdReq set_unique_id = 9;
+    case kSetUniqueId: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_unique_id_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.BodyIdReq set_segmentation_id = 10;
+    case kSetSegmentationId: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_segmentation_id_);
+      break;
+    }
+    // .sapien.Renderer.server.proto.BodyFloat32Req set_visibility = 11;
+    case kSetVisibility: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.command_.set_visibility_);
+      break;
+    }
+    case COMMAND_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Command::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Command::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Command::GetClassData() const { return &_class_data_; }
+
+
+void Command::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Command*>(&to_msg);
+  auto& from = static_cast<const Command&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.Command)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_provisional_id() != 0) {
+    _this->_internal_set_provisional_id(from._internal_provisional_id());
+  }
+  switch (from.command_case()) {
+    case kCreateMaterial: {
+      _this->_internal_mutable_create_material()->::sapien::Renderer::server::proto::Empty::MergeFrom(
+          from._internal_create_material());
+      break;
+    }
+    case kRemoveMaterial: {
+      _this->_internal_mutable_remove_material()->::sapien::Renderer::server::proto::Id::MergeFrom(
+          from._internal_remove_material());
+      break;
+    }
+    case kSetBaseColor: {
+      _this->_internal_mutable_set_base_color()->::sapien::Renderer::server::proto::IdVec4::MergeFrom(
+          from._internal_set_base_color());
+      break;
+    }
+    case kSetRoughness: {
+      _this->_internal_mutable_set_roughness()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_roughness());
+      break;
+    }
+    case kSetSpecular: {
+      _this->_internal_mutable_set_specular()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_specular());
+      break;
+    }
+    case kSetMetallic: {
+      _this->_internal_mutable_set_metallic()->::sapien::Renderer::server::proto::IdFloat::MergeFrom(
+          from._internal_set_metallic());
+      break;
+    }
+    case kAddBodyMesh: {
+      _this->_internal_mutable_add_body_mesh()->::sapien::Renderer::server::proto::AddBodyMeshReq::MergeFrom(
+          from._internal_add_body_mesh());
+      break;
+    }
+    case kAddBodyPrimitive: {
+      _this->_internal_mutable_add_body_primitive()->::sapien::Renderer::server::proto::AddBodyPrimitiveReq::MergeFrom(
+          from._internal_add_body_primitive());
+      break;
+    }
+    case kSetUniqueId: {
+      _this->_internal_mutable_set_unique_id()->::sapien::Renderer::server::proto::BodyIdReq::MergeFrom(
+          from._internal_set_unique_id());
+      break;
+    }
+    case kSetSegmentationId: {
+      _this->_internal_mutable_set_segmentation_id()->::sapien::Renderer::server::proto::BodyIdReq::MergeFrom(
+          from._internal_set_segmentation_id());
+      break;
+    }
+    case kSetVisibility: {
+      _this->_internal_mutable_set_visibility()->::sapien::Renderer::server::proto::BodyFloat32Req::MergeFrom(
+          from._internal_set_visibility());
+      break;
+    }
+    case COMMAND_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Command::CopyFrom(const Command& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.Command)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Command::IsInitialized() const {
+  return true;
+}
+
+void Command::InternalSwap(Command* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.provisional_id_, other->_impl_.provisional_id_);
+  swap(_impl_.command_, other->_impl_.command_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Command::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[30]);
+}
+
+// ===================================================================
+
+class CommandBatchReq::_Internal {
+ public:
+};
+
+CommandBatchReq::CommandBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.CommandBatchReq)
+}
+CommandBatchReq::CommandBatchReq(const CommandBatchReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommandBatchReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.commands_){from._impl_.commands_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.CommandBatchReq)
+}
+
+inline void CommandBatchReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.commands_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommandBatchReq::~CommandBatchReq() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.CommandBatchReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommandBatchReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.commands_.~RepeatedPtrField();
+}
+
+void CommandBatchReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommandBatchReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.CommandBatchReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.commands_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommandBatchReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sapien.Renderer.server.proto.Command commands = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_commands(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommandBatchReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.CommandBatchReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .sapien.Renderer.server.proto.Command commands = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_commands_size()); i < n; i++) {
+    const auto& repfield = this->_internal_commands(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.CommandBatchReq)
+  return target;
+}
+
+size_t CommandBatchReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.CommandBatchReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sapien.Renderer.server.proto.Command commands = 1;
+  total_size += 1UL * this->_internal_commands_size();
+  for (const auto& msg : this->_impl_.commands_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommandBatchReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommandBatchReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommandBatchReq::GetClassData() const { return &_class_data_; }
+
+
+void CommandBatchReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommandBatchReq*>(&to_msg);
+  auto& from = static_cast<const CommandBatchReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.CommandBatchReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.commands_.MergeFrom(from._impl_.commands_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommandBatchReq::CopyFrom(const CommandBatchReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.CommandBatchReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommandBatchReq::IsInitialized() const {
+  return true;
+}
+
+void CommandBatchReq::InternalSwap(CommandBatchReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.commands_.InternalSwap(&other->_impl_.commands_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommandBatchReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[31]);
+}
+
+// ===================================================================
+
+class CommandBatchRes::_Internal {
+ public:
+};
+
+CommandBatchRes::CommandBatchRes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.CommandBatchRes)
+}
+CommandBatchRes::CommandBatchRes(const CommandBatchRes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommandBatchRes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.provisional_ids_){from._impl_.provisional_ids_}
+    , /*decltype(_impl_._provisional_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.ids_){from._impl_.ids_}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.CommandBatchRes)
+}
+
+inline void CommandBatchRes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.provisional_ids_){arena}
+    , /*decltype(_impl_._provisional_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.ids_){arena}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CommandBatchRes::~CommandBatchRes() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.CommandBatchRes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommandBatchRes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.provisional_ids_.~RepeatedField();
+  _impl_.ids_.~RepeatedField();
+}
+
+void CommandBatchRes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommandBatchRes::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.CommandBatchRes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.provisional_ids_.Clear();
+  _impl_.ids_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommandBatchRes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 provisional_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_provisional_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_provisional_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommandBatchRes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.CommandBatchRes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 provisional_ids = 1;
+  {
+    int byte_size = _impl_._provisional_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_provisional_ids(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 ids = 2;
+  {
+    int byte_size = _impl_._ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_ids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.CommandBatchRes)
+  return target;
+}
+
+size_t CommandBatchRes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.CommandBatchRes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 provisional_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.provisional_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._provisional_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommandBatchRes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommandBatchRes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommandBatchRes::GetClassData() const { return &_class_data_; }
+
+
+void CommandBatchRes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommandBatchRes*>(&to_msg);
+  auto& from = static_cast<const CommandBatchRes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.CommandBatchRes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.provisional_ids_.MergeFrom(from._impl_.provisional_ids_);
+  _this->_impl_.ids_.MergeFrom(from._impl_.ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommandBatchRes::CopyFrom(const CommandBatchRes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.CommandBatchRes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommandBatchRes::IsInitialized() const {
+  return true;
+}
+
+void CommandBatchRes::InternalSwap(CommandBatchRes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.provisional_ids_.InternalSwap(&other->_impl_.provisional_ids_);
+  _impl_.ids_.InternalSwap(&other->_impl_.ids_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommandBatchRes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[32]);
+}
+
+// ===================================================================
+
+class Histogram::_Internal {
+ public:
+};
+
+Histogram::Histogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.Histogram)
+}
+Histogram::Histogram(const Histogram& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Histogram* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){from._impl_.buckets_}
+    , /*decltype(_impl_._buckets_cached_byte_size_)*/{0}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_us_){}
+    , decltype(_impl_.max_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_us_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_us_));
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.Histogram)
+}
+
+inline void Histogram::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){arena}
+    , /*decltype(_impl_._buckets_cached_byte_size_)*/{0}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.sum_us_){uint64_t{0u}}
+    , decltype(_impl_.max_us_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Histogram::~Histogram() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.Histogram)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Histogram::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedField();
+}
+
+void Histogram::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Histogram::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.Histogram)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_us_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_us_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Histogram::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sum_us = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sum_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_us = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 buckets = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_buckets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_buckets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Histogram::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.Histogram)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_count(), target);
+  }
+
+  // uint64 sum_us = 2;
+  if (this->_internal_sum_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sum_us(), target);
+  }
+
+  // uint64 max_us = 3;
+  if (this->_internal_max_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_max_us(), target);
+  }
+
+  // repeated uint64 buckets = 4;
+  {
+    int byte_size = _impl_._buckets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_buckets(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.Histogram)
+  return target;
+}
+
+size_t Histogram::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.Histogram)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 buckets = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.buckets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._buckets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 sum_us = 2;
+  if (this->_internal_sum_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sum_us());
+  }
+
+  // uint64 max_us = 3;
+  if (this->_internal_max_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Histogram::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Histogram::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Histogram::GetClassData() const { return &_class_data_; }
+
+
+void Histogram::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Histogram*>(&to_msg);
+  auto& from = static_cast<const Histogram&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.Histogram)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_sum_us() != 0) {
+    _this->_internal_set_sum_us(from._internal_sum_us());
+  }
+  if (from._internal_max_us() != 0) {
+    _this->_internal_set_max_us(from._internal_max_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Histogram::CopyFrom(const Histogram& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.Histogram)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Histogram::IsInitialized() const {
+  return true;
+}
+
+void Histogram::InternalSwap(Histogram* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Histogram, _impl_.max_us_)
+      + sizeof(Histogram::_impl_.max_us_)
+      - PROTOBUF_FIELD_OFFSET(Histogram, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Histogram::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[33]);
+}
+
+// ===================================================================
+
+class MethodMetrics::_Internal {
+ public:
+  static const ::sapien::Renderer::server::proto::Histogram& latency(const MethodMetrics* msg);
+  static const ::sapien::Renderer::server::proto::Histogram& handler(const MethodMetrics* msg);
+};
+
+const ::sapien::Renderer::server::proto::Histogram&
+MethodMetrics::_Internal::latency(const MethodMetrics* msg) {
+  return *msg->_impl_.latency_;
+}
+const ::sapien::Renderer::server::proto::Histogram&
+MethodMetrics::_Internal::handler(const MethodMetrics* msg) {
+  return *msg->_impl_.handler_;
+}
+MethodMetrics::MethodMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.MethodMetrics)
+}
+MethodMetrics::MethodMetrics(const MethodMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MethodMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.latency_){nullptr}
+    , decltype(_impl_.handler_){nullptr}
+    , decltype(_impl_.errors_){}
+    , decltype(_impl_.bytes_in_){}
+    , decltype(_impl_.bytes_out_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_latency()) {
+    _this->_impl_.latency_ = new ::sapien::Renderer::server::proto::Histogram(*from._impl_.latency_);
+  }
+  if (from._internal_has_handler()) {
+    _this->_impl_.handler_ = new ::sapien::Renderer::server::proto::Histogram(*from._impl_.handler_);
+  }
+  ::memcpy(&_impl_.errors_, &from._impl_.errors_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bytes_out_) -
+    reinterpret_cast<char*>(&_impl_.errors_)) + sizeof(_impl_.bytes_out_));
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.MethodMetrics)
+}
+
+inline void MethodMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.latency_){nullptr}
+    , decltype(_impl_.handler_){nullptr}
+    , decltype(_impl_.errors_){uint64_t{0u}}
+    , decltype(_impl_.bytes_in_){uint64_t{0u}}
+    , decltype(_impl_.bytes_out_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MethodMetrics::~MethodMetrics() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.MethodMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MethodMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.latency_;
+  if (this != internal_default_instance()) delete _impl_.handler_;
+}
+
+void MethodMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MethodMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.MethodMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.handler_ != nullptr) {
+    delete _impl_.handler_;
+  }
+  _impl_.handler_ = nullptr;
+  ::memset(&_impl_.errors_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bytes_out_) -
+      reinterpret_cast<char*>(&_impl_.errors_)) + sizeof(_impl_.bytes_out_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MethodMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sapien.Renderer.server.proto.MethodMetrics.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.Histogram latency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_latency(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.Histogram handler = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_handler(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 errors = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.errors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_in = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bytes_in_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_out = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.bytes_out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MethodMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.MethodMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sapien.Renderer.server.proto.MethodMetrics.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  if (this->_internal_has_latency()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::latency(this),
+        _Internal::latency(this).GetCachedSize(), target, stream);
+  }
+
+  // .sapien.Renderer.server.proto.Histogram handler = 3;
+  if (this->_internal_has_handler()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::handler(this),
+        _Internal::handler(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 errors = 4;
+  if (this->_internal_errors() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_errors(), target);
+  }
+
+  // uint64 bytes_in = 5;
+  if (this->_internal_bytes_in() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_bytes_in(), target);
+  }
+
+  // uint64 bytes_out = 6;
+  if (this->_internal_bytes_out() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_bytes_out(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.MethodMetrics)
+  return target;
+}
+
+size_t MethodMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.MethodMetrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  if (this->_internal_has_latency()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.latency_);
+  }
+
+  // .sapien.Renderer.server.proto.Histogram handler = 3;
+  if (this->_internal_has_handler()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.handler_);
+  }
+
+  // uint64 errors = 4;
+  if (this->_internal_errors() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_errors());
+  }
+
+  // uint64 bytes_in = 5;
+  if (this->_internal_bytes_in() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_in());
+  }
+
+  // uint64 bytes_out = 6;
+  if (this->_internal_bytes_out() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_out());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MethodMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MethodMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MethodMetrics::GetClassData() const { return &_class_data_; }
+
+
+void MethodMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MethodMetrics*>(&to_msg);
+  auto& from = static_cast<const MethodMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.MethodMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_latency()) {
+    _this->_internal_mutable_latency()->::sapien::Renderer::server::proto::Histogram::MergeFrom(
+        from._internal_latency());
+  }
+  if (from._internal_has_handler()) {
+    _this->_internal_mutable_handler()->::sapien::Renderer::server::proto::Histogram::MergeFrom(
+        from._internal_handler());
+  }
+  if (from._internal_errors() != 0) {
+    _this->_internal_set_errors(from._internal_errors());
+  }
+  if (from._internal_bytes_in() != 0) {
+    _this->_internal_set_bytes_in(from._internal_bytes_in());
+  }
+  if (from._internal_bytes_out() != 0) {
+    _this->_internal_set_bytes_out(from._internal_bytes_out());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MethodMetrics::CopyFrom(const MethodMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.MethodMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MethodMetrics::IsInitialized() const {
+  return true;
+}
+
+void MethodMetrics::InternalSwap(MethodMetrics* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MethodMetrics, _impl_.bytes_out_)
+      + sizeof(MethodMetrics::_impl_.bytes_out_)
+      - PROTOBUF_FIELD_OFFSET(MethodMetrics, _impl_.latency_)>(
+          reinterpret_cast<char*>(&_impl_.latency_),
+          reinterpret_cast<char*>(&other->_impl_.latency_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MethodMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[34]);
+}
+
+// ===================================================================
+
+class StageMetrics::_Internal {
+ public:
+  static const ::sapien::Renderer::server::proto::Histogram& latency(const StageMetrics* msg);
+};
+
+const ::sapien::Renderer::server::proto::Histogram&
+StageMetrics::_Internal::latency(const StageMetrics* msg) {
+  return *msg->_impl_.latency_;
+}
+StageMetrics::StageMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.StageMetrics)
+}
+StageMetrics::StageMetrics(const StageMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StageMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.latency_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_latency()) {
+    _this->_impl_.latency_ = new ::sapien::Renderer::server::proto::Histogram(*from._impl_.latency_);
+  }
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.StageMetrics)
+}
+
+inline void StageMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.latency_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StageMetrics::~StageMetrics() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.StageMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StageMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.latency_;
+}
+
+void StageMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StageMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.StageMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StageMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sapien.Renderer.server.proto.StageMetrics.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .sapien.Renderer.server.proto.Histogram latency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_latency(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StageMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.StageMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sapien.Renderer.server.proto.StageMetrics.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  if (this->_internal_has_latency()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::latency(this),
+        _Internal::latency(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.StageMetrics)
+  return target;
+}
+
+size_t StageMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.StageMetrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  if (this->_internal_has_latency()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.latency_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StageMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StageMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StageMetrics::GetClassData() const { return &_class_data_; }
+
+
+void StageMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StageMetrics*>(&to_msg);
+  auto& from = static_cast<const StageMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.StageMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_latency()) {
+    _this->_internal_mutable_latency()->::sapien::Renderer::server::proto::Histogram::MergeFrom(
+        from._internal_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StageMetrics::CopyFrom(const StageMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.StageMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StageMetrics::IsInitialized() const {
+  return true;
+}
+
+void StageMetrics::InternalSwap(StageMetrics* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.latency_, other->_impl_.latency_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StageMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[35]);
+}
+
+// ===================================================================
+
+class SceneMetrics::_Internal {
+ public:
+};
+
+SceneMetrics::SceneMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.SceneMetrics)
+}
+SceneMetrics::SceneMetrics(const SceneMetrics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SceneMetrics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.scene_id_){}
+    , decltype(_impl_.scene_index_){}
+    , decltype(_impl_.frames_){}
+    , decltype(_impl_.pictures_){}
+    , decltype(_impl_.pending_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.scene_id_, &from._impl_.scene_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pending_) -
+    reinterpret_cast<char*>(&_impl_.scene_id_)) + sizeof(_impl_.pending_));
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.SceneMetrics)
+}
+
+inline void SceneMetrics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.scene_id_){uint64_t{0u}}
+    , decltype(_impl_.scene_index_){uint64_t{0u}}
+    , decltype(_impl_.frames_){uint64_t{0u}}
+    , decltype(_impl_.pictures_){uint64_t{0u}}
+    , decltype(_impl_.pending_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SceneMetrics::~SceneMetrics() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.SceneMetrics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SceneMetrics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SceneMetrics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SceneMetrics::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.SceneMetrics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.scene_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pending_) -
+      reinterpret_cast<char*>(&_impl_.scene_id_)) + sizeof(_impl_.pending_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SceneMetrics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 scene_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.scene_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 scene_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.scene_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 frames = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 pictures = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.pictures_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 pending = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.pending_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SceneMetrics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.SceneMetrics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 scene_id = 1;
+  if (this->_internal_scene_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_scene_id(), target);
+  }
+
+  // uint64 scene_index = 2;
+  if (this->_internal_scene_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_scene_index(), target);
+  }
+
+  // uint64 frames = 3;
+  if (this->_internal_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_frames(), target);
+  }
+
+  // uint64 pictures = 4;
+  if (this->_internal_pictures() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_pictures(), target);
+  }
+
+  // uint32 pending = 5;
+  if (this->_internal_pending() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_pending(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.SceneMetrics)
+  return target;
+}
+
+size_t SceneMetrics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.SceneMetrics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 scene_id = 1;
+  if (this->_internal_scene_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scene_id());
+  }
+
+  // uint64 scene_index = 2;
+  if (this->_internal_scene_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scene_index());
+  }
+
+  // uint64 frames = 3;
+  if (this->_internal_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_frames());
+  }
+
+  // uint64 pictures = 4;
+  if (this->_internal_pictures() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_pictures());
+  }
+
+  // uint32 pending = 5;
+  if (this->_internal_pending() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pending());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SceneMetrics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SceneMetrics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SceneMetrics::GetClassData() const { return &_class_data_; }
+
+
+void SceneMetrics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SceneMetrics*>(&to_msg);
+  auto& from = static_cast<const SceneMetrics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.SceneMetrics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_scene_id() != 0) {
+    _this->_internal_set_scene_id(from._internal_scene_id());
+  }
+  if (from._internal_scene_index() != 0) {
+    _this->_internal_set_scene_index(from._internal_scene_index());
+  }
+  if (from._internal_frames() != 0) {
+    _this->_internal_set_frames(from._internal_frames());
+  }
+  if (from._internal_pictures() != 0) {
+    _this->_internal_set_pictures(from._internal_pictures());
+  }
+  if (from._internal_pending() != 0) {
+    _this->_internal_set_pending(from._internal_pending());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SceneMetrics::CopyFrom(const SceneMetrics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.SceneMetrics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SceneMetrics::IsInitialized() const {
+  return true;
+}
+
+void SceneMetrics::InternalSwap(SceneMetrics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SceneMetrics, _impl_.pending_)
+      + sizeof(SceneMetrics::_impl_.pending_)
+      - PROTOBUF_FIELD_OFFSET(SceneMetrics, _impl_.scene_id_)>(
+          reinterpret_cast<char*>(&_impl_.scene_id_),
+          reinterpret_cast<char*>(&other->_impl_.scene_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SceneMetrics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[36]);
+}
+
+// ===================================================================
+
+class MetricsRes::_Internal {
+ public:
+};
+
+MetricsRes::MetricsRes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sapien.Renderer.server.proto.MetricsRes)
+}
+MetricsRes::MetricsRes(const MetricsRes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricsRes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.methods_){from._impl_.methods_}
+    , decltype(_impl_.stages_){from._impl_.stages_}
+    , decltype(_impl_.scenes_){from._impl_.scenes_}
+    , decltype(_impl_.uptime_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.uptime_us_ = from._impl_.uptime_us_;
+  // @@protoc_insertion_point(copy_constructor:sapien.Renderer.server.proto.MetricsRes)
+}
+
+inline void MetricsRes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.methods_){arena}
+    , decltype(_impl_.stages_){arena}
+    , decltype(_impl_.scenes_){arena}
+    , decltype(_impl_.uptime_us_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MetricsRes::~MetricsRes() {
+  // @@protoc_insertion_point(destructor:sapien.Renderer.server.proto.MetricsRes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricsRes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.methods_.~RepeatedPtrField();
+  _impl_.stages_.~RepeatedPtrField();
+  _impl_.scenes_.~RepeatedPtrField();
+}
+
+void MetricsRes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricsRes::Clear() {
+// @@protoc_insertion_point(message_clear_start:sapien.Renderer.server.proto.MetricsRes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.methods_.Clear();
+  _impl_.stages_.Clear();
+  _impl_.scenes_.Clear();
+  _impl_.uptime_us_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricsRes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 uptime_us = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.uptime_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sapien.Renderer.server.proto.MethodMetrics methods = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_methods(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sapien.Renderer.server.proto.StageMetrics stages = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sapien.Renderer.server.proto.SceneMetrics scenes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scenes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricsRes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sapien.Renderer.server.proto.MetricsRes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 uptime_us = 1;
+  if (this->_internal_uptime_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_uptime_us(), target);
+  }
+
+  // repeated .sapien.Renderer.server.proto.MethodMetrics methods = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_methods_size()); i < n; i++) {
+    const auto& repfield = this->_internal_methods(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .sapien.Renderer.server.proto.StageMetrics stages = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .sapien.Renderer.server.proto.SceneMetrics scenes = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scenes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scenes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sapien.Renderer.server.proto.MetricsRes)
+  return target;
+}
+
+size_t MetricsRes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sapien.Renderer.server.proto.MetricsRes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sapien.Renderer.server.proto.MethodMetrics methods = 2;
+  total_size += 1UL * this->_internal_methods_size();
+  for (const auto& msg : this->_impl_.methods_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .sapien.Renderer.server.proto.StageMetrics stages = 3;
+  total_size += 1UL * this->_internal_stages_size();
+  for (const auto& msg : this->_impl_.stages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .sapien.Renderer.server.proto.SceneMetrics scenes = 4;
+  total_size += 1UL * this->_internal_scenes_size();
+  for (const auto& msg : this->_impl_.scenes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 uptime_us = 1;
+  if (this->_internal_uptime_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_uptime_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricsRes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricsRes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricsRes::GetClassData() const { return &_class_data_; }
+
+
+void MetricsRes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricsRes*>(&to_msg);
+  auto& from = static_cast<const MetricsRes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sapien.Renderer.server.proto.MetricsRes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.methods_.MergeFrom(from._impl_.methods_);
+  _this->_impl_.stages_.MergeFrom(from._impl_.stages_);
+  _this->_impl_.scenes_.MergeFrom(from._impl_.scenes_);
+  if (from._internal_uptime_us() != 0) {
+    _this->_internal_set_uptime_us(from._internal_uptime_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricsRes::CopyFrom(const MetricsRes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sapien.Renderer.server.proto.MetricsRes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricsRes::IsInitialized() const {
+  return true;
+}
+
+void MetricsRes::InternalSwap(MetricsRes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.methods_.InternalSwap(&other->_impl_.methods_);
+  _impl_.stages_.InternalSwap(&other->_impl_.stages_);
+  _impl_.scenes_.InternalSwap(&other->_impl_.scenes_);
+  swap(_impl_.uptime_us_, other->_impl_.uptime_us_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricsRes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_render_5fserver_2eproto_getter, &descriptor_table_render_5fserver_2eproto_once,
+      file_level_metadata_render_5fserver_2eproto[37]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace proto
+}  // namespace server
+}  // namespace Renderer
+}  // namespace sapien
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Empty*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Empty >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Empty >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Uint32*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Uint32 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Uint32 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Index*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Index >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Index >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Id*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Id >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Id >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Vec3*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Vec3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Vec3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Vec4*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Vec4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Vec4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Quat*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Quat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Quat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Pose*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Pose >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Pose >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdVec3*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdVec3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdVec3 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdVec4*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdVec4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdVec4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::IdFloat*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::IdFloat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::IdFloat >(arena);
 }
 template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::AddBodyMeshReq*
 Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::AddBodyMeshReq >(Arena* arena) {
@@ -8269,6 +11883,46 @@ template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::BodyReq*
 Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::BodyReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::BodyReq >(arena);
 }
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::UpdateRenderBatchReq*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::UpdateRenderBatchReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::UpdateRenderBatchReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::AttachSharedMemoryReq*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::AttachSharedMemoryReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::AttachSharedMemoryReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Command*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Command >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Command >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::CommandBatchReq*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::CommandBatchReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::CommandBatchReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::CommandBatchRes*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::CommandBatchRes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::CommandBatchRes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::Histogram*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::Histogram >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::Histogram >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::MethodMetrics*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::MethodMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::MethodMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::StageMetrics*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::StageMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::StageMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::SceneMetrics*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::SceneMetrics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::SceneMetrics >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sapien::Renderer::server::proto::MetricsRes*
+Arena::CreateMaybeMessage< ::sapien::Renderer::server::proto::MetricsRes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sapien::Renderer::server::proto::MetricsRes >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021006 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -65,6 +65,9 @@ extern AddDirectionalLightReqDefaultTypeInternal _AddDirectionalLightReq_default
 class AddPointLightReq;
 struct AddPointLightReqDefaultTypeInternal;
 extern AddPointLightReqDefaultTypeInternal _AddPointLightReq_default_instance_;
+class AttachSharedMemoryReq;
+struct AttachSharedMemoryReqDefaultTypeInternal;
+extern AttachSharedMemoryReqDefaultTypeInternal _AttachSharedMemoryReq_default_instance_;
 class BodyFloat32Req;
 struct BodyFloat32ReqDefaultTypeInternal;
 extern BodyFloat32ReqDefaultTypeInternal _BodyFloat32Req_default_instance_;
@@ -80,12 +83,24 @@ extern BodyUint32ReqDefaultTypeInternal _BodyUint32Req_default_instance_;
 class CameraParamsReq;
 struct CameraParamsReqDefaultTypeInternal;
 extern CameraParamsReqDefaultTypeInternal _CameraParamsReq_default_instance_;
+class Command;
+struct CommandDefaultTypeInternal;
+extern CommandDefaultTypeInternal _Command_default_instance_;
+class CommandBatchReq;
+struct CommandBatchReqDefaultTypeInternal;
+extern CommandBatchReqDefaultTypeInternal _CommandBatchReq_default_instance_;
+class CommandBatchRes;
+struct CommandBatchResDefaultTypeInternal;
+extern CommandBatchResDefaultTypeInternal _CommandBatchRes_default_instance_;
 class Empty;
 struct EmptyDefaultTypeInternal;
 extern EmptyDefaultTypeInternal _Empty_default_instance_;
 class EntityOrderReq;
 struct EntityOrderReqDefaultTypeInternal;
 extern EntityOrderReqDefaultTypeInternal _EntityOrderReq_default_instance_;
+class Histogram;
+struct HistogramDefaultTypeInternal;
+extern HistogramDefaultTypeInternal _Histogram_default_instance_;
 class Id;
 struct IdDefaultTypeInternal;
 extern IdDefaultTypeInternal _Id_default_instance_;
@@ -101,6 +116,12 @@ extern IdVec4DefaultTypeInternal _IdVec4_default_instance_;
 class Index;
 struct IndexDefaultTypeInternal;
 extern IndexDefaultTypeInternal _Index_default_instance_;
+class MethodMetrics;
+struct MethodMetricsDefaultTypeInternal;
+extern MethodMetricsDefaultTypeInternal _MethodMetrics_default_instance_;
+class MetricsRes;
+struct MetricsResDefaultTypeInternal;
+extern MetricsResDefaultTypeInternal _MetricsRes_default_instance_;
 class Pose;
 struct PoseDefaultTypeInternal;
 extern PoseDefaultTypeInternal _Pose_default_instance_;
@@ -116,6 +137,12 @@ extern RemoveCameraReqDefaultTypeInternal _RemoveCameraReq_default_instance_;
 class RemoveLightReq;
 struct RemoveLightReqDefaultTypeInternal;
 extern RemoveLightReqDefaultTypeInternal _RemoveLightReq_default_instance_;
+class SceneMetrics;
+struct SceneMetricsDefaultTypeInternal;
+extern SceneMetricsDefaultTypeInternal _SceneMetrics_default_instance_;
+class StageMetrics;
+struct StageMetricsDefaultTypeInternal;
+extern StageMetricsDefaultTypeInternal _StageMetrics_default_instance_;
 class TakePictureReq;
 struct TakePictureReqDefaultTypeInternal;
 extern TakePictureReqDefaultTypeInternal _TakePictureReq_default_instance_;
@@ -125,6 +152,9 @@ extern Uint32DefaultTypeInternal _Uint32_default_instance_;
 class UpdateRenderAndTakePicturesReq;
 struct UpdateRenderAndTakePicturesReqDefaultTypeInternal;
 extern UpdateRenderAndTakePicturesReqDefaultTypeInternal _UpdateRenderAndTakePicturesReq_default_instance_;
+class UpdateRenderBatchReq;
+struct UpdateRenderBatchReqDefaultTypeInternal;
+extern UpdateRenderBatchReqDefaultTypeInternal _UpdateRenderBatchReq_default_instance_;
 class UpdateRenderReq;
 struct UpdateRenderReqDefaultTypeInternal;
 extern UpdateRenderReqDefaultTypeInternal _UpdateRenderReq_default_instance_;
@@ -144,26 +174,36 @@ template<> ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* Arena::Create
 template<> ::sapien::Renderer::server::proto::AddCameraReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::AddCameraReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::AddDirectionalLightReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::AddDirectionalLightReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::AddPointLightReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::AddPointLightReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::AttachSharedMemoryReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::AttachSharedMemoryReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::BodyFloat32Req* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::BodyFloat32Req>(Arena*);
 template<> ::sapien::Renderer::server::proto::BodyIdReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::BodyIdReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::BodyReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::BodyReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::BodyUint32Req* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::BodyUint32Req>(Arena*);
 template<> ::sapien::Renderer::server::proto::CameraParamsReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::CameraParamsReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::Command* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Command>(Arena*);
+template<> ::sapien::Renderer::server::proto::CommandBatchReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::CommandBatchReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::CommandBatchRes* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::CommandBatchRes>(Arena*);
 template<> ::sapien::Renderer::server::proto::Empty* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Empty>(Arena*);
 template<> ::sapien::Renderer::server::proto::EntityOrderReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::EntityOrderReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::Histogram* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Histogram>(Arena*);
 template<> ::sapien::Renderer::server::proto::Id* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Id>(Arena*);
 template<> ::sapien::Renderer::server::proto::IdFloat* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::IdFloat>(Arena*);
 template<> ::sapien::Renderer::server::proto::IdVec3* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::IdVec3>(Arena*);
 template<> ::sapien::Renderer::server::proto::IdVec4* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::IdVec4>(Arena*);
 template<> ::sapien::Renderer::server::proto::Index* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Index>(Arena*);
+template<> ::sapien::Renderer::server::proto::MethodMetrics* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::MethodMetrics>(Arena*);
+template<> ::sapien::Renderer::server::proto::MetricsRes* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::MetricsRes>(Arena*);
 template<> ::sapien::Renderer::server::proto::Pose* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Pose>(Arena*);
 template<> ::sapien::Renderer::server::proto::Quat* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Quat>(Arena*);
 template<> ::sapien::Renderer::server::proto::RemoveBodyReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::RemoveBodyReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::RemoveCameraReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::RemoveCameraReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::RemoveLightReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::RemoveLightReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::SceneMetrics* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::SceneMetrics>(Arena*);
+template<> ::sapien::Renderer::server::proto::StageMetrics* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::StageMetrics>(Arena*);
 template<> ::sapien::Renderer::server::proto::TakePictureReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::TakePictureReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::Uint32* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Uint32>(Arena*);
 template<> ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq>(Arena*);
+template<> ::sapien::Renderer::server::proto::UpdateRenderBatchReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::UpdateRenderBatchReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::UpdateRenderReq* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::UpdateRenderReq>(Arena*);
 template<> ::sapien::Renderer::server::proto::Vec3* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(Arena*);
 template<> ::sapien::Renderer::server::proto::Vec4* Arena::CreateMaybeMessage<::sapien::Renderer::server::proto::Vec4>(Arena*);
@@ -3854,6 +3894,8 @@ class UpdateRenderReq final :
   enum : int {
     kBodyPosesFieldNumber = 2,
     kCameraPosesFieldNumber = 3,
+    kBodyPoseDataFieldNumber = 4,
+    kCameraPoseDataFieldNumber = 5,
     kSceneIdFieldNumber = 1,
   };
   // repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
@@ -3892,6 +3934,50 @@ class UpdateRenderReq final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
       camera_poses() const;
 
+  // repeated float body_pose_data = 4;
+  int body_pose_data_size() const;
+  private:
+  int _internal_body_pose_data_size() const;
+  public:
+  void clear_body_pose_data();
+  private:
+  float _internal_body_pose_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_body_pose_data() const;
+  void _internal_add_body_pose_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_body_pose_data();
+  public:
+  float body_pose_data(int index) const;
+  void set_body_pose_data(int index, float value);
+  void add_body_pose_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      body_pose_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_body_pose_data();
+
+  // repeated float camera_pose_data = 5;
+  int camera_pose_data_size() const;
+  private:
+  int _internal_camera_pose_data_size() const;
+  public:
+  void clear_camera_pose_data();
+  private:
+  float _internal_camera_pose_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_camera_pose_data() const;
+  void _internal_add_camera_pose_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_camera_pose_data();
+  public:
+  float camera_pose_data(int index) const;
+  void set_camera_pose_data(int index, float value);
+  void add_camera_pose_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      camera_pose_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_camera_pose_data();
+
   // uint64 scene_id = 1;
   void clear_scene_id();
   uint64_t scene_id() const;
@@ -3911,6 +3997,8 @@ class UpdateRenderReq final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose > body_poses_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose > camera_poses_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > body_pose_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > camera_pose_data_;
     uint64_t scene_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -4712,6 +4800,8 @@ class UpdateRenderAndTakePicturesReq final :
     kBodyPosesFieldNumber = 2,
     kCameraPosesFieldNumber = 3,
     kCameraIdsFieldNumber = 4,
+    kBodyPoseDataFieldNumber = 5,
+    kCameraPoseDataFieldNumber = 6,
     kSceneIdFieldNumber = 1,
   };
   // repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
@@ -4772,6 +4862,50 @@ class UpdateRenderAndTakePicturesReq final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_camera_ids();
 
+  // repeated float body_pose_data = 5;
+  int body_pose_data_size() const;
+  private:
+  int _internal_body_pose_data_size() const;
+  public:
+  void clear_body_pose_data();
+  private:
+  float _internal_body_pose_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_body_pose_data() const;
+  void _internal_add_body_pose_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_body_pose_data();
+  public:
+  float body_pose_data(int index) const;
+  void set_body_pose_data(int index, float value);
+  void add_body_pose_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      body_pose_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_body_pose_data();
+
+  // repeated float camera_pose_data = 6;
+  int camera_pose_data_size() const;
+  private:
+  int _internal_camera_pose_data_size() const;
+  public:
+  void clear_camera_pose_data();
+  private:
+  float _internal_camera_pose_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_camera_pose_data() const;
+  void _internal_add_camera_pose_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_camera_pose_data();
+  public:
+  float camera_pose_data(int index) const;
+  void set_camera_pose_data(int index, float value);
+  void add_camera_pose_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      camera_pose_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_camera_pose_data();
+
   // uint64 scene_id = 1;
   void clear_scene_id();
   uint64_t scene_id() const;
@@ -4793,6 +4927,8 @@ class UpdateRenderAndTakePicturesReq final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose > camera_poses_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > camera_ids_;
     mutable std::atomic<int> _camera_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > body_pose_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > camera_pose_data_;
     uint64_t scene_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -5194,364 +5330,3768 @@ class BodyReq final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_render_5fserver_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class UpdateRenderBatchReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.UpdateRenderBatchReq) */ {
+ public:
+  inline UpdateRenderBatchReq() : UpdateRenderBatchReq(nullptr) {}
+  ~UpdateRenderBatchReq() override;
+  explicit PROTOBUF_CONSTEXPR UpdateRenderBatchReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Empty
+  UpdateRenderBatchReq(const UpdateRenderBatchReq& from);
+  UpdateRenderBatchReq(UpdateRenderBatchReq&& from) noexcept
+    : UpdateRenderBatchReq() {
+    *this = ::std::move(from);
+  }
 
-// -------------------------------------------------------------------
+  inline UpdateRenderBatchReq& operator=(const UpdateRenderBatchReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateRenderBatchReq& operator=(UpdateRenderBatchReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// Uint32
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateRenderBatchReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateRenderBatchReq* internal_default_instance() {
+    return reinterpret_cast<const UpdateRenderBatchReq*>(
+               &_UpdateRenderBatchReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
 
-// uint32 value = 1;
-inline void Uint32::clear_value() {
-  _impl_.value_ = 0u;
-}
-inline uint32_t Uint32::_internal_value() const {
-  return _impl_.value_;
-}
-inline uint32_t Uint32::value() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Uint32.value)
-  return _internal_value();
-}
-inline void Uint32::_internal_set_value(uint32_t value) {
-  
-  _impl_.value_ = value;
-}
-inline void Uint32::set_value(uint32_t value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Uint32.value)
-}
+  friend void swap(UpdateRenderBatchReq& a, UpdateRenderBatchReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpdateRenderBatchReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateRenderBatchReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// Index
+  UpdateRenderBatchReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateRenderBatchReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateRenderBatchReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateRenderBatchReq& from) {
+    UpdateRenderBatchReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// uint64 index = 1;
-inline void Index::clear_index() {
-  _impl_.index_ = uint64_t{0u};
-}
-inline uint64_t Index::_internal_index() const {
-  return _impl_.index_;
-}
-inline uint64_t Index::index() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Index.index)
-  return _internal_index();
-}
-inline void Index::_internal_set_index(uint64_t value) {
-  
-  _impl_.index_ = value;
-}
-inline void Index::set_index(uint64_t value) {
-  _internal_set_index(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Index.index)
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// -------------------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpdateRenderBatchReq* other);
 
-// Id
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.UpdateRenderBatchReq";
+  }
+  protected:
+  explicit UpdateRenderBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// uint64 id = 1;
-inline void Id::clear_id() {
-  _impl_.id_ = uint64_t{0u};
-}
-inline uint64_t Id::_internal_id() const {
-  return _impl_.id_;
-}
-inline uint64_t Id::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Id.id)
-  return _internal_id();
-}
-inline void Id::_internal_set_id(uint64_t value) {
-  
-  _impl_.id_ = value;
-}
-inline void Id::set_id(uint64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Id.id)
-}
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-// -------------------------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-// Vec3
+  // nested types ----------------------------------------------------
 
-// float x = 1;
-inline void Vec3::clear_x() {
-  _impl_.x_ = 0;
-}
-inline float Vec3::_internal_x() const {
-  return _impl_.x_;
-}
-inline float Vec3::x() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.x)
-  return _internal_x();
-}
-inline void Vec3::_internal_set_x(float value) {
-  
-  _impl_.x_ = value;
-}
-inline void Vec3::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.x)
-}
+  // accessors -------------------------------------------------------
 
-// float y = 2;
-inline void Vec3::clear_y() {
-  _impl_.y_ = 0;
-}
-inline float Vec3::_internal_y() const {
-  return _impl_.y_;
-}
-inline float Vec3::y() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.y)
-  return _internal_y();
-}
-inline void Vec3::_internal_set_y(float value) {
-  
-  _impl_.y_ = value;
-}
-inline void Vec3::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.y)
-}
+  enum : int {
+    kScenesFieldNumber = 1,
+  };
+  // repeated .sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq scenes = 1;
+  int scenes_size() const;
+  private:
+  int _internal_scenes_size() const;
+  public:
+  void clear_scenes();
+  ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* mutable_scenes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq >*
+      mutable_scenes();
+  private:
+  const ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq& _internal_scenes(int index) const;
+  ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* _internal_add_scenes();
+  public:
+  const ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq& scenes(int index) const;
+  ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* add_scenes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq >&
+      scenes() const;
 
-// float z = 3;
-inline void Vec3::clear_z() {
-  _impl_.z_ = 0;
-}
-inline float Vec3::_internal_z() const {
-  return _impl_.z_;
-}
-inline float Vec3::z() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.z)
-  return _internal_z();
-}
-inline void Vec3::_internal_set_z(float value) {
-  
-  _impl_.z_ = value;
-}
-inline void Vec3::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.z)
-}
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.UpdateRenderBatchReq)
+ private:
+  class _Internal;
 
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq > scenes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
 // -------------------------------------------------------------------
 
-// Vec4
+class AttachSharedMemoryReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.AttachSharedMemoryReq) */ {
+ public:
+  inline AttachSharedMemoryReq() : AttachSharedMemoryReq(nullptr) {}
+  ~AttachSharedMemoryReq() override;
+  explicit PROTOBUF_CONSTEXPR AttachSharedMemoryReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// float x = 1;
-inline void Vec4::clear_x() {
-  _impl_.x_ = 0;
-}
-inline float Vec4::_internal_x() const {
-  return _impl_.x_;
+  AttachSharedMemoryReq(const AttachSharedMemoryReq& from);
+  AttachSharedMemoryReq(AttachSharedMemoryReq&& from) noexcept
+    : AttachSharedMemoryReq() {
+    *this = ::std::move(from);
+  }
+
+  inline AttachSharedMemoryReq& operator=(const AttachSharedMemoryReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttachSharedMemoryReq& operator=(AttachSharedMemoryReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AttachSharedMemoryReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AttachSharedMemoryReq* internal_default_instance() {
+    return reinterpret_cast<const AttachSharedMemoryReq*>(
+               &_AttachSharedMemoryReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(AttachSharedMemoryReq& a, AttachSharedMemoryReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttachSharedMemoryReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AttachSharedMemoryReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AttachSharedMemoryReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AttachSharedMemoryReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AttachSharedMemoryReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AttachSharedMemoryReq& from) {
+    AttachSharedMemoryReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttachSharedMemoryReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.AttachSharedMemoryReq";
+  }
+  protected:
+  explicit AttachSharedMemoryReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kSceneIdFieldNumber = 1,
+  };
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 scene_id = 1;
+  void clear_scene_id();
+  uint64_t scene_id() const;
+  void set_scene_id(uint64_t value);
+  private:
+  uint64_t _internal_scene_id() const;
+  void _internal_set_scene_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.AttachSharedMemoryReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t scene_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Command final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.Command) */ {
+ public:
+  inline Command() : Command(nullptr) {}
+  ~Command() override;
+  explicit PROTOBUF_CONSTEXPR Command(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Command(const Command& from);
+  Command(Command&& from) noexcept
+    : Command() {
+    *this = ::std::move(from);
+  }
+
+  inline Command& operator=(const Command& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Command& operator=(Command&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Command& default_instance() {
+    return *internal_default_instance();
+  }
+  enum CommandCase {
+    kCreateMaterial = 1,
+    kRemoveMaterial = 2,
+    kSetBaseColor = 3,
+    kSetRoughness = 4,
+    kSetSpecular = 5,
+    kSetMetallic = 6,
+    kAddBodyMesh = 7,
+    kAddBodyPrimitive = 8,
+    kSetUniqueId = 9,
+    kSetSegmentationId = 10,
+    kSetVisibility = 11,
+    COMMAND_NOT_SET = 0,
+  };
+
+  static inline const Command* internal_default_instance() {
+    return reinterpret_cast<const Command*>(
+               &_Command_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(Command& a, Command& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Command* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Command* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Command* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Command>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Command& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Command& from) {
+    Command::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Command* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.Command";
+  }
+  protected:
+  explicit Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProvisionalIdFieldNumber = 12,
+    kCreateMaterialFieldNumber = 1,
+    kRemoveMaterialFieldNumber = 2,
+    kSetBaseColorFieldNumber = 3,
+    kSetRoughnessFieldNumber = 4,
+    kSetSpecularFieldNumber = 5,
+    kSetMetallicFieldNumber = 6,
+    kAddBodyMeshFieldNumber = 7,
+    kAddBodyPrimitiveFieldNumber = 8,
+    kSetUniqueIdFieldNumber = 9,
+    kSetSegmentationIdFieldNumber = 10,
+    kSetVisibilityFieldNumber = 11,
+  };
+  // uint64 provisional_id = 12;
+  void clear_provisional_id();
+  uint64_t provisional_id() const;
+  void set_provisional_id(uint64_t value);
+  private:
+  uint64_t _internal_provisional_id() const;
+  void _internal_set_provisional_id(uint64_t value);
+  public:
+
+  // .sapien.Renderer.server.proto.Empty create_material = 1;
+  bool has_create_material() const;
+  private:
+  bool _internal_has_create_material() const;
+  public:
+  void clear_create_material();
+  const ::sapien::Renderer::server::proto::Empty& create_material() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::Empty* release_create_material();
+  ::sapien::Renderer::server::proto::Empty* mutable_create_material();
+  void set_allocated_create_material(::sapien::Renderer::server::proto::Empty* create_material);
+  private:
+  const ::sapien::Renderer::server::proto::Empty& _internal_create_material() const;
+  ::sapien::Renderer::server::proto::Empty* _internal_mutable_create_material();
+  public:
+  void unsafe_arena_set_allocated_create_material(
+      ::sapien::Renderer::server::proto::Empty* create_material);
+  ::sapien::Renderer::server::proto::Empty* unsafe_arena_release_create_material();
+
+  // .sapien.Renderer.server.proto.Id remove_material = 2;
+  bool has_remove_material() const;
+  private:
+  bool _internal_has_remove_material() const;
+  public:
+  void clear_remove_material();
+  const ::sapien::Renderer::server::proto::Id& remove_material() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::Id* release_remove_material();
+  ::sapien::Renderer::server::proto::Id* mutable_remove_material();
+  void set_allocated_remove_material(::sapien::Renderer::server::proto::Id* remove_material);
+  private:
+  const ::sapien::Renderer::server::proto::Id& _internal_remove_material() const;
+  ::sapien::Renderer::server::proto::Id* _internal_mutable_remove_material();
+  public:
+  void unsafe_arena_set_allocated_remove_material(
+      ::sapien::Renderer::server::proto::Id* remove_material);
+  ::sapien::Renderer::server::proto::Id* unsafe_arena_release_remove_material();
+
+  // .sapien.Renderer.server.proto.IdVec4 set_base_color = 3;
+  bool has_set_base_color() const;
+  private:
+  bool _internal_has_set_base_color() const;
+  public:
+  void clear_set_base_color();
+  const ::sapien::Renderer::server::proto::IdVec4& set_base_color() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::IdVec4* release_set_base_color();
+  ::sapien::Renderer::server::proto::IdVec4* mutable_set_base_color();
+  void set_allocated_set_base_color(::sapien::Renderer::server::proto::IdVec4* set_base_color);
+  private:
+  const ::sapien::Renderer::server::proto::IdVec4& _internal_set_base_color() const;
+  ::sapien::Renderer::server::proto::IdVec4* _internal_mutable_set_base_color();
+  public:
+  void unsafe_arena_set_allocated_set_base_color(
+      ::sapien::Renderer::server::proto::IdVec4* set_base_color);
+  ::sapien::Renderer::server::proto::IdVec4* unsafe_arena_release_set_base_color();
+
+  // .sapien.Renderer.server.proto.IdFloat set_roughness = 4;
+  bool has_set_roughness() const;
+  private:
+  bool _internal_has_set_roughness() const;
+  public:
+  void clear_set_roughness();
+  const ::sapien::Renderer::server::proto::IdFloat& set_roughness() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::IdFloat* release_set_roughness();
+  ::sapien::Renderer::server::proto::IdFloat* mutable_set_roughness();
+  void set_allocated_set_roughness(::sapien::Renderer::server::proto::IdFloat* set_roughness);
+  private:
+  const ::sapien::Renderer::server::proto::IdFloat& _internal_set_roughness() const;
+  ::sapien::Renderer::server::proto::IdFloat* _internal_mutable_set_roughness();
+  public:
+  void unsafe_arena_set_allocated_set_roughness(
+      ::sapien::Renderer::server::proto::IdFloat* set_roughness);
+  ::sapien::Renderer::server::proto::IdFloat* unsafe_arena_release_set_roughness();
+
+  // .sapien.Renderer.server.proto.IdFloat set_specular = 5;
+  bool has_set_specular() const;
+  private:
+  bool _internal_has_set_specular() const;
+  public:
+  void clear_set_specular();
+  const ::sapien::Renderer::server::proto::IdFloat& set_specular() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::IdFloat* release_set_specular();
+  ::sapien::Renderer::server::proto::IdFloat* mutable_set_specular();
+  void set_allocated_set_specular(::sapien::Renderer::server::proto::IdFloat* set_specular);
+  private:
+  const ::sapien::Renderer::server::proto::IdFloat& _internal_set_specular() const;
+  ::sapien::Renderer::server::proto::IdFloat* _internal_mutable_set_specular();
+  public:
+  void unsafe_arena_set_allocated_set_specular(
+      ::sapien::Renderer::server::proto::IdFloat* set_specular);
+  ::sapien::Renderer::server::proto::IdFloat* unsafe_arena_release_set_specular();
+
+  // .sapien.Renderer.server.proto.IdFloat set_metallic = 6;
+  bool has_set_metallic() const;
+  private:
+  bool _internal_has_set_metallic() const;
+  public:
+  void clear_set_metallic();
+  const ::sapien::Renderer::server::proto::IdFloat& set_metallic() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::IdFloat* release_set_metallic();
+  ::sapien::Renderer::server::proto::IdFloat* mutable_set_metallic();
+  void set_allocated_set_metallic(::sapien::Renderer::server::proto::IdFloat* set_metallic);
+  private:
+  const ::sapien::Renderer::server::proto::IdFloat& _internal_set_metallic() const;
+  ::sapien::Renderer::server::proto::IdFloat* _internal_mutable_set_metallic();
+  public:
+  void unsafe_arena_set_allocated_set_metallic(
+      ::sapien::Renderer::server::proto::IdFloat* set_metallic);
+  ::sapien::Renderer::server::proto::IdFloat* unsafe_arena_release_set_metallic();
+
+  // .sapien.Renderer.server.proto.AddBodyMeshReq add_body_mesh = 7;
+  bool has_add_body_mesh() const;
+  private:
+  bool _internal_has_add_body_mesh() const;
+  public:
+  void clear_add_body_mesh();
+  const ::sapien::Renderer::server::proto::AddBodyMeshReq& add_body_mesh() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::AddBodyMeshReq* release_add_body_mesh();
+  ::sapien::Renderer::server::proto::AddBodyMeshReq* mutable_add_body_mesh();
+  void set_allocated_add_body_mesh(::sapien::Renderer::server::proto::AddBodyMeshReq* add_body_mesh);
+  private:
+  const ::sapien::Renderer::server::proto::AddBodyMeshReq& _internal_add_body_mesh() const;
+  ::sapien::Renderer::server::proto::AddBodyMeshReq* _internal_mutable_add_body_mesh();
+  public:
+  void unsafe_arena_set_allocated_add_body_mesh(
+      ::sapien::Renderer::server::proto::AddBodyMeshReq* add_body_mesh);
+  ::sapien::Renderer::server::proto::AddBodyMeshReq* unsafe_arena_release_add_body_mesh();
+
+  // .sapien.Renderer.server.proto.AddBodyPrimitiveReq add_body_primitive = 8;
+  bool has_add_body_primitive() const;
+  private:
+  bool _internal_has_add_body_primitive() const;
+  public:
+  void clear_add_body_primitive();
+  const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq& add_body_primitive() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* release_add_body_primitive();
+  ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* mutable_add_body_primitive();
+  void set_allocated_add_body_primitive(::sapien::Renderer::server::proto::AddBodyPrimitiveReq* add_body_primitive);
+  private:
+  const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq& _internal_add_body_primitive() const;
+  ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* _internal_mutable_add_body_primitive();
+  public:
+  void unsafe_arena_set_allocated_add_body_primitive(
+      ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* add_body_primitive);
+  ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* unsafe_arena_release_add_body_primitive();
+
+  // .sapien.Renderer.server.proto.BodyIdReq set_unique_id = 9;
+  bool has_set_unique_id() const;
+  private:
+  bool _internal_has_set_unique_id() const;
+  public:
+  void clear_set_unique_id();
+  const ::sapien::Renderer::server::proto::BodyIdReq& set_unique_id() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::BodyIdReq* release_set_unique_id();
+  ::sapien::Renderer::server::proto::BodyIdReq* mutable_set_unique_id();
+  void set_allocated_set_unique_id(::sapien::Renderer::server::proto::BodyIdReq* set_unique_id);
+  private:
+  const ::sapien::Renderer::server::proto::BodyIdReq& _internal_set_unique_id() const;
+  ::sapien::Renderer::server::proto::BodyIdReq* _internal_mutable_set_unique_id();
+  public:
+  void unsafe_arena_set_allocated_set_unique_id(
+      ::sapien::Renderer::server::proto::BodyIdReq* set_unique_id);
+  ::sapien::Renderer::server::proto::BodyIdReq* unsafe_arena_release_set_unique_id();
+
+  // .sapien.Renderer.server.proto.BodyIdReq set_segmentation_id = 10;
+  bool has_set_segmentation_id() const;
+  private:
+  bool _internal_has_set_segmentation_id() const;
+  public:
+  void clear_set_segmentation_id();
+  const ::sapien::Renderer::server::proto::BodyIdReq& set_segmentation_id() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::BodyIdReq* release_set_segmentation_id();
+  ::sapien::Renderer::server::proto::BodyIdReq* mutable_set_segmentation_id();
+  void set_allocated_set_segmentation_id(::sapien::Renderer::server::proto::BodyIdReq* set_segmentation_id);
+  private:
+  const ::sapien::Renderer::server::proto::BodyIdReq& _internal_set_segmentation_id() const;
+  ::sapien::Renderer::server::proto::BodyIdReq* _internal_mutable_set_segmentation_id();
+  public:
+  void unsafe_arena_set_allocated_set_segmentation_id(
+      ::sapien::Renderer::server::proto::BodyIdReq* set_segmentation_id);
+  ::sapien::Renderer::server::proto::BodyIdReq* unsafe_arena_release_set_segmentation_id();
+
+  // .sapien.Renderer.server.proto.BodyFloat32Req set_visibility = 11;
+  bool has_set_visibility() const;
+  private:
+  bool _internal_has_set_visibility() const;
+  public:
+  void clear_set_visibility();
+  const ::sapien::Renderer::server::proto::BodyFloat32Req& set_visibility() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::BodyFloat32Req* release_set_visibility();
+  ::sapien::Renderer::server::proto::BodyFloat32Req* mutable_set_visibility();
+  void set_allocated_set_visibility(::sapien::Renderer::server::proto::BodyFloat32Req* set_visibility);
+  private:
+  const ::sapien::Renderer::server::proto::BodyFloat32Req& _internal_set_visibility() const;
+  ::sapien::Renderer::server::proto::BodyFloat32Req* _internal_mutable_set_visibility();
+  public:
+  void unsafe_arena_set_allocated_set_visibility(
+      ::sapien::Renderer::server::proto::BodyFloat32Req* set_visibility);
+  ::sapien::Renderer::server::proto::BodyFloat32Req* unsafe_arena_release_set_visibility();
+
+  void clear_command();
+  CommandCase command_case() const;
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.Command)
+ private:
+  class _Internal;
+  void set_has_create_material();
+  void set_has_remove_material();
+  void set_has_set_base_color();
+  void set_has_set_roughness();
+  void set_has_set_specular();
+  void set_has_set_metallic();
+  void set_has_add_body_mesh();
+  void set_has_add_body_primitive();
+  void set_has_set_unique_id();
+  void set_has_set_segmentation_id();
+  void set_has_set_visibility();
+
+  inline bool has_command() const;
+  inline void clear_has_command();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t provisional_id_;
+    union CommandUnion {
+      constexpr CommandUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::sapien::Renderer::server::proto::Empty* create_material_;
+      ::sapien::Renderer::server::proto::Id* remove_material_;
+      ::sapien::Renderer::server::proto::IdVec4* set_base_color_;
+      ::sapien::Renderer::server::proto::IdFloat* set_roughness_;
+      ::sapien::Renderer::server::proto::IdFloat* set_specular_;
+      ::sapien::Renderer::server::proto::IdFloat* set_metallic_;
+      ::sapien::Renderer::server::proto::AddBodyMeshReq* add_body_mesh_;
+      ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* add_body_primitive_;
+      ::sapien::Renderer::server::proto::BodyIdReq* set_unique_id_;
+      ::sapien::Renderer::server::proto::BodyIdReq* set_segmentation_id_;
+      ::sapien::Renderer::server::proto::BodyFloat32Req* set_visibility_;
+    } command_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommandBatchReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.CommandBatchReq) */ {
+ public:
+  inline CommandBatchReq() : CommandBatchReq(nullptr) {}
+  ~CommandBatchReq() override;
+  explicit PROTOBUF_CONSTEXPR CommandBatchReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommandBatchReq(const CommandBatchReq& from);
+  CommandBatchReq(CommandBatchReq&& from) noexcept
+    : CommandBatchReq() {
+    *this = ::std::move(from);
+  }
+
+  inline CommandBatchReq& operator=(const CommandBatchReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommandBatchReq& operator=(CommandBatchReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommandBatchReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommandBatchReq* internal_default_instance() {
+    return reinterpret_cast<const CommandBatchReq*>(
+               &_CommandBatchReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(CommandBatchReq& a, CommandBatchReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommandBatchReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommandBatchReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommandBatchReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommandBatchReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommandBatchReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommandBatchReq& from) {
+    CommandBatchReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommandBatchReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.CommandBatchReq";
+  }
+  protected:
+  explicit CommandBatchReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommandsFieldNumber = 1,
+  };
+  // repeated .sapien.Renderer.server.proto.Command commands = 1;
+  int commands_size() const;
+  private:
+  int _internal_commands_size() const;
+  public:
+  void clear_commands();
+  ::sapien::Renderer::server::proto::Command* mutable_commands(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Command >*
+      mutable_commands();
+  private:
+  const ::sapien::Renderer::server::proto::Command& _internal_commands(int index) const;
+  ::sapien::Renderer::server::proto::Command* _internal_add_commands();
+  public:
+  const ::sapien::Renderer::server::proto::Command& commands(int index) const;
+  ::sapien::Renderer::server::proto::Command* add_commands();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Command >&
+      commands() const;
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.CommandBatchReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Command > commands_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommandBatchRes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.CommandBatchRes) */ {
+ public:
+  inline CommandBatchRes() : CommandBatchRes(nullptr) {}
+  ~CommandBatchRes() override;
+  explicit PROTOBUF_CONSTEXPR CommandBatchRes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommandBatchRes(const CommandBatchRes& from);
+  CommandBatchRes(CommandBatchRes&& from) noexcept
+    : CommandBatchRes() {
+    *this = ::std::move(from);
+  }
+
+  inline CommandBatchRes& operator=(const CommandBatchRes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommandBatchRes& operator=(CommandBatchRes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommandBatchRes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommandBatchRes* internal_default_instance() {
+    return reinterpret_cast<const CommandBatchRes*>(
+               &_CommandBatchRes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(CommandBatchRes& a, CommandBatchRes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommandBatchRes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommandBatchRes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommandBatchRes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommandBatchRes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommandBatchRes& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommandBatchRes& from) {
+    CommandBatchRes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommandBatchRes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.CommandBatchRes";
+  }
+  protected:
+  explicit CommandBatchRes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProvisionalIdsFieldNumber = 1,
+    kIdsFieldNumber = 2,
+  };
+  // repeated uint64 provisional_ids = 1;
+  int provisional_ids_size() const;
+  private:
+  int _internal_provisional_ids_size() const;
+  public:
+  void clear_provisional_ids();
+  private:
+  uint64_t _internal_provisional_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_provisional_ids() const;
+  void _internal_add_provisional_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_provisional_ids();
+  public:
+  uint64_t provisional_ids(int index) const;
+  void set_provisional_ids(int index, uint64_t value);
+  void add_provisional_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      provisional_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_provisional_ids();
+
+  // repeated uint64 ids = 2;
+  int ids_size() const;
+  private:
+  int _internal_ids_size() const;
+  public:
+  void clear_ids();
+  private:
+  uint64_t _internal_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_ids() const;
+  void _internal_add_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_ids();
+  public:
+  uint64_t ids(int index) const;
+  void set_ids(int index, uint64_t value);
+  void add_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_ids();
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.CommandBatchRes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > provisional_ids_;
+    mutable std::atomic<int> _provisional_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > ids_;
+    mutable std::atomic<int> _ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Histogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.Histogram) */ {
+ public:
+  inline Histogram() : Histogram(nullptr) {}
+  ~Histogram() override;
+  explicit PROTOBUF_CONSTEXPR Histogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Histogram(const Histogram& from);
+  Histogram(Histogram&& from) noexcept
+    : Histogram() {
+    *this = ::std::move(from);
+  }
+
+  inline Histogram& operator=(const Histogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Histogram& operator=(Histogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Histogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Histogram* internal_default_instance() {
+    return reinterpret_cast<const Histogram*>(
+               &_Histogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(Histogram& a, Histogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Histogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Histogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Histogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Histogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Histogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Histogram& from) {
+    Histogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Histogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.Histogram";
+  }
+  protected:
+  explicit Histogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 4,
+    kCountFieldNumber = 1,
+    kSumUsFieldNumber = 2,
+    kMaxUsFieldNumber = 3,
+  };
+  // repeated uint64 buckets = 4;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  private:
+  uint64_t _internal_buckets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_buckets() const;
+  void _internal_add_buckets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_buckets();
+  public:
+  uint64_t buckets(int index) const;
+  void set_buckets(int index, uint64_t value);
+  void add_buckets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      buckets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_buckets();
+
+  // uint64 count = 1;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 sum_us = 2;
+  void clear_sum_us();
+  uint64_t sum_us() const;
+  void set_sum_us(uint64_t value);
+  private:
+  uint64_t _internal_sum_us() const;
+  void _internal_set_sum_us(uint64_t value);
+  public:
+
+  // uint64 max_us = 3;
+  void clear_max_us();
+  uint64_t max_us() const;
+  void set_max_us(uint64_t value);
+  private:
+  uint64_t _internal_max_us() const;
+  void _internal_set_max_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.Histogram)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > buckets_;
+    mutable std::atomic<int> _buckets_cached_byte_size_;
+    uint64_t count_;
+    uint64_t sum_us_;
+    uint64_t max_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MethodMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.MethodMetrics) */ {
+ public:
+  inline MethodMetrics() : MethodMetrics(nullptr) {}
+  ~MethodMetrics() override;
+  explicit PROTOBUF_CONSTEXPR MethodMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MethodMetrics(const MethodMetrics& from);
+  MethodMetrics(MethodMetrics&& from) noexcept
+    : MethodMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline MethodMetrics& operator=(const MethodMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MethodMetrics& operator=(MethodMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MethodMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MethodMetrics* internal_default_instance() {
+    return reinterpret_cast<const MethodMetrics*>(
+               &_MethodMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(MethodMetrics& a, MethodMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MethodMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MethodMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MethodMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MethodMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MethodMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MethodMetrics& from) {
+    MethodMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MethodMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.MethodMetrics";
+  }
+  protected:
+  explicit MethodMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kLatencyFieldNumber = 2,
+    kHandlerFieldNumber = 3,
+    kErrorsFieldNumber = 4,
+    kBytesInFieldNumber = 5,
+    kBytesOutFieldNumber = 6,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  bool has_latency() const;
+  private:
+  bool _internal_has_latency() const;
+  public:
+  void clear_latency();
+  const ::sapien::Renderer::server::proto::Histogram& latency() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::Histogram* release_latency();
+  ::sapien::Renderer::server::proto::Histogram* mutable_latency();
+  void set_allocated_latency(::sapien::Renderer::server::proto::Histogram* latency);
+  private:
+  const ::sapien::Renderer::server::proto::Histogram& _internal_latency() const;
+  ::sapien::Renderer::server::proto::Histogram* _internal_mutable_latency();
+  public:
+  void unsafe_arena_set_allocated_latency(
+      ::sapien::Renderer::server::proto::Histogram* latency);
+  ::sapien::Renderer::server::proto::Histogram* unsafe_arena_release_latency();
+
+  // .sapien.Renderer.server.proto.Histogram handler = 3;
+  bool has_handler() const;
+  private:
+  bool _internal_has_handler() const;
+  public:
+  void clear_handler();
+  const ::sapien::Renderer::server::proto::Histogram& handler() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::Histogram* release_handler();
+  ::sapien::Renderer::server::proto::Histogram* mutable_handler();
+  void set_allocated_handler(::sapien::Renderer::server::proto::Histogram* handler);
+  private:
+  const ::sapien::Renderer::server::proto::Histogram& _internal_handler() const;
+  ::sapien::Renderer::server::proto::Histogram* _internal_mutable_handler();
+  public:
+  void unsafe_arena_set_allocated_handler(
+      ::sapien::Renderer::server::proto::Histogram* handler);
+  ::sapien::Renderer::server::proto::Histogram* unsafe_arena_release_handler();
+
+  // uint64 errors = 4;
+  void clear_errors();
+  uint64_t errors() const;
+  void set_errors(uint64_t value);
+  private:
+  uint64_t _internal_errors() const;
+  void _internal_set_errors(uint64_t value);
+  public:
+
+  // uint64 bytes_in = 5;
+  void clear_bytes_in();
+  uint64_t bytes_in() const;
+  void set_bytes_in(uint64_t value);
+  private:
+  uint64_t _internal_bytes_in() const;
+  void _internal_set_bytes_in(uint64_t value);
+  public:
+
+  // uint64 bytes_out = 6;
+  void clear_bytes_out();
+  uint64_t bytes_out() const;
+  void set_bytes_out(uint64_t value);
+  private:
+  uint64_t _internal_bytes_out() const;
+  void _internal_set_bytes_out(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.MethodMetrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::sapien::Renderer::server::proto::Histogram* latency_;
+    ::sapien::Renderer::server::proto::Histogram* handler_;
+    uint64_t errors_;
+    uint64_t bytes_in_;
+    uint64_t bytes_out_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StageMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.StageMetrics) */ {
+ public:
+  inline StageMetrics() : StageMetrics(nullptr) {}
+  ~StageMetrics() override;
+  explicit PROTOBUF_CONSTEXPR StageMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StageMetrics(const StageMetrics& from);
+  StageMetrics(StageMetrics&& from) noexcept
+    : StageMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline StageMetrics& operator=(const StageMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StageMetrics& operator=(StageMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StageMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StageMetrics* internal_default_instance() {
+    return reinterpret_cast<const StageMetrics*>(
+               &_StageMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(StageMetrics& a, StageMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StageMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StageMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StageMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StageMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StageMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StageMetrics& from) {
+    StageMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StageMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.StageMetrics";
+  }
+  protected:
+  explicit StageMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kLatencyFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .sapien.Renderer.server.proto.Histogram latency = 2;
+  bool has_latency() const;
+  private:
+  bool _internal_has_latency() const;
+  public:
+  void clear_latency();
+  const ::sapien::Renderer::server::proto::Histogram& latency() const;
+  PROTOBUF_NODISCARD ::sapien::Renderer::server::proto::Histogram* release_latency();
+  ::sapien::Renderer::server::proto::Histogram* mutable_latency();
+  void set_allocated_latency(::sapien::Renderer::server::proto::Histogram* latency);
+  private:
+  const ::sapien::Renderer::server::proto::Histogram& _internal_latency() const;
+  ::sapien::Renderer::server::proto::Histogram* _internal_mutable_latency();
+  public:
+  void unsafe_arena_set_allocated_latency(
+      ::sapien::Renderer::server::proto::Histogram* latency);
+  ::sapien::Renderer::server::proto::Histogram* unsafe_arena_release_latency();
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.StageMetrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::sapien::Renderer::server::proto::Histogram* latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SceneMetrics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.SceneMetrics) */ {
+ public:
+  inline SceneMetrics() : SceneMetrics(nullptr) {}
+  ~SceneMetrics() override;
+  explicit PROTOBUF_CONSTEXPR SceneMetrics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SceneMetrics(const SceneMetrics& from);
+  SceneMetrics(SceneMetrics&& from) noexcept
+    : SceneMetrics() {
+    *this = ::std::move(from);
+  }
+
+  inline SceneMetrics& operator=(const SceneMetrics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SceneMetrics& operator=(SceneMetrics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SceneMetrics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SceneMetrics* internal_default_instance() {
+    return reinterpret_cast<const SceneMetrics*>(
+               &_SceneMetrics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(SceneMetrics& a, SceneMetrics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SceneMetrics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SceneMetrics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SceneMetrics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SceneMetrics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SceneMetrics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SceneMetrics& from) {
+    SceneMetrics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SceneMetrics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.SceneMetrics";
+  }
+  protected:
+  explicit SceneMetrics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSceneIdFieldNumber = 1,
+    kSceneIndexFieldNumber = 2,
+    kFramesFieldNumber = 3,
+    kPicturesFieldNumber = 4,
+    kPendingFieldNumber = 5,
+  };
+  // uint64 scene_id = 1;
+  void clear_scene_id();
+  uint64_t scene_id() const;
+  void set_scene_id(uint64_t value);
+  private:
+  uint64_t _internal_scene_id() const;
+  void _internal_set_scene_id(uint64_t value);
+  public:
+
+  // uint64 scene_index = 2;
+  void clear_scene_index();
+  uint64_t scene_index() const;
+  void set_scene_index(uint64_t value);
+  private:
+  uint64_t _internal_scene_index() const;
+  void _internal_set_scene_index(uint64_t value);
+  public:
+
+  // uint64 frames = 3;
+  void clear_frames();
+  uint64_t frames() const;
+  void set_frames(uint64_t value);
+  private:
+  uint64_t _internal_frames() const;
+  void _internal_set_frames(uint64_t value);
+  public:
+
+  // uint64 pictures = 4;
+  void clear_pictures();
+  uint64_t pictures() const;
+  void set_pictures(uint64_t value);
+  private:
+  uint64_t _internal_pictures() const;
+  void _internal_set_pictures(uint64_t value);
+  public:
+
+  // uint32 pending = 5;
+  void clear_pending();
+  uint32_t pending() const;
+  void set_pending(uint32_t value);
+  private:
+  uint32_t _internal_pending() const;
+  void _internal_set_pending(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.SceneMetrics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t scene_id_;
+    uint64_t scene_index_;
+    uint64_t frames_;
+    uint64_t pictures_;
+    uint32_t pending_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricsRes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sapien.Renderer.server.proto.MetricsRes) */ {
+ public:
+  inline MetricsRes() : MetricsRes(nullptr) {}
+  ~MetricsRes() override;
+  explicit PROTOBUF_CONSTEXPR MetricsRes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricsRes(const MetricsRes& from);
+  MetricsRes(MetricsRes&& from) noexcept
+    : MetricsRes() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricsRes& operator=(const MetricsRes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricsRes& operator=(MetricsRes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricsRes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricsRes* internal_default_instance() {
+    return reinterpret_cast<const MetricsRes*>(
+               &_MetricsRes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(MetricsRes& a, MetricsRes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricsRes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricsRes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricsRes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricsRes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricsRes& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricsRes& from) {
+    MetricsRes::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricsRes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sapien.Renderer.server.proto.MetricsRes";
+  }
+  protected:
+  explicit MetricsRes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMethodsFieldNumber = 2,
+    kStagesFieldNumber = 3,
+    kScenesFieldNumber = 4,
+    kUptimeUsFieldNumber = 1,
+  };
+  // repeated .sapien.Renderer.server.proto.MethodMetrics methods = 2;
+  int methods_size() const;
+  private:
+  int _internal_methods_size() const;
+  public:
+  void clear_methods();
+  ::sapien::Renderer::server::proto::MethodMetrics* mutable_methods(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::MethodMetrics >*
+      mutable_methods();
+  private:
+  const ::sapien::Renderer::server::proto::MethodMetrics& _internal_methods(int index) const;
+  ::sapien::Renderer::server::proto::MethodMetrics* _internal_add_methods();
+  public:
+  const ::sapien::Renderer::server::proto::MethodMetrics& methods(int index) const;
+  ::sapien::Renderer::server::proto::MethodMetrics* add_methods();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::MethodMetrics >&
+      methods() const;
+
+  // repeated .sapien.Renderer.server.proto.StageMetrics stages = 3;
+  int stages_size() const;
+  private:
+  int _internal_stages_size() const;
+  public:
+  void clear_stages();
+  ::sapien::Renderer::server::proto::StageMetrics* mutable_stages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::StageMetrics >*
+      mutable_stages();
+  private:
+  const ::sapien::Renderer::server::proto::StageMetrics& _internal_stages(int index) const;
+  ::sapien::Renderer::server::proto::StageMetrics* _internal_add_stages();
+  public:
+  const ::sapien::Renderer::server::proto::StageMetrics& stages(int index) const;
+  ::sapien::Renderer::server::proto::StageMetrics* add_stages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::StageMetrics >&
+      stages() const;
+
+  // repeated .sapien.Renderer.server.proto.SceneMetrics scenes = 4;
+  int scenes_size() const;
+  private:
+  int _internal_scenes_size() const;
+  public:
+  void clear_scenes();
+  ::sapien::Renderer::server::proto::SceneMetrics* mutable_scenes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::SceneMetrics >*
+      mutable_scenes();
+  private:
+  const ::sapien::Renderer::server::proto::SceneMetrics& _internal_scenes(int index) const;
+  ::sapien::Renderer::server::proto::SceneMetrics* _internal_add_scenes();
+  public:
+  const ::sapien::Renderer::server::proto::SceneMetrics& scenes(int index) const;
+  ::sapien::Renderer::server::proto::SceneMetrics* add_scenes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::SceneMetrics >&
+      scenes() const;
+
+  // uint64 uptime_us = 1;
+  void clear_uptime_us();
+  uint64_t uptime_us() const;
+  void set_uptime_us(uint64_t value);
+  private:
+  uint64_t _internal_uptime_us() const;
+  void _internal_set_uptime_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sapien.Renderer.server.proto.MetricsRes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::MethodMetrics > methods_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::StageMetrics > stages_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::SceneMetrics > scenes_;
+    uint64_t uptime_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_render_5fserver_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Empty
+
+// -------------------------------------------------------------------
+
+// Uint32
+
+// uint32 value = 1;
+inline void Uint32::clear_value() {
+  _impl_.value_ = 0u;
+}
+inline uint32_t Uint32::_internal_value() const {
+  return _impl_.value_;
+}
+inline uint32_t Uint32::value() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Uint32.value)
+  return _internal_value();
+}
+inline void Uint32::_internal_set_value(uint32_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void Uint32::set_value(uint32_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Uint32.value)
+}
+
+// -------------------------------------------------------------------
+
+// Index
+
+// uint64 index = 1;
+inline void Index::clear_index() {
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t Index::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint64_t Index::index() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Index.index)
+  return _internal_index();
+}
+inline void Index::_internal_set_index(uint64_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void Index::set_index(uint64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Index.index)
+}
+
+// -------------------------------------------------------------------
+
+// Id
+
+// uint64 id = 1;
+inline void Id::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t Id::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Id::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Id.id)
+  return _internal_id();
+}
+inline void Id::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Id::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Id.id)
+}
+
+// -------------------------------------------------------------------
+
+// Vec3
+
+// float x = 1;
+inline void Vec3::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float Vec3::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Vec3::x() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.x)
+  return _internal_x();
+}
+inline void Vec3::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void Vec3::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.x)
+}
+
+// float y = 2;
+inline void Vec3::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float Vec3::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Vec3::y() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.y)
+  return _internal_y();
+}
+inline void Vec3::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void Vec3::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.y)
+}
+
+// float z = 3;
+inline void Vec3::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float Vec3::_internal_z() const {
+  return _impl_.z_;
+}
+inline float Vec3::z() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec3.z)
+  return _internal_z();
+}
+inline void Vec3::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void Vec3::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec3.z)
+}
+
+// -------------------------------------------------------------------
+
+// Vec4
+
+// float x = 1;
+inline void Vec4::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float Vec4::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Vec4::x() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.x)
+  return _internal_x();
+}
+inline void Vec4::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void Vec4::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.x)
+}
+
+// float y = 2;
+inline void Vec4::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float Vec4::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Vec4::y() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.y)
+  return _internal_y();
+}
+inline void Vec4::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void Vec4::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.y)
+}
+
+// float z = 3;
+inline void Vec4::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float Vec4::_internal_z() const {
+  return _impl_.z_;
+}
+inline float Vec4::z() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.z)
+  return _internal_z();
+}
+inline void Vec4::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void Vec4::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.z)
+}
+
+// float w = 4;
+inline void Vec4::clear_w() {
+  _impl_.w_ = 0;
+}
+inline float Vec4::_internal_w() const {
+  return _impl_.w_;
+}
+inline float Vec4::w() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.w)
+  return _internal_w();
+}
+inline void Vec4::_internal_set_w(float value) {
+  
+  _impl_.w_ = value;
+}
+inline void Vec4::set_w(float value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.w)
+}
+
+// -------------------------------------------------------------------
+
+// Quat
+
+// float w = 1;
+inline void Quat::clear_w() {
+  _impl_.w_ = 0;
+}
+inline float Quat::_internal_w() const {
+  return _impl_.w_;
+}
+inline float Quat::w() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.w)
+  return _internal_w();
+}
+inline void Quat::_internal_set_w(float value) {
+  
+  _impl_.w_ = value;
+}
+inline void Quat::set_w(float value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.w)
+}
+
+// float x = 2;
+inline void Quat::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float Quat::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Quat::x() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.x)
+  return _internal_x();
+}
+inline void Quat::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void Quat::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.x)
+}
+
+// float y = 3;
+inline void Quat::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float Quat::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Quat::y() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.y)
+  return _internal_y();
+}
+inline void Quat::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void Quat::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.y)
+}
+
+// float z = 4;
+inline void Quat::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float Quat::_internal_z() const {
+  return _impl_.z_;
+}
+inline float Quat::z() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.z)
+  return _internal_z();
+}
+inline void Quat::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void Quat::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.z)
+}
+
+// -------------------------------------------------------------------
+
+// Pose
+
+// .sapien.Renderer.server.proto.Vec3 p = 1;
+inline bool Pose::_internal_has_p() const {
+  return this != internal_default_instance() && _impl_.p_ != nullptr;
+}
+inline bool Pose::has_p() const {
+  return _internal_has_p();
+}
+inline void Pose::clear_p() {
+  if (GetArenaForAllocation() == nullptr && _impl_.p_ != nullptr) {
+    delete _impl_.p_;
+  }
+  _impl_.p_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec3& Pose::_internal_p() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.p_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec3& Pose::p() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Pose.p)
+  return _internal_p();
+}
+inline void Pose::unsafe_arena_set_allocated_p(
+    ::sapien::Renderer::server::proto::Vec3* p) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p_);
+  }
+  _impl_.p_ = p;
+  if (p) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Pose.p)
+}
+inline ::sapien::Renderer::server::proto::Vec3* Pose::release_p() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.p_;
+  _impl_.p_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* Pose::unsafe_arena_release_p() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Pose.p)
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.p_;
+  _impl_.p_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* Pose::_internal_mutable_p() {
+  
+  if (_impl_.p_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.p_ = p;
+  }
+  return _impl_.p_;
+}
+inline ::sapien::Renderer::server::proto::Vec3* Pose::mutable_p() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_p();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Pose.p)
+  return _msg;
+}
+inline void Pose::set_allocated_p(::sapien::Renderer::server::proto::Vec3* p) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.p_;
+  }
+  if (p) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p);
+    if (message_arena != submessage_arena) {
+      p = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, p, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.p_ = p;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Pose.p)
+}
+
+// .sapien.Renderer.server.proto.Quat q = 2;
+inline bool Pose::_internal_has_q() const {
+  return this != internal_default_instance() && _impl_.q_ != nullptr;
+}
+inline bool Pose::has_q() const {
+  return _internal_has_q();
+}
+inline void Pose::clear_q() {
+  if (GetArenaForAllocation() == nullptr && _impl_.q_ != nullptr) {
+    delete _impl_.q_;
+  }
+  _impl_.q_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Quat& Pose::_internal_q() const {
+  const ::sapien::Renderer::server::proto::Quat* p = _impl_.q_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Quat&>(
+      ::sapien::Renderer::server::proto::_Quat_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Quat& Pose::q() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Pose.q)
+  return _internal_q();
+}
+inline void Pose::unsafe_arena_set_allocated_q(
+    ::sapien::Renderer::server::proto::Quat* q) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.q_);
+  }
+  _impl_.q_ = q;
+  if (q) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Pose.q)
+}
+inline ::sapien::Renderer::server::proto::Quat* Pose::release_q() {
+  
+  ::sapien::Renderer::server::proto::Quat* temp = _impl_.q_;
+  _impl_.q_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Quat* Pose::unsafe_arena_release_q() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Pose.q)
+  
+  ::sapien::Renderer::server::proto::Quat* temp = _impl_.q_;
+  _impl_.q_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Quat* Pose::_internal_mutable_q() {
+  
+  if (_impl_.q_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Quat>(GetArenaForAllocation());
+    _impl_.q_ = p;
+  }
+  return _impl_.q_;
+}
+inline ::sapien::Renderer::server::proto::Quat* Pose::mutable_q() {
+  ::sapien::Renderer::server::proto::Quat* _msg = _internal_mutable_q();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Pose.q)
+  return _msg;
+}
+inline void Pose::set_allocated_q(::sapien::Renderer::server::proto::Quat* q) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.q_;
+  }
+  if (q) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(q);
+    if (message_arena != submessage_arena) {
+      q = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, q, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.q_ = q;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Pose.q)
+}
+
+// -------------------------------------------------------------------
+
+// IdVec3
+
+// uint64 id = 1;
+inline void IdVec3::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t IdVec3::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t IdVec3::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec3.id)
+  return _internal_id();
+}
+inline void IdVec3::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void IdVec3::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdVec3.id)
+}
+
+// .sapien.Renderer.server.proto.Vec3 data = 2;
+inline bool IdVec3::_internal_has_data() const {
+  return this != internal_default_instance() && _impl_.data_ != nullptr;
+}
+inline bool IdVec3::has_data() const {
+  return _internal_has_data();
+}
+inline void IdVec3::clear_data() {
+  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
+    delete _impl_.data_;
+  }
+  _impl_.data_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec3& IdVec3::_internal_data() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec3& IdVec3::data() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec3.data)
+  return _internal_data();
+}
+inline void IdVec3::unsafe_arena_set_allocated_data(
+    ::sapien::Renderer::server::proto::Vec3* data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+  }
+  _impl_.data_ = data;
+  if (data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.IdVec3.data)
+}
+inline ::sapien::Renderer::server::proto::Vec3* IdVec3::release_data() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* IdVec3::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.IdVec3.data)
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* IdVec3::_internal_mutable_data() {
+  
+  if (_impl_.data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.data_ = p;
+  }
+  return _impl_.data_;
+}
+inline ::sapien::Renderer::server::proto::Vec3* IdVec3::mutable_data() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.IdVec3.data)
+  return _msg;
+}
+inline void IdVec3::set_allocated_data(::sapien::Renderer::server::proto::Vec3* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.IdVec3.data)
+}
+
+// -------------------------------------------------------------------
+
+// IdVec4
+
+// uint64 id = 1;
+inline void IdVec4::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t IdVec4::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t IdVec4::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec4.id)
+  return _internal_id();
+}
+inline void IdVec4::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void IdVec4::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdVec4.id)
+}
+
+// .sapien.Renderer.server.proto.Vec4 data = 2;
+inline bool IdVec4::_internal_has_data() const {
+  return this != internal_default_instance() && _impl_.data_ != nullptr;
+}
+inline bool IdVec4::has_data() const {
+  return _internal_has_data();
+}
+inline void IdVec4::clear_data() {
+  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
+    delete _impl_.data_;
+  }
+  _impl_.data_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec4& IdVec4::_internal_data() const {
+  const ::sapien::Renderer::server::proto::Vec4* p = _impl_.data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec4&>(
+      ::sapien::Renderer::server::proto::_Vec4_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec4& IdVec4::data() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec4.data)
+  return _internal_data();
+}
+inline void IdVec4::unsafe_arena_set_allocated_data(
+    ::sapien::Renderer::server::proto::Vec4* data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+  }
+  _impl_.data_ = data;
+  if (data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.IdVec4.data)
+}
+inline ::sapien::Renderer::server::proto::Vec4* IdVec4::release_data() {
+  
+  ::sapien::Renderer::server::proto::Vec4* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec4* IdVec4::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.IdVec4.data)
+  
+  ::sapien::Renderer::server::proto::Vec4* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec4* IdVec4::_internal_mutable_data() {
+  
+  if (_impl_.data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec4>(GetArenaForAllocation());
+    _impl_.data_ = p;
+  }
+  return _impl_.data_;
+}
+inline ::sapien::Renderer::server::proto::Vec4* IdVec4::mutable_data() {
+  ::sapien::Renderer::server::proto::Vec4* _msg = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.IdVec4.data)
+  return _msg;
+}
+inline void IdVec4::set_allocated_data(::sapien::Renderer::server::proto::Vec4* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.IdVec4.data)
+}
+
+// -------------------------------------------------------------------
+
+// IdFloat
+
+// uint64 id = 1;
+inline void IdFloat::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t IdFloat::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t IdFloat::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdFloat.id)
+  return _internal_id();
+}
+inline void IdFloat::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void IdFloat::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdFloat.id)
+}
+
+// float data = 2;
+inline void IdFloat::clear_data() {
+  _impl_.data_ = 0;
+}
+inline float IdFloat::_internal_data() const {
+  return _impl_.data_;
+}
+inline float IdFloat::data() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdFloat.data)
+  return _internal_data();
+}
+inline void IdFloat::_internal_set_data(float value) {
+  
+  _impl_.data_ = value;
+}
+inline void IdFloat::set_data(float value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdFloat.data)
+}
+
+// -------------------------------------------------------------------
+
+// AddBodyMeshReq
+
+// uint64 scene_id = 1;
+inline void AddBodyMeshReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t AddBodyMeshReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t AddBodyMeshReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.scene_id)
+  return _internal_scene_id();
+}
+inline void AddBodyMeshReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void AddBodyMeshReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyMeshReq.scene_id)
+}
+
+// string filename = 2;
+inline void AddBodyMeshReq::clear_filename() {
+  _impl_.filename_.ClearToEmpty();
+}
+inline const std::string& AddBodyMeshReq::filename() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+  return _internal_filename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddBodyMeshReq::set_filename(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+}
+inline std::string* AddBodyMeshReq::mutable_filename() {
+  std::string* _s = _internal_mutable_filename();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+  return _s;
+}
+inline const std::string& AddBodyMeshReq::_internal_filename() const {
+  return _impl_.filename_.Get();
+}
+inline void AddBodyMeshReq::_internal_set_filename(const std::string& value) {
+  
+  _impl_.filename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AddBodyMeshReq::_internal_mutable_filename() {
+  
+  return _impl_.filename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AddBodyMeshReq::release_filename() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+  return _impl_.filename_.Release();
+}
+inline void AddBodyMeshReq::set_allocated_filename(std::string* filename) {
+  if (filename != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+}
+
+// .sapien.Renderer.server.proto.Vec3 scale = 3;
+inline bool AddBodyMeshReq::_internal_has_scale() const {
+  return this != internal_default_instance() && _impl_.scale_ != nullptr;
+}
+inline bool AddBodyMeshReq::has_scale() const {
+  return _internal_has_scale();
+}
+inline void AddBodyMeshReq::clear_scale() {
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
+  }
+  _impl_.scale_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddBodyMeshReq::_internal_scale() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.scale_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddBodyMeshReq::scale() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+  return _internal_scale();
+}
+inline void AddBodyMeshReq::unsafe_arena_set_allocated_scale(
+    ::sapien::Renderer::server::proto::Vec3* scale) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
+  }
+  _impl_.scale_ = scale;
+  if (scale) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::release_scale() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::unsafe_arena_release_scale() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::_internal_mutable_scale() {
+  
+  if (_impl_.scale_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.scale_ = p;
+  }
+  return _impl_.scale_;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::mutable_scale() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_scale();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+  return _msg;
+}
+inline void AddBodyMeshReq::set_allocated_scale(::sapien::Renderer::server::proto::Vec3* scale) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scale_;
+  }
+  if (scale) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
+    if (message_arena != submessage_arena) {
+      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scale, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.scale_ = scale;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+}
+
+// -------------------------------------------------------------------
+
+// AddBodyPrimitiveReq
+
+// uint64 scene_id = 1;
+inline void AddBodyPrimitiveReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t AddBodyPrimitiveReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t AddBodyPrimitiveReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scene_id)
+  return _internal_scene_id();
+}
+inline void AddBodyPrimitiveReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void AddBodyPrimitiveReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scene_id)
+}
+
+// .sapien.Renderer.server.proto.PrimitiveType type = 2;
+inline void AddBodyPrimitiveReq::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::sapien::Renderer::server::proto::PrimitiveType AddBodyPrimitiveReq::_internal_type() const {
+  return static_cast< ::sapien::Renderer::server::proto::PrimitiveType >(_impl_.type_);
+}
+inline ::sapien::Renderer::server::proto::PrimitiveType AddBodyPrimitiveReq::type() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.type)
+  return _internal_type();
+}
+inline void AddBodyPrimitiveReq::_internal_set_type(::sapien::Renderer::server::proto::PrimitiveType value) {
+  
+  _impl_.type_ = value;
+}
+inline void AddBodyPrimitiveReq::set_type(::sapien::Renderer::server::proto::PrimitiveType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.type)
+}
+
+// .sapien.Renderer.server.proto.Vec3 scale = 3;
+inline bool AddBodyPrimitiveReq::_internal_has_scale() const {
+  return this != internal_default_instance() && _impl_.scale_ != nullptr;
+}
+inline bool AddBodyPrimitiveReq::has_scale() const {
+  return _internal_has_scale();
+}
+inline void AddBodyPrimitiveReq::clear_scale() {
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
+  }
+  _impl_.scale_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddBodyPrimitiveReq::_internal_scale() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.scale_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddBodyPrimitiveReq::scale() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+  return _internal_scale();
+}
+inline void AddBodyPrimitiveReq::unsafe_arena_set_allocated_scale(
+    ::sapien::Renderer::server::proto::Vec3* scale) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
+  }
+  _impl_.scale_ = scale;
+  if (scale) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::release_scale() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::unsafe_arena_release_scale() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+  return temp;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::_internal_mutable_scale() {
+  
+  if (_impl_.scale_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.scale_ = p;
+  }
+  return _impl_.scale_;
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::mutable_scale() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_scale();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+  return _msg;
+}
+inline void AddBodyPrimitiveReq::set_allocated_scale(::sapien::Renderer::server::proto::Vec3* scale) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scale_;
+  }
+  if (scale) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
+    if (message_arena != submessage_arena) {
+      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scale, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.scale_ = scale;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+}
+
+// uint64 material = 4;
+inline void AddBodyPrimitiveReq::clear_material() {
+  _impl_.material_ = uint64_t{0u};
+}
+inline uint64_t AddBodyPrimitiveReq::_internal_material() const {
+  return _impl_.material_;
+}
+inline uint64_t AddBodyPrimitiveReq::material() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.material)
+  return _internal_material();
+}
+inline void AddBodyPrimitiveReq::_internal_set_material(uint64_t value) {
+  
+  _impl_.material_ = value;
+}
+inline void AddBodyPrimitiveReq::set_material(uint64_t value) {
+  _internal_set_material(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.material)
+}
+
+// -------------------------------------------------------------------
+
+// RemoveBodyReq
+
+// uint64 scene_id = 1;
+inline void RemoveBodyReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t RemoveBodyReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t RemoveBodyReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveBodyReq.scene_id)
+  return _internal_scene_id();
+}
+inline void RemoveBodyReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void RemoveBodyReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveBodyReq.scene_id)
+}
+
+// uint64 body_id = 2;
+inline void RemoveBodyReq::clear_body_id() {
+  _impl_.body_id_ = uint64_t{0u};
+}
+inline uint64_t RemoveBodyReq::_internal_body_id() const {
+  return _impl_.body_id_;
+}
+inline uint64_t RemoveBodyReq::body_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveBodyReq.body_id)
+  return _internal_body_id();
+}
+inline void RemoveBodyReq::_internal_set_body_id(uint64_t value) {
+  
+  _impl_.body_id_ = value;
+}
+inline void RemoveBodyReq::set_body_id(uint64_t value) {
+  _internal_set_body_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveBodyReq.body_id)
+}
+
+// -------------------------------------------------------------------
+
+// AddCameraReq
+
+// uint64 scene_id = 1;
+inline void AddCameraReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t AddCameraReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t AddCameraReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.scene_id)
+  return _internal_scene_id();
+}
+inline void AddCameraReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void AddCameraReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.scene_id)
+}
+
+// uint32 width = 2;
+inline void AddCameraReq::clear_width() {
+  _impl_.width_ = 0u;
+}
+inline uint32_t AddCameraReq::_internal_width() const {
+  return _impl_.width_;
+}
+inline uint32_t AddCameraReq::width() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.width)
+  return _internal_width();
+}
+inline void AddCameraReq::_internal_set_width(uint32_t value) {
+  
+  _impl_.width_ = value;
 }
-inline float Vec4::x() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.x)
-  return _internal_x();
+inline void AddCameraReq::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.width)
+}
+
+// uint32 height = 3;
+inline void AddCameraReq::clear_height() {
+  _impl_.height_ = 0u;
+}
+inline uint32_t AddCameraReq::_internal_height() const {
+  return _impl_.height_;
+}
+inline uint32_t AddCameraReq::height() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.height)
+  return _internal_height();
+}
+inline void AddCameraReq::_internal_set_height(uint32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void AddCameraReq::set_height(uint32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.height)
+}
+
+// float fovy = 4;
+inline void AddCameraReq::clear_fovy() {
+  _impl_.fovy_ = 0;
+}
+inline float AddCameraReq::_internal_fovy() const {
+  return _impl_.fovy_;
+}
+inline float AddCameraReq::fovy() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.fovy)
+  return _internal_fovy();
+}
+inline void AddCameraReq::_internal_set_fovy(float value) {
+  
+  _impl_.fovy_ = value;
+}
+inline void AddCameraReq::set_fovy(float value) {
+  _internal_set_fovy(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.fovy)
+}
+
+// float near = 5;
+inline void AddCameraReq::clear_near() {
+  _impl_.near_ = 0;
+}
+inline float AddCameraReq::_internal_near() const {
+  return _impl_.near_;
+}
+inline float AddCameraReq::near() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.near)
+  return _internal_near();
+}
+inline void AddCameraReq::_internal_set_near(float value) {
+  
+  _impl_.near_ = value;
+}
+inline void AddCameraReq::set_near(float value) {
+  _internal_set_near(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.near)
+}
+
+// float far = 6;
+inline void AddCameraReq::clear_far() {
+  _impl_.far_ = 0;
+}
+inline float AddCameraReq::_internal_far() const {
+  return _impl_.far_;
+}
+inline float AddCameraReq::far() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.far)
+  return _internal_far();
+}
+inline void AddCameraReq::_internal_set_far(float value) {
+  
+  _impl_.far_ = value;
+}
+inline void AddCameraReq::set_far(float value) {
+  _internal_set_far(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.far)
+}
+
+// string shader = 7;
+inline void AddCameraReq::clear_shader() {
+  _impl_.shader_.ClearToEmpty();
+}
+inline const std::string& AddCameraReq::shader() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.shader)
+  return _internal_shader();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddCameraReq::set_shader(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.shader_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.shader)
+}
+inline std::string* AddCameraReq::mutable_shader() {
+  std::string* _s = _internal_mutable_shader();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddCameraReq.shader)
+  return _s;
+}
+inline const std::string& AddCameraReq::_internal_shader() const {
+  return _impl_.shader_.Get();
+}
+inline void AddCameraReq::_internal_set_shader(const std::string& value) {
+  
+  _impl_.shader_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AddCameraReq::_internal_mutable_shader() {
+  
+  return _impl_.shader_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AddCameraReq::release_shader() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddCameraReq.shader)
+  return _impl_.shader_.Release();
+}
+inline void AddCameraReq::set_allocated_shader(std::string* shader) {
+  if (shader != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.shader_.SetAllocated(shader, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shader_.IsDefault()) {
+    _impl_.shader_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddCameraReq.shader)
+}
+
+// -------------------------------------------------------------------
+
+// RemoveCameraReq
+
+// uint64 scene_id = 1;
+inline void RemoveCameraReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t RemoveCameraReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t RemoveCameraReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveCameraReq.scene_id)
+  return _internal_scene_id();
+}
+inline void RemoveCameraReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void RemoveCameraReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveCameraReq.scene_id)
+}
+
+// uint64 camera_id = 2;
+inline void RemoveCameraReq::clear_camera_id() {
+  _impl_.camera_id_ = uint64_t{0u};
+}
+inline uint64_t RemoveCameraReq::_internal_camera_id() const {
+  return _impl_.camera_id_;
+}
+inline uint64_t RemoveCameraReq::camera_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveCameraReq.camera_id)
+  return _internal_camera_id();
+}
+inline void RemoveCameraReq::_internal_set_camera_id(uint64_t value) {
+  
+  _impl_.camera_id_ = value;
+}
+inline void RemoveCameraReq::set_camera_id(uint64_t value) {
+  _internal_set_camera_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveCameraReq.camera_id)
+}
+
+// -------------------------------------------------------------------
+
+// AddPointLightReq
+
+// uint64 scene_id = 1;
+inline void AddPointLightReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t AddPointLightReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t AddPointLightReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.scene_id)
+  return _internal_scene_id();
+}
+inline void AddPointLightReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void AddPointLightReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.scene_id)
+}
+
+// .sapien.Renderer.server.proto.Vec3 position = 2;
+inline bool AddPointLightReq::_internal_has_position() const {
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
+}
+inline bool AddPointLightReq::has_position() const {
+  return _internal_has_position();
+}
+inline void AddPointLightReq::clear_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::_internal_position() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::position() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.position)
+  return _internal_position();
+}
+inline void AddPointLightReq::unsafe_arena_set_allocated_position(
+    ::sapien::Renderer::server::proto::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.position)
+}
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::release_position() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Vec4::_internal_set_x(float value) {
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddPointLightReq.position)
   
-  _impl_.x_ = value;
-}
-inline void Vec4::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.x)
-}
-
-// float y = 2;
-inline void Vec4::clear_y() {
-  _impl_.y_ = 0;
-}
-inline float Vec4::_internal_y() const {
-  return _impl_.y_;
-}
-inline float Vec4::y() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.y)
-  return _internal_y();
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+  return temp;
 }
-inline void Vec4::_internal_set_y(float value) {
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::_internal_mutable_position() {
   
-  _impl_.y_ = value;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
+  }
+  return _impl_.position_;
 }
-inline void Vec4::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.y)
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::mutable_position() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_position();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddPointLightReq.position)
+  return _msg;
+}
+inline void AddPointLightReq::set_allocated_position(::sapien::Renderer::server::proto::Vec3* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.position)
 }
 
-// float z = 3;
-inline void Vec4::clear_z() {
-  _impl_.z_ = 0;
+// .sapien.Renderer.server.proto.Vec3 color = 3;
+inline bool AddPointLightReq::_internal_has_color() const {
+  return this != internal_default_instance() && _impl_.color_ != nullptr;
 }
-inline float Vec4::_internal_z() const {
-  return _impl_.z_;
+inline bool AddPointLightReq::has_color() const {
+  return _internal_has_color();
 }
-inline float Vec4::z() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.z)
-  return _internal_z();
+inline void AddPointLightReq::clear_color() {
+  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
+    delete _impl_.color_;
+  }
+  _impl_.color_ = nullptr;
 }
-inline void Vec4::_internal_set_z(float value) {
-  
-  _impl_.z_ = value;
+inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::_internal_color() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.color_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
 }
-inline void Vec4::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.z)
+inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::color() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.color)
+  return _internal_color();
 }
-
-// float w = 4;
-inline void Vec4::clear_w() {
-  _impl_.w_ = 0;
+inline void AddPointLightReq::unsafe_arena_set_allocated_color(
+    ::sapien::Renderer::server::proto::Vec3* color) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+  }
+  _impl_.color_ = color;
+  if (color) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.color)
 }
-inline float Vec4::_internal_w() const {
-  return _impl_.w_;
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::release_color() {
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline float Vec4::w() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Vec4.w)
-  return _internal_w();
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::unsafe_arena_release_color() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddPointLightReq.color)
+  
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
+  return temp;
 }
-inline void Vec4::_internal_set_w(float value) {
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::_internal_mutable_color() {
   
-  _impl_.w_ = value;
+  if (_impl_.color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.color_ = p;
+  }
+  return _impl_.color_;
 }
-inline void Vec4::set_w(float value) {
-  _internal_set_w(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Vec4.w)
+inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::mutable_color() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_color();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddPointLightReq.color)
+  return _msg;
+}
+inline void AddPointLightReq::set_allocated_color(::sapien::Renderer::server::proto::Vec3* color) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.color_;
+  }
+  if (color) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(color);
+    if (message_arena != submessage_arena) {
+      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, color, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.color_ = color;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.color)
 }
 
-// -------------------------------------------------------------------
-
-// Quat
-
-// float w = 1;
-inline void Quat::clear_w() {
-  _impl_.w_ = 0;
+// bool shadow = 4;
+inline void AddPointLightReq::clear_shadow() {
+  _impl_.shadow_ = false;
 }
-inline float Quat::_internal_w() const {
-  return _impl_.w_;
+inline bool AddPointLightReq::_internal_shadow() const {
+  return _impl_.shadow_;
 }
-inline float Quat::w() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.w)
-  return _internal_w();
+inline bool AddPointLightReq::shadow() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow)
+  return _internal_shadow();
 }
-inline void Quat::_internal_set_w(float value) {
+inline void AddPointLightReq::_internal_set_shadow(bool value) {
   
-  _impl_.w_ = value;
+  _impl_.shadow_ = value;
 }
-inline void Quat::set_w(float value) {
-  _internal_set_w(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.w)
+inline void AddPointLightReq::set_shadow(bool value) {
+  _internal_set_shadow(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow)
 }
 
-// float x = 2;
-inline void Quat::clear_x() {
-  _impl_.x_ = 0;
+// float shadow_near = 5;
+inline void AddPointLightReq::clear_shadow_near() {
+  _impl_.shadow_near_ = 0;
 }
-inline float Quat::_internal_x() const {
-  return _impl_.x_;
+inline float AddPointLightReq::_internal_shadow_near() const {
+  return _impl_.shadow_near_;
 }
-inline float Quat::x() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.x)
-  return _internal_x();
+inline float AddPointLightReq::shadow_near() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_near)
+  return _internal_shadow_near();
 }
-inline void Quat::_internal_set_x(float value) {
+inline void AddPointLightReq::_internal_set_shadow_near(float value) {
   
-  _impl_.x_ = value;
+  _impl_.shadow_near_ = value;
 }
-inline void Quat::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.x)
+inline void AddPointLightReq::set_shadow_near(float value) {
+  _internal_set_shadow_near(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_near)
 }
 
-// float y = 3;
-inline void Quat::clear_y() {
-  _impl_.y_ = 0;
+// float shadow_far = 6;
+inline void AddPointLightReq::clear_shadow_far() {
+  _impl_.shadow_far_ = 0;
 }
-inline float Quat::_internal_y() const {
-  return _impl_.y_;
+inline float AddPointLightReq::_internal_shadow_far() const {
+  return _impl_.shadow_far_;
 }
-inline float Quat::y() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.y)
-  return _internal_y();
+inline float AddPointLightReq::shadow_far() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_far)
+  return _internal_shadow_far();
 }
-inline void Quat::_internal_set_y(float value) {
+inline void AddPointLightReq::_internal_set_shadow_far(float value) {
   
-  _impl_.y_ = value;
+  _impl_.shadow_far_ = value;
 }
-inline void Quat::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.y)
+inline void AddPointLightReq::set_shadow_far(float value) {
+  _internal_set_shadow_far(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_far)
 }
 
-// float z = 4;
-inline void Quat::clear_z() {
-  _impl_.z_ = 0;
+// int32 shadow_map_size = 7;
+inline void AddPointLightReq::clear_shadow_map_size() {
+  _impl_.shadow_map_size_ = 0;
 }
-inline float Quat::_internal_z() const {
-  return _impl_.z_;
+inline int32_t AddPointLightReq::_internal_shadow_map_size() const {
+  return _impl_.shadow_map_size_;
 }
-inline float Quat::z() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Quat.z)
-  return _internal_z();
+inline int32_t AddPointLightReq::shadow_map_size() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_map_size)
+  return _internal_shadow_map_size();
 }
-inline void Quat::_internal_set_z(float value) {
+inline void AddPointLightReq::_internal_set_shadow_map_size(int32_t value) {
   
-  _impl_.z_ = value;
+  _impl_.shadow_map_size_ = value;
 }
-inline void Quat::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Quat.z)
+inline void AddPointLightReq::set_shadow_map_size(int32_t value) {
+  _internal_set_shadow_map_size(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_map_size)
 }
 
 // -------------------------------------------------------------------
 
-// Pose
+// AddDirectionalLightReq
 
-// .sapien.Renderer.server.proto.Vec3 p = 1;
-inline bool Pose::_internal_has_p() const {
-  return this != internal_default_instance() && _impl_.p_ != nullptr;
+// uint64 scene_id = 1;
+inline void AddDirectionalLightReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
 }
-inline bool Pose::has_p() const {
-  return _internal_has_p();
+inline uint64_t AddDirectionalLightReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
 }
-inline void Pose::clear_p() {
-  if (GetArenaForAllocation() == nullptr && _impl_.p_ != nullptr) {
-    delete _impl_.p_;
+inline uint64_t AddDirectionalLightReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.scene_id)
+  return _internal_scene_id();
+}
+inline void AddDirectionalLightReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void AddDirectionalLightReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.scene_id)
+}
+
+// .sapien.Renderer.server.proto.Vec3 direction = 2;
+inline bool AddDirectionalLightReq::_internal_has_direction() const {
+  return this != internal_default_instance() && _impl_.direction_ != nullptr;
+}
+inline bool AddDirectionalLightReq::has_direction() const {
+  return _internal_has_direction();
+}
+inline void AddDirectionalLightReq::clear_direction() {
+  if (GetArenaForAllocation() == nullptr && _impl_.direction_ != nullptr) {
+    delete _impl_.direction_;
   }
-  _impl_.p_ = nullptr;
+  _impl_.direction_ = nullptr;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& Pose::_internal_p() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.p_;
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_direction() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.direction_;
   return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
       ::sapien::Renderer::server::proto::_Vec3_default_instance_);
 }
-inline const ::sapien::Renderer::server::proto::Vec3& Pose::p() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Pose.p)
-  return _internal_p();
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::direction() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
+  return _internal_direction();
 }
-inline void Pose::unsafe_arena_set_allocated_p(
-    ::sapien::Renderer::server::proto::Vec3* p) {
+inline void AddDirectionalLightReq::unsafe_arena_set_allocated_direction(
+    ::sapien::Renderer::server::proto::Vec3* direction) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.direction_);
   }
-  _impl_.p_ = p;
-  if (p) {
+  _impl_.direction_ = direction;
+  if (direction) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Pose.p)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
 }
-inline ::sapien::Renderer::server::proto::Vec3* Pose::release_p() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_direction() {
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.p_;
-  _impl_.p_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.direction_;
+  _impl_.direction_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5563,85 +9103,85 @@ inline ::sapien::Renderer::server::proto::Vec3* Pose::release_p() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* Pose::unsafe_arena_release_p() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Pose.p)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_direction() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.p_;
-  _impl_.p_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.direction_;
+  _impl_.direction_ = nullptr;
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* Pose::_internal_mutable_p() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_direction() {
   
-  if (_impl_.p_ == nullptr) {
+  if (_impl_.direction_ == nullptr) {
     auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.p_ = p;
+    _impl_.direction_ = p;
   }
-  return _impl_.p_;
+  return _impl_.direction_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* Pose::mutable_p() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_p();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Pose.p)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_direction() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_direction();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
   return _msg;
 }
-inline void Pose::set_allocated_p(::sapien::Renderer::server::proto::Vec3* p) {
+inline void AddDirectionalLightReq::set_allocated_direction(::sapien::Renderer::server::proto::Vec3* direction) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.p_;
+    delete _impl_.direction_;
   }
-  if (p) {
+  if (direction) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(direction);
     if (message_arena != submessage_arena) {
-      p = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, p, submessage_arena);
+      direction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, direction, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.p_ = p;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Pose.p)
+  _impl_.direction_ = direction;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
 }
 
-// .sapien.Renderer.server.proto.Quat q = 2;
-inline bool Pose::_internal_has_q() const {
-  return this != internal_default_instance() && _impl_.q_ != nullptr;
+// .sapien.Renderer.server.proto.Vec3 color = 3;
+inline bool AddDirectionalLightReq::_internal_has_color() const {
+  return this != internal_default_instance() && _impl_.color_ != nullptr;
 }
-inline bool Pose::has_q() const {
-  return _internal_has_q();
+inline bool AddDirectionalLightReq::has_color() const {
+  return _internal_has_color();
 }
-inline void Pose::clear_q() {
-  if (GetArenaForAllocation() == nullptr && _impl_.q_ != nullptr) {
-    delete _impl_.q_;
+inline void AddDirectionalLightReq::clear_color() {
+  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
+    delete _impl_.color_;
   }
-  _impl_.q_ = nullptr;
+  _impl_.color_ = nullptr;
 }
-inline const ::sapien::Renderer::server::proto::Quat& Pose::_internal_q() const {
-  const ::sapien::Renderer::server::proto::Quat* p = _impl_.q_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Quat&>(
-      ::sapien::Renderer::server::proto::_Quat_default_instance_);
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_color() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.color_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
+      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
 }
-inline const ::sapien::Renderer::server::proto::Quat& Pose::q() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Pose.q)
-  return _internal_q();
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::color() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
+  return _internal_color();
 }
-inline void Pose::unsafe_arena_set_allocated_q(
-    ::sapien::Renderer::server::proto::Quat* q) {
+inline void AddDirectionalLightReq::unsafe_arena_set_allocated_color(
+    ::sapien::Renderer::server::proto::Vec3* color) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.q_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
   }
-  _impl_.q_ = q;
-  if (q) {
+  _impl_.color_ = color;
+  if (color) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Pose.q)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
 }
-inline ::sapien::Renderer::server::proto::Quat* Pose::release_q() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_color() {
   
-  ::sapien::Renderer::server::proto::Quat* temp = _impl_.q_;
-  _impl_.q_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5653,109 +9193,105 @@ inline ::sapien::Renderer::server::proto::Quat* Pose::release_q() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Quat* Pose::unsafe_arena_release_q() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Pose.q)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_color() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
   
-  ::sapien::Renderer::server::proto::Quat* temp = _impl_.q_;
-  _impl_.q_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Quat* Pose::_internal_mutable_q() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_color() {
   
-  if (_impl_.q_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Quat>(GetArenaForAllocation());
-    _impl_.q_ = p;
+  if (_impl_.color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
+    _impl_.color_ = p;
   }
-  return _impl_.q_;
+  return _impl_.color_;
 }
-inline ::sapien::Renderer::server::proto::Quat* Pose::mutable_q() {
-  ::sapien::Renderer::server::proto::Quat* _msg = _internal_mutable_q();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Pose.q)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_color() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_color();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
   return _msg;
 }
-inline void Pose::set_allocated_q(::sapien::Renderer::server::proto::Quat* q) {
+inline void AddDirectionalLightReq::set_allocated_color(::sapien::Renderer::server::proto::Vec3* color) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.q_;
+    delete _impl_.color_;
   }
-  if (q) {
+  if (color) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(q);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(color);
     if (message_arena != submessage_arena) {
-      q = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, q, submessage_arena);
+      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, color, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.q_ = q;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.Pose.q)
+  _impl_.color_ = color;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
 }
 
-// -------------------------------------------------------------------
-
-// IdVec3
-
-// uint64 id = 1;
-inline void IdVec3::clear_id() {
-  _impl_.id_ = uint64_t{0u};
+// bool shadow = 4;
+inline void AddDirectionalLightReq::clear_shadow() {
+  _impl_.shadow_ = false;
 }
-inline uint64_t IdVec3::_internal_id() const {
-  return _impl_.id_;
+inline bool AddDirectionalLightReq::_internal_shadow() const {
+  return _impl_.shadow_;
 }
-inline uint64_t IdVec3::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec3.id)
-  return _internal_id();
+inline bool AddDirectionalLightReq::shadow() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow)
+  return _internal_shadow();
 }
-inline void IdVec3::_internal_set_id(uint64_t value) {
+inline void AddDirectionalLightReq::_internal_set_shadow(bool value) {
   
-  _impl_.id_ = value;
+  _impl_.shadow_ = value;
 }
-inline void IdVec3::set_id(uint64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdVec3.id)
+inline void AddDirectionalLightReq::set_shadow(bool value) {
+  _internal_set_shadow(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow)
 }
 
-// .sapien.Renderer.server.proto.Vec3 data = 2;
-inline bool IdVec3::_internal_has_data() const {
-  return this != internal_default_instance() && _impl_.data_ != nullptr;
+// .sapien.Renderer.server.proto.Vec3 position = 5;
+inline bool AddDirectionalLightReq::_internal_has_position() const {
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
-inline bool IdVec3::has_data() const {
-  return _internal_has_data();
+inline bool AddDirectionalLightReq::has_position() const {
+  return _internal_has_position();
 }
-inline void IdVec3::clear_data() {
-  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
-    delete _impl_.data_;
+inline void AddDirectionalLightReq::clear_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  _impl_.data_ = nullptr;
+  _impl_.position_ = nullptr;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& IdVec3::_internal_data() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.data_;
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_position() const {
+  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.position_;
   return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
       ::sapien::Renderer::server::proto::_Vec3_default_instance_);
 }
-inline const ::sapien::Renderer::server::proto::Vec3& IdVec3::data() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec3.data)
-  return _internal_data();
+inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::position() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
+  return _internal_position();
 }
-inline void IdVec3::unsafe_arena_set_allocated_data(
-    ::sapien::Renderer::server::proto::Vec3* data) {
+inline void AddDirectionalLightReq::unsafe_arena_set_allocated_position(
+    ::sapien::Renderer::server::proto::Vec3* position) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
   }
-  _impl_.data_ = data;
-  if (data) {
+  _impl_.position_ = position;
+  if (position) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.IdVec3.data)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
 }
-inline ::sapien::Renderer::server::proto::Vec3* IdVec3::release_data() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_position() {
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.data_;
-  _impl_.data_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5767,2341 +9303,3097 @@ inline ::sapien::Renderer::server::proto::Vec3* IdVec3::release_data() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* IdVec3::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.IdVec3.data)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.data_;
-  _impl_.data_ = nullptr;
+  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* IdVec3::_internal_mutable_data() {
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_position() {
   
-  if (_impl_.data_ == nullptr) {
+  if (_impl_.position_ == nullptr) {
     auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.data_ = p;
+    _impl_.position_ = p;
   }
-  return _impl_.data_;
+  return _impl_.position_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* IdVec3::mutable_data() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.IdVec3.data)
+inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_position() {
+  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_position();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
   return _msg;
 }
-inline void IdVec3::set_allocated_data(::sapien::Renderer::server::proto::Vec3* data) {
+inline void AddDirectionalLightReq::set_allocated_position(::sapien::Renderer::server::proto::Vec3* position) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.data_;
+    delete _impl_.position_;
   }
-  if (data) {
+  if (position) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
-      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, data, submessage_arena);
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.data_ = data;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.IdVec3.data)
+  _impl_.position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
+}
+
+// float shadow_scale = 6;
+inline void AddDirectionalLightReq::clear_shadow_scale() {
+  _impl_.shadow_scale_ = 0;
+}
+inline float AddDirectionalLightReq::_internal_shadow_scale() const {
+  return _impl_.shadow_scale_;
+}
+inline float AddDirectionalLightReq::shadow_scale() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_scale)
+  return _internal_shadow_scale();
+}
+inline void AddDirectionalLightReq::_internal_set_shadow_scale(float value) {
+  
+  _impl_.shadow_scale_ = value;
+}
+inline void AddDirectionalLightReq::set_shadow_scale(float value) {
+  _internal_set_shadow_scale(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_scale)
+}
+
+// float shadow_near = 7;
+inline void AddDirectionalLightReq::clear_shadow_near() {
+  _impl_.shadow_near_ = 0;
+}
+inline float AddDirectionalLightReq::_internal_shadow_near() const {
+  return _impl_.shadow_near_;
+}
+inline float AddDirectionalLightReq::shadow_near() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_near)
+  return _internal_shadow_near();
+}
+inline void AddDirectionalLightReq::_internal_set_shadow_near(float value) {
+  
+  _impl_.shadow_near_ = value;
+}
+inline void AddDirectionalLightReq::set_shadow_near(float value) {
+  _internal_set_shadow_near(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_near)
+}
+
+// float shadow_far = 8;
+inline void AddDirectionalLightReq::clear_shadow_far() {
+  _impl_.shadow_far_ = 0;
+}
+inline float AddDirectionalLightReq::_internal_shadow_far() const {
+  return _impl_.shadow_far_;
+}
+inline float AddDirectionalLightReq::shadow_far() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_far)
+  return _internal_shadow_far();
+}
+inline void AddDirectionalLightReq::_internal_set_shadow_far(float value) {
+  
+  _impl_.shadow_far_ = value;
+}
+inline void AddDirectionalLightReq::set_shadow_far(float value) {
+  _internal_set_shadow_far(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_far)
+}
+
+// int32 shadow_map_size = 9;
+inline void AddDirectionalLightReq::clear_shadow_map_size() {
+  _impl_.shadow_map_size_ = 0;
+}
+inline int32_t AddDirectionalLightReq::_internal_shadow_map_size() const {
+  return _impl_.shadow_map_size_;
+}
+inline int32_t AddDirectionalLightReq::shadow_map_size() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_map_size)
+  return _internal_shadow_map_size();
+}
+inline void AddDirectionalLightReq::_internal_set_shadow_map_size(int32_t value) {
+  
+  _impl_.shadow_map_size_ = value;
+}
+inline void AddDirectionalLightReq::set_shadow_map_size(int32_t value) {
+  _internal_set_shadow_map_size(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_map_size)
 }
 
 // -------------------------------------------------------------------
 
-// IdVec4
+// RemoveLightReq
 
-// uint64 id = 1;
-inline void IdVec4::clear_id() {
-  _impl_.id_ = uint64_t{0u};
+// uint64 scene_id = 1;
+inline void RemoveLightReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t IdVec4::_internal_id() const {
-  return _impl_.id_;
+inline uint64_t RemoveLightReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
 }
-inline uint64_t IdVec4::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec4.id)
-  return _internal_id();
+inline uint64_t RemoveLightReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveLightReq.scene_id)
+  return _internal_scene_id();
+}
+inline void RemoveLightReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void RemoveLightReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveLightReq.scene_id)
+}
+
+// uint64 light_id = 2;
+inline void RemoveLightReq::clear_light_id() {
+  _impl_.light_id_ = uint64_t{0u};
+}
+inline uint64_t RemoveLightReq::_internal_light_id() const {
+  return _impl_.light_id_;
+}
+inline uint64_t RemoveLightReq::light_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveLightReq.light_id)
+  return _internal_light_id();
+}
+inline void RemoveLightReq::_internal_set_light_id(uint64_t value) {
+  
+  _impl_.light_id_ = value;
+}
+inline void RemoveLightReq::set_light_id(uint64_t value) {
+  _internal_set_light_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveLightReq.light_id)
+}
+
+// -------------------------------------------------------------------
+
+// EntityOrderReq
+
+// uint64 scene_id = 1;
+inline void EntityOrderReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t EntityOrderReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t EntityOrderReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.scene_id)
+  return _internal_scene_id();
+}
+inline void EntityOrderReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void EntityOrderReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.scene_id)
+}
+
+// repeated uint64 body_ids = 2 [packed = true];
+inline int EntityOrderReq::_internal_body_ids_size() const {
+  return _impl_.body_ids_.size();
+}
+inline int EntityOrderReq::body_ids_size() const {
+  return _internal_body_ids_size();
+}
+inline void EntityOrderReq::clear_body_ids() {
+  _impl_.body_ids_.Clear();
+}
+inline uint64_t EntityOrderReq::_internal_body_ids(int index) const {
+  return _impl_.body_ids_.Get(index);
+}
+inline uint64_t EntityOrderReq::body_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+  return _internal_body_ids(index);
+}
+inline void EntityOrderReq::set_body_ids(int index, uint64_t value) {
+  _impl_.body_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+}
+inline void EntityOrderReq::_internal_add_body_ids(uint64_t value) {
+  _impl_.body_ids_.Add(value);
+}
+inline void EntityOrderReq::add_body_ids(uint64_t value) {
+  _internal_add_body_ids(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+EntityOrderReq::_internal_body_ids() const {
+  return _impl_.body_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+EntityOrderReq::body_ids() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+  return _internal_body_ids();
 }
-inline void IdVec4::_internal_set_id(uint64_t value) {
-  
-  _impl_.id_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+EntityOrderReq::_internal_mutable_body_ids() {
+  return &_impl_.body_ids_;
 }
-inline void IdVec4::set_id(uint64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdVec4.id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+EntityOrderReq::mutable_body_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+  return _internal_mutable_body_ids();
 }
 
-// .sapien.Renderer.server.proto.Vec4 data = 2;
-inline bool IdVec4::_internal_has_data() const {
-  return this != internal_default_instance() && _impl_.data_ != nullptr;
+// repeated uint64 camera_ids = 3 [packed = true];
+inline int EntityOrderReq::_internal_camera_ids_size() const {
+  return _impl_.camera_ids_.size();
 }
-inline bool IdVec4::has_data() const {
-  return _internal_has_data();
+inline int EntityOrderReq::camera_ids_size() const {
+  return _internal_camera_ids_size();
 }
-inline void IdVec4::clear_data() {
-  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
-    delete _impl_.data_;
-  }
-  _impl_.data_ = nullptr;
+inline void EntityOrderReq::clear_camera_ids() {
+  _impl_.camera_ids_.Clear();
 }
-inline const ::sapien::Renderer::server::proto::Vec4& IdVec4::_internal_data() const {
-  const ::sapien::Renderer::server::proto::Vec4* p = _impl_.data_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec4&>(
-      ::sapien::Renderer::server::proto::_Vec4_default_instance_);
+inline uint64_t EntityOrderReq::_internal_camera_ids(int index) const {
+  return _impl_.camera_ids_.Get(index);
 }
-inline const ::sapien::Renderer::server::proto::Vec4& IdVec4::data() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdVec4.data)
-  return _internal_data();
+inline uint64_t EntityOrderReq::camera_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
+  return _internal_camera_ids(index);
 }
-inline void IdVec4::unsafe_arena_set_allocated_data(
-    ::sapien::Renderer::server::proto::Vec4* data) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
-  }
-  _impl_.data_ = data;
-  if (data) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.IdVec4.data)
+inline void EntityOrderReq::set_camera_ids(int index, uint64_t value) {
+  _impl_.camera_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
 }
-inline ::sapien::Renderer::server::proto::Vec4* IdVec4::release_data() {
-  
-  ::sapien::Renderer::server::proto::Vec4* temp = _impl_.data_;
-  _impl_.data_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void EntityOrderReq::_internal_add_camera_ids(uint64_t value) {
+  _impl_.camera_ids_.Add(value);
 }
-inline ::sapien::Renderer::server::proto::Vec4* IdVec4::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.IdVec4.data)
-  
-  ::sapien::Renderer::server::proto::Vec4* temp = _impl_.data_;
-  _impl_.data_ = nullptr;
-  return temp;
+inline void EntityOrderReq::add_camera_ids(uint64_t value) {
+  _internal_add_camera_ids(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
 }
-inline ::sapien::Renderer::server::proto::Vec4* IdVec4::_internal_mutable_data() {
-  
-  if (_impl_.data_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec4>(GetArenaForAllocation());
-    _impl_.data_ = p;
-  }
-  return _impl_.data_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+EntityOrderReq::_internal_camera_ids() const {
+  return _impl_.camera_ids_;
 }
-inline ::sapien::Renderer::server::proto::Vec4* IdVec4::mutable_data() {
-  ::sapien::Renderer::server::proto::Vec4* _msg = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.IdVec4.data)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+EntityOrderReq::camera_ids() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
+  return _internal_camera_ids();
 }
-inline void IdVec4::set_allocated_data(::sapien::Renderer::server::proto::Vec4* data) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.data_;
-  }
-  if (data) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
-    if (message_arena != submessage_arena) {
-      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, data, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.data_ = data;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.IdVec4.data)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+EntityOrderReq::_internal_mutable_camera_ids() {
+  return &_impl_.camera_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+EntityOrderReq::mutable_camera_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
+  return _internal_mutable_camera_ids();
 }
 
 // -------------------------------------------------------------------
 
-// IdFloat
+// UpdateRenderReq
 
-// uint64 id = 1;
-inline void IdFloat::clear_id() {
-  _impl_.id_ = uint64_t{0u};
+// uint64 scene_id = 1;
+inline void UpdateRenderReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t IdFloat::_internal_id() const {
-  return _impl_.id_;
+inline uint64_t UpdateRenderReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
 }
-inline uint64_t IdFloat::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdFloat.id)
-  return _internal_id();
+inline uint64_t UpdateRenderReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.scene_id)
+  return _internal_scene_id();
 }
-inline void IdFloat::_internal_set_id(uint64_t value) {
+inline void UpdateRenderReq::_internal_set_scene_id(uint64_t value) {
   
-  _impl_.id_ = value;
+  _impl_.scene_id_ = value;
 }
-inline void IdFloat::set_id(uint64_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdFloat.id)
+inline void UpdateRenderReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderReq.scene_id)
 }
 
-// float data = 2;
-inline void IdFloat::clear_data() {
-  _impl_.data_ = 0;
+// repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
+inline int UpdateRenderReq::_internal_body_poses_size() const {
+  return _impl_.body_poses_.size();
 }
-inline float IdFloat::_internal_data() const {
-  return _impl_.data_;
+inline int UpdateRenderReq::body_poses_size() const {
+  return _internal_body_poses_size();
 }
-inline float IdFloat::data() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.IdFloat.data)
-  return _internal_data();
+inline void UpdateRenderReq::clear_body_poses() {
+  _impl_.body_poses_.Clear();
 }
-inline void IdFloat::_internal_set_data(float value) {
-  
-  _impl_.data_ = value;
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::mutable_body_poses(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
+  return _impl_.body_poses_.Mutable(index);
 }
-inline void IdFloat::set_data(float value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.IdFloat.data)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
+UpdateRenderReq::mutable_body_poses() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
+  return &_impl_.body_poses_;
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::_internal_body_poses(int index) const {
+  return _impl_.body_poses_.Get(index);
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::body_poses(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
+  return _internal_body_poses(index);
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::_internal_add_body_poses() {
+  return _impl_.body_poses_.Add();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::add_body_poses() {
+  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_body_poses();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
+UpdateRenderReq::body_poses() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
+  return _impl_.body_poses_;
 }
 
-// -------------------------------------------------------------------
-
-// AddBodyMeshReq
-
-// uint64 scene_id = 1;
-inline void AddBodyMeshReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// repeated .sapien.Renderer.server.proto.Pose camera_poses = 3;
+inline int UpdateRenderReq::_internal_camera_poses_size() const {
+  return _impl_.camera_poses_.size();
 }
-inline uint64_t AddBodyMeshReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline int UpdateRenderReq::camera_poses_size() const {
+  return _internal_camera_poses_size();
 }
-inline uint64_t AddBodyMeshReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.scene_id)
-  return _internal_scene_id();
+inline void UpdateRenderReq::clear_camera_poses() {
+  _impl_.camera_poses_.Clear();
 }
-inline void AddBodyMeshReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::mutable_camera_poses(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
+  return _impl_.camera_poses_.Mutable(index);
 }
-inline void AddBodyMeshReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyMeshReq.scene_id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
+UpdateRenderReq::mutable_camera_poses() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
+  return &_impl_.camera_poses_;
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::_internal_camera_poses(int index) const {
+  return _impl_.camera_poses_.Get(index);
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::camera_poses(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
+  return _internal_camera_poses(index);
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::_internal_add_camera_poses() {
+  return _impl_.camera_poses_.Add();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::add_camera_poses() {
+  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_camera_poses();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
+UpdateRenderReq::camera_poses() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
+  return _impl_.camera_poses_;
 }
 
-// string filename = 2;
-inline void AddBodyMeshReq::clear_filename() {
-  _impl_.filename_.ClearToEmpty();
+// repeated float body_pose_data = 4;
+inline int UpdateRenderReq::_internal_body_pose_data_size() const {
+  return _impl_.body_pose_data_.size();
 }
-inline const std::string& AddBodyMeshReq::filename() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
-  return _internal_filename();
+inline int UpdateRenderReq::body_pose_data_size() const {
+  return _internal_body_pose_data_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AddBodyMeshReq::set_filename(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+inline void UpdateRenderReq::clear_body_pose_data() {
+  _impl_.body_pose_data_.Clear();
 }
-inline std::string* AddBodyMeshReq::mutable_filename() {
-  std::string* _s = _internal_mutable_filename();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
-  return _s;
+inline float UpdateRenderReq::_internal_body_pose_data(int index) const {
+  return _impl_.body_pose_data_.Get(index);
 }
-inline const std::string& AddBodyMeshReq::_internal_filename() const {
-  return _impl_.filename_.Get();
+inline float UpdateRenderReq::body_pose_data(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.body_pose_data)
+  return _internal_body_pose_data(index);
 }
-inline void AddBodyMeshReq::_internal_set_filename(const std::string& value) {
-  
-  _impl_.filename_.Set(value, GetArenaForAllocation());
+inline void UpdateRenderReq::set_body_pose_data(int index, float value) {
+  _impl_.body_pose_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderReq.body_pose_data)
 }
-inline std::string* AddBodyMeshReq::_internal_mutable_filename() {
-  
-  return _impl_.filename_.Mutable(GetArenaForAllocation());
+inline void UpdateRenderReq::_internal_add_body_pose_data(float value) {
+  _impl_.body_pose_data_.Add(value);
 }
-inline std::string* AddBodyMeshReq::release_filename() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
-  return _impl_.filename_.Release();
+inline void UpdateRenderReq::add_body_pose_data(float value) {
+  _internal_add_body_pose_data(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.body_pose_data)
 }
-inline void AddBodyMeshReq::set_allocated_filename(std::string* filename) {
-  if (filename != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filename_.IsDefault()) {
-    _impl_.filename_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.filename)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderReq::_internal_body_pose_data() const {
+  return _impl_.body_pose_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderReq::body_pose_data() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.body_pose_data)
+  return _internal_body_pose_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderReq::_internal_mutable_body_pose_data() {
+  return &_impl_.body_pose_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderReq::mutable_body_pose_data() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.body_pose_data)
+  return _internal_mutable_body_pose_data();
 }
 
-// .sapien.Renderer.server.proto.Vec3 scale = 3;
-inline bool AddBodyMeshReq::_internal_has_scale() const {
-  return this != internal_default_instance() && _impl_.scale_ != nullptr;
+// repeated float camera_pose_data = 5;
+inline int UpdateRenderReq::_internal_camera_pose_data_size() const {
+  return _impl_.camera_pose_data_.size();
 }
-inline bool AddBodyMeshReq::has_scale() const {
-  return _internal_has_scale();
+inline int UpdateRenderReq::camera_pose_data_size() const {
+  return _internal_camera_pose_data_size();
 }
-inline void AddBodyMeshReq::clear_scale() {
-  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
-    delete _impl_.scale_;
-  }
-  _impl_.scale_ = nullptr;
+inline void UpdateRenderReq::clear_camera_pose_data() {
+  _impl_.camera_pose_data_.Clear();
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddBodyMeshReq::_internal_scale() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.scale_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline float UpdateRenderReq::_internal_camera_pose_data(int index) const {
+  return _impl_.camera_pose_data_.Get(index);
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddBodyMeshReq::scale() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
-  return _internal_scale();
+inline float UpdateRenderReq::camera_pose_data(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.camera_pose_data)
+  return _internal_camera_pose_data(index);
 }
-inline void AddBodyMeshReq::unsafe_arena_set_allocated_scale(
-    ::sapien::Renderer::server::proto::Vec3* scale) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
-  }
-  _impl_.scale_ = scale;
-  if (scale) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+inline void UpdateRenderReq::set_camera_pose_data(int index, float value) {
+  _impl_.camera_pose_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderReq.camera_pose_data)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::release_scale() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
-  _impl_.scale_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void UpdateRenderReq::_internal_add_camera_pose_data(float value) {
+  _impl_.camera_pose_data_.Add(value);
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::unsafe_arena_release_scale() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
-  _impl_.scale_ = nullptr;
-  return temp;
+inline void UpdateRenderReq::add_camera_pose_data(float value) {
+  _internal_add_camera_pose_data(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.camera_pose_data)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::_internal_mutable_scale() {
-  
-  if (_impl_.scale_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.scale_ = p;
-  }
-  return _impl_.scale_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderReq::_internal_camera_pose_data() const {
+  return _impl_.camera_pose_data_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyMeshReq::mutable_scale() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_scale();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderReq::camera_pose_data() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_pose_data)
+  return _internal_camera_pose_data();
 }
-inline void AddBodyMeshReq::set_allocated_scale(::sapien::Renderer::server::proto::Vec3* scale) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.scale_;
-  }
-  if (scale) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
-    if (message_arena != submessage_arena) {
-      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, scale, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.scale_ = scale;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyMeshReq.scale)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderReq::_internal_mutable_camera_pose_data() {
+  return &_impl_.camera_pose_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderReq::mutable_camera_pose_data() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_pose_data)
+  return _internal_mutable_camera_pose_data();
 }
 
 // -------------------------------------------------------------------
 
-// AddBodyPrimitiveReq
+// BodyIdReq
 
 // uint64 scene_id = 1;
-inline void AddBodyPrimitiveReq::clear_scene_id() {
+inline void BodyIdReq::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t AddBodyPrimitiveReq::_internal_scene_id() const {
+inline uint64_t BodyIdReq::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t AddBodyPrimitiveReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scene_id)
+inline uint64_t BodyIdReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.scene_id)
   return _internal_scene_id();
 }
-inline void AddBodyPrimitiveReq::_internal_set_scene_id(uint64_t value) {
+inline void BodyIdReq::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void AddBodyPrimitiveReq::set_scene_id(uint64_t value) {
+inline void BodyIdReq::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.scene_id)
 }
 
-// .sapien.Renderer.server.proto.PrimitiveType type = 2;
-inline void AddBodyPrimitiveReq::clear_type() {
-  _impl_.type_ = 0;
+// uint64 body_id = 2;
+inline void BodyIdReq::clear_body_id() {
+  _impl_.body_id_ = uint64_t{0u};
 }
-inline ::sapien::Renderer::server::proto::PrimitiveType AddBodyPrimitiveReq::_internal_type() const {
-  return static_cast< ::sapien::Renderer::server::proto::PrimitiveType >(_impl_.type_);
+inline uint64_t BodyIdReq::_internal_body_id() const {
+  return _impl_.body_id_;
 }
-inline ::sapien::Renderer::server::proto::PrimitiveType AddBodyPrimitiveReq::type() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.type)
-  return _internal_type();
+inline uint64_t BodyIdReq::body_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.body_id)
+  return _internal_body_id();
 }
-inline void AddBodyPrimitiveReq::_internal_set_type(::sapien::Renderer::server::proto::PrimitiveType value) {
+inline void BodyIdReq::_internal_set_body_id(uint64_t value) {
   
-  _impl_.type_ = value;
+  _impl_.body_id_ = value;
 }
-inline void AddBodyPrimitiveReq::set_type(::sapien::Renderer::server::proto::PrimitiveType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.type)
+inline void BodyIdReq::set_body_id(uint64_t value) {
+  _internal_set_body_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.body_id)
 }
 
-// .sapien.Renderer.server.proto.Vec3 scale = 3;
-inline bool AddBodyPrimitiveReq::_internal_has_scale() const {
-  return this != internal_default_instance() && _impl_.scale_ != nullptr;
+// uint32 id = 3;
+inline void BodyIdReq::clear_id() {
+  _impl_.id_ = 0u;
 }
-inline bool AddBodyPrimitiveReq::has_scale() const {
-  return _internal_has_scale();
+inline uint32_t BodyIdReq::_internal_id() const {
+  return _impl_.id_;
 }
-inline void AddBodyPrimitiveReq::clear_scale() {
-  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
-    delete _impl_.scale_;
-  }
-  _impl_.scale_ = nullptr;
+inline uint32_t BodyIdReq::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.id)
+  return _internal_id();
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddBodyPrimitiveReq::_internal_scale() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.scale_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline void BodyIdReq::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddBodyPrimitiveReq::scale() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
-  return _internal_scale();
+inline void BodyIdReq::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.id)
 }
-inline void AddBodyPrimitiveReq::unsafe_arena_set_allocated_scale(
-    ::sapien::Renderer::server::proto::Vec3* scale) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
-  }
-  _impl_.scale_ = scale;
-  if (scale) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+
+// -------------------------------------------------------------------
+
+// BodyUint32Req
+
+// uint64 scene_id = 1;
+inline void BodyUint32Req::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::release_scale() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
-  _impl_.scale_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline uint64_t BodyUint32Req::_internal_scene_id() const {
+  return _impl_.scene_id_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::unsafe_arena_release_scale() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+inline uint64_t BodyUint32Req::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.scene_id)
+  return _internal_scene_id();
+}
+inline void BodyUint32Req::_internal_set_scene_id(uint64_t value) {
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.scale_;
-  _impl_.scale_ = nullptr;
-  return temp;
+  _impl_.scene_id_ = value;
+}
+inline void BodyUint32Req::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.scene_id)
+}
+
+// uint64 body_id = 2;
+inline void BodyUint32Req::clear_body_id() {
+  _impl_.body_id_ = uint64_t{0u};
+}
+inline uint64_t BodyUint32Req::_internal_body_id() const {
+  return _impl_.body_id_;
+}
+inline uint64_t BodyUint32Req::body_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.body_id)
+  return _internal_body_id();
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::_internal_mutable_scale() {
+inline void BodyUint32Req::_internal_set_body_id(uint64_t value) {
   
-  if (_impl_.scale_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.scale_ = p;
-  }
-  return _impl_.scale_;
-}
-inline ::sapien::Renderer::server::proto::Vec3* AddBodyPrimitiveReq::mutable_scale() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_scale();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
-  return _msg;
+  _impl_.body_id_ = value;
 }
-inline void AddBodyPrimitiveReq::set_allocated_scale(::sapien::Renderer::server::proto::Vec3* scale) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.scale_;
-  }
-  if (scale) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
-    if (message_arena != submessage_arena) {
-      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, scale, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.scale_ = scale;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddBodyPrimitiveReq.scale)
+inline void BodyUint32Req::set_body_id(uint64_t value) {
+  _internal_set_body_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.body_id)
 }
 
-// uint64 material = 4;
-inline void AddBodyPrimitiveReq::clear_material() {
-  _impl_.material_ = uint64_t{0u};
+// uint32 id = 3;
+inline void BodyUint32Req::clear_id() {
+  _impl_.id_ = 0u;
 }
-inline uint64_t AddBodyPrimitiveReq::_internal_material() const {
-  return _impl_.material_;
+inline uint32_t BodyUint32Req::_internal_id() const {
+  return _impl_.id_;
 }
-inline uint64_t AddBodyPrimitiveReq::material() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddBodyPrimitiveReq.material)
-  return _internal_material();
+inline uint32_t BodyUint32Req::id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.id)
+  return _internal_id();
 }
-inline void AddBodyPrimitiveReq::_internal_set_material(uint64_t value) {
+inline void BodyUint32Req::_internal_set_id(uint32_t value) {
   
-  _impl_.material_ = value;
+  _impl_.id_ = value;
 }
-inline void AddBodyPrimitiveReq::set_material(uint64_t value) {
-  _internal_set_material(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddBodyPrimitiveReq.material)
+inline void BodyUint32Req::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.id)
 }
 
 // -------------------------------------------------------------------
 
-// RemoveBodyReq
+// BodyFloat32Req
 
 // uint64 scene_id = 1;
-inline void RemoveBodyReq::clear_scene_id() {
+inline void BodyFloat32Req::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t RemoveBodyReq::_internal_scene_id() const {
+inline uint64_t BodyFloat32Req::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t RemoveBodyReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveBodyReq.scene_id)
+inline uint64_t BodyFloat32Req::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.scene_id)
   return _internal_scene_id();
 }
-inline void RemoveBodyReq::_internal_set_scene_id(uint64_t value) {
+inline void BodyFloat32Req::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void RemoveBodyReq::set_scene_id(uint64_t value) {
+inline void BodyFloat32Req::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveBodyReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.scene_id)
 }
 
 // uint64 body_id = 2;
-inline void RemoveBodyReq::clear_body_id() {
+inline void BodyFloat32Req::clear_body_id() {
   _impl_.body_id_ = uint64_t{0u};
 }
-inline uint64_t RemoveBodyReq::_internal_body_id() const {
+inline uint64_t BodyFloat32Req::_internal_body_id() const {
   return _impl_.body_id_;
 }
-inline uint64_t RemoveBodyReq::body_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveBodyReq.body_id)
+inline uint64_t BodyFloat32Req::body_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.body_id)
   return _internal_body_id();
 }
-inline void RemoveBodyReq::_internal_set_body_id(uint64_t value) {
+inline void BodyFloat32Req::_internal_set_body_id(uint64_t value) {
   
   _impl_.body_id_ = value;
 }
-inline void RemoveBodyReq::set_body_id(uint64_t value) {
+inline void BodyFloat32Req::set_body_id(uint64_t value) {
   _internal_set_body_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveBodyReq.body_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.body_id)
+}
+
+// float value = 3;
+inline void BodyFloat32Req::clear_value() {
+  _impl_.value_ = 0;
+}
+inline float BodyFloat32Req::_internal_value() const {
+  return _impl_.value_;
+}
+inline float BodyFloat32Req::value() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.value)
+  return _internal_value();
+}
+inline void BodyFloat32Req::_internal_set_value(float value) {
+  
+  _impl_.value_ = value;
+}
+inline void BodyFloat32Req::set_value(float value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.value)
 }
 
 // -------------------------------------------------------------------
 
-// AddCameraReq
+// TakePictureReq
 
 // uint64 scene_id = 1;
-inline void AddCameraReq::clear_scene_id() {
+inline void TakePictureReq::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t AddCameraReq::_internal_scene_id() const {
+inline uint64_t TakePictureReq::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t AddCameraReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.scene_id)
+inline uint64_t TakePictureReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.TakePictureReq.scene_id)
   return _internal_scene_id();
 }
-inline void AddCameraReq::_internal_set_scene_id(uint64_t value) {
+inline void TakePictureReq::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void AddCameraReq::set_scene_id(uint64_t value) {
+inline void TakePictureReq::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.TakePictureReq.scene_id)
+}
+
+// uint64 camera_id = 2;
+inline void TakePictureReq::clear_camera_id() {
+  _impl_.camera_id_ = uint64_t{0u};
+}
+inline uint64_t TakePictureReq::_internal_camera_id() const {
+  return _impl_.camera_id_;
+}
+inline uint64_t TakePictureReq::camera_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.TakePictureReq.camera_id)
+  return _internal_camera_id();
+}
+inline void TakePictureReq::_internal_set_camera_id(uint64_t value) {
+  
+  _impl_.camera_id_ = value;
+}
+inline void TakePictureReq::set_camera_id(uint64_t value) {
+  _internal_set_camera_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.TakePictureReq.camera_id)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateRenderAndTakePicturesReq
+
+// uint64 scene_id = 1;
+inline void UpdateRenderAndTakePicturesReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
+}
+inline uint64_t UpdateRenderAndTakePicturesReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
+}
+inline uint64_t UpdateRenderAndTakePicturesReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.scene_id)
+  return _internal_scene_id();
+}
+inline void UpdateRenderAndTakePicturesReq::_internal_set_scene_id(uint64_t value) {
+  
+  _impl_.scene_id_ = value;
+}
+inline void UpdateRenderAndTakePicturesReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.scene_id)
+}
+
+// repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
+inline int UpdateRenderAndTakePicturesReq::_internal_body_poses_size() const {
+  return _impl_.body_poses_.size();
+}
+inline int UpdateRenderAndTakePicturesReq::body_poses_size() const {
+  return _internal_body_poses_size();
+}
+inline void UpdateRenderAndTakePicturesReq::clear_body_poses() {
+  _impl_.body_poses_.Clear();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::mutable_body_poses(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
+  return _impl_.body_poses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
+UpdateRenderAndTakePicturesReq::mutable_body_poses() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
+  return &_impl_.body_poses_;
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::_internal_body_poses(int index) const {
+  return _impl_.body_poses_.Get(index);
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::body_poses(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
+  return _internal_body_poses(index);
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::_internal_add_body_poses() {
+  return _impl_.body_poses_.Add();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::add_body_poses() {
+  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_body_poses();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
+UpdateRenderAndTakePicturesReq::body_poses() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
+  return _impl_.body_poses_;
+}
+
+// repeated .sapien.Renderer.server.proto.Pose camera_poses = 3;
+inline int UpdateRenderAndTakePicturesReq::_internal_camera_poses_size() const {
+  return _impl_.camera_poses_.size();
+}
+inline int UpdateRenderAndTakePicturesReq::camera_poses_size() const {
+  return _internal_camera_poses_size();
+}
+inline void UpdateRenderAndTakePicturesReq::clear_camera_poses() {
+  _impl_.camera_poses_.Clear();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::mutable_camera_poses(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
+  return _impl_.camera_poses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
+UpdateRenderAndTakePicturesReq::mutable_camera_poses() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
+  return &_impl_.camera_poses_;
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::_internal_camera_poses(int index) const {
+  return _impl_.camera_poses_.Get(index);
+}
+inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::camera_poses(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
+  return _internal_camera_poses(index);
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::_internal_add_camera_poses() {
+  return _impl_.camera_poses_.Add();
+}
+inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::add_camera_poses() {
+  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_camera_poses();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
+UpdateRenderAndTakePicturesReq::camera_poses() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
+  return _impl_.camera_poses_;
+}
+
+// repeated uint64 camera_ids = 4 [packed = true];
+inline int UpdateRenderAndTakePicturesReq::_internal_camera_ids_size() const {
+  return _impl_.camera_ids_.size();
 }
-
-// uint32 width = 2;
-inline void AddCameraReq::clear_width() {
-  _impl_.width_ = 0u;
+inline int UpdateRenderAndTakePicturesReq::camera_ids_size() const {
+  return _internal_camera_ids_size();
 }
-inline uint32_t AddCameraReq::_internal_width() const {
-  return _impl_.width_;
+inline void UpdateRenderAndTakePicturesReq::clear_camera_ids() {
+  _impl_.camera_ids_.Clear();
 }
-inline uint32_t AddCameraReq::width() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.width)
-  return _internal_width();
+inline uint64_t UpdateRenderAndTakePicturesReq::_internal_camera_ids(int index) const {
+  return _impl_.camera_ids_.Get(index);
 }
-inline void AddCameraReq::_internal_set_width(uint32_t value) {
-  
-  _impl_.width_ = value;
+inline uint64_t UpdateRenderAndTakePicturesReq::camera_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
+  return _internal_camera_ids(index);
 }
-inline void AddCameraReq::set_width(uint32_t value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.width)
+inline void UpdateRenderAndTakePicturesReq::set_camera_ids(int index, uint64_t value) {
+  _impl_.camera_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
 }
-
-// uint32 height = 3;
-inline void AddCameraReq::clear_height() {
-  _impl_.height_ = 0u;
+inline void UpdateRenderAndTakePicturesReq::_internal_add_camera_ids(uint64_t value) {
+  _impl_.camera_ids_.Add(value);
 }
-inline uint32_t AddCameraReq::_internal_height() const {
-  return _impl_.height_;
+inline void UpdateRenderAndTakePicturesReq::add_camera_ids(uint64_t value) {
+  _internal_add_camera_ids(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
 }
-inline uint32_t AddCameraReq::height() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.height)
-  return _internal_height();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UpdateRenderAndTakePicturesReq::_internal_camera_ids() const {
+  return _impl_.camera_ids_;
 }
-inline void AddCameraReq::_internal_set_height(uint32_t value) {
-  
-  _impl_.height_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UpdateRenderAndTakePicturesReq::camera_ids() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
+  return _internal_camera_ids();
 }
-inline void AddCameraReq::set_height(uint32_t value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.height)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UpdateRenderAndTakePicturesReq::_internal_mutable_camera_ids() {
+  return &_impl_.camera_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UpdateRenderAndTakePicturesReq::mutable_camera_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
+  return _internal_mutable_camera_ids();
 }
 
-// float fovy = 4;
-inline void AddCameraReq::clear_fovy() {
-  _impl_.fovy_ = 0;
+// repeated float body_pose_data = 5;
+inline int UpdateRenderAndTakePicturesReq::_internal_body_pose_data_size() const {
+  return _impl_.body_pose_data_.size();
 }
-inline float AddCameraReq::_internal_fovy() const {
-  return _impl_.fovy_;
+inline int UpdateRenderAndTakePicturesReq::body_pose_data_size() const {
+  return _internal_body_pose_data_size();
 }
-inline float AddCameraReq::fovy() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.fovy)
-  return _internal_fovy();
+inline void UpdateRenderAndTakePicturesReq::clear_body_pose_data() {
+  _impl_.body_pose_data_.Clear();
 }
-inline void AddCameraReq::_internal_set_fovy(float value) {
-  
-  _impl_.fovy_ = value;
+inline float UpdateRenderAndTakePicturesReq::_internal_body_pose_data(int index) const {
+  return _impl_.body_pose_data_.Get(index);
 }
-inline void AddCameraReq::set_fovy(float value) {
-  _internal_set_fovy(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.fovy)
+inline float UpdateRenderAndTakePicturesReq::body_pose_data(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_pose_data)
+  return _internal_body_pose_data(index);
 }
-
-// float near = 5;
-inline void AddCameraReq::clear_near() {
-  _impl_.near_ = 0;
+inline void UpdateRenderAndTakePicturesReq::set_body_pose_data(int index, float value) {
+  _impl_.body_pose_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_pose_data)
 }
-inline float AddCameraReq::_internal_near() const {
-  return _impl_.near_;
+inline void UpdateRenderAndTakePicturesReq::_internal_add_body_pose_data(float value) {
+  _impl_.body_pose_data_.Add(value);
 }
-inline float AddCameraReq::near() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.near)
-  return _internal_near();
+inline void UpdateRenderAndTakePicturesReq::add_body_pose_data(float value) {
+  _internal_add_body_pose_data(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_pose_data)
 }
-inline void AddCameraReq::_internal_set_near(float value) {
-  
-  _impl_.near_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderAndTakePicturesReq::_internal_body_pose_data() const {
+  return _impl_.body_pose_data_;
 }
-inline void AddCameraReq::set_near(float value) {
-  _internal_set_near(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.near)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderAndTakePicturesReq::body_pose_data() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_pose_data)
+  return _internal_body_pose_data();
 }
-
-// float far = 6;
-inline void AddCameraReq::clear_far() {
-  _impl_.far_ = 0;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderAndTakePicturesReq::_internal_mutable_body_pose_data() {
+  return &_impl_.body_pose_data_;
 }
-inline float AddCameraReq::_internal_far() const {
-  return _impl_.far_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderAndTakePicturesReq::mutable_body_pose_data() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_pose_data)
+  return _internal_mutable_body_pose_data();
 }
-inline float AddCameraReq::far() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.far)
-  return _internal_far();
+
+// repeated float camera_pose_data = 6;
+inline int UpdateRenderAndTakePicturesReq::_internal_camera_pose_data_size() const {
+  return _impl_.camera_pose_data_.size();
 }
-inline void AddCameraReq::_internal_set_far(float value) {
-  
-  _impl_.far_ = value;
+inline int UpdateRenderAndTakePicturesReq::camera_pose_data_size() const {
+  return _internal_camera_pose_data_size();
 }
-inline void AddCameraReq::set_far(float value) {
-  _internal_set_far(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.far)
+inline void UpdateRenderAndTakePicturesReq::clear_camera_pose_data() {
+  _impl_.camera_pose_data_.Clear();
 }
-
-// string shader = 7;
-inline void AddCameraReq::clear_shader() {
-  _impl_.shader_.ClearToEmpty();
+inline float UpdateRenderAndTakePicturesReq::_internal_camera_pose_data(int index) const {
+  return _impl_.camera_pose_data_.Get(index);
 }
-inline const std::string& AddCameraReq::shader() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddCameraReq.shader)
-  return _internal_shader();
+inline float UpdateRenderAndTakePicturesReq::camera_pose_data(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_pose_data)
+  return _internal_camera_pose_data(index);
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AddCameraReq::set_shader(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.shader_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddCameraReq.shader)
+inline void UpdateRenderAndTakePicturesReq::set_camera_pose_data(int index, float value) {
+  _impl_.camera_pose_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_pose_data)
 }
-inline std::string* AddCameraReq::mutable_shader() {
-  std::string* _s = _internal_mutable_shader();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddCameraReq.shader)
-  return _s;
+inline void UpdateRenderAndTakePicturesReq::_internal_add_camera_pose_data(float value) {
+  _impl_.camera_pose_data_.Add(value);
 }
-inline const std::string& AddCameraReq::_internal_shader() const {
-  return _impl_.shader_.Get();
+inline void UpdateRenderAndTakePicturesReq::add_camera_pose_data(float value) {
+  _internal_add_camera_pose_data(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_pose_data)
 }
-inline void AddCameraReq::_internal_set_shader(const std::string& value) {
-  
-  _impl_.shader_.Set(value, GetArenaForAllocation());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderAndTakePicturesReq::_internal_camera_pose_data() const {
+  return _impl_.camera_pose_data_;
 }
-inline std::string* AddCameraReq::_internal_mutable_shader() {
-  
-  return _impl_.shader_.Mutable(GetArenaForAllocation());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+UpdateRenderAndTakePicturesReq::camera_pose_data() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_pose_data)
+  return _internal_camera_pose_data();
 }
-inline std::string* AddCameraReq::release_shader() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddCameraReq.shader)
-  return _impl_.shader_.Release();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderAndTakePicturesReq::_internal_mutable_camera_pose_data() {
+  return &_impl_.camera_pose_data_;
 }
-inline void AddCameraReq::set_allocated_shader(std::string* shader) {
-  if (shader != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.shader_.SetAllocated(shader, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.shader_.IsDefault()) {
-    _impl_.shader_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddCameraReq.shader)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+UpdateRenderAndTakePicturesReq::mutable_camera_pose_data() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_pose_data)
+  return _internal_mutable_camera_pose_data();
 }
 
 // -------------------------------------------------------------------
 
-// RemoveCameraReq
+// CameraParamsReq
 
 // uint64 scene_id = 1;
-inline void RemoveCameraReq::clear_scene_id() {
+inline void CameraParamsReq::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t RemoveCameraReq::_internal_scene_id() const {
+inline uint64_t CameraParamsReq::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t RemoveCameraReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveCameraReq.scene_id)
+inline uint64_t CameraParamsReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.scene_id)
   return _internal_scene_id();
 }
-inline void RemoveCameraReq::_internal_set_scene_id(uint64_t value) {
+inline void CameraParamsReq::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void RemoveCameraReq::set_scene_id(uint64_t value) {
+inline void CameraParamsReq::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveCameraReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.scene_id)
 }
 
 // uint64 camera_id = 2;
-inline void RemoveCameraReq::clear_camera_id() {
+inline void CameraParamsReq::clear_camera_id() {
   _impl_.camera_id_ = uint64_t{0u};
 }
-inline uint64_t RemoveCameraReq::_internal_camera_id() const {
+inline uint64_t CameraParamsReq::_internal_camera_id() const {
   return _impl_.camera_id_;
 }
-inline uint64_t RemoveCameraReq::camera_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveCameraReq.camera_id)
+inline uint64_t CameraParamsReq::camera_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.camera_id)
   return _internal_camera_id();
 }
-inline void RemoveCameraReq::_internal_set_camera_id(uint64_t value) {
+inline void CameraParamsReq::_internal_set_camera_id(uint64_t value) {
   
   _impl_.camera_id_ = value;
 }
-inline void RemoveCameraReq::set_camera_id(uint64_t value) {
+inline void CameraParamsReq::set_camera_id(uint64_t value) {
   _internal_set_camera_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveCameraReq.camera_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.camera_id)
 }
 
-// -------------------------------------------------------------------
-
-// AddPointLightReq
+// float near = 3;
+inline void CameraParamsReq::clear_near() {
+  _impl_.near_ = 0;
+}
+inline float CameraParamsReq::_internal_near() const {
+  return _impl_.near_;
+}
+inline float CameraParamsReq::near() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.near)
+  return _internal_near();
+}
+inline void CameraParamsReq::_internal_set_near(float value) {
+  
+  _impl_.near_ = value;
+}
+inline void CameraParamsReq::set_near(float value) {
+  _internal_set_near(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.near)
+}
 
-// uint64 scene_id = 1;
-inline void AddPointLightReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// float far = 4;
+inline void CameraParamsReq::clear_far() {
+  _impl_.far_ = 0;
 }
-inline uint64_t AddPointLightReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline float CameraParamsReq::_internal_far() const {
+  return _impl_.far_;
 }
-inline uint64_t AddPointLightReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.scene_id)
-  return _internal_scene_id();
+inline float CameraParamsReq::far() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.far)
+  return _internal_far();
 }
-inline void AddPointLightReq::_internal_set_scene_id(uint64_t value) {
+inline void CameraParamsReq::_internal_set_far(float value) {
   
-  _impl_.scene_id_ = value;
+  _impl_.far_ = value;
 }
-inline void AddPointLightReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.scene_id)
+inline void CameraParamsReq::set_far(float value) {
+  _internal_set_far(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.far)
 }
 
-// .sapien.Renderer.server.proto.Vec3 position = 2;
-inline bool AddPointLightReq::_internal_has_position() const {
-  return this != internal_default_instance() && _impl_.position_ != nullptr;
+// float fx = 5;
+inline void CameraParamsReq::clear_fx() {
+  _impl_.fx_ = 0;
 }
-inline bool AddPointLightReq::has_position() const {
-  return _internal_has_position();
+inline float CameraParamsReq::_internal_fx() const {
+  return _impl_.fx_;
 }
-inline void AddPointLightReq::clear_position() {
-  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
-    delete _impl_.position_;
-  }
-  _impl_.position_ = nullptr;
+inline float CameraParamsReq::fx() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.fx)
+  return _internal_fx();
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::_internal_position() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.position_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline void CameraParamsReq::_internal_set_fx(float value) {
+  
+  _impl_.fx_ = value;
+}
+inline void CameraParamsReq::set_fx(float value) {
+  _internal_set_fx(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.fx)
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::position() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.position)
-  return _internal_position();
+
+// float fy = 6;
+inline void CameraParamsReq::clear_fy() {
+  _impl_.fy_ = 0;
 }
-inline void AddPointLightReq::unsafe_arena_set_allocated_position(
-    ::sapien::Renderer::server::proto::Vec3* position) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
-  }
-  _impl_.position_ = position;
-  if (position) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.position)
+inline float CameraParamsReq::_internal_fy() const {
+  return _impl_.fy_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::release_position() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
-  _impl_.position_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline float CameraParamsReq::fy() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.fy)
+  return _internal_fy();
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::unsafe_arena_release_position() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddPointLightReq.position)
+inline void CameraParamsReq::_internal_set_fy(float value) {
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
-  _impl_.position_ = nullptr;
-  return temp;
+  _impl_.fy_ = value;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::_internal_mutable_position() {
-  
-  if (_impl_.position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.position_ = p;
-  }
-  return _impl_.position_;
+inline void CameraParamsReq::set_fy(float value) {
+  _internal_set_fy(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.fy)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::mutable_position() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_position();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddPointLightReq.position)
-  return _msg;
+
+// float cx = 7;
+inline void CameraParamsReq::clear_cx() {
+  _impl_.cx_ = 0;
 }
-inline void AddPointLightReq::set_allocated_position(::sapien::Renderer::server::proto::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.position_;
-  }
-  if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
-    if (message_arena != submessage_arena) {
-      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.position)
+inline float CameraParamsReq::_internal_cx() const {
+  return _impl_.cx_;
 }
-
-// .sapien.Renderer.server.proto.Vec3 color = 3;
-inline bool AddPointLightReq::_internal_has_color() const {
-  return this != internal_default_instance() && _impl_.color_ != nullptr;
+inline float CameraParamsReq::cx() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.cx)
+  return _internal_cx();
 }
-inline bool AddPointLightReq::has_color() const {
-  return _internal_has_color();
+inline void CameraParamsReq::_internal_set_cx(float value) {
+  
+  _impl_.cx_ = value;
 }
-inline void AddPointLightReq::clear_color() {
-  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
-    delete _impl_.color_;
-  }
-  _impl_.color_ = nullptr;
+inline void CameraParamsReq::set_cx(float value) {
+  _internal_set_cx(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.cx)
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::_internal_color() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.color_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+
+// float cy = 8;
+inline void CameraParamsReq::clear_cy() {
+  _impl_.cy_ = 0;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddPointLightReq::color() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.color)
-  return _internal_color();
+inline float CameraParamsReq::_internal_cy() const {
+  return _impl_.cy_;
 }
-inline void AddPointLightReq::unsafe_arena_set_allocated_color(
-    ::sapien::Renderer::server::proto::Vec3* color) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
-  }
-  _impl_.color_ = color;
-  if (color) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.color)
+inline float CameraParamsReq::cy() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.cy)
+  return _internal_cy();
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::release_color() {
+inline void CameraParamsReq::_internal_set_cy(float value) {
   
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.cy_ = value;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::unsafe_arena_release_color() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddPointLightReq.color)
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
-  return temp;
+inline void CameraParamsReq::set_cy(float value) {
+  _internal_set_cy(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.cy)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::_internal_mutable_color() {
-  
-  if (_impl_.color_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.color_ = p;
-  }
-  return _impl_.color_;
+
+// float skew = 9;
+inline void CameraParamsReq::clear_skew() {
+  _impl_.skew_ = 0;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddPointLightReq::mutable_color() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_color();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddPointLightReq.color)
-  return _msg;
+inline float CameraParamsReq::_internal_skew() const {
+  return _impl_.skew_;
 }
-inline void AddPointLightReq::set_allocated_color(::sapien::Renderer::server::proto::Vec3* color) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.color_;
-  }
-  if (color) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(color);
-    if (message_arena != submessage_arena) {
-      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, color, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.color_ = color;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddPointLightReq.color)
+inline float CameraParamsReq::skew() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.skew)
+  return _internal_skew();
+}
+inline void CameraParamsReq::_internal_set_skew(float value) {
+  
+  _impl_.skew_ = value;
+}
+inline void CameraParamsReq::set_skew(float value) {
+  _internal_set_skew(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.skew)
 }
 
-// bool shadow = 4;
-inline void AddPointLightReq::clear_shadow() {
-  _impl_.shadow_ = false;
+// -------------------------------------------------------------------
+
+// BodyReq
+
+// uint64 scene_id = 1;
+inline void BodyReq::clear_scene_id() {
+  _impl_.scene_id_ = uint64_t{0u};
 }
-inline bool AddPointLightReq::_internal_shadow() const {
-  return _impl_.shadow_;
+inline uint64_t BodyReq::_internal_scene_id() const {
+  return _impl_.scene_id_;
 }
-inline bool AddPointLightReq::shadow() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow)
-  return _internal_shadow();
+inline uint64_t BodyReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyReq.scene_id)
+  return _internal_scene_id();
 }
-inline void AddPointLightReq::_internal_set_shadow(bool value) {
+inline void BodyReq::_internal_set_scene_id(uint64_t value) {
   
-  _impl_.shadow_ = value;
+  _impl_.scene_id_ = value;
 }
-inline void AddPointLightReq::set_shadow(bool value) {
-  _internal_set_shadow(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow)
+inline void BodyReq::set_scene_id(uint64_t value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyReq.scene_id)
 }
 
-// float shadow_near = 5;
-inline void AddPointLightReq::clear_shadow_near() {
-  _impl_.shadow_near_ = 0;
+// uint64 body_id = 2;
+inline void BodyReq::clear_body_id() {
+  _impl_.body_id_ = uint64_t{0u};
 }
-inline float AddPointLightReq::_internal_shadow_near() const {
-  return _impl_.shadow_near_;
+inline uint64_t BodyReq::_internal_body_id() const {
+  return _impl_.body_id_;
 }
-inline float AddPointLightReq::shadow_near() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_near)
-  return _internal_shadow_near();
+inline uint64_t BodyReq::body_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyReq.body_id)
+  return _internal_body_id();
 }
-inline void AddPointLightReq::_internal_set_shadow_near(float value) {
+inline void BodyReq::_internal_set_body_id(uint64_t value) {
   
-  _impl_.shadow_near_ = value;
+  _impl_.body_id_ = value;
 }
-inline void AddPointLightReq::set_shadow_near(float value) {
-  _internal_set_shadow_near(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_near)
+inline void BodyReq::set_body_id(uint64_t value) {
+  _internal_set_body_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyReq.body_id)
 }
 
-// float shadow_far = 6;
-inline void AddPointLightReq::clear_shadow_far() {
-  _impl_.shadow_far_ = 0;
+// -------------------------------------------------------------------
+
+// UpdateRenderBatchReq
+
+// repeated .sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq scenes = 1;
+inline int UpdateRenderBatchReq::_internal_scenes_size() const {
+  return _impl_.scenes_.size();
 }
-inline float AddPointLightReq::_internal_shadow_far() const {
-  return _impl_.shadow_far_;
+inline int UpdateRenderBatchReq::scenes_size() const {
+  return _internal_scenes_size();
 }
-inline float AddPointLightReq::shadow_far() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_far)
-  return _internal_shadow_far();
+inline void UpdateRenderBatchReq::clear_scenes() {
+  _impl_.scenes_.Clear();
 }
-inline void AddPointLightReq::_internal_set_shadow_far(float value) {
-  
-  _impl_.shadow_far_ = value;
+inline ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* UpdateRenderBatchReq::mutable_scenes(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderBatchReq.scenes)
+  return _impl_.scenes_.Mutable(index);
 }
-inline void AddPointLightReq::set_shadow_far(float value) {
-  _internal_set_shadow_far(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_far)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq >*
+UpdateRenderBatchReq::mutable_scenes() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderBatchReq.scenes)
+  return &_impl_.scenes_;
 }
-
-// int32 shadow_map_size = 7;
-inline void AddPointLightReq::clear_shadow_map_size() {
-  _impl_.shadow_map_size_ = 0;
+inline const ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq& UpdateRenderBatchReq::_internal_scenes(int index) const {
+  return _impl_.scenes_.Get(index);
 }
-inline int32_t AddPointLightReq::_internal_shadow_map_size() const {
-  return _impl_.shadow_map_size_;
+inline const ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq& UpdateRenderBatchReq::scenes(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderBatchReq.scenes)
+  return _internal_scenes(index);
 }
-inline int32_t AddPointLightReq::shadow_map_size() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddPointLightReq.shadow_map_size)
-  return _internal_shadow_map_size();
+inline ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* UpdateRenderBatchReq::_internal_add_scenes() {
+  return _impl_.scenes_.Add();
 }
-inline void AddPointLightReq::_internal_set_shadow_map_size(int32_t value) {
-  
-  _impl_.shadow_map_size_ = value;
+inline ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* UpdateRenderBatchReq::add_scenes() {
+  ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq* _add = _internal_add_scenes();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderBatchReq.scenes)
+  return _add;
 }
-inline void AddPointLightReq::set_shadow_map_size(int32_t value) {
-  _internal_set_shadow_map_size(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddPointLightReq.shadow_map_size)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::UpdateRenderAndTakePicturesReq >&
+UpdateRenderBatchReq::scenes() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderBatchReq.scenes)
+  return _impl_.scenes_;
 }
 
 // -------------------------------------------------------------------
 
-// AddDirectionalLightReq
+// AttachSharedMemoryReq
 
 // uint64 scene_id = 1;
-inline void AddDirectionalLightReq::clear_scene_id() {
+inline void AttachSharedMemoryReq::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t AddDirectionalLightReq::_internal_scene_id() const {
+inline uint64_t AttachSharedMemoryReq::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t AddDirectionalLightReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.scene_id)
+inline uint64_t AttachSharedMemoryReq::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AttachSharedMemoryReq.scene_id)
   return _internal_scene_id();
 }
-inline void AddDirectionalLightReq::_internal_set_scene_id(uint64_t value) {
+inline void AttachSharedMemoryReq::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void AddDirectionalLightReq::set_scene_id(uint64_t value) {
+inline void AttachSharedMemoryReq::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AttachSharedMemoryReq.scene_id)
 }
 
-// .sapien.Renderer.server.proto.Vec3 direction = 2;
-inline bool AddDirectionalLightReq::_internal_has_direction() const {
-  return this != internal_default_instance() && _impl_.direction_ != nullptr;
+// string name = 2;
+inline void AttachSharedMemoryReq::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline bool AddDirectionalLightReq::has_direction() const {
-  return _internal_has_direction();
+inline const std::string& AttachSharedMemoryReq::name() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AttachSharedMemoryReq.name)
+  return _internal_name();
 }
-inline void AddDirectionalLightReq::clear_direction() {
-  if (GetArenaForAllocation() == nullptr && _impl_.direction_ != nullptr) {
-    delete _impl_.direction_;
-  }
-  _impl_.direction_ = nullptr;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttachSharedMemoryReq::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AttachSharedMemoryReq.name)
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_direction() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.direction_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline std::string* AttachSharedMemoryReq::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AttachSharedMemoryReq.name)
+  return _s;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::direction() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
-  return _internal_direction();
+inline const std::string& AttachSharedMemoryReq::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void AddDirectionalLightReq::unsafe_arena_set_allocated_direction(
-    ::sapien::Renderer::server::proto::Vec3* direction) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.direction_);
-  }
-  _impl_.direction_ = direction;
-  if (direction) {
+inline void AttachSharedMemoryReq::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AttachSharedMemoryReq::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AttachSharedMemoryReq::release_name() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AttachSharedMemoryReq.name)
+  return _impl_.name_.Release();
+}
+inline void AttachSharedMemoryReq::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AttachSharedMemoryReq.name)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_direction() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.direction_;
-  _impl_.direction_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+
+// -------------------------------------------------------------------
+
+// Command
+
+// .sapien.Renderer.server.proto.Empty create_material = 1;
+inline bool Command::_internal_has_create_material() const {
+  return command_case() == kCreateMaterial;
+}
+inline bool Command::has_create_material() const {
+  return _internal_has_create_material();
+}
+inline void Command::set_has_create_material() {
+  _impl_._oneof_case_[0] = kCreateMaterial;
+}
+inline void Command::clear_create_material() {
+  if (_internal_has_create_material()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.create_material_;
+    }
+    clear_has_command();
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_direction() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.direction_;
-  _impl_.direction_ = nullptr;
-  return temp;
+inline ::sapien::Renderer::server::proto::Empty* Command::release_create_material() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.create_material)
+  if (_internal_has_create_material()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::Empty* temp = _impl_.command_.create_material_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.create_material_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_direction() {
-  
-  if (_impl_.direction_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.direction_ = p;
+inline const ::sapien::Renderer::server::proto::Empty& Command::_internal_create_material() const {
+  return _internal_has_create_material()
+      ? *_impl_.command_.create_material_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::Empty&>(::sapien::Renderer::server::proto::_Empty_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Empty& Command::create_material() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.create_material)
+  return _internal_create_material();
+}
+inline ::sapien::Renderer::server::proto::Empty* Command::unsafe_arena_release_create_material() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.create_material)
+  if (_internal_has_create_material()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::Empty* temp = _impl_.command_.create_material_;
+    _impl_.command_.create_material_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return _impl_.direction_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_direction() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_direction();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
+inline void Command::unsafe_arena_set_allocated_create_material(::sapien::Renderer::server::proto::Empty* create_material) {
+  clear_command();
+  if (create_material) {
+    set_has_create_material();
+    _impl_.command_.create_material_ = create_material;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.create_material)
+}
+inline ::sapien::Renderer::server::proto::Empty* Command::_internal_mutable_create_material() {
+  if (!_internal_has_create_material()) {
+    clear_command();
+    set_has_create_material();
+    _impl_.command_.create_material_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::Empty >(GetArenaForAllocation());
+  }
+  return _impl_.command_.create_material_;
+}
+inline ::sapien::Renderer::server::proto::Empty* Command::mutable_create_material() {
+  ::sapien::Renderer::server::proto::Empty* _msg = _internal_mutable_create_material();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.create_material)
   return _msg;
 }
-inline void AddDirectionalLightReq::set_allocated_direction(::sapien::Renderer::server::proto::Vec3* direction) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.direction_;
+
+// .sapien.Renderer.server.proto.Id remove_material = 2;
+inline bool Command::_internal_has_remove_material() const {
+  return command_case() == kRemoveMaterial;
+}
+inline bool Command::has_remove_material() const {
+  return _internal_has_remove_material();
+}
+inline void Command::set_has_remove_material() {
+  _impl_._oneof_case_[0] = kRemoveMaterial;
+}
+inline void Command::clear_remove_material() {
+  if (_internal_has_remove_material()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.remove_material_;
+    }
+    clear_has_command();
   }
-  if (direction) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(direction);
-    if (message_arena != submessage_arena) {
-      direction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, direction, submessage_arena);
+}
+inline ::sapien::Renderer::server::proto::Id* Command::release_remove_material() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.remove_material)
+  if (_internal_has_remove_material()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::Id* temp = _impl_.command_.remove_material_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    
+    _impl_.command_.remove_material_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.direction_ = direction;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.direction)
+}
+inline const ::sapien::Renderer::server::proto::Id& Command::_internal_remove_material() const {
+  return _internal_has_remove_material()
+      ? *_impl_.command_.remove_material_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::Id&>(::sapien::Renderer::server::proto::_Id_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::Id& Command::remove_material() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.remove_material)
+  return _internal_remove_material();
+}
+inline ::sapien::Renderer::server::proto::Id* Command::unsafe_arena_release_remove_material() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.remove_material)
+  if (_internal_has_remove_material()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::Id* temp = _impl_.command_.remove_material_;
+    _impl_.command_.remove_material_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Command::unsafe_arena_set_allocated_remove_material(::sapien::Renderer::server::proto::Id* remove_material) {
+  clear_command();
+  if (remove_material) {
+    set_has_remove_material();
+    _impl_.command_.remove_material_ = remove_material;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.remove_material)
+}
+inline ::sapien::Renderer::server::proto::Id* Command::_internal_mutable_remove_material() {
+  if (!_internal_has_remove_material()) {
+    clear_command();
+    set_has_remove_material();
+    _impl_.command_.remove_material_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::Id >(GetArenaForAllocation());
+  }
+  return _impl_.command_.remove_material_;
+}
+inline ::sapien::Renderer::server::proto::Id* Command::mutable_remove_material() {
+  ::sapien::Renderer::server::proto::Id* _msg = _internal_mutable_remove_material();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.remove_material)
+  return _msg;
 }
 
-// .sapien.Renderer.server.proto.Vec3 color = 3;
-inline bool AddDirectionalLightReq::_internal_has_color() const {
-  return this != internal_default_instance() && _impl_.color_ != nullptr;
+// .sapien.Renderer.server.proto.IdVec4 set_base_color = 3;
+inline bool Command::_internal_has_set_base_color() const {
+  return command_case() == kSetBaseColor;
 }
-inline bool AddDirectionalLightReq::has_color() const {
-  return _internal_has_color();
+inline bool Command::has_set_base_color() const {
+  return _internal_has_set_base_color();
 }
-inline void AddDirectionalLightReq::clear_color() {
-  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
-    delete _impl_.color_;
+inline void Command::set_has_set_base_color() {
+  _impl_._oneof_case_[0] = kSetBaseColor;
+}
+inline void Command::clear_set_base_color() {
+  if (_internal_has_set_base_color()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_base_color_;
+    }
+    clear_has_command();
   }
-  _impl_.color_ = nullptr;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_color() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.color_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline ::sapien::Renderer::server::proto::IdVec4* Command::release_set_base_color() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_base_color)
+  if (_internal_has_set_base_color()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdVec4* temp = _impl_.command_.set_base_color_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_base_color_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::color() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
-  return _internal_color();
+inline const ::sapien::Renderer::server::proto::IdVec4& Command::_internal_set_base_color() const {
+  return _internal_has_set_base_color()
+      ? *_impl_.command_.set_base_color_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::IdVec4&>(::sapien::Renderer::server::proto::_IdVec4_default_instance_);
 }
-inline void AddDirectionalLightReq::unsafe_arena_set_allocated_color(
-    ::sapien::Renderer::server::proto::Vec3* color) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
+inline const ::sapien::Renderer::server::proto::IdVec4& Command::set_base_color() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_base_color)
+  return _internal_set_base_color();
+}
+inline ::sapien::Renderer::server::proto::IdVec4* Command::unsafe_arena_release_set_base_color() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_base_color)
+  if (_internal_has_set_base_color()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdVec4* temp = _impl_.command_.set_base_color_;
+    _impl_.command_.set_base_color_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  _impl_.color_ = color;
-  if (color) {
-    
+}
+inline void Command::unsafe_arena_set_allocated_set_base_color(::sapien::Renderer::server::proto::IdVec4* set_base_color) {
+  clear_command();
+  if (set_base_color) {
+    set_has_set_base_color();
+    _impl_.command_.set_base_color_ = set_base_color;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_base_color)
+}
+inline ::sapien::Renderer::server::proto::IdVec4* Command::_internal_mutable_set_base_color() {
+  if (!_internal_has_set_base_color()) {
+    clear_command();
+    set_has_set_base_color();
+    _impl_.command_.set_base_color_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::IdVec4 >(GetArenaForAllocation());
+  }
+  return _impl_.command_.set_base_color_;
+}
+inline ::sapien::Renderer::server::proto::IdVec4* Command::mutable_set_base_color() {
+  ::sapien::Renderer::server::proto::IdVec4* _msg = _internal_mutable_set_base_color();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_base_color)
+  return _msg;
+}
+
+// .sapien.Renderer.server.proto.IdFloat set_roughness = 4;
+inline bool Command::_internal_has_set_roughness() const {
+  return command_case() == kSetRoughness;
+}
+inline bool Command::has_set_roughness() const {
+  return _internal_has_set_roughness();
+}
+inline void Command::set_has_set_roughness() {
+  _impl_._oneof_case_[0] = kSetRoughness;
+}
+inline void Command::clear_set_roughness() {
+  if (_internal_has_set_roughness()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_roughness_;
+    }
+    clear_has_command();
+  }
+}
+inline ::sapien::Renderer::server::proto::IdFloat* Command::release_set_roughness() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_roughness)
+  if (_internal_has_set_roughness()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_roughness_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_roughness_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_color() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::_internal_set_roughness() const {
+  return _internal_has_set_roughness()
+      ? *_impl_.command_.set_roughness_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::IdFloat&>(::sapien::Renderer::server::proto::_IdFloat_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::set_roughness() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_roughness)
+  return _internal_set_roughness();
+}
+inline ::sapien::Renderer::server::proto::IdFloat* Command::unsafe_arena_release_set_roughness() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_roughness)
+  if (_internal_has_set_roughness()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_roughness_;
+    _impl_.command_.set_roughness_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_color() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.color_;
-  _impl_.color_ = nullptr;
-  return temp;
+inline void Command::unsafe_arena_set_allocated_set_roughness(::sapien::Renderer::server::proto::IdFloat* set_roughness) {
+  clear_command();
+  if (set_roughness) {
+    set_has_set_roughness();
+    _impl_.command_.set_roughness_ = set_roughness;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_roughness)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_color() {
-  
-  if (_impl_.color_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.color_ = p;
+inline ::sapien::Renderer::server::proto::IdFloat* Command::_internal_mutable_set_roughness() {
+  if (!_internal_has_set_roughness()) {
+    clear_command();
+    set_has_set_roughness();
+    _impl_.command_.set_roughness_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::IdFloat >(GetArenaForAllocation());
   }
-  return _impl_.color_;
+  return _impl_.command_.set_roughness_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_color() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_color();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
+inline ::sapien::Renderer::server::proto::IdFloat* Command::mutable_set_roughness() {
+  ::sapien::Renderer::server::proto::IdFloat* _msg = _internal_mutable_set_roughness();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_roughness)
   return _msg;
 }
-inline void AddDirectionalLightReq::set_allocated_color(::sapien::Renderer::server::proto::Vec3* color) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.color_;
+
+// .sapien.Renderer.server.proto.IdFloat set_specular = 5;
+inline bool Command::_internal_has_set_specular() const {
+  return command_case() == kSetSpecular;
+}
+inline bool Command::has_set_specular() const {
+  return _internal_has_set_specular();
+}
+inline void Command::set_has_set_specular() {
+  _impl_._oneof_case_[0] = kSetSpecular;
+}
+inline void Command::clear_set_specular() {
+  if (_internal_has_set_specular()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_specular_;
+    }
+    clear_has_command();
   }
-  if (color) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(color);
-    if (message_arena != submessage_arena) {
-      color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, color, submessage_arena);
+}
+inline ::sapien::Renderer::server::proto::IdFloat* Command::release_set_specular() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_specular)
+  if (_internal_has_set_specular()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_specular_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    
+    _impl_.command_.set_specular_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.color_ = color;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.color)
 }
-
-// bool shadow = 4;
-inline void AddDirectionalLightReq::clear_shadow() {
-  _impl_.shadow_ = false;
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::_internal_set_specular() const {
+  return _internal_has_set_specular()
+      ? *_impl_.command_.set_specular_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::IdFloat&>(::sapien::Renderer::server::proto::_IdFloat_default_instance_);
+}
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::set_specular() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_specular)
+  return _internal_set_specular();
 }
-inline bool AddDirectionalLightReq::_internal_shadow() const {
-  return _impl_.shadow_;
+inline ::sapien::Renderer::server::proto::IdFloat* Command::unsafe_arena_release_set_specular() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_specular)
+  if (_internal_has_set_specular()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_specular_;
+    _impl_.command_.set_specular_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline bool AddDirectionalLightReq::shadow() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow)
-  return _internal_shadow();
+inline void Command::unsafe_arena_set_allocated_set_specular(::sapien::Renderer::server::proto::IdFloat* set_specular) {
+  clear_command();
+  if (set_specular) {
+    set_has_set_specular();
+    _impl_.command_.set_specular_ = set_specular;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_specular)
 }
-inline void AddDirectionalLightReq::_internal_set_shadow(bool value) {
-  
-  _impl_.shadow_ = value;
+inline ::sapien::Renderer::server::proto::IdFloat* Command::_internal_mutable_set_specular() {
+  if (!_internal_has_set_specular()) {
+    clear_command();
+    set_has_set_specular();
+    _impl_.command_.set_specular_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::IdFloat >(GetArenaForAllocation());
+  }
+  return _impl_.command_.set_specular_;
 }
-inline void AddDirectionalLightReq::set_shadow(bool value) {
-  _internal_set_shadow(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow)
+inline ::sapien::Renderer::server::proto::IdFloat* Command::mutable_set_specular() {
+  ::sapien::Renderer::server::proto::IdFloat* _msg = _internal_mutable_set_specular();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_specular)
+  return _msg;
 }
 
-// .sapien.Renderer.server.proto.Vec3 position = 5;
-inline bool AddDirectionalLightReq::_internal_has_position() const {
-  return this != internal_default_instance() && _impl_.position_ != nullptr;
+// .sapien.Renderer.server.proto.IdFloat set_metallic = 6;
+inline bool Command::_internal_has_set_metallic() const {
+  return command_case() == kSetMetallic;
 }
-inline bool AddDirectionalLightReq::has_position() const {
-  return _internal_has_position();
+inline bool Command::has_set_metallic() const {
+  return _internal_has_set_metallic();
 }
-inline void AddDirectionalLightReq::clear_position() {
-  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
-    delete _impl_.position_;
+inline void Command::set_has_set_metallic() {
+  _impl_._oneof_case_[0] = kSetMetallic;
+}
+inline void Command::clear_set_metallic() {
+  if (_internal_has_set_metallic()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_metallic_;
+    }
+    clear_has_command();
   }
-  _impl_.position_ = nullptr;
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::_internal_position() const {
-  const ::sapien::Renderer::server::proto::Vec3* p = _impl_.position_;
-  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Vec3&>(
-      ::sapien::Renderer::server::proto::_Vec3_default_instance_);
+inline ::sapien::Renderer::server::proto::IdFloat* Command::release_set_metallic() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_metallic)
+  if (_internal_has_set_metallic()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_metallic_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_metallic_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::sapien::Renderer::server::proto::Vec3& AddDirectionalLightReq::position() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
-  return _internal_position();
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::_internal_set_metallic() const {
+  return _internal_has_set_metallic()
+      ? *_impl_.command_.set_metallic_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::IdFloat&>(::sapien::Renderer::server::proto::_IdFloat_default_instance_);
 }
-inline void AddDirectionalLightReq::unsafe_arena_set_allocated_position(
-    ::sapien::Renderer::server::proto::Vec3* position) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
-  }
-  _impl_.position_ = position;
-  if (position) {
-    
+inline const ::sapien::Renderer::server::proto::IdFloat& Command::set_metallic() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_metallic)
+  return _internal_set_metallic();
+}
+inline ::sapien::Renderer::server::proto::IdFloat* Command::unsafe_arena_release_set_metallic() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_metallic)
+  if (_internal_has_set_metallic()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::IdFloat* temp = _impl_.command_.set_metallic_;
+    _impl_.command_.set_metallic_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::release_position() {
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
-  _impl_.position_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline void Command::unsafe_arena_set_allocated_set_metallic(::sapien::Renderer::server::proto::IdFloat* set_metallic) {
+  clear_command();
+  if (set_metallic) {
+    set_has_set_metallic();
+    _impl_.command_.set_metallic_ = set_metallic;
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::unsafe_arena_release_position() {
-  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
-  
-  ::sapien::Renderer::server::proto::Vec3* temp = _impl_.position_;
-  _impl_.position_ = nullptr;
-  return temp;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_metallic)
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::_internal_mutable_position() {
-  
-  if (_impl_.position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Vec3>(GetArenaForAllocation());
-    _impl_.position_ = p;
+inline ::sapien::Renderer::server::proto::IdFloat* Command::_internal_mutable_set_metallic() {
+  if (!_internal_has_set_metallic()) {
+    clear_command();
+    set_has_set_metallic();
+    _impl_.command_.set_metallic_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::IdFloat >(GetArenaForAllocation());
   }
-  return _impl_.position_;
+  return _impl_.command_.set_metallic_;
 }
-inline ::sapien::Renderer::server::proto::Vec3* AddDirectionalLightReq::mutable_position() {
-  ::sapien::Renderer::server::proto::Vec3* _msg = _internal_mutable_position();
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
+inline ::sapien::Renderer::server::proto::IdFloat* Command::mutable_set_metallic() {
+  ::sapien::Renderer::server::proto::IdFloat* _msg = _internal_mutable_set_metallic();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_metallic)
   return _msg;
 }
-inline void AddDirectionalLightReq::set_allocated_position(::sapien::Renderer::server::proto::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.position_;
+
+// .sapien.Renderer.server.proto.AddBodyMeshReq add_body_mesh = 7;
+inline bool Command::_internal_has_add_body_mesh() const {
+  return command_case() == kAddBodyMesh;
+}
+inline bool Command::has_add_body_mesh() const {
+  return _internal_has_add_body_mesh();
+}
+inline void Command::set_has_add_body_mesh() {
+  _impl_._oneof_case_[0] = kAddBodyMesh;
+}
+inline void Command::clear_add_body_mesh() {
+  if (_internal_has_add_body_mesh()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.add_body_mesh_;
+    }
+    clear_has_command();
   }
-  if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
-    if (message_arena != submessage_arena) {
-      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
+}
+inline ::sapien::Renderer::server::proto::AddBodyMeshReq* Command::release_add_body_mesh() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.add_body_mesh)
+  if (_internal_has_add_body_mesh()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::AddBodyMeshReq* temp = _impl_.command_.add_body_mesh_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    
+    _impl_.command_.add_body_mesh_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  _impl_.position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.AddDirectionalLightReq.position)
 }
-
-// float shadow_scale = 6;
-inline void AddDirectionalLightReq::clear_shadow_scale() {
-  _impl_.shadow_scale_ = 0;
+inline const ::sapien::Renderer::server::proto::AddBodyMeshReq& Command::_internal_add_body_mesh() const {
+  return _internal_has_add_body_mesh()
+      ? *_impl_.command_.add_body_mesh_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::AddBodyMeshReq&>(::sapien::Renderer::server::proto::_AddBodyMeshReq_default_instance_);
 }
-inline float AddDirectionalLightReq::_internal_shadow_scale() const {
-  return _impl_.shadow_scale_;
+inline const ::sapien::Renderer::server::proto::AddBodyMeshReq& Command::add_body_mesh() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.add_body_mesh)
+  return _internal_add_body_mesh();
 }
-inline float AddDirectionalLightReq::shadow_scale() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_scale)
-  return _internal_shadow_scale();
+inline ::sapien::Renderer::server::proto::AddBodyMeshReq* Command::unsafe_arena_release_add_body_mesh() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.add_body_mesh)
+  if (_internal_has_add_body_mesh()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::AddBodyMeshReq* temp = _impl_.command_.add_body_mesh_;
+    _impl_.command_.add_body_mesh_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void AddDirectionalLightReq::_internal_set_shadow_scale(float value) {
-  
-  _impl_.shadow_scale_ = value;
+inline void Command::unsafe_arena_set_allocated_add_body_mesh(::sapien::Renderer::server::proto::AddBodyMeshReq* add_body_mesh) {
+  clear_command();
+  if (add_body_mesh) {
+    set_has_add_body_mesh();
+    _impl_.command_.add_body_mesh_ = add_body_mesh;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.add_body_mesh)
 }
-inline void AddDirectionalLightReq::set_shadow_scale(float value) {
-  _internal_set_shadow_scale(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_scale)
+inline ::sapien::Renderer::server::proto::AddBodyMeshReq* Command::_internal_mutable_add_body_mesh() {
+  if (!_internal_has_add_body_mesh()) {
+    clear_command();
+    set_has_add_body_mesh();
+    _impl_.command_.add_body_mesh_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::AddBodyMeshReq >(GetArenaForAllocation());
+  }
+  return _impl_.command_.add_body_mesh_;
+}
+inline ::sapien::Renderer::server::proto::AddBodyMeshReq* Command::mutable_add_body_mesh() {
+  ::sapien::Renderer::server::proto::AddBodyMeshReq* _msg = _internal_mutable_add_body_mesh();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.add_body_mesh)
+  return _msg;
 }
 
-// float shadow_near = 7;
-inline void AddDirectionalLightReq::clear_shadow_near() {
-  _impl_.shadow_near_ = 0;
+// .sapien.Renderer.server.proto.AddBodyPrimitiveReq add_body_primitive = 8;
+inline bool Command::_internal_has_add_body_primitive() const {
+  return command_case() == kAddBodyPrimitive;
 }
-inline float AddDirectionalLightReq::_internal_shadow_near() const {
-  return _impl_.shadow_near_;
+inline bool Command::has_add_body_primitive() const {
+  return _internal_has_add_body_primitive();
 }
-inline float AddDirectionalLightReq::shadow_near() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_near)
-  return _internal_shadow_near();
+inline void Command::set_has_add_body_primitive() {
+  _impl_._oneof_case_[0] = kAddBodyPrimitive;
 }
-inline void AddDirectionalLightReq::_internal_set_shadow_near(float value) {
-  
-  _impl_.shadow_near_ = value;
+inline void Command::clear_add_body_primitive() {
+  if (_internal_has_add_body_primitive()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.add_body_primitive_;
+    }
+    clear_has_command();
+  }
 }
-inline void AddDirectionalLightReq::set_shadow_near(float value) {
-  _internal_set_shadow_near(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_near)
+inline ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* Command::release_add_body_primitive() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.add_body_primitive)
+  if (_internal_has_add_body_primitive()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* temp = _impl_.command_.add_body_primitive_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.add_body_primitive_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// float shadow_far = 8;
-inline void AddDirectionalLightReq::clear_shadow_far() {
-  _impl_.shadow_far_ = 0;
+inline const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq& Command::_internal_add_body_primitive() const {
+  return _internal_has_add_body_primitive()
+      ? *_impl_.command_.add_body_primitive_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::AddBodyPrimitiveReq&>(::sapien::Renderer::server::proto::_AddBodyPrimitiveReq_default_instance_);
 }
-inline float AddDirectionalLightReq::_internal_shadow_far() const {
-  return _impl_.shadow_far_;
+inline const ::sapien::Renderer::server::proto::AddBodyPrimitiveReq& Command::add_body_primitive() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.add_body_primitive)
+  return _internal_add_body_primitive();
 }
-inline float AddDirectionalLightReq::shadow_far() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_far)
-  return _internal_shadow_far();
+inline ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* Command::unsafe_arena_release_add_body_primitive() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.add_body_primitive)
+  if (_internal_has_add_body_primitive()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* temp = _impl_.command_.add_body_primitive_;
+    _impl_.command_.add_body_primitive_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void AddDirectionalLightReq::_internal_set_shadow_far(float value) {
-  
-  _impl_.shadow_far_ = value;
+inline void Command::unsafe_arena_set_allocated_add_body_primitive(::sapien::Renderer::server::proto::AddBodyPrimitiveReq* add_body_primitive) {
+  clear_command();
+  if (add_body_primitive) {
+    set_has_add_body_primitive();
+    _impl_.command_.add_body_primitive_ = add_body_primitive;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.add_body_primitive)
 }
-inline void AddDirectionalLightReq::set_shadow_far(float value) {
-  _internal_set_shadow_far(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_far)
+inline ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* Command::_internal_mutable_add_body_primitive() {
+  if (!_internal_has_add_body_primitive()) {
+    clear_command();
+    set_has_add_body_primitive();
+    _impl_.command_.add_body_primitive_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::AddBodyPrimitiveReq >(GetArenaForAllocation());
+  }
+  return _impl_.command_.add_body_primitive_;
+}
+inline ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* Command::mutable_add_body_primitive() {
+  ::sapien::Renderer::server::proto::AddBodyPrimitiveReq* _msg = _internal_mutable_add_body_primitive();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.add_body_primitive)
+  return _msg;
 }
 
-// int32 shadow_map_size = 9;
-inline void AddDirectionalLightReq::clear_shadow_map_size() {
-  _impl_.shadow_map_size_ = 0;
+// .sapien.Renderer.server.proto.BodyIdReq set_unique_id = 9;
+inline bool Command::_internal_has_set_unique_id() const {
+  return command_case() == kSetUniqueId;
 }
-inline int32_t AddDirectionalLightReq::_internal_shadow_map_size() const {
-  return _impl_.shadow_map_size_;
+inline bool Command::has_set_unique_id() const {
+  return _internal_has_set_unique_id();
 }
-inline int32_t AddDirectionalLightReq::shadow_map_size() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_map_size)
-  return _internal_shadow_map_size();
+inline void Command::set_has_set_unique_id() {
+  _impl_._oneof_case_[0] = kSetUniqueId;
 }
-inline void AddDirectionalLightReq::_internal_set_shadow_map_size(int32_t value) {
-  
-  _impl_.shadow_map_size_ = value;
+inline void Command::clear_set_unique_id() {
+  if (_internal_has_set_unique_id()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_unique_id_;
+    }
+    clear_has_command();
+  }
 }
-inline void AddDirectionalLightReq::set_shadow_map_size(int32_t value) {
-  _internal_set_shadow_map_size(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.AddDirectionalLightReq.shadow_map_size)
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::release_set_unique_id() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_unique_id)
+  if (_internal_has_set_unique_id()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyIdReq* temp = _impl_.command_.set_unique_id_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_unique_id_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// -------------------------------------------------------------------
-
-// RemoveLightReq
-
-// uint64 scene_id = 1;
-inline void RemoveLightReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+inline const ::sapien::Renderer::server::proto::BodyIdReq& Command::_internal_set_unique_id() const {
+  return _internal_has_set_unique_id()
+      ? *_impl_.command_.set_unique_id_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::BodyIdReq&>(::sapien::Renderer::server::proto::_BodyIdReq_default_instance_);
 }
-inline uint64_t RemoveLightReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline const ::sapien::Renderer::server::proto::BodyIdReq& Command::set_unique_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_unique_id)
+  return _internal_set_unique_id();
 }
-inline uint64_t RemoveLightReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveLightReq.scene_id)
-  return _internal_scene_id();
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::unsafe_arena_release_set_unique_id() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_unique_id)
+  if (_internal_has_set_unique_id()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyIdReq* temp = _impl_.command_.set_unique_id_;
+    _impl_.command_.set_unique_id_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void RemoveLightReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline void Command::unsafe_arena_set_allocated_set_unique_id(::sapien::Renderer::server::proto::BodyIdReq* set_unique_id) {
+  clear_command();
+  if (set_unique_id) {
+    set_has_set_unique_id();
+    _impl_.command_.set_unique_id_ = set_unique_id;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_unique_id)
 }
-inline void RemoveLightReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveLightReq.scene_id)
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::_internal_mutable_set_unique_id() {
+  if (!_internal_has_set_unique_id()) {
+    clear_command();
+    set_has_set_unique_id();
+    _impl_.command_.set_unique_id_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::BodyIdReq >(GetArenaForAllocation());
+  }
+  return _impl_.command_.set_unique_id_;
+}
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::mutable_set_unique_id() {
+  ::sapien::Renderer::server::proto::BodyIdReq* _msg = _internal_mutable_set_unique_id();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_unique_id)
+  return _msg;
 }
 
-// uint64 light_id = 2;
-inline void RemoveLightReq::clear_light_id() {
-  _impl_.light_id_ = uint64_t{0u};
+// .sapien.Renderer.server.proto.BodyIdReq set_segmentation_id = 10;
+inline bool Command::_internal_has_set_segmentation_id() const {
+  return command_case() == kSetSegmentationId;
 }
-inline uint64_t RemoveLightReq::_internal_light_id() const {
-  return _impl_.light_id_;
+inline bool Command::has_set_segmentation_id() const {
+  return _internal_has_set_segmentation_id();
 }
-inline uint64_t RemoveLightReq::light_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.RemoveLightReq.light_id)
-  return _internal_light_id();
+inline void Command::set_has_set_segmentation_id() {
+  _impl_._oneof_case_[0] = kSetSegmentationId;
 }
-inline void RemoveLightReq::_internal_set_light_id(uint64_t value) {
-  
-  _impl_.light_id_ = value;
+inline void Command::clear_set_segmentation_id() {
+  if (_internal_has_set_segmentation_id()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_segmentation_id_;
+    }
+    clear_has_command();
+  }
 }
-inline void RemoveLightReq::set_light_id(uint64_t value) {
-  _internal_set_light_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.RemoveLightReq.light_id)
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::release_set_segmentation_id() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_segmentation_id)
+  if (_internal_has_set_segmentation_id()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyIdReq* temp = _impl_.command_.set_segmentation_id_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_segmentation_id_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// -------------------------------------------------------------------
-
-// EntityOrderReq
-
-// uint64 scene_id = 1;
-inline void EntityOrderReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+inline const ::sapien::Renderer::server::proto::BodyIdReq& Command::_internal_set_segmentation_id() const {
+  return _internal_has_set_segmentation_id()
+      ? *_impl_.command_.set_segmentation_id_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::BodyIdReq&>(::sapien::Renderer::server::proto::_BodyIdReq_default_instance_);
 }
-inline uint64_t EntityOrderReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline const ::sapien::Renderer::server::proto::BodyIdReq& Command::set_segmentation_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_segmentation_id)
+  return _internal_set_segmentation_id();
 }
-inline uint64_t EntityOrderReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.scene_id)
-  return _internal_scene_id();
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::unsafe_arena_release_set_segmentation_id() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_segmentation_id)
+  if (_internal_has_set_segmentation_id()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyIdReq* temp = _impl_.command_.set_segmentation_id_;
+    _impl_.command_.set_segmentation_id_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void EntityOrderReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline void Command::unsafe_arena_set_allocated_set_segmentation_id(::sapien::Renderer::server::proto::BodyIdReq* set_segmentation_id) {
+  clear_command();
+  if (set_segmentation_id) {
+    set_has_set_segmentation_id();
+    _impl_.command_.set_segmentation_id_ = set_segmentation_id;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_segmentation_id)
 }
-inline void EntityOrderReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.scene_id)
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::_internal_mutable_set_segmentation_id() {
+  if (!_internal_has_set_segmentation_id()) {
+    clear_command();
+    set_has_set_segmentation_id();
+    _impl_.command_.set_segmentation_id_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::BodyIdReq >(GetArenaForAllocation());
+  }
+  return _impl_.command_.set_segmentation_id_;
+}
+inline ::sapien::Renderer::server::proto::BodyIdReq* Command::mutable_set_segmentation_id() {
+  ::sapien::Renderer::server::proto::BodyIdReq* _msg = _internal_mutable_set_segmentation_id();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_segmentation_id)
+  return _msg;
+}
+
+// .sapien.Renderer.server.proto.BodyFloat32Req set_visibility = 11;
+inline bool Command::_internal_has_set_visibility() const {
+  return command_case() == kSetVisibility;
+}
+inline bool Command::has_set_visibility() const {
+  return _internal_has_set_visibility();
+}
+inline void Command::set_has_set_visibility() {
+  _impl_._oneof_case_[0] = kSetVisibility;
+}
+inline void Command::clear_set_visibility() {
+  if (_internal_has_set_visibility()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.command_.set_visibility_;
+    }
+    clear_has_command();
+  }
 }
-
-// repeated uint64 body_ids = 2 [packed = true];
-inline int EntityOrderReq::_internal_body_ids_size() const {
-  return _impl_.body_ids_.size();
+inline ::sapien::Renderer::server::proto::BodyFloat32Req* Command::release_set_visibility() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.Command.set_visibility)
+  if (_internal_has_set_visibility()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyFloat32Req* temp = _impl_.command_.set_visibility_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.command_.set_visibility_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline int EntityOrderReq::body_ids_size() const {
-  return _internal_body_ids_size();
+inline const ::sapien::Renderer::server::proto::BodyFloat32Req& Command::_internal_set_visibility() const {
+  return _internal_has_set_visibility()
+      ? *_impl_.command_.set_visibility_
+      : reinterpret_cast< ::sapien::Renderer::server::proto::BodyFloat32Req&>(::sapien::Renderer::server::proto::_BodyFloat32Req_default_instance_);
 }
-inline void EntityOrderReq::clear_body_ids() {
-  _impl_.body_ids_.Clear();
+inline const ::sapien::Renderer::server::proto::BodyFloat32Req& Command::set_visibility() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.set_visibility)
+  return _internal_set_visibility();
 }
-inline uint64_t EntityOrderReq::_internal_body_ids(int index) const {
-  return _impl_.body_ids_.Get(index);
+inline ::sapien::Renderer::server::proto::BodyFloat32Req* Command::unsafe_arena_release_set_visibility() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sapien.Renderer.server.proto.Command.set_visibility)
+  if (_internal_has_set_visibility()) {
+    clear_has_command();
+    ::sapien::Renderer::server::proto::BodyFloat32Req* temp = _impl_.command_.set_visibility_;
+    _impl_.command_.set_visibility_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline uint64_t EntityOrderReq::body_ids(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
-  return _internal_body_ids(index);
+inline void Command::unsafe_arena_set_allocated_set_visibility(::sapien::Renderer::server::proto::BodyFloat32Req* set_visibility) {
+  clear_command();
+  if (set_visibility) {
+    set_has_set_visibility();
+    _impl_.command_.set_visibility_ = set_visibility;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.Command.set_visibility)
 }
-inline void EntityOrderReq::set_body_ids(int index, uint64_t value) {
-  _impl_.body_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+inline ::sapien::Renderer::server::proto::BodyFloat32Req* Command::_internal_mutable_set_visibility() {
+  if (!_internal_has_set_visibility()) {
+    clear_command();
+    set_has_set_visibility();
+    _impl_.command_.set_visibility_ = CreateMaybeMessage< ::sapien::Renderer::server::proto::BodyFloat32Req >(GetArenaForAllocation());
+  }
+  return _impl_.command_.set_visibility_;
 }
-inline void EntityOrderReq::_internal_add_body_ids(uint64_t value) {
-  _impl_.body_ids_.Add(value);
+inline ::sapien::Renderer::server::proto::BodyFloat32Req* Command::mutable_set_visibility() {
+  ::sapien::Renderer::server::proto::BodyFloat32Req* _msg = _internal_mutable_set_visibility();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.Command.set_visibility)
+  return _msg;
 }
-inline void EntityOrderReq::add_body_ids(uint64_t value) {
-  _internal_add_body_ids(value);
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
+
+// uint64 provisional_id = 12;
+inline void Command::clear_provisional_id() {
+  _impl_.provisional_id_ = uint64_t{0u};
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-EntityOrderReq::_internal_body_ids() const {
-  return _impl_.body_ids_;
+inline uint64_t Command::_internal_provisional_id() const {
+  return _impl_.provisional_id_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-EntityOrderReq::body_ids() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
-  return _internal_body_ids();
+inline uint64_t Command::provisional_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Command.provisional_id)
+  return _internal_provisional_id();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-EntityOrderReq::_internal_mutable_body_ids() {
-  return &_impl_.body_ids_;
+inline void Command::_internal_set_provisional_id(uint64_t value) {
+  
+  _impl_.provisional_id_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-EntityOrderReq::mutable_body_ids() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.EntityOrderReq.body_ids)
-  return _internal_mutable_body_ids();
+inline void Command::set_provisional_id(uint64_t value) {
+  _internal_set_provisional_id(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Command.provisional_id)
 }
 
-// repeated uint64 camera_ids = 3 [packed = true];
-inline int EntityOrderReq::_internal_camera_ids_size() const {
-  return _impl_.camera_ids_.size();
+inline bool Command::has_command() const {
+  return command_case() != COMMAND_NOT_SET;
 }
-inline int EntityOrderReq::camera_ids_size() const {
-  return _internal_camera_ids_size();
+inline void Command::clear_has_command() {
+  _impl_._oneof_case_[0] = COMMAND_NOT_SET;
 }
-inline void EntityOrderReq::clear_camera_ids() {
-  _impl_.camera_ids_.Clear();
+inline Command::CommandCase Command::command_case() const {
+  return Command::CommandCase(_impl_._oneof_case_[0]);
 }
-inline uint64_t EntityOrderReq::_internal_camera_ids(int index) const {
-  return _impl_.camera_ids_.Get(index);
+// -------------------------------------------------------------------
+
+// CommandBatchReq
+
+// repeated .sapien.Renderer.server.proto.Command commands = 1;
+inline int CommandBatchReq::_internal_commands_size() const {
+  return _impl_.commands_.size();
 }
-inline uint64_t EntityOrderReq::camera_ids(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
-  return _internal_camera_ids(index);
+inline int CommandBatchReq::commands_size() const {
+  return _internal_commands_size();
 }
-inline void EntityOrderReq::set_camera_ids(int index, uint64_t value) {
-  _impl_.camera_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
+inline void CommandBatchReq::clear_commands() {
+  _impl_.commands_.Clear();
 }
-inline void EntityOrderReq::_internal_add_camera_ids(uint64_t value) {
-  _impl_.camera_ids_.Add(value);
+inline ::sapien::Renderer::server::proto::Command* CommandBatchReq::mutable_commands(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.CommandBatchReq.commands)
+  return _impl_.commands_.Mutable(index);
 }
-inline void EntityOrderReq::add_camera_ids(uint64_t value) {
-  _internal_add_camera_ids(value);
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Command >*
+CommandBatchReq::mutable_commands() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.CommandBatchReq.commands)
+  return &_impl_.commands_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-EntityOrderReq::_internal_camera_ids() const {
-  return _impl_.camera_ids_;
+inline const ::sapien::Renderer::server::proto::Command& CommandBatchReq::_internal_commands(int index) const {
+  return _impl_.commands_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-EntityOrderReq::camera_ids() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
-  return _internal_camera_ids();
+inline const ::sapien::Renderer::server::proto::Command& CommandBatchReq::commands(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CommandBatchReq.commands)
+  return _internal_commands(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-EntityOrderReq::_internal_mutable_camera_ids() {
-  return &_impl_.camera_ids_;
+inline ::sapien::Renderer::server::proto::Command* CommandBatchReq::_internal_add_commands() {
+  return _impl_.commands_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-EntityOrderReq::mutable_camera_ids() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.EntityOrderReq.camera_ids)
-  return _internal_mutable_camera_ids();
+inline ::sapien::Renderer::server::proto::Command* CommandBatchReq::add_commands() {
+  ::sapien::Renderer::server::proto::Command* _add = _internal_add_commands();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.CommandBatchReq.commands)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Command >&
+CommandBatchReq::commands() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.CommandBatchReq.commands)
+  return _impl_.commands_;
 }
 
 // -------------------------------------------------------------------
 
-// UpdateRenderReq
+// CommandBatchRes
 
-// uint64 scene_id = 1;
-inline void UpdateRenderReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
-}
-inline uint64_t UpdateRenderReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+// repeated uint64 provisional_ids = 1;
+inline int CommandBatchRes::_internal_provisional_ids_size() const {
+  return _impl_.provisional_ids_.size();
 }
-inline uint64_t UpdateRenderReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.scene_id)
-  return _internal_scene_id();
+inline int CommandBatchRes::provisional_ids_size() const {
+  return _internal_provisional_ids_size();
 }
-inline void UpdateRenderReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline void CommandBatchRes::clear_provisional_ids() {
+  _impl_.provisional_ids_.Clear();
 }
-inline void UpdateRenderReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderReq.scene_id)
+inline uint64_t CommandBatchRes::_internal_provisional_ids(int index) const {
+  return _impl_.provisional_ids_.Get(index);
 }
-
-// repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
-inline int UpdateRenderReq::_internal_body_poses_size() const {
-  return _impl_.body_poses_.size();
+inline uint64_t CommandBatchRes::provisional_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CommandBatchRes.provisional_ids)
+  return _internal_provisional_ids(index);
 }
-inline int UpdateRenderReq::body_poses_size() const {
-  return _internal_body_poses_size();
+inline void CommandBatchRes::set_provisional_ids(int index, uint64_t value) {
+  _impl_.provisional_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CommandBatchRes.provisional_ids)
 }
-inline void UpdateRenderReq::clear_body_poses() {
-  _impl_.body_poses_.Clear();
+inline void CommandBatchRes::_internal_add_provisional_ids(uint64_t value) {
+  _impl_.provisional_ids_.Add(value);
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::mutable_body_poses(int index) {
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
-  return _impl_.body_poses_.Mutable(index);
+inline void CommandBatchRes::add_provisional_ids(uint64_t value) {
+  _internal_add_provisional_ids(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.CommandBatchRes.provisional_ids)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
-UpdateRenderReq::mutable_body_poses() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
-  return &_impl_.body_poses_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandBatchRes::_internal_provisional_ids() const {
+  return _impl_.provisional_ids_;
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::_internal_body_poses(int index) const {
-  return _impl_.body_poses_.Get(index);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandBatchRes::provisional_ids() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.CommandBatchRes.provisional_ids)
+  return _internal_provisional_ids();
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::body_poses(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
-  return _internal_body_poses(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandBatchRes::_internal_mutable_provisional_ids() {
+  return &_impl_.provisional_ids_;
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::_internal_add_body_poses() {
-  return _impl_.body_poses_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandBatchRes::mutable_provisional_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.CommandBatchRes.provisional_ids)
+  return _internal_mutable_provisional_ids();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::add_body_poses() {
-  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_body_poses();
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
-  return _add;
+
+// repeated uint64 ids = 2;
+inline int CommandBatchRes::_internal_ids_size() const {
+  return _impl_.ids_.size();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
-UpdateRenderReq::body_poses() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.body_poses)
-  return _impl_.body_poses_;
+inline int CommandBatchRes::ids_size() const {
+  return _internal_ids_size();
 }
-
-// repeated .sapien.Renderer.server.proto.Pose camera_poses = 3;
-inline int UpdateRenderReq::_internal_camera_poses_size() const {
-  return _impl_.camera_poses_.size();
+inline void CommandBatchRes::clear_ids() {
+  _impl_.ids_.Clear();
 }
-inline int UpdateRenderReq::camera_poses_size() const {
-  return _internal_camera_poses_size();
+inline uint64_t CommandBatchRes::_internal_ids(int index) const {
+  return _impl_.ids_.Get(index);
 }
-inline void UpdateRenderReq::clear_camera_poses() {
-  _impl_.camera_poses_.Clear();
+inline uint64_t CommandBatchRes::ids(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CommandBatchRes.ids)
+  return _internal_ids(index);
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::mutable_camera_poses(int index) {
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
-  return _impl_.camera_poses_.Mutable(index);
+inline void CommandBatchRes::set_ids(int index, uint64_t value) {
+  _impl_.ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CommandBatchRes.ids)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
-UpdateRenderReq::mutable_camera_poses() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
-  return &_impl_.camera_poses_;
+inline void CommandBatchRes::_internal_add_ids(uint64_t value) {
+  _impl_.ids_.Add(value);
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::_internal_camera_poses(int index) const {
-  return _impl_.camera_poses_.Get(index);
+inline void CommandBatchRes::add_ids(uint64_t value) {
+  _internal_add_ids(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.CommandBatchRes.ids)
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderReq::camera_poses(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
-  return _internal_camera_poses(index);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandBatchRes::_internal_ids() const {
+  return _impl_.ids_;
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::_internal_add_camera_poses() {
-  return _impl_.camera_poses_.Add();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CommandBatchRes::ids() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.CommandBatchRes.ids)
+  return _internal_ids();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderReq::add_camera_poses() {
-  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_camera_poses();
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
-  return _add;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandBatchRes::_internal_mutable_ids() {
+  return &_impl_.ids_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
-UpdateRenderReq::camera_poses() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderReq.camera_poses)
-  return _impl_.camera_poses_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CommandBatchRes::mutable_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.CommandBatchRes.ids)
+  return _internal_mutable_ids();
 }
 
 // -------------------------------------------------------------------
 
-// BodyIdReq
+// Histogram
 
-// uint64 scene_id = 1;
-inline void BodyIdReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// uint64 count = 1;
+inline void Histogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
 }
-inline uint64_t BodyIdReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline uint64_t Histogram::_internal_count() const {
+  return _impl_.count_;
 }
-inline uint64_t BodyIdReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.scene_id)
-  return _internal_scene_id();
+inline uint64_t Histogram::count() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Histogram.count)
+  return _internal_count();
 }
-inline void BodyIdReq::_internal_set_scene_id(uint64_t value) {
+inline void Histogram::_internal_set_count(uint64_t value) {
   
-  _impl_.scene_id_ = value;
+  _impl_.count_ = value;
 }
-inline void BodyIdReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.scene_id)
+inline void Histogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Histogram.count)
 }
 
-// uint64 body_id = 2;
-inline void BodyIdReq::clear_body_id() {
-  _impl_.body_id_ = uint64_t{0u};
+// uint64 sum_us = 2;
+inline void Histogram::clear_sum_us() {
+  _impl_.sum_us_ = uint64_t{0u};
 }
-inline uint64_t BodyIdReq::_internal_body_id() const {
-  return _impl_.body_id_;
+inline uint64_t Histogram::_internal_sum_us() const {
+  return _impl_.sum_us_;
 }
-inline uint64_t BodyIdReq::body_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.body_id)
-  return _internal_body_id();
+inline uint64_t Histogram::sum_us() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Histogram.sum_us)
+  return _internal_sum_us();
 }
-inline void BodyIdReq::_internal_set_body_id(uint64_t value) {
+inline void Histogram::_internal_set_sum_us(uint64_t value) {
   
-  _impl_.body_id_ = value;
+  _impl_.sum_us_ = value;
 }
-inline void BodyIdReq::set_body_id(uint64_t value) {
-  _internal_set_body_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.body_id)
+inline void Histogram::set_sum_us(uint64_t value) {
+  _internal_set_sum_us(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Histogram.sum_us)
 }
 
-// uint32 id = 3;
-inline void BodyIdReq::clear_id() {
-  _impl_.id_ = 0u;
+// uint64 max_us = 3;
+inline void Histogram::clear_max_us() {
+  _impl_.max_us_ = uint64_t{0u};
 }
-inline uint32_t BodyIdReq::_internal_id() const {
-  return _impl_.id_;
+inline uint64_t Histogram::_internal_max_us() const {
+  return _impl_.max_us_;
 }
-inline uint32_t BodyIdReq::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyIdReq.id)
-  return _internal_id();
+inline uint64_t Histogram::max_us() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Histogram.max_us)
+  return _internal_max_us();
 }
-inline void BodyIdReq::_internal_set_id(uint32_t value) {
+inline void Histogram::_internal_set_max_us(uint64_t value) {
   
-  _impl_.id_ = value;
+  _impl_.max_us_ = value;
 }
-inline void BodyIdReq::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyIdReq.id)
+inline void Histogram::set_max_us(uint64_t value) {
+  _internal_set_max_us(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Histogram.max_us)
 }
 
-// -------------------------------------------------------------------
-
-// BodyUint32Req
-
-// uint64 scene_id = 1;
-inline void BodyUint32Req::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
-}
-inline uint64_t BodyUint32Req::_internal_scene_id() const {
-  return _impl_.scene_id_;
-}
-inline uint64_t BodyUint32Req::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.scene_id)
-  return _internal_scene_id();
+// repeated uint64 buckets = 4;
+inline int Histogram::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
 }
-inline void BodyUint32Req::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
-}
-inline void BodyUint32Req::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.scene_id)
-}
-
-// uint64 body_id = 2;
-inline void BodyUint32Req::clear_body_id() {
-  _impl_.body_id_ = uint64_t{0u};
+inline int Histogram::buckets_size() const {
+  return _internal_buckets_size();
 }
-inline uint64_t BodyUint32Req::_internal_body_id() const {
-  return _impl_.body_id_;
+inline void Histogram::clear_buckets() {
+  _impl_.buckets_.Clear();
 }
-inline uint64_t BodyUint32Req::body_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.body_id)
-  return _internal_body_id();
+inline uint64_t Histogram::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
 }
-inline void BodyUint32Req::_internal_set_body_id(uint64_t value) {
-  
-  _impl_.body_id_ = value;
+inline uint64_t Histogram::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.Histogram.buckets)
+  return _internal_buckets(index);
 }
-inline void BodyUint32Req::set_body_id(uint64_t value) {
-  _internal_set_body_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.body_id)
+inline void Histogram::set_buckets(int index, uint64_t value) {
+  _impl_.buckets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.Histogram.buckets)
 }
-
-// uint32 id = 3;
-inline void BodyUint32Req::clear_id() {
-  _impl_.id_ = 0u;
+inline void Histogram::_internal_add_buckets(uint64_t value) {
+  _impl_.buckets_.Add(value);
 }
-inline uint32_t BodyUint32Req::_internal_id() const {
-  return _impl_.id_;
+inline void Histogram::add_buckets(uint64_t value) {
+  _internal_add_buckets(value);
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.Histogram.buckets)
 }
-inline uint32_t BodyUint32Req::id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyUint32Req.id)
-  return _internal_id();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Histogram::_internal_buckets() const {
+  return _impl_.buckets_;
 }
-inline void BodyUint32Req::_internal_set_id(uint32_t value) {
-  
-  _impl_.id_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Histogram::buckets() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.Histogram.buckets)
+  return _internal_buckets();
 }
-inline void BodyUint32Req::set_id(uint32_t value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyUint32Req.id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Histogram::_internal_mutable_buckets() {
+  return &_impl_.buckets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Histogram::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.Histogram.buckets)
+  return _internal_mutable_buckets();
 }
 
 // -------------------------------------------------------------------
 
-// BodyFloat32Req
+// MethodMetrics
 
-// uint64 scene_id = 1;
-inline void BodyFloat32Req::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// string name = 1;
+inline void MethodMetrics::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline uint64_t BodyFloat32Req::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline const std::string& MethodMetrics::name() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.name)
+  return _internal_name();
 }
-inline uint64_t BodyFloat32Req::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.scene_id)
-  return _internal_scene_id();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MethodMetrics::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.MethodMetrics.name)
 }
-inline void BodyFloat32Req::_internal_set_scene_id(uint64_t value) {
+inline std::string* MethodMetrics::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MethodMetrics.name)
+  return _s;
+}
+inline const std::string& MethodMetrics::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MethodMetrics::_internal_set_name(const std::string& value) {
   
-  _impl_.scene_id_ = value;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline void BodyFloat32Req::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.scene_id)
+inline std::string* MethodMetrics::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MethodMetrics::release_name() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.MethodMetrics.name)
+  return _impl_.name_.Release();
+}
+inline void MethodMetrics::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.MethodMetrics.name)
 }
 
-// uint64 body_id = 2;
-inline void BodyFloat32Req::clear_body_id() {
-  _impl_.body_id_ = uint64_t{0u};
+// .sapien.Renderer.server.proto.Histogram latency = 2;
+inline bool MethodMetrics::_internal_has_latency() const {
+  return this != internal_default_instance() && _impl_.latency_ != nullptr;
 }
-inline uint64_t BodyFloat32Req::_internal_body_id() const {
-  return _impl_.body_id_;
+inline bool MethodMetrics::has_latency() const {
+  return _internal_has_latency();
 }
-inline uint64_t BodyFloat32Req::body_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.body_id)
-  return _internal_body_id();
+inline void MethodMetrics::clear_latency() {
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
 }
-inline void BodyFloat32Req::_internal_set_body_id(uint64_t value) {
-  
-  _impl_.body_id_ = value;
+inline const ::sapien::Renderer::server::proto::Histogram& MethodMetrics::_internal_latency() const {
+  const ::sapien::Renderer::server::proto::Histogram* p = _impl_.latency_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Histogram&>(
+      ::sapien::Renderer::server::proto::_Histogram_default_instance_);
 }
-inline void BodyFloat32Req::set_body_id(uint64_t value) {
-  _internal_set_body_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.body_id)
+inline const ::sapien::Renderer::server::proto::Histogram& MethodMetrics::latency() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.latency)
+  return _internal_latency();
 }
-
-// float value = 3;
-inline void BodyFloat32Req::clear_value() {
-  _impl_.value_ = 0;
+inline void MethodMetrics::unsafe_arena_set_allocated_latency(
+    ::sapien::Renderer::server::proto::Histogram* latency) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.latency_);
+  }
+  _impl_.latency_ = latency;
+  if (latency) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.MethodMetrics.latency)
 }
-inline float BodyFloat32Req::_internal_value() const {
-  return _impl_.value_;
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::release_latency() {
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline float BodyFloat32Req::value() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyFloat32Req.value)
-  return _internal_value();
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::unsafe_arena_release_latency() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.MethodMetrics.latency)
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+  return temp;
 }
-inline void BodyFloat32Req::_internal_set_value(float value) {
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::_internal_mutable_latency() {
   
-  _impl_.value_ = value;
+  if (_impl_.latency_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Histogram>(GetArenaForAllocation());
+    _impl_.latency_ = p;
+  }
+  return _impl_.latency_;
 }
-inline void BodyFloat32Req::set_value(float value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyFloat32Req.value)
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::mutable_latency() {
+  ::sapien::Renderer::server::proto::Histogram* _msg = _internal_mutable_latency();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MethodMetrics.latency)
+  return _msg;
+}
+inline void MethodMetrics::set_allocated_latency(::sapien::Renderer::server::proto::Histogram* latency) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.latency_;
+  }
+  if (latency) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(latency);
+    if (message_arena != submessage_arena) {
+      latency = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, latency, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.latency_ = latency;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.MethodMetrics.latency)
 }
 
-// -------------------------------------------------------------------
-
-// TakePictureReq
-
-// uint64 scene_id = 1;
-inline void TakePictureReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// .sapien.Renderer.server.proto.Histogram handler = 3;
+inline bool MethodMetrics::_internal_has_handler() const {
+  return this != internal_default_instance() && _impl_.handler_ != nullptr;
 }
-inline uint64_t TakePictureReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline bool MethodMetrics::has_handler() const {
+  return _internal_has_handler();
 }
-inline uint64_t TakePictureReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.TakePictureReq.scene_id)
-  return _internal_scene_id();
+inline void MethodMetrics::clear_handler() {
+  if (GetArenaForAllocation() == nullptr && _impl_.handler_ != nullptr) {
+    delete _impl_.handler_;
+  }
+  _impl_.handler_ = nullptr;
 }
-inline void TakePictureReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline const ::sapien::Renderer::server::proto::Histogram& MethodMetrics::_internal_handler() const {
+  const ::sapien::Renderer::server::proto::Histogram* p = _impl_.handler_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Histogram&>(
+      ::sapien::Renderer::server::proto::_Histogram_default_instance_);
 }
-inline void TakePictureReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.TakePictureReq.scene_id)
+inline const ::sapien::Renderer::server::proto::Histogram& MethodMetrics::handler() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.handler)
+  return _internal_handler();
 }
-
-// uint64 camera_id = 2;
-inline void TakePictureReq::clear_camera_id() {
-  _impl_.camera_id_ = uint64_t{0u};
+inline void MethodMetrics::unsafe_arena_set_allocated_handler(
+    ::sapien::Renderer::server::proto::Histogram* handler) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.handler_);
+  }
+  _impl_.handler_ = handler;
+  if (handler) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.MethodMetrics.handler)
 }
-inline uint64_t TakePictureReq::_internal_camera_id() const {
-  return _impl_.camera_id_;
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::release_handler() {
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.handler_;
+  _impl_.handler_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline uint64_t TakePictureReq::camera_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.TakePictureReq.camera_id)
-  return _internal_camera_id();
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::unsafe_arena_release_handler() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.MethodMetrics.handler)
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.handler_;
+  _impl_.handler_ = nullptr;
+  return temp;
 }
-inline void TakePictureReq::_internal_set_camera_id(uint64_t value) {
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::_internal_mutable_handler() {
   
-  _impl_.camera_id_ = value;
+  if (_impl_.handler_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Histogram>(GetArenaForAllocation());
+    _impl_.handler_ = p;
+  }
+  return _impl_.handler_;
 }
-inline void TakePictureReq::set_camera_id(uint64_t value) {
-  _internal_set_camera_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.TakePictureReq.camera_id)
+inline ::sapien::Renderer::server::proto::Histogram* MethodMetrics::mutable_handler() {
+  ::sapien::Renderer::server::proto::Histogram* _msg = _internal_mutable_handler();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MethodMetrics.handler)
+  return _msg;
+}
+inline void MethodMetrics::set_allocated_handler(::sapien::Renderer::server::proto::Histogram* handler) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.handler_;
+  }
+  if (handler) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(handler);
+    if (message_arena != submessage_arena) {
+      handler = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, handler, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.handler_ = handler;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.MethodMetrics.handler)
 }
 
-// -------------------------------------------------------------------
-
-// UpdateRenderAndTakePicturesReq
-
-// uint64 scene_id = 1;
-inline void UpdateRenderAndTakePicturesReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+// uint64 errors = 4;
+inline void MethodMetrics::clear_errors() {
+  _impl_.errors_ = uint64_t{0u};
 }
-inline uint64_t UpdateRenderAndTakePicturesReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline uint64_t MethodMetrics::_internal_errors() const {
+  return _impl_.errors_;
 }
-inline uint64_t UpdateRenderAndTakePicturesReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.scene_id)
-  return _internal_scene_id();
+inline uint64_t MethodMetrics::errors() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.errors)
+  return _internal_errors();
 }
-inline void UpdateRenderAndTakePicturesReq::_internal_set_scene_id(uint64_t value) {
+inline void MethodMetrics::_internal_set_errors(uint64_t value) {
   
-  _impl_.scene_id_ = value;
+  _impl_.errors_ = value;
 }
-inline void UpdateRenderAndTakePicturesReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.scene_id)
+inline void MethodMetrics::set_errors(uint64_t value) {
+  _internal_set_errors(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.MethodMetrics.errors)
 }
 
-// repeated .sapien.Renderer.server.proto.Pose body_poses = 2;
-inline int UpdateRenderAndTakePicturesReq::_internal_body_poses_size() const {
-  return _impl_.body_poses_.size();
+// uint64 bytes_in = 5;
+inline void MethodMetrics::clear_bytes_in() {
+  _impl_.bytes_in_ = uint64_t{0u};
 }
-inline int UpdateRenderAndTakePicturesReq::body_poses_size() const {
-  return _internal_body_poses_size();
+inline uint64_t MethodMetrics::_internal_bytes_in() const {
+  return _impl_.bytes_in_;
 }
-inline void UpdateRenderAndTakePicturesReq::clear_body_poses() {
-  _impl_.body_poses_.Clear();
+inline uint64_t MethodMetrics::bytes_in() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.bytes_in)
+  return _internal_bytes_in();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::mutable_body_poses(int index) {
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
-  return _impl_.body_poses_.Mutable(index);
+inline void MethodMetrics::_internal_set_bytes_in(uint64_t value) {
+  
+  _impl_.bytes_in_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
-UpdateRenderAndTakePicturesReq::mutable_body_poses() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
-  return &_impl_.body_poses_;
+inline void MethodMetrics::set_bytes_in(uint64_t value) {
+  _internal_set_bytes_in(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.MethodMetrics.bytes_in)
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::_internal_body_poses(int index) const {
-  return _impl_.body_poses_.Get(index);
+
+// uint64 bytes_out = 6;
+inline void MethodMetrics::clear_bytes_out() {
+  _impl_.bytes_out_ = uint64_t{0u};
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::body_poses(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
-  return _internal_body_poses(index);
+inline uint64_t MethodMetrics::_internal_bytes_out() const {
+  return _impl_.bytes_out_;
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::_internal_add_body_poses() {
-  return _impl_.body_poses_.Add();
+inline uint64_t MethodMetrics::bytes_out() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MethodMetrics.bytes_out)
+  return _internal_bytes_out();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::add_body_poses() {
-  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_body_poses();
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
-  return _add;
+inline void MethodMetrics::_internal_set_bytes_out(uint64_t value) {
+  
+  _impl_.bytes_out_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
-UpdateRenderAndTakePicturesReq::body_poses() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.body_poses)
-  return _impl_.body_poses_;
+inline void MethodMetrics::set_bytes_out(uint64_t value) {
+  _internal_set_bytes_out(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.MethodMetrics.bytes_out)
 }
 
-// repeated .sapien.Renderer.server.proto.Pose camera_poses = 3;
-inline int UpdateRenderAndTakePicturesReq::_internal_camera_poses_size() const {
-  return _impl_.camera_poses_.size();
-}
-inline int UpdateRenderAndTakePicturesReq::camera_poses_size() const {
-  return _internal_camera_poses_size();
-}
-inline void UpdateRenderAndTakePicturesReq::clear_camera_poses() {
-  _impl_.camera_poses_.Clear();
+// -------------------------------------------------------------------
+
+// StageMetrics
+
+// string name = 1;
+inline void StageMetrics::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::mutable_camera_poses(int index) {
-  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
-  return _impl_.camera_poses_.Mutable(index);
+inline const std::string& StageMetrics::name() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.StageMetrics.name)
+  return _internal_name();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >*
-UpdateRenderAndTakePicturesReq::mutable_camera_poses() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
-  return &_impl_.camera_poses_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StageMetrics::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.StageMetrics.name)
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::_internal_camera_poses(int index) const {
-  return _impl_.camera_poses_.Get(index);
+inline std::string* StageMetrics::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.StageMetrics.name)
+  return _s;
 }
-inline const ::sapien::Renderer::server::proto::Pose& UpdateRenderAndTakePicturesReq::camera_poses(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
-  return _internal_camera_poses(index);
+inline const std::string& StageMetrics::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::_internal_add_camera_poses() {
-  return _impl_.camera_poses_.Add();
+inline void StageMetrics::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::sapien::Renderer::server::proto::Pose* UpdateRenderAndTakePicturesReq::add_camera_poses() {
-  ::sapien::Renderer::server::proto::Pose* _add = _internal_add_camera_poses();
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
-  return _add;
+inline std::string* StageMetrics::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::Pose >&
-UpdateRenderAndTakePicturesReq::camera_poses() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_poses)
-  return _impl_.camera_poses_;
+inline std::string* StageMetrics::release_name() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.StageMetrics.name)
+  return _impl_.name_.Release();
 }
-
-// repeated uint64 camera_ids = 4 [packed = true];
-inline int UpdateRenderAndTakePicturesReq::_internal_camera_ids_size() const {
-  return _impl_.camera_ids_.size();
+inline void StageMetrics::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.StageMetrics.name)
 }
-inline int UpdateRenderAndTakePicturesReq::camera_ids_size() const {
-  return _internal_camera_ids_size();
+
+// .sapien.Renderer.server.proto.Histogram latency = 2;
+inline bool StageMetrics::_internal_has_latency() const {
+  return this != internal_default_instance() && _impl_.latency_ != nullptr;
 }
-inline void UpdateRenderAndTakePicturesReq::clear_camera_ids() {
-  _impl_.camera_ids_.Clear();
+inline bool StageMetrics::has_latency() const {
+  return _internal_has_latency();
 }
-inline uint64_t UpdateRenderAndTakePicturesReq::_internal_camera_ids(int index) const {
-  return _impl_.camera_ids_.Get(index);
+inline void StageMetrics::clear_latency() {
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
 }
-inline uint64_t UpdateRenderAndTakePicturesReq::camera_ids(int index) const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
-  return _internal_camera_ids(index);
+inline const ::sapien::Renderer::server::proto::Histogram& StageMetrics::_internal_latency() const {
+  const ::sapien::Renderer::server::proto::Histogram* p = _impl_.latency_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sapien::Renderer::server::proto::Histogram&>(
+      ::sapien::Renderer::server::proto::_Histogram_default_instance_);
 }
-inline void UpdateRenderAndTakePicturesReq::set_camera_ids(int index, uint64_t value) {
-  _impl_.camera_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
+inline const ::sapien::Renderer::server::proto::Histogram& StageMetrics::latency() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.StageMetrics.latency)
+  return _internal_latency();
 }
-inline void UpdateRenderAndTakePicturesReq::_internal_add_camera_ids(uint64_t value) {
-  _impl_.camera_ids_.Add(value);
+inline void StageMetrics::unsafe_arena_set_allocated_latency(
+    ::sapien::Renderer::server::proto::Histogram* latency) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.latency_);
+  }
+  _impl_.latency_ = latency;
+  if (latency) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sapien.Renderer.server.proto.StageMetrics.latency)
 }
-inline void UpdateRenderAndTakePicturesReq::add_camera_ids(uint64_t value) {
-  _internal_add_camera_ids(value);
-  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
+inline ::sapien::Renderer::server::proto::Histogram* StageMetrics::release_latency() {
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-UpdateRenderAndTakePicturesReq::_internal_camera_ids() const {
-  return _impl_.camera_ids_;
+inline ::sapien::Renderer::server::proto::Histogram* StageMetrics::unsafe_arena_release_latency() {
+  // @@protoc_insertion_point(field_release:sapien.Renderer.server.proto.StageMetrics.latency)
+  
+  ::sapien::Renderer::server::proto::Histogram* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+  return temp;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
-UpdateRenderAndTakePicturesReq::camera_ids() const {
-  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
-  return _internal_camera_ids();
+inline ::sapien::Renderer::server::proto::Histogram* StageMetrics::_internal_mutable_latency() {
+  
+  if (_impl_.latency_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sapien::Renderer::server::proto::Histogram>(GetArenaForAllocation());
+    _impl_.latency_ = p;
+  }
+  return _impl_.latency_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-UpdateRenderAndTakePicturesReq::_internal_mutable_camera_ids() {
-  return &_impl_.camera_ids_;
+inline ::sapien::Renderer::server::proto::Histogram* StageMetrics::mutable_latency() {
+  ::sapien::Renderer::server::proto::Histogram* _msg = _internal_mutable_latency();
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.StageMetrics.latency)
+  return _msg;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
-UpdateRenderAndTakePicturesReq::mutable_camera_ids() {
-  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.UpdateRenderAndTakePicturesReq.camera_ids)
-  return _internal_mutable_camera_ids();
+inline void StageMetrics::set_allocated_latency(::sapien::Renderer::server::proto::Histogram* latency) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.latency_;
+  }
+  if (latency) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(latency);
+    if (message_arena != submessage_arena) {
+      latency = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, latency, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.latency_ = latency;
+  // @@protoc_insertion_point(field_set_allocated:sapien.Renderer.server.proto.StageMetrics.latency)
 }
 
 // -------------------------------------------------------------------
 
-// CameraParamsReq
+// SceneMetrics
 
 // uint64 scene_id = 1;
-inline void CameraParamsReq::clear_scene_id() {
+inline void SceneMetrics::clear_scene_id() {
   _impl_.scene_id_ = uint64_t{0u};
 }
-inline uint64_t CameraParamsReq::_internal_scene_id() const {
+inline uint64_t SceneMetrics::_internal_scene_id() const {
   return _impl_.scene_id_;
 }
-inline uint64_t CameraParamsReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.scene_id)
+inline uint64_t SceneMetrics::scene_id() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.SceneMetrics.scene_id)
   return _internal_scene_id();
 }
-inline void CameraParamsReq::_internal_set_scene_id(uint64_t value) {
+inline void SceneMetrics::_internal_set_scene_id(uint64_t value) {
   
   _impl_.scene_id_ = value;
 }
-inline void CameraParamsReq::set_scene_id(uint64_t value) {
+inline void SceneMetrics::set_scene_id(uint64_t value) {
   _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.scene_id)
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.SceneMetrics.scene_id)
 }
 
-// uint64 camera_id = 2;
-inline void CameraParamsReq::clear_camera_id() {
-  _impl_.camera_id_ = uint64_t{0u};
+// uint64 scene_index = 2;
+inline void SceneMetrics::clear_scene_index() {
+  _impl_.scene_index_ = uint64_t{0u};
 }
-inline uint64_t CameraParamsReq::_internal_camera_id() const {
-  return _impl_.camera_id_;
+inline uint64_t SceneMetrics::_internal_scene_index() const {
+  return _impl_.scene_index_;
 }
-inline uint64_t CameraParamsReq::camera_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.camera_id)
-  return _internal_camera_id();
+inline uint64_t SceneMetrics::scene_index() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.SceneMetrics.scene_index)
+  return _internal_scene_index();
 }
-inline void CameraParamsReq::_internal_set_camera_id(uint64_t value) {
+inline void SceneMetrics::_internal_set_scene_index(uint64_t value) {
   
-  _impl_.camera_id_ = value;
+  _impl_.scene_index_ = value;
 }
-inline void CameraParamsReq::set_camera_id(uint64_t value) {
-  _internal_set_camera_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.camera_id)
+inline void SceneMetrics::set_scene_index(uint64_t value) {
+  _internal_set_scene_index(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.SceneMetrics.scene_index)
 }
 
-// float near = 3;
-inline void CameraParamsReq::clear_near() {
-  _impl_.near_ = 0;
+// uint64 frames = 3;
+inline void SceneMetrics::clear_frames() {
+  _impl_.frames_ = uint64_t{0u};
 }
-inline float CameraParamsReq::_internal_near() const {
-  return _impl_.near_;
+inline uint64_t SceneMetrics::_internal_frames() const {
+  return _impl_.frames_;
 }
-inline float CameraParamsReq::near() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.near)
-  return _internal_near();
+inline uint64_t SceneMetrics::frames() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.SceneMetrics.frames)
+  return _internal_frames();
 }
-inline void CameraParamsReq::_internal_set_near(float value) {
+inline void SceneMetrics::_internal_set_frames(uint64_t value) {
   
-  _impl_.near_ = value;
+  _impl_.frames_ = value;
 }
-inline void CameraParamsReq::set_near(float value) {
-  _internal_set_near(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.near)
+inline void SceneMetrics::set_frames(uint64_t value) {
+  _internal_set_frames(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.SceneMetrics.frames)
 }
 
-// float far = 4;
-inline void CameraParamsReq::clear_far() {
-  _impl_.far_ = 0;
+// uint64 pictures = 4;
+inline void SceneMetrics::clear_pictures() {
+  _impl_.pictures_ = uint64_t{0u};
 }
-inline float CameraParamsReq::_internal_far() const {
-  return _impl_.far_;
+inline uint64_t SceneMetrics::_internal_pictures() const {
+  return _impl_.pictures_;
 }
-inline float CameraParamsReq::far() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.far)
-  return _internal_far();
+inline uint64_t SceneMetrics::pictures() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.SceneMetrics.pictures)
+  return _internal_pictures();
 }
-inline void CameraParamsReq::_internal_set_far(float value) {
+inline void SceneMetrics::_internal_set_pictures(uint64_t value) {
   
-  _impl_.far_ = value;
+  _impl_.pictures_ = value;
 }
-inline void CameraParamsReq::set_far(float value) {
-  _internal_set_far(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.far)
+inline void SceneMetrics::set_pictures(uint64_t value) {
+  _internal_set_pictures(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.SceneMetrics.pictures)
 }
 
-// float fx = 5;
-inline void CameraParamsReq::clear_fx() {
-  _impl_.fx_ = 0;
+// uint32 pending = 5;
+inline void SceneMetrics::clear_pending() {
+  _impl_.pending_ = 0u;
 }
-inline float CameraParamsReq::_internal_fx() const {
-  return _impl_.fx_;
+inline uint32_t SceneMetrics::_internal_pending() const {
+  return _impl_.pending_;
 }
-inline float CameraParamsReq::fx() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.fx)
-  return _internal_fx();
+inline uint32_t SceneMetrics::pending() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.SceneMetrics.pending)
+  return _internal_pending();
 }
-inline void CameraParamsReq::_internal_set_fx(float value) {
+inline void SceneMetrics::_internal_set_pending(uint32_t value) {
   
-  _impl_.fx_ = value;
+  _impl_.pending_ = value;
 }
-inline void CameraParamsReq::set_fx(float value) {
-  _internal_set_fx(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.fx)
+inline void SceneMetrics::set_pending(uint32_t value) {
+  _internal_set_pending(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.SceneMetrics.pending)
 }
 
-// float fy = 6;
-inline void CameraParamsReq::clear_fy() {
-  _impl_.fy_ = 0;
+// -------------------------------------------------------------------
+
+// MetricsRes
+
+// uint64 uptime_us = 1;
+inline void MetricsRes::clear_uptime_us() {
+  _impl_.uptime_us_ = uint64_t{0u};
 }
-inline float CameraParamsReq::_internal_fy() const {
-  return _impl_.fy_;
+inline uint64_t MetricsRes::_internal_uptime_us() const {
+  return _impl_.uptime_us_;
 }
-inline float CameraParamsReq::fy() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.fy)
-  return _internal_fy();
+inline uint64_t MetricsRes::uptime_us() const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MetricsRes.uptime_us)
+  return _internal_uptime_us();
 }
-inline void CameraParamsReq::_internal_set_fy(float value) {
+inline void MetricsRes::_internal_set_uptime_us(uint64_t value) {
   
-  _impl_.fy_ = value;
+  _impl_.uptime_us_ = value;
 }
-inline void CameraParamsReq::set_fy(float value) {
-  _internal_set_fy(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.fy)
+inline void MetricsRes::set_uptime_us(uint64_t value) {
+  _internal_set_uptime_us(value);
+  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.MetricsRes.uptime_us)
 }
 
-// float cx = 7;
-inline void CameraParamsReq::clear_cx() {
-  _impl_.cx_ = 0;
+// repeated .sapien.Renderer.server.proto.MethodMetrics methods = 2;
+inline int MetricsRes::_internal_methods_size() const {
+  return _impl_.methods_.size();
 }
-inline float CameraParamsReq::_internal_cx() const {
-  return _impl_.cx_;
+inline int MetricsRes::methods_size() const {
+  return _internal_methods_size();
 }
-inline float CameraParamsReq::cx() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.cx)
-  return _internal_cx();
+inline void MetricsRes::clear_methods() {
+  _impl_.methods_.Clear();
 }
-inline void CameraParamsReq::_internal_set_cx(float value) {
-  
-  _impl_.cx_ = value;
+inline ::sapien::Renderer::server::proto::MethodMetrics* MetricsRes::mutable_methods(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MetricsRes.methods)
+  return _impl_.methods_.Mutable(index);
 }
-inline void CameraParamsReq::set_cx(float value) {
-  _internal_set_cx(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.cx)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::MethodMetrics >*
+MetricsRes::mutable_methods() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.MetricsRes.methods)
+  return &_impl_.methods_;
 }
-
-// float cy = 8;
-inline void CameraParamsReq::clear_cy() {
-  _impl_.cy_ = 0;
+inline const ::sapien::Renderer::server::proto::MethodMetrics& MetricsRes::_internal_methods(int index) const {
+  return _impl_.methods_.Get(index);
 }
-inline float CameraParamsReq::_internal_cy() const {
-  return _impl_.cy_;
+inline const ::sapien::Renderer::server::proto::MethodMetrics& MetricsRes::methods(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MetricsRes.methods)
+  return _internal_methods(index);
 }
-inline float CameraParamsReq::cy() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.cy)
-  return _internal_cy();
+inline ::sapien::Renderer::server::proto::MethodMetrics* MetricsRes::_internal_add_methods() {
+  return _impl_.methods_.Add();
 }
-inline void CameraParamsReq::_internal_set_cy(float value) {
-  
-  _impl_.cy_ = value;
+inline ::sapien::Renderer::server::proto::MethodMetrics* MetricsRes::add_methods() {
+  ::sapien::Renderer::server::proto::MethodMetrics* _add = _internal_add_methods();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.MetricsRes.methods)
+  return _add;
 }
-inline void CameraParamsReq::set_cy(float value) {
-  _internal_set_cy(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.cy)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::MethodMetrics >&
+MetricsRes::methods() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.MetricsRes.methods)
+  return _impl_.methods_;
 }
 
-// float skew = 9;
-inline void CameraParamsReq::clear_skew() {
-  _impl_.skew_ = 0;
+// repeated .sapien.Renderer.server.proto.StageMetrics stages = 3;
+inline int MetricsRes::_internal_stages_size() const {
+  return _impl_.stages_.size();
 }
-inline float CameraParamsReq::_internal_skew() const {
-  return _impl_.skew_;
+inline int MetricsRes::stages_size() const {
+  return _internal_stages_size();
 }
-inline float CameraParamsReq::skew() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.CameraParamsReq.skew)
-  return _internal_skew();
+inline void MetricsRes::clear_stages() {
+  _impl_.stages_.Clear();
 }
-inline void CameraParamsReq::_internal_set_skew(float value) {
-  
-  _impl_.skew_ = value;
+inline ::sapien::Renderer::server::proto::StageMetrics* MetricsRes::mutable_stages(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MetricsRes.stages)
+  return _impl_.stages_.Mutable(index);
 }
-inline void CameraParamsReq::set_skew(float value) {
-  _internal_set_skew(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.CameraParamsReq.skew)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::StageMetrics >*
+MetricsRes::mutable_stages() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.MetricsRes.stages)
+  return &_impl_.stages_;
 }
-
-// -------------------------------------------------------------------
-
-// BodyReq
-
-// uint64 scene_id = 1;
-inline void BodyReq::clear_scene_id() {
-  _impl_.scene_id_ = uint64_t{0u};
+inline const ::sapien::Renderer::server::proto::StageMetrics& MetricsRes::_internal_stages(int index) const {
+  return _impl_.stages_.Get(index);
 }
-inline uint64_t BodyReq::_internal_scene_id() const {
-  return _impl_.scene_id_;
+inline const ::sapien::Renderer::server::proto::StageMetrics& MetricsRes::stages(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MetricsRes.stages)
+  return _internal_stages(index);
 }
-inline uint64_t BodyReq::scene_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyReq.scene_id)
-  return _internal_scene_id();
+inline ::sapien::Renderer::server::proto::StageMetrics* MetricsRes::_internal_add_stages() {
+  return _impl_.stages_.Add();
 }
-inline void BodyReq::_internal_set_scene_id(uint64_t value) {
-  
-  _impl_.scene_id_ = value;
+inline ::sapien::Renderer::server::proto::StageMetrics* MetricsRes::add_stages() {
+  ::sapien::Renderer::server::proto::StageMetrics* _add = _internal_add_stages();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.MetricsRes.stages)
+  return _add;
 }
-inline void BodyReq::set_scene_id(uint64_t value) {
-  _internal_set_scene_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyReq.scene_id)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::StageMetrics >&
+MetricsRes::stages() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.MetricsRes.stages)
+  return _impl_.stages_;
 }
 
-// uint64 body_id = 2;
-inline void BodyReq::clear_body_id() {
-  _impl_.body_id_ = uint64_t{0u};
+// repeated .sapien.Renderer.server.proto.SceneMetrics scenes = 4;
+inline int MetricsRes::_internal_scenes_size() const {
+  return _impl_.scenes_.size();
 }
-inline uint64_t BodyReq::_internal_body_id() const {
-  return _impl_.body_id_;
+inline int MetricsRes::scenes_size() const {
+  return _internal_scenes_size();
 }
-inline uint64_t BodyReq::body_id() const {
-  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.BodyReq.body_id)
-  return _internal_body_id();
+inline void MetricsRes::clear_scenes() {
+  _impl_.scenes_.Clear();
 }
-inline void BodyReq::_internal_set_body_id(uint64_t value) {
-  
-  _impl_.body_id_ = value;
+inline ::sapien::Renderer::server::proto::SceneMetrics* MetricsRes::mutable_scenes(int index) {
+  // @@protoc_insertion_point(field_mutable:sapien.Renderer.server.proto.MetricsRes.scenes)
+  return _impl_.scenes_.Mutable(index);
 }
-inline void BodyReq::set_body_id(uint64_t value) {
-  _internal_set_body_id(value);
-  // @@protoc_insertion_point(field_set:sapien.Renderer.server.proto.BodyReq.body_id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::SceneMetrics >*
+MetricsRes::mutable_scenes() {
+  // @@protoc_insertion_point(field_mutable_list:sapien.Renderer.server.proto.MetricsRes.scenes)
+  return &_impl_.scenes_;
+}
+inline const ::sapien::Renderer::server::proto::SceneMetrics& MetricsRes::_internal_scenes(int index) const {
+  return _impl_.scenes_.Get(index);
+}
+inline const ::sapien::Renderer::server::proto::SceneMetrics& MetricsRes::scenes(int index) const {
+  // @@protoc_insertion_point(field_get:sapien.Renderer.server.proto.MetricsRes.scenes)
+  return _internal_scenes(index);
+}
+inline ::sapien::Renderer::server::proto::SceneMetrics* MetricsRes::_internal_add_scenes() {
+  return _impl_.scenes_.Add();
+}
+inline ::sapien::Renderer::server::proto::SceneMetrics* MetricsRes::add_scenes() {
+  ::sapien::Renderer::server::proto::SceneMetrics* _add = _internal_add_scenes();
+  // @@protoc_insertion_point(field_add:sapien.Renderer.server.proto.MetricsRes.scenes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sapien::Renderer::server::proto::SceneMetrics >&
+MetricsRes::scenes() const {
+  // @@protoc_insertion_point(field_list:sapien.Renderer.server.proto.MetricsRes.scenes)
+  return _impl_.scenes_;
 }
 
 #ifdef __GNUC__
@@ -8161,6 +12453,26 @@ inline void BodyReq::set_body_id(uint64_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
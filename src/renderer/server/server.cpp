@@ -1,6 +1,7 @@
 #include "sapien/renderer/server/server.h"
 #include <algorithm>
 #include <easy/profiler.h>
+#include <fstream>
 #include <spdlog/spdlog.h>
 #include <string>
 
@@ -67,8 +68,7 @@ Status RenderServiceImpl::CreateScene(ServerContext *c, const proto::Index *req,
   info->sceneIndex = index;
   info->sceneId = id;
   info->scene = std::make_shared<svulkan2::scene::Scene>();
-  info->threadRunner = std::make_unique<ThreadPool>(1);
-  info->threadRunner->init();
+  info->threadRunner = std::make_unique<TaskQueue>();
 
   mSceneMap.set(id, info);
 
@@ -90,6 +90,7 @@ Status RenderServiceImpl::RemoveScene(ServerContext *c, const proto::Id *req, pr
   log::info("RemoveScene {}", req->id());
   // TODO: make sure nothing is running
   auto info = mSceneMap.get(req->id());
+  info->sharedMemory.reset();
 
   Status status = Status::OK;
 
@@ -360,97 +361,134 @@ Status RenderServiceImpl::SetEntityOrder(ServerContext *c, const proto::EntityOr
   return Status::OK;
 }
 
-Status RenderServiceImpl::UpdateRender(ServerContext *c, const proto::UpdateRenderReq *req,
-                                       proto::Empty *res) {
-  EASY_FUNCTION();
+// packed poses: 7 floats per entity, p.xyz then q.wxyz, one pose for every ordered entity
+template <typename T>
+static bool applyPackedPoses(float const *data, size_t size, std::vector<T *> const &targets) {
+  if (size != targets.size() * 7) {
+    return false;
+  }
+  float const *d = data;
+  for (size_t i = 0; i < size / 7; ++i, d += 7) {
+    targets[i]->setPosition({d[0], d[1], d[2]});
+    targets[i]->setRotation({d[3], d[4], d[5], d[6]});
+  }
+  return true;
+}
 
-  auto info = mSceneMap.get(req->scene_id());
+template <typename Req> Status RenderServiceImpl::updatePoses(SceneInfo &info, Req const &req) {
+  {
+    ScopedLatency timer(*mStages.applyPoses);
+    // older clients send one message per pose, possibly for only the first entities
+    bool legacy = req.body_poses_size() || req.camera_poses_size();
+    bool valid;
+    if (legacy) {
+      valid = !req.body_pose_data_size() && !req.camera_pose_data_size() &&
+              static_cast<size_t>(req.body_poses_size()) <= info.orderedObjects.size() &&
+              static_cast<size_t>(req.camera_poses_size()) <= info.orderedCameras.size();
+    } else {
+      valid = applyPackedPoses(req.body_pose_data().data(), req.body_pose_data().size(),
+                               info.orderedObjects) &&
+              applyPackedPoses(req.camera_pose_data().data(), req.camera_pose_data().size(),
+                               info.orderedCameras);
+    }
+    if (!valid) {
+      return Status(grpc::StatusCode::INVALID_ARGUMENT,
+                    "update render failed: poses do not match the entity order");
+    }
 
-  for (int i = 0; i < req->body_poses_size(); ++i) {
-    glm::vec3 p{req->body_poses(i).p().x(), req->body_poses(i).p().y(),
-                req->body_poses(i).p().z()};
-    glm::quat q{req->body_poses(i).q().w(), req->body_poses(i).q().x(), req->body_poses(i).q().y(),
-                req->body_poses(i).q().z()};
-    info->orderedObjects[i]->setPosition(p);
-    info->orderedObjects[i]->setRotation(q);
+    for (int i = 0; i < req.body_poses_size(); ++i) {
+      glm::vec3 p{req.body_poses(i).p().x(), req.body_poses(i).p().y(),
+                  req.body_poses(i).p().z()};
+      glm::quat q{req.body_poses(i).q().w(), req.body_poses(i).q().x(),
+                  req.body_poses(i).q().y(), req.body_poses(i).q().z()};
+      info.orderedObjects[i]->setPosition(p);
+      info.orderedObjects[i]->setRotation(q);
+    }
+
+    for (int i = 0; i < req.camera_poses_size(); ++i) {
+      glm::vec3 p{req.camera_poses(i).p().x(), req.camera_poses(i).p().y(),
+                  req.camera_poses(i).p().z()};
+      glm::quat q{req.camera_poses(i).q().w(), req.camera_poses(i).q().x(),
+                  req.camera_poses(i).q().y(), req.camera_poses(i).q().z()};
+      info.orderedCameras[i]->setPosition(p);
+      info.orderedCameras[i]->setRotation(q);
+    }
   }
 
-  for (int i = 0; i < req->camera_poses_size(); ++i) {
-    glm::vec3 p{req->camera_poses(i).p().x(), req->camera_poses(i).p().y(),
-                req->camera_poses(i).p().z()};
-    glm::quat q{req->camera_poses(i).q().w(), req->camera_poses(i).q().x(),
-                req->camera_poses(i).q().y(), req->camera_poses(i).q().z()};
-    info->orderedCameras[i]->setPosition(p);
-    info->orderedCameras[i]->setRotation(q);
+  {
+    ScopedLatency timer(*mStages.updateMatrices);
+    info.scene->getRootNode().updateGlobalModelMatrixRecursive(); // TODO: check this
   }
+  info.frameCount.fetch_add(1, std::memory_order_relaxed);
+  return Status::OK;
+}
 
-  info->scene->getRootNode().updateGlobalModelMatrixRecursive(); // TODO: check this
+Status RenderServiceImpl::UpdateRender(ServerContext *c, const proto::UpdateRenderReq *req,
+                                       proto::Empty *res) {
+  EASY_FUNCTION();
 
-  return Status::OK;
+  auto info = mSceneMap.get(req->scene_id());
+  return updatePoses(*info, *req);
 }
 
 Status RenderServiceImpl::UpdateRenderAndTakePictures(
     ServerContext *c, const proto::UpdateRenderAndTakePicturesReq *req, proto::Empty *res) {
   auto sceneInfo = mSceneMap.get(req->scene_id());
 
-  for (int i = 0; i < req->body_poses_size(); ++i) {
-    glm::vec3 p{req->body_poses(i).p().x(), req->body_poses(i).p().y(),
-                req->body_poses(i).p().z()};
-    glm::quat q{req->body_poses(i).q().w(), req->body_poses(i).q().x(), req->body_poses(i).q().y(),
-                req->body_poses(i).q().z()};
-    sceneInfo->orderedObjects[i]->setPosition(p);
-    sceneInfo->orderedObjects[i]->setRotation(q);
+  if (auto status = updatePoses(*sceneInfo, *req); !status.ok()) {
+    return status;
   }
+  submitPictures(*sceneInfo, {req->camera_ids().data(), size_t(req->camera_ids().size())});
+  return Status::OK;
+}
 
-  for (int i = 0; i < req->camera_poses_size(); ++i) {
-    glm::vec3 p{req->camera_poses(i).p().x(), req->camera_poses(i).p().y(),
-                req->camera_poses(i).p().z()};
-    glm::quat q{req->camera_poses(i).q().w(), req->camera_poses(i).q().x(),
-                req->camera_poses(i).q().y(), req->camera_poses(i).q().z()};
-    sceneInfo->orderedCameras[i]->setPosition(p);
-    sceneInfo->orderedCameras[i]->setRotation(q);
-  }
-
-  sceneInfo->scene->getRootNode().updateGlobalModelMatrixRecursive(); // TODO: check this
-
-  for (int i = 0; i < req->camera_ids_size(); ++i) {
-    uint64_t camera_id = req->camera_ids(i);
-    auto camInfo = sceneInfo->cameraMap.at(camera_id);
+void RenderServiceImpl::submitPictures(SceneInfo &sceneInfo,
+                                       std::span<uint64_t const> cameraIds) {
+  for (uint64_t camera_id : cameraIds) {
+    auto camInfo = sceneInfo.cameraMap.at(camera_id);
     camInfo->frameCounter++;
+    sceneInfo.pictureCount.fetch_add(1, std::memory_order_relaxed);
 
-    sceneInfo->threadRunner->submit(
+    sceneInfo.threadRunner->submit(
         [context = mContext, sem = camInfo->semaphore.get(), cb = camInfo->commandBuffer.get(),
          renderer = camInfo->renderer.get(), cam = camInfo->camera, fillInfo = camInfo->fillInfo,
-         frame = camInfo->frameCounter]() {
+         frame = camInfo->frameCounter, stages = &mStages]() {
           uint64_t waitFrame = frame - 1;
-          auto result = context->getDevice().waitSemaphores(
-              vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
+          vk::Result result;
+          {
+            ScopedLatency timer(*stages->semaphoreWait);
+            result = context->getDevice().waitSemaphores(
+                vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
+          }
           if (result != vk::Result::eSuccess) {
             throw std::runtime_error("take picture failed: wait failed");
           }
-          cb.reset();
-          cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-          try {
-            renderer->render(*cam, {}, {}, {}, {});
-          } catch (std::exception const &e) {
-            log::critical("rendering failed");
+          {
+            ScopedLatency timer(*stages->render);
+            cb.reset();
+            cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+            try {
+              renderer->render(*cam, {}, {}, {}, {});
+            } catch (std::exception const &e) {
+              log::critical("rendering failed");
+            }
+
+            for (auto &entry : fillInfo) {
+              auto [name, buffer, offset] = entry;
+              auto target = renderer->getRenderTarget(name);
+              auto extent = target->getImage().getExtent();
+              vk::Format format = target->getFormat();
+              vk::DeviceSize size =
+                  extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
+              target->getImage().recordCopyToBuffer(cb, buffer, offset, size,
+                                                    vk::Offset3D{0, 0, 0}, extent);
+            }
+            cb.end();
           }
-
-          for (auto &entry : fillInfo) {
-            auto [name, buffer, offset] = entry;
-            auto target = renderer->getRenderTarget(name);
-            auto extent = target->getImage().getExtent();
-            vk::Format format = target->getFormat();
-            vk::DeviceSize size =
-                extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
-            target->getImage().recordCopyToBuffer(cb, buffer, offset, size, vk::Offset3D{0, 0, 0},
-                                                  extent);
-          }
-          cb.end();
+          ScopedLatency timer(*stages->submit);
           context->getQueue().submit(cb, {}, {}, {}, sem, frame, {});
         });
   }
-  return Status::OK;
 }
 
 // ========== Material ==========//
@@ -563,6 +601,7 @@ Status RenderServiceImpl::TakePicture(ServerContext *c, const proto::TakePicture
   auto sceneInfo = mSceneMap.get(req->scene_id());
   auto camInfo = sceneInfo->cameraMap.at(req->camera_id());
   camInfo->frameCounter++;
+  sceneInfo->pictureCount.fetch_add(1, std::memory_order_relaxed);
 
   // auto context = mContext;
   // auto sem = camInfo->semaphore.get();
@@ -575,28 +614,37 @@ Status RenderServiceImpl::TakePicture(ServerContext *c, const proto::TakePicture
   sceneInfo->threadRunner->submit([context = mContext, sem = camInfo->semaphore.get(),
                                    cb = camInfo->commandBuffer.get(),
                                    renderer = camInfo->renderer.get(), cam = camInfo->camera,
-                                   fillInfo = camInfo->fillInfo, frame = camInfo->frameCounter]() {
+                                   fillInfo = camInfo->fillInfo, frame = camInfo->frameCounter,
+                                   stages = &mStages]() {
     uint64_t waitFrame = frame - 1;
-    auto result =
-        context->getDevice().waitSemaphores(vk::SemaphoreWaitInfo({}, sem, waitFrame), UINT64_MAX);
+    vk::Result result;
+    {
+      ScopedLatency timer(*stages->semaphoreWait);
+      result = context->getDevice().waitSemaphores(vk::SemaphoreWaitInfo({}, sem, waitFrame),
+                                                   UINT64_MAX);
+    }
     if (result != vk::Result::eSuccess) {
       throw std::runtime_error("take picture failed: wait failed");
     }
-    cb.reset();
-    cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-    renderer->render(*cam, {}, {}, {}, {});
-
-    for (auto &entry : fillInfo) {
-      auto [name, buffer, offset] = entry;
-      auto target = renderer->getRenderTarget(name);
-      auto extent = target->getImage().getExtent();
-      vk::Format format = target->getFormat();
-      vk::DeviceSize size =
-          extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
-      target->getImage().recordCopyToBuffer(cb, buffer, offset, size, vk::Offset3D{0, 0, 0},
-                                            extent);
+    {
+      ScopedLatency timer(*stages->render);
+      cb.reset();
+      cb.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+      renderer->render(*cam, {}, {}, {}, {});
+
+      for (auto &entry : fillInfo) {
+        auto [name, buffer, offset] = entry;
+        auto target = renderer->getRenderTarget(name);
+        auto extent = target->getImage().getExtent();
+        vk::Format format = target->getFormat();
+        vk::DeviceSize size =
+            extent.width * extent.height * extent.depth * svulkan2::getFormatSize(format);
+        target->getImage().recordCopyToBuffer(cb, buffer, offset, size, vk::Offset3D{0, 0, 0},
+                                              extent);
+      }
+      cb.end();
     }
-    cb.end();
+    ScopedLatency timer(*stages->submit);
     context->getQueue().submit(cb, {}, {}, {}, sem, frame, {});
   });
 
@@ -615,6 +663,245 @@ Status RenderServiceImpl::SetCameraParameters(ServerContext *c, const proto::Cam
   return Status::OK;
 }
 
+// ========== Batch ==========//
+Status RenderServiceImpl::UpdateRenderBatch(ServerContext *c,
+                                            const proto::UpdateRenderBatchReq *req,
+                                            proto::Empty *res) {
+  EASY_FUNCTION();
+
+  std::vector<std::shared_ptr<SceneInfo>> infos;
+  infos.reserve(req->scenes_size());
+  for (auto &scene : req->scenes()) {
+    infos.push_back(mSceneMap.get(scene.scene_id()));
+  }
+
+  // poses of different scenes are applied in parallel, each after the work already queued for
+  // its scene
+  std::vector<std::future<Status>> updates;
+  updates.reserve(infos.size());
+  for (int i = 0; i < req->scenes_size(); ++i) {
+    updates.push_back(infos[i]->threadRunner->submit(
+        [this, info = infos[i].get(), &scene = req->scenes(i)]() {
+          return updatePoses(*info, scene);
+        }));
+  }
+  Status status = Status::OK;
+  for (auto &update : updates) {
+    if (auto s = update.get(); !s.ok()) {
+      status = s;
+    }
+  }
+  if (!status.ok()) {
+    return status;
+  }
+
+  for (int i = 0; i < req->scenes_size(); ++i) {
+    auto &ids = req->scenes(i).camera_ids();
+    submitPictures(*infos[i], {ids.data(), size_t(ids.size())});
+  }
+  return Status::OK;
+}
+
+// ========== Shared memory ==========//
+Status RenderServiceImpl::AttachSharedMemory(ServerContext *c,
+                                             const proto::AttachSharedMemoryReq *req,
+                                             proto::Empty *res) {
+  log::info("AttachSharedMemory {} {}", req->scene_id(), req->name());
+  auto info = mSceneMap.get(req->scene_id());
+
+  std::unique_ptr<ShmRing> ring;
+  try {
+    ring = ShmRing::Open(req->name());
+  } catch (std::exception const &e) {
+    return Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+  }
+  info->sharedMemory.reset();
+  info->sharedMemory = std::make_unique<ShmRingServer>(
+      std::move(ring), [this, info = info.get()](ShmRing &ring, uint32_t n) {
+        applySharedMemoryFrame(*info, ring, n);
+      });
+  return Status::OK;
+}
+
+void RenderServiceImpl::applySharedMemoryFrame(SceneInfo &info, ShmRing &ring, uint32_t n) {
+  EASY_FUNCTION();
+  auto &header = ring.header();
+  auto &frame = ring.frame(n);
+  if (frame.bodyCount > header.maxBodies || frame.cameraCount > header.maxCameras ||
+      frame.pictureCount > header.maxCameras) {
+    throw std::runtime_error("shared memory frame exceeds the ring capacity");
+  }
+
+  float const *poses = ring.poses(n);
+  {
+    ScopedLatency timer(*mStages.applyPoses);
+    if (!applyPackedPoses(poses, frame.bodyCount * 7, info.orderedObjects) ||
+        !applyPackedPoses(poses + frame.bodyCount * 7, frame.cameraCount * 7,
+                          info.orderedCameras)) {
+      throw std::runtime_error("update render failed: poses do not match the entity order");
+    }
+  }
+  {
+    ScopedLatency timer(*mStages.updateMatrices);
+    info.scene->getRootNode().updateGlobalModelMatrixRecursive();
+  }
+  info.frameCount.fetch_add(1, std::memory_order_relaxed);
+
+  submitPictures(info, {ring.pictures(n), frame.pictureCount});
+}
+
+// ========== Commands ==========//
+Status RenderServiceImpl::SubmitCommands(ServerContext *c, const proto::CommandBatchReq *req,
+                                         proto::CommandBatchRes *res) {
+  EASY_FUNCTION();
+  log::info("SubmitCommands {}", req->commands_size());
+
+  std::unordered_map<rs_id_t, rs_id_t> ids;
+  auto resolve = [&](rs_id_t id) {
+    if (!(id & kProvisionalIdBit)) {
+      return id;
+    }
+    auto it = ids.find(id);
+    if (it == ids.end()) {
+      throw std::runtime_error("unknown provisional id");
+    }
+    return it->second;
+  };
+
+  std::vector<rs_id_t> materials;
+  std::vector<proto::RemoveBodyReq> bodies;
+  Status status = Status::OK;
+  int index = 0;
+  try {
+    for (; index < req->commands_size(); ++index) {
+      auto &command = req->commands(index);
+      proto::Empty empty;
+      proto::Id created;
+      bool creates = false;
+      switch (command.command_case()) {
+      case proto::Command::kCreateMaterial:
+        status = CreateMaterial(c, &command.create_material(), &created);
+        if ((creates = status.ok())) {
+          materials.push_back(created.id());
+        }
+        break;
+      case proto::Command::kRemoveMaterial: {
+        proto::Id r = command.remove_material();
+        r.set_id(resolve(r.id()));
+        status = RemoveMaterial(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetBaseColor: {
+        proto::IdVec4 r = command.set_base_color();
+        r.set_id(resolve(r.id()));
+        status = SetBaseColor(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetRoughness: {
+        proto::IdFloat r = command.set_roughness();
+        r.set_id(resolve(r.id()));
+        status = SetRoughness(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetSpecular: {
+        proto::IdFloat r = command.set_specular();
+        r.set_id(resolve(r.id()));
+        status = SetSpecular(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetMetallic: {
+        proto::IdFloat r = command.set_metallic();
+        r.set_id(resolve(r.id()));
+        status = SetMetallic(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kAddBodyMesh:
+        status = AddBodyMesh(c, &command.add_body_mesh(), &created);
+        if ((creates = status.ok())) {
+          bodies.emplace_back().set_scene_id(command.add_body_mesh().scene_id());
+          bodies.back().set_body_id(created.id());
+        }
+        break;
+      case proto::Command::kAddBodyPrimitive: {
+        proto::AddBodyPrimitiveReq r = command.add_body_primitive();
+        r.set_material(resolve(r.material()));
+        status = AddBodyPrimitive(c, &r, &created);
+        if ((creates = status.ok())) {
+          bodies.emplace_back().set_scene_id(r.scene_id());
+          bodies.back().set_body_id(created.id());
+        }
+        break;
+      }
+      case proto::Command::kSetUniqueId: {
+        proto::BodyIdReq r = command.set_unique_id();
+        r.set_body_id(resolve(r.body_id()));
+        status = SetUniqueId(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetSegmentationId: {
+        proto::BodyIdReq r = command.set_segmentation_id();
+        r.set_body_id(resolve(r.body_id()));
+        status = SetSegmentationId(c, &r, &empty);
+        break;
+      }
+      case proto::Command::kSetVisibility: {
+        proto::BodyFloat32Req r = command.set_visibility();
+        r.set_body_id(resolve(r.body_id()));
+        status = SetVisibility(c, &r, &empty);
+        break;
+      }
+      default:
+        status = Status(grpc::StatusCode::INVALID_ARGUMENT, "empty command");
+      }
+
+      if (!status.ok()) {
+        break;
+      }
+      if (creates && (command.provisional_id() & kProvisionalIdBit)) {
+        ids[command.provisional_id()] = created.id();
+        res->add_provisional_ids(command.provisional_id());
+        res->add_ids(created.id());
+      }
+    }
+  } catch (std::exception const &e) {
+    status = Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+  }
+
+  if (!status.ok()) {
+    // created objects are removed, changes to existing ones stay
+    for (auto it = bodies.rbegin(); it != bodies.rend(); ++it) {
+      proto::Empty empty;
+      RemoveBody(c, &*it, &empty);
+    }
+    for (auto id : materials) {
+      mMaterialMap.erase(id);
+    }
+    res->Clear();
+    return Status(status.error_code(),
+                  "command " + std::to_string(index) + " failed: " + status.error_message());
+  }
+  return Status::OK;
+}
+
+// ========== Metrics ==========//
+Status RenderServiceImpl::GetMetrics(ServerContext *c, const proto::Empty *req,
+                                     proto::MetricsRes *res) {
+  fillMetrics(*res);
+  return Status::OK;
+}
+
+void RenderServiceImpl::fillMetrics(proto::MetricsRes &res) {
+  mMetrics->fill(res);
+  for (auto &[id, info] : mSceneMap.flat()) {
+    auto scene = res.add_scenes();
+    scene->set_scene_id(id);
+    scene->set_scene_index(info->sceneIndex);
+    scene->set_frames(info->frameCount.load(std::memory_order_relaxed));
+    scene->set_pictures(info->pictureCount.load(std::memory_order_relaxed));
+    scene->set_pending(info->threadRunner->getPendingCount());
+  }
+}
+
 std::shared_ptr<svulkan2::resource::SVMetallicMaterial>
 RenderServiceImpl::getMaterial(rs_id_t id) {
   if (auto mat = mMaterialMap.get(id, nullptr)) {
@@ -630,7 +917,11 @@ RenderServiceImpl::getMaterial(rs_id_t id) {
 RenderServiceImpl::RenderServiceImpl(
     std::shared_ptr<svulkan2::core::Context> context,
     std::shared_ptr<svulkan2::resource::SVResourceManager> manager)
-    : mContext(context), mResourceManager(manager) {
+    : mContext(context), mResourceManager(manager),
+      mMetrics(std::make_shared<MetricsRegistry>()) {
+  mStages = {&mMetrics->stage("apply_poses"), &mMetrics->stage("update_matrices"),
+             &mMetrics->stage("semaphore_wait"), &mMetrics->stage("render"),
+             &mMetrics->stage("queue_submit")};
 
   mCubeMesh = svulkan2::resource::SVMesh::CreateCube();
   mSphereMesh = svulkan2::resource::SVMesh::CreateUVSphere(32, 16);
@@ -651,6 +942,9 @@ void RenderServer::start(std::string const &address) {
   grpc::ServerBuilder builder;
   builder.AddListeningPort(address, grpc::InsecureServerCredentials());
   builder.RegisterService(mService.get());
+  std::vector<std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface>> creators;
+  creators.push_back(std::make_unique<ServerMetricsInterceptorFactory>(mService->mMetrics));
+  builder.experimental().SetInterceptorCreators(std::move(creators));
   mServer = builder.BuildAndStart();
   log::info("Render server listening on {}", address);
 }
@@ -660,6 +954,50 @@ void RenderServer::stop() {
   mServer->Wait();
 }
 
+RenderServer::~RenderServer() { stopMetricsDump(); }
+
+std::string RenderServer::getMetricsJson() const {
+  if (!mService) {
+    throw std::runtime_error("failed to get metrics: render server is not started");
+  }
+  proto::MetricsRes metrics;
+  mService->fillMetrics(metrics);
+  return metricsToJson(metrics);
+}
+
+void RenderServer::startMetricsDump(std::string const &filename, uint32_t intervalMs) {
+  if (!mService) {
+    throw std::runtime_error("failed to dump metrics: render server is not started");
+  }
+  if (intervalMs == 0) {
+    throw std::runtime_error("failed to dump metrics: interval must be positive");
+  }
+  stopMetricsDump();
+  auto file = std::make_shared<std::ofstream>(filename, std::ios::app);
+  if (!*file) {
+    throw std::runtime_error("failed to dump metrics: cannot open " + filename);
+  }
+  mDumpStop = false;
+  mDumpThread = std::thread([this, file, intervalMs]() {
+    std::unique_lock lock(mDumpMutex);
+    while (!mDumpCondition.wait_for(lock, std::chrono::milliseconds(intervalMs),
+                                    [this]() { return mDumpStop; })) {
+      *file << getMetricsJson() << std::endl;
+    }
+  });
+}
+
+void RenderServer::stopMetricsDump() {
+  {
+    std::lock_guard lock(mDumpMutex);
+    mDumpStop = true;
+  }
+  mDumpCondition.notify_all();
+  if (mDumpThread.joinable()) {
+    mDumpThread.join();
+  }
+}
+
 bool RenderServer::waitAll(uint64_t timeout) {
   std::vector<vk::Semaphore> sems;
   std::vector<uint64_t> values;
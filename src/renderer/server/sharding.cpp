@@ -0,0 +1,246 @@
+#include "sapien/renderer/server/sharding.h"
+#include <algorithm>
+#include <numeric>
+#include <spdlog/spdlog.h>
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+//========== Material ==========//
+void ShardedMaterial::setBaseColor(std::array<float, 4> color) {
+  mBaseColor = color;
+  for (auto &[renderer, mat] : mShardMaterials) {
+    mat->setBaseColor(color);
+  }
+}
+std::array<float, 4> ShardedMaterial::getBaseColor() const {
+  // the server creates materials white
+  return mBaseColor.value_or(std::array<float, 4>{1.f, 1.f, 1.f, 1.f});
+}
+
+void ShardedMaterial::setRoughness(float roughness) {
+  mRoughness = roughness;
+  for (auto &[renderer, mat] : mShardMaterials) {
+    mat->setRoughness(roughness);
+  }
+}
+float ShardedMaterial::getRoughness() const {
+  if (!mRoughness) {
+    throw std::runtime_error("get material not implemented for rendering client");
+  }
+  return *mRoughness;
+}
+
+void ShardedMaterial::setSpecular(float specular) {
+  mSpecular = specular;
+  for (auto &[renderer, mat] : mShardMaterials) {
+    mat->setSpecular(specular);
+  }
+}
+float ShardedMaterial::getSpecular() const {
+  if (!mSpecular) {
+    throw std::runtime_error("get material not implemented for rendering client");
+  }
+  return *mSpecular;
+}
+
+void ShardedMaterial::setMetallic(float metallic) {
+  mMetallic = metallic;
+  for (auto &[renderer, mat] : mShardMaterials) {
+    mat->setMetallic(metallic);
+  }
+}
+float ShardedMaterial::getMetallic() const {
+  if (!mMetallic) {
+    throw std::runtime_error("get material not implemented for rendering client");
+  }
+  return *mMetallic;
+}
+
+std::shared_ptr<ClientMaterial> ShardedMaterial::getShardMaterial(ClientRenderer &renderer) {
+  for (auto &[r, mat] : mShardMaterials) {
+    if (r == &renderer) {
+      return mat;
+    }
+  }
+  auto mat = std::static_pointer_cast<ClientMaterial>(renderer.createMaterial());
+  if (mBaseColor) {
+    mat->setBaseColor(*mBaseColor);
+  }
+  if (mRoughness) {
+    mat->setRoughness(*mRoughness);
+  }
+  if (mSpecular) {
+    mat->setSpecular(*mSpecular);
+  }
+  if (mMetallic) {
+    mat->setMetallic(*mMetallic);
+  }
+  mShardMaterials.push_back({&renderer, mat});
+  return mat;
+}
+
+//========== Placement ==========//
+// FNV-1a, stable across processes so every client places a scene key on the same shard
+static uint64_t hashKey(std::string const &key) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : key) {
+    hash = (hash ^ c) * 1099511628211ull;
+  }
+  // final mix, FNV alone clusters keys that differ in the last characters
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+static constexpr int kRingPointsPerShard = 64;
+
+ShardPlacer::ShardPlacer(std::vector<std::string> const &addresses, ShardPlacement placement)
+    : mAddresses(addresses), mPlacement(placement), mHealthy(addresses.size(), true) {
+  if (addresses.empty()) {
+    throw std::runtime_error("sharded renderer needs at least one server address");
+  }
+  for (uint32_t i = 0; i < addresses.size(); ++i) {
+    for (int p = 0; p < kRingPointsPerShard; ++p) {
+      mRing.push_back({hashKey(addresses[i] + "#" + std::to_string(p)), i});
+    }
+  }
+  std::sort(mRing.begin(), mRing.end());
+}
+
+std::vector<uint32_t>
+ShardPlacer::order(std::string const &key,
+                   std::vector<std::pair<uint32_t, uint32_t>> const &load) const {
+  std::vector<uint32_t> order;
+  if (mPlacement == ShardPlacement::eCONSISTENT_HASH) {
+    // walk the ring clockwise from the key, each shard once
+    size_t start = std::lower_bound(mRing.begin(), mRing.end(),
+                                    std::pair<uint64_t, uint32_t>{hashKey(key), 0}) -
+                   mRing.begin();
+    for (size_t i = 0; i < mRing.size() && order.size() < mAddresses.size(); ++i) {
+      uint32_t shard = mRing[(start + i) % mRing.size()].second;
+      if (std::find(order.begin(), order.end(), shard) == order.end()) {
+        order.push_back(shard);
+      }
+    }
+    return order;
+  }
+
+  if (load.size() != mAddresses.size()) {
+    throw std::runtime_error("failed to place scene: load must be given for every shard");
+  }
+  order.resize(mAddresses.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t a, uint32_t b) { return load[a] < load[b]; });
+  return order;
+}
+
+uint32_t ShardPlacer::place(std::string const &key,
+                            std::vector<std::pair<uint32_t, uint32_t>> const &load,
+                            std::function<void(uint32_t)> const &create) {
+  std::string errors;
+  for (uint32_t index : order(key, load)) {
+    if (!mHealthy[index]) {
+      continue;
+    }
+    try {
+      create(index);
+      return index;
+    } catch (std::exception const &e) {
+      spdlog::get("SAPIEN")->warn("Render server {} failed to create a scene: {}",
+                                  mAddresses[index], e.what());
+      mHealthy[index] = false;
+      errors += "\n" + mAddresses[index] + ": " + e.what();
+    }
+  }
+  throw std::runtime_error("failed to create scene: no healthy render server" + errors);
+}
+
+//========== Renderer ==========//
+ShardedRenderer::ShardedRenderer(std::vector<std::string> const &addresses,
+                                 uint64_t processIndex, ShardPlacement placement)
+    : mProcessIndex(processIndex), mPlacer(addresses, placement) {
+  for (auto &address : addresses) {
+    mShards.push_back(std::make_shared<ClientRenderer>(address, processIndex));
+  }
+}
+
+ClientScene *ShardedRenderer::createScene(std::string const &name) {
+  // scenes created by SScene are unnamed, their creation order in this process is the key
+  std::string key = name.empty() ? std::to_string(mProcessIndex) + "/" +
+                                       std::to_string(mSceneSerial)
+                                 : name;
+  ++mSceneSerial;
+
+  std::vector<std::pair<uint32_t, uint32_t>> load;
+  for (auto &shard : mShards) {
+    load.push_back({shard->getSceneCount(), shard->getFramesInFlight()});
+  }
+  ClientScene *scene{};
+  mPlacer.place(key, load, [&](uint32_t index) { scene = mShards[index]->createScene(name); });
+  return scene;
+}
+
+void ShardedRenderer::removeScene(IPxrScene *scene) {
+  if (auto clientScene = dynamic_cast<ClientScene *>(scene)) {
+    clientScene->getRenderer()->removeScene(scene);
+  }
+}
+
+std::shared_ptr<IPxrMaterial> ShardedRenderer::createMaterial() {
+  return std::make_shared<ShardedMaterial>();
+}
+
+uint32_t ShardedRenderer::checkHealth(uint32_t timeoutMs) {
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < mShards.size(); ++i) {
+    bool healthy = mShards[i]->isConnected(timeoutMs);
+    mPlacer.setHealthy(i, healthy);
+    count += healthy;
+  }
+  return count;
+}
+
+std::vector<ShardStats> ShardedRenderer::getShardStats() const {
+  std::vector<ShardStats> stats;
+  for (uint32_t i = 0; i < mShards.size(); ++i) {
+    auto &shard = mShards[i];
+    stats.push_back({shard->getAddress(), mPlacer.isHealthy(i), shard->getSceneCount(),
+                     shard->getFramesInFlight(), shard->getPendingCommandCount()});
+  }
+  return stats;
+}
+
+void ShardedRenderer::setBatchUpdates(bool enable) {
+  mBatchUpdates = enable;
+  for (auto &shard : mShards) {
+    shard->setBatchUpdates(enable);
+  }
+}
+
+void ShardedRenderer::setMaxFramesInFlight(uint32_t count) {
+  mMaxFramesInFlight = count;
+  for (auto &shard : mShards) {
+    shard->setMaxFramesInFlight(count);
+  }
+}
+
+void ShardedRenderer::setCommandBatching(bool enable) {
+  mCommandBatching = enable;
+  for (auto &shard : mShards) {
+    shard->setCommandBatching(enable);
+  }
+}
+
+void ShardedRenderer::flush() {
+  for (auto &shard : mShards) {
+    shard->flush();
+  }
+}
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
@@ -0,0 +1,234 @@
+#include "sapien/renderer/server/shared_memory.h"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sapien {
+namespace Renderer {
+namespace server {
+
+static constexpr size_t kHeaderSize = 64;
+
+static size_t slotSize(uint32_t maxBodies, uint32_t maxCameras) {
+  size_t size = sizeof(ShmFrameHeader) + maxCameras * sizeof(uint64_t) +
+                (maxBodies + maxCameras) * 7 * sizeof(float);
+  return (size + 63) / 64 * 64;
+}
+
+#ifdef __linux__
+
+std::unique_ptr<ShmRing> ShmRing::Create(std::string const &name, uint32_t slotCount,
+                                         uint32_t maxBodies, uint32_t maxCameras) {
+  if (slotCount == 0) {
+    throw std::runtime_error("failed to create shared memory: ring needs at least one slot");
+  }
+  size_t slot = slotSize(maxBodies, maxCameras);
+  size_t size = kHeaderSize + slot * slotCount;
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("failed to create shared memory " + name + ": " +
+                             std::strerror(errno));
+  }
+  if (ftruncate(fd, size) != 0) {
+    int err = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    throw std::runtime_error("failed to resize shared memory " + name + ": " +
+                             std::strerror(err));
+  }
+  void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    throw std::runtime_error("failed to map shared memory " + name);
+  }
+
+  // ftruncate zero fills, counters start at 0 and frame 1 is the first one published
+  auto &header = *reinterpret_cast<ShmRingHeader *>(data);
+  header.slotCount = slotCount;
+  header.maxBodies = maxBodies;
+  header.maxCameras = maxCameras;
+  header.slotSize = slot;
+  std::atomic_ref<uint32_t>(header.magic).store(kMagic, std::memory_order_release);
+
+  return std::unique_ptr<ShmRing>(new ShmRing(name, data, size, true));
+}
+
+std::unique_ptr<ShmRing> ShmRing::Open(std::string const &name) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    throw std::runtime_error("failed to open shared memory " + name + ": " +
+                             std::strerror(errno));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kHeaderSize) {
+    close(fd);
+    throw std::runtime_error("failed to open shared memory " + name + ": invalid size");
+  }
+  size_t size = st.st_size;
+  void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("failed to map shared memory " + name);
+  }
+
+  auto ring = std::unique_ptr<ShmRing>(new ShmRing(name, data, size, false));
+  auto &header = ring->header();
+  if (std::atomic_ref<uint32_t>(header.magic).load(std::memory_order_acquire) != kMagic ||
+      header.slotCount == 0 || header.slotSize != slotSize(header.maxBodies, header.maxCameras) ||
+      kHeaderSize + header.slotSize * header.slotCount > size) {
+    throw std::runtime_error("failed to open shared memory " + name + ": invalid header");
+  }
+  return ring;
+}
+
+ShmRing::~ShmRing() {
+  munmap(mData, mSize);
+  if (mOwner) {
+    shm_unlink(mName.c_str());
+  }
+}
+
+void ShmRing::unlink() {
+  if (mOwner) {
+    shm_unlink(mName.c_str());
+    mOwner = false;
+  }
+}
+
+bool ShmRing::wait(std::atomic<uint32_t> &word, uint32_t value, uint32_t timeoutMs) {
+  struct timespec timeout {
+    static_cast<time_t>(timeoutMs / 1000), static_cast<long>(timeoutMs % 1000) * 1000000
+  };
+  // not FUTEX_PRIVATE, the word is shared between processes
+  long ret = syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, value, &timeout,
+                     nullptr, 0);
+  return ret == 0 || errno != ETIMEDOUT;
+}
+
+void ShmRing::wake(std::atomic<uint32_t> &word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr,
+          0);
+}
+
+#else
+
+std::unique_ptr<ShmRing> ShmRing::Create(std::string const &name, uint32_t slotCount,
+                                         uint32_t maxBodies, uint32_t maxCameras) {
+  throw std::runtime_error("shared memory transport is only supported on Linux");
+}
+std::unique_ptr<ShmRing> ShmRing::Open(std::string const &name) {
+  throw std::runtime_error("shared memory transport is only supported on Linux");
+}
+ShmRing::~ShmRing() {}
+void ShmRing::unlink() {}
+bool ShmRing::wait(std::atomic<uint32_t> &word, uint32_t value, uint32_t timeoutMs) {
+  return false;
+}
+void ShmRing::wake(std::atomic<uint32_t> &word) {}
+
+#endif
+
+ShmRing::ShmRing(std::string const &name, void *data, size_t size, bool owner)
+    : mName(name), mData(data), mSize(size), mOwner(owner) {}
+
+ShmFrameHeader &ShmRing::frame(uint32_t n) const {
+  auto &h = header();
+  return *reinterpret_cast<ShmFrameHeader *>(static_cast<char *>(mData) + kHeaderSize +
+                                             (n % h.slotCount) * h.slotSize);
+}
+
+uint64_t *ShmRing::pictures(uint32_t n) const {
+  return reinterpret_cast<uint64_t *>(&frame(n) + 1);
+}
+
+float *ShmRing::poses(uint32_t n) const {
+  return reinterpret_cast<float *>(pictures(n) + header().maxCameras);
+}
+
+uint32_t ShmRing::beginFrame(uint32_t timeoutMs) {
+  auto &h = header();
+  uint32_t n = h.requested.load(std::memory_order_relaxed) + 1;
+  // the slot is free once the frame that used it last is completed
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  for (uint32_t done = h.completed.load(std::memory_order_acquire);
+       !reached(done, n - h.slotCount); done = h.completed.load(std::memory_order_acquire)) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      throw std::runtime_error("shared memory transport: render server is not responding");
+    }
+    wait(h.completed, done, timeoutMs);
+  }
+  return n;
+}
+
+void ShmRing::endFrame(uint32_t n) {
+  header().requested.store(n, std::memory_order_release);
+  wake(header().requested);
+}
+
+void ShmRing::waitCompleted(uint32_t n, uint32_t timeoutMs) {
+  auto &h = header();
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  for (uint32_t done = h.completed.load(std::memory_order_acquire); !reached(done, n);
+       done = h.completed.load(std::memory_order_acquire)) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      throw std::runtime_error("shared memory transport: render server is not responding");
+    }
+    wait(h.completed, done, timeoutMs);
+  }
+  if (uint32_t failed = h.error.load(std::memory_order_acquire); failed && reached(failed, n)) {
+    throw std::runtime_error("update render failed: the render server rejected the frame");
+  }
+}
+
+ShmRingServer::ShmRingServer(std::unique_ptr<ShmRing> ring, Handler handler)
+    : mRing(std::move(ring)), mHandler(std::move(handler)) {
+  mThread = std::thread([this]() { run(); });
+}
+
+ShmRingServer::~ShmRingServer() {
+  mStop = true;
+  ShmRing::wake(mRing->header().requested);
+  mThread.join();
+}
+
+void ShmRingServer::run() {
+  auto &h = mRing->header();
+  uint32_t served = h.completed.load(std::memory_order_acquire);
+  while (!mStop) {
+    uint32_t requested = h.requested.load(std::memory_order_acquire);
+    if (requested == served) {
+      // the timeout only bounds how long a missed wake during shutdown can delay the stop
+      ShmRing::wait(h.requested, served, 100);
+      continue;
+    }
+    // the client cannot run more than slotCount frames ahead, so every frame up to requested
+    // is still in its slot
+    for (uint32_t n = served + 1; !mStop && ShmRing::reached(requested, n); ++n) {
+      try {
+        mHandler(*mRing, n);
+      } catch (std::exception const &) {
+        h.error.store(n, std::memory_order_relaxed);
+      }
+      h.completed.store(n, std::memory_order_release);
+      ShmRing::wake(h.completed);
+      served = n;
+    }
+  }
+}
+
+} // namespace server
+} // namespace Renderer
+} // namespace sapien
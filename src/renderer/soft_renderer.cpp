@@ -0,0 +1,944 @@
+#include "sapien/renderer/soft_renderer.h"
+#include <algorithm>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace sapien {
+namespace Renderer {
+
+//========== Mesh ==========//
+SoftMesh::SoftMesh(std::vector<float> vertices, std::vector<float> normals,
+                   std::vector<uint32_t> indices)
+    : mVertices(std::move(vertices)), mNormals(std::move(normals)),
+      mIndices(std::move(indices)) {}
+
+static std::shared_ptr<SoftMesh> createCube() {
+  std::vector<float> vertices;
+  std::vector<float> normals;
+  std::vector<uint32_t> indices;
+  for (int axis = 0; axis < 3; ++axis) {
+    int u = (axis + 1) % 3;
+    int v = (axis + 2) % 3;
+    for (float sign : {-1.f, 1.f}) {
+      uint32_t base = vertices.size() / 3;
+      for (auto [a, b] : {std::pair{-1.f, -1.f}, {1.f, -1.f}, {1.f, 1.f}, {-1.f, 1.f}}) {
+        float position[3];
+        position[axis] = sign;
+        position[u] = a;
+        position[v] = b;
+        float normal[3]{0.f, 0.f, 0.f};
+        normal[axis] = sign;
+        vertices.insert(vertices.end(), position, position + 3);
+        normals.insert(normals.end(), normal, normal + 3);
+      }
+      // counter-clockwise seen from outside
+      if (sign > 0) {
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+      } else {
+        indices.insert(indices.end(), {base, base + 2, base + 1, base, base + 3, base + 2});
+      }
+    }
+  }
+  return std::make_shared<SoftMesh>(vertices, normals, indices);
+}
+
+/** x = 0 plane with y, z in [-1, 1] facing +x */
+static std::shared_ptr<SoftMesh> createYZPlane() {
+  return std::make_shared<SoftMesh>(
+      std::vector<float>{0.f, -1.f, -1.f, 0.f, 1.f, -1.f, 0.f, 1.f, 1.f, 0.f, -1.f, 1.f},
+      std::vector<float>{1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f},
+      std::vector<uint32_t>{0, 1, 2, 0, 2, 3});
+}
+
+/** revolve a profile of (x, radius, normal x, normal radius) points around the x axis */
+static std::shared_ptr<SoftMesh> revolve(std::vector<std::array<float, 4>> const &profile,
+                                         uint32_t segments) {
+  std::vector<float> vertices;
+  std::vector<float> normals;
+  std::vector<uint32_t> indices;
+  for (auto [x, r, nx, nr] : profile) {
+    for (uint32_t s = 0; s <= segments; ++s) {
+      float phi = 2.f * M_PI * s / segments;
+      float c = std::cos(phi);
+      float sn = std::sin(phi);
+      vertices.insert(vertices.end(), {x, r * c, r * sn});
+      normals.insert(normals.end(), {nx, nr * c, nr * sn});
+    }
+  }
+  uint32_t stride = segments + 1;
+  for (uint32_t ring = 0; ring + 1 < profile.size(); ++ring) {
+    for (uint32_t s = 0; s < segments; ++s) {
+      uint32_t a = ring * stride + s;
+      uint32_t b = a + stride;
+      indices.insert(indices.end(), {a, b, a + 1, a + 1, b, b + 1});
+    }
+  }
+  return std::make_shared<SoftMesh>(vertices, normals, indices);
+}
+
+static std::shared_ptr<SoftMesh> createSphere(uint32_t segments, uint32_t rings) {
+  std::vector<std::array<float, 4>> profile;
+  for (uint32_t i = 0; i <= rings; ++i) {
+    float theta = M_PI * i / rings;
+    profile.push_back({std::cos(theta), std::sin(theta), std::cos(theta), std::sin(theta)});
+  }
+  return revolve(profile, segments);
+}
+
+/** capsule along x, like the collision shape */
+static std::shared_ptr<SoftMesh> createCapsule(float radius, float halfLength, uint32_t segments,
+                                               uint32_t halfRings) {
+  std::vector<std::array<float, 4>> profile;
+  for (uint32_t i = 0; i <= halfRings; ++i) {
+    float theta = M_PI / 2.f * i / halfRings;
+    profile.push_back({halfLength + radius * std::cos(theta), radius * std::sin(theta),
+                       std::cos(theta), std::sin(theta)});
+  }
+  for (uint32_t i = 0; i <= halfRings; ++i) {
+    float theta = M_PI / 2.f * (1.f + static_cast<float>(i) / halfRings);
+    profile.push_back({-halfLength + radius * std::cos(theta), radius * std::sin(theta),
+                       std::cos(theta), std::sin(theta)});
+  }
+  return revolve(profile, segments);
+}
+
+//========== Rigidbody ==========//
+SoftRigidbody::SoftRigidbody(SoftScene *scene, std::vector<std::shared_ptr<SoftShape>> shapes,
+                             physx::PxGeometryType::Enum type, physx::PxVec3 scale)
+    : mScene(scene), mShapes(std::move(shapes)), mType(type), mScale(scale),
+      mRenderScale(type == physx::PxGeometryType::eCAPSULE ? physx::PxVec3{1.f, 1.f, 1.f}
+                                                            : scale) {}
+
+void SoftRigidbody::setInitialPose(const physx::PxTransform &transform) {
+  mInitialPose = transform;
+  update({{0, 0, 0}, physx::PxIdentity});
+}
+
+void SoftRigidbody::update(const physx::PxTransform &transform) {
+  mPose = transform * mInitialPose;
+}
+
+void SoftRigidbody::setRenderMode(uint32_t mode) {
+  if (mode == 0) {
+    setVisibility(1.f);
+    return;
+  }
+  if (mode == 1) {
+    setVisibility(0.f);
+    return;
+  }
+  if (mode == 2) {
+    setVisibility(0.5f);
+  }
+}
+
+void SoftRigidbody::destroy() { mScene->removeRigidbody(this); }
+
+std::vector<std::shared_ptr<IPxrRenderShape>> SoftRigidbody::getRenderShapes() {
+  return {mShapes.begin(), mShapes.end()};
+}
+
+void SoftRigidbody::rescale(float factor) {
+  mInitialPose.p *= factor;
+  mScale *= factor;
+  mRenderScale *= factor;
+}
+
+//========== Rasterizer ==========//
+namespace {
+
+constexpr int kTileSize = 32;
+constexpr uint32_t kNoTriangle = std::numeric_limits<uint32_t>::max();
+
+/** a shape of a visible body with everything the vertex stage needs */
+struct DrawItem {
+  SoftMesh const *mesh;
+  physx::PxTransform modelView;
+  physx::PxVec3 scale;
+  std::array<float, 4> color;
+  uint32_t uniqueId;
+  uint32_t segmentationId;
+  bool shadeFlat;
+};
+
+/** screen position and 1/z of the corners for coverage and depth, camera space position and
+ *  normal for the attributes of the covered pixels */
+struct Triangle {
+  float x[3];
+  float y[3];
+  float invZ[3];
+  physx::PxVec3 position[3];
+  physx::PxVec3 normal[3];
+  uint32_t item;
+};
+
+struct Vertex {
+  physx::PxVec3 position;
+  physx::PxVec3 normal;
+};
+
+struct Projection {
+  float fx;
+  float fy;
+  float cx;
+  float cy;
+  float skew;
+  float near;
+  float far;
+  int width;
+  int height;
+};
+
+/** in camera space, point lights have a cosCutoff below -1 */
+struct ShadingLight {
+  physx::PxVec3 position;
+  physx::PxVec3 direction;
+  physx::PxVec3 color;
+  float cosCutoff;
+  bool directional;
+};
+
+/** depth and visible triangle of the pixels of one tile, written in the coverage pass */
+struct TileBuffer {
+  float depth[kTileSize * kTileSize];
+  uint32_t triangle[kTileSize * kTileSize];
+  float weight1[kTileSize * kTileSize];
+  float weight2[kTileSize * kTileSize];
+};
+
+/** pixels [first, last) touched by the span [lo, hi], clamped before the conversion since
+ *  triangles close to the near plane can reach far outside the image */
+std::pair<int, int> pixelRange(float lo, float hi, int size) {
+  float limit = static_cast<float>(size);
+  return {static_cast<int>(std::floor(std::clamp(lo, 0.f, limit))),
+          static_cast<int>(std::ceil(std::clamp(hi, 0.f, limit)))};
+}
+
+void emitTriangle(Vertex const &v0, Vertex const &v1, Vertex const &v2, uint32_t item,
+                  Projection const &proj, std::vector<Triangle> &out) {
+  Triangle t;
+  Vertex const *v[3] = {&v0, &v1, &v2};
+  for (int i = 0; i < 3; ++i) {
+    // OpenGL camera space to image coordinates, x right and y down
+    float invZ = -1.f / v[i]->position.z;
+    float x = v[i]->position.x;
+    float y = -v[i]->position.y;
+    t.x[i] = proj.cx + (proj.fx * x + proj.skew * y) * invZ;
+    t.y[i] = proj.cy + proj.fy * y * invZ;
+    t.invZ[i] = invZ;
+    t.position[i] = v[i]->position;
+    t.normal[i] = v[i]->normal;
+  }
+  float area = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.x[2] - t.x[0]) * (t.y[1] - t.y[0]);
+  if (!(std::abs(area) > 1e-8f)) {
+    return;
+  }
+  auto [minX, maxX] = std::minmax({t.x[0], t.x[1], t.x[2]});
+  auto [minY, maxY] = std::minmax({t.y[0], t.y[1], t.y[2]});
+  if (maxX < 0.f || maxY < 0.f || minX > proj.width || minY > proj.height) {
+    return;
+  }
+  t.item = item;
+  out.push_back(t);
+}
+
+/** clip against the near plane, the far plane is left to the depth test */
+void clipTriangle(Vertex const (&tri)[3], uint32_t item, Projection const &proj,
+                  std::vector<Triangle> &out) {
+  float d[3];
+  int inside = 0;
+  int beyond = 0;
+  for (int i = 0; i < 3; ++i) {
+    d[i] = -tri[i].position.z - proj.near;
+    inside += d[i] >= 0.f;
+    beyond += -tri[i].position.z > proj.far;
+  }
+  if (inside == 0 || beyond == 3) {
+    return;
+  }
+  if (inside == 3) {
+    emitTriangle(tri[0], tri[1], tri[2], item, proj, out);
+    return;
+  }
+  Vertex polygon[4];
+  int count = 0;
+  for (int i = 0; i < 3; ++i) {
+    int j = (i + 1) % 3;
+    if (d[i] >= 0.f) {
+      polygon[count++] = tri[i];
+    }
+    if ((d[i] >= 0.f) != (d[j] >= 0.f)) {
+      float s = d[i] / (d[i] - d[j]);
+      polygon[count++] = {tri[i].position + (tri[j].position - tri[i].position) * s,
+                          tri[i].normal + (tri[j].normal - tri[i].normal) * s};
+    }
+  }
+  for (int k = 1; k + 1 < count; ++k) {
+    emitTriangle(polygon[0], polygon[k], polygon[k + 1], item, proj, out);
+  }
+}
+
+/** vertex stage of one draw item: transform to camera space, clip and project */
+void setupItem(DrawItem const &item, uint32_t itemIndex, Projection const &proj,
+               std::vector<Triangle> &out) {
+  out.clear();
+  auto &vertices = item.mesh->vertices();
+  auto &normals = item.mesh->normals();
+  auto &indices = item.mesh->indices();
+  size_t count = vertices.size() / 3;
+  bool smooth = !item.shadeFlat && normals.size() == vertices.size();
+
+  thread_local std::vector<Vertex> transformed;
+  transformed.resize(count);
+  // normals transform with the inverse scale
+  physx::PxVec3 normalScale{1.f / item.scale.x, 1.f / item.scale.y, 1.f / item.scale.z};
+  for (size_t i = 0; i < count; ++i) {
+    physx::PxVec3 p{vertices[3 * i] * item.scale.x, vertices[3 * i + 1] * item.scale.y,
+                    vertices[3 * i + 2] * item.scale.z};
+    transformed[i].position = item.modelView.transform(p);
+    if (smooth) {
+      physx::PxVec3 n{normals[3 * i] * normalScale.x, normals[3 * i + 1] * normalScale.y,
+                      normals[3 * i + 2] * normalScale.z};
+      transformed[i].normal = item.modelView.q.rotate(n).getNormalized();
+    }
+  }
+
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    uint32_t a = indices[i];
+    uint32_t b = indices[i + 1];
+    uint32_t c = indices[i + 2];
+    if (a >= count || b >= count || c >= count) {
+      continue;
+    }
+    Vertex tri[3] = {transformed[a], transformed[b], transformed[c]};
+    if (!smooth) {
+      // the winding of the mesh is unknown, face normals point to the camera
+      auto n = (tri[1].position - tri[0].position)
+                   .cross(tri[2].position - tri[0].position)
+                   .getNormalized();
+      if (n.dot(tri[0].position) > 0.f) {
+        n = -n;
+      }
+      tri[0].normal = tri[1].normal = tri[2].normal = n;
+    }
+    clipTriangle(tri, itemIndex, proj, out);
+  }
+}
+
+/** old where keep is all ones, value where it is 0. Selecting with masks instead of a
+ *  conditional keeps the stores unconditional, otherwise GCC does not vectorize the loop. */
+inline float blend(float old, float value, uint32_t keep) {
+  return std::bit_cast<float>((std::bit_cast<uint32_t>(old) & keep) |
+                              (std::bit_cast<uint32_t>(value) & ~keep));
+}
+
+/** coverage pass of one triangle over the pixels of a tile, the pixel loop has no branches so
+ *  the compiler vectorizes it */
+void rasterizeTriangle(Triangle const &t, uint32_t index, int tileX, int tileY, int tileW,
+                       int tileH, TileBuffer &tile) {
+  auto [minX, maxX] = std::minmax({t.x[0], t.x[1], t.x[2]});
+  auto [minY, maxY] = std::minmax({t.y[0], t.y[1], t.y[2]});
+  auto [x0, x1] = pixelRange(minX - tileX, maxX - tileX, tileW);
+  auto [y0, y1] = pixelRange(minY - tileY, maxY - tileY, tileH);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  // barycentric weights as plane equations w = a * x + b * y + c in tile coordinates
+  float invArea =
+      1.f / ((t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.x[2] - t.x[0]) * (t.y[1] - t.y[0]));
+  float a[3], b[3], c[3];
+  for (int i = 0; i < 3; ++i) {
+    int j = (i + 1) % 3;
+    int k = (i + 2) % 3;
+    float ex = t.x[k] - t.x[j];
+    float ey = t.y[k] - t.y[j];
+    float px = t.x[j] - tileX;
+    float py = t.y[j] - tileY;
+    a[i] = -ey * invArea;
+    b[i] = ex * invArea;
+    c[i] = (ey * px - ex * py) * invArea;
+  }
+  float iz0 = t.invZ[0];
+  float iz1 = t.invZ[1];
+  float iz2 = t.invZ[2];
+
+  for (int y = y0; y < y1; ++y) {
+    float py = y + 0.5f;
+    float r0 = b[0] * py + c[0];
+    float r1 = b[1] * py + c[1];
+    float r2 = b[2] * py + c[2];
+    float *depth = tile.depth + y * kTileSize;
+    uint32_t *triangle = tile.triangle + y * kTileSize;
+    float *weight1 = tile.weight1 + y * kTileSize;
+    float *weight2 = tile.weight2 + y * kTileSize;
+    for (int x = x0; x < x1; ++x) {
+      float px = x + 0.5f;
+      float w0 = a[0] * px + r0;
+      float w1 = a[1] * px + r1;
+      float w2 = a[2] * px + r2;
+      float z = 1.f / (w0 * iz0 + w1 * iz1 + w2 * iz2);
+      uint32_t keep =
+          -static_cast<uint32_t>((w0 < 0.f) | (w1 < 0.f) | (w2 < 0.f) | !(z < depth[x]));
+      depth[x] = blend(depth[x], z, keep);
+      triangle[x] = (triangle[x] & keep) | (index & ~keep);
+      // perspective correct weights
+      weight1[x] = blend(weight1[x], w1 * iz1 * z, keep);
+      weight2[x] = blend(weight2[x], w2 * iz2 * z, keep);
+    }
+  }
+}
+
+} // namespace
+
+/** per camera scratch memory of the rasterizer */
+struct SoftRasterBuffers {
+  std::vector<DrawItem> items;
+  std::vector<std::vector<Triangle>> itemTriangles;
+  // triangles overlapping each tile, one list per tile for each chunk of shapes
+  std::vector<std::vector<std::vector<Triangle const *>>> bins;
+};
+
+//========== Camera ==========//
+SoftCamera::SoftCamera(SoftScene *scene, uint32_t width, uint32_t height, float fovy,
+                       float near, float far)
+    : mScene(scene), mWidth(width), mHeight(height), mCx(width / 2.f), mCy(height / 2.f),
+      mFx(height / 2.f / std::tan(fovy / 2.f)), mFy(mFx), mNear(near), mFar(far) {}
+
+SoftCamera::~SoftCamera() = default;
+
+IPxrScene *SoftCamera::getScene() { return mScene; }
+
+void SoftCamera::setPerspectiveCameraParameters(float near, float far, float fx, float fy,
+                                                float cx, float cy, float skew) {
+  mNear = near;
+  mFar = far;
+  mFx = fx;
+  mFy = fy;
+  mCx = cx;
+  mCy = cy;
+  mSkew = skew;
+}
+
+std::vector<float> SoftCamera::getFloatImage(std::string const &name) {
+  if (name == "Color") {
+    return mColor;
+  }
+  if (name == "Position") {
+    return mPosition;
+  }
+  if (name == "Normal") {
+    return mNormal;
+  }
+  if (name == "Albedo") {
+    return mAlbedo;
+  }
+  if (name == "Depth") {
+    return mDepth;
+  }
+  throw std::runtime_error("failed to get image: the soft renderer does not render " + name);
+}
+
+std::vector<uint32_t> SoftCamera::getUintImage(std::string const &name) {
+  if (name == "Segmentation") {
+    return mSegmentation;
+  }
+  throw std::runtime_error("failed to get image: the soft renderer does not render " + name);
+}
+
+std::string SoftCamera::getImageFormat(std::string const &name) {
+  if (name == "Segmentation") {
+    return "i4";
+  }
+  if (name == "Color" || name == "Position" || name == "Normal" || name == "Albedo" ||
+      name == "Depth") {
+    return "f4";
+  }
+  throw std::runtime_error("failed to get image: the soft renderer does not render " + name);
+}
+
+void SoftCamera::takePicture() { mScene->render(*this); }
+
+//========== Scene ==========//
+SoftScene::SoftScene(SoftRenderer *renderer, std::string const &name)
+    : mRenderer(renderer), mName(name) {}
+
+IPxrRigidbody *SoftScene::addBody(std::unique_ptr<SoftRigidbody> body) {
+  mBodies.push_back(std::move(body));
+  return mBodies.back().get();
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale) {
+  return addBody(std::make_unique<SoftRigidbody>(
+      this, mRenderer->loadFile(meshFile), physx::PxGeometryType::eTRIANGLEMESH, scale));
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(const std::string &meshFile, const physx::PxVec3 &scale,
+                                       std::shared_ptr<IPxrMaterial> material) {
+  auto shapes = mRenderer->loadFile(meshFile);
+  if (material) {
+    for (auto &shape : shapes) {
+      shape->setMaterial(material);
+    }
+  }
+  return addBody(std::make_unique<SoftRigidbody>(this, shapes,
+                                                 physx::PxGeometryType::eTRIANGLEMESH, scale));
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(std::shared_ptr<IRenderMesh> mesh,
+                                       const physx::PxVec3 &scale,
+                                       std::shared_ptr<IPxrMaterial> material) {
+  auto softMesh = std::dynamic_pointer_cast<SoftMesh>(mesh);
+  if (!softMesh) {
+    throw std::runtime_error("failed to add body: the mesh is not from this renderer");
+  }
+  if (!material) {
+    material = mRenderer->createMaterial();
+  }
+  return addBody(std::make_unique<SoftRigidbody>(
+      this, std::vector{std::make_shared<SoftShape>(softMesh, material)},
+      physx::PxGeometryType::eTRIANGLEMESH, scale));
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(physx::PxGeometryType::Enum type,
+                                       const physx::PxVec3 &scale,
+                                       std::shared_ptr<IPxrMaterial> material) {
+  if (!material) {
+    material = mRenderer->createMaterial();
+  }
+  auto mesh = mRenderer->getPrimitiveMesh(type, scale);
+  return addBody(std::make_unique<SoftRigidbody>(
+      this, std::vector{std::make_shared<SoftShape>(mesh, material)}, type, scale));
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(physx::PxGeometryType::Enum type,
+                                       const physx::PxVec3 &scale, const physx::PxVec3 &color) {
+  auto material = mRenderer->createMaterial();
+  material->setBaseColor({color.x, color.y, color.z, 1.f});
+  return addRigidbody(type, scale, material);
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                                       std::vector<physx::PxVec3> const &normals,
+                                       std::vector<uint32_t> const &indices,
+                                       const physx::PxVec3 &scale,
+                                       std::shared_ptr<IPxrMaterial> material) {
+  std::vector<float> positions;
+  std::vector<float> normalValues;
+  for (auto &v : vertices) {
+    positions.insert(positions.end(), {v.x, v.y, v.z});
+  }
+  for (auto &n : normals) {
+    normalValues.insert(normalValues.end(), {n.x, n.y, n.z});
+  }
+  auto mesh = std::make_shared<SoftMesh>(positions, normalValues, indices);
+  return addRigidbody(mesh, scale, material);
+}
+
+IPxrRigidbody *SoftScene::addRigidbody(std::vector<physx::PxVec3> const &vertices,
+                                       std::vector<physx::PxVec3> const &normals,
+                                       std::vector<uint32_t> const &indices,
+                                       const physx::PxVec3 &scale, const physx::PxVec3 &color) {
+  auto material = mRenderer->createMaterial();
+  material->setBaseColor({color.x, color.y, color.z, 1.f});
+  return addRigidbody(vertices, normals, indices, scale, material);
+}
+
+void SoftScene::removeRigidbody(IPxrRigidbody *body) {
+  mBodies.erase(std::remove_if(mBodies.begin(), mBodies.end(),
+                               [body](auto &b) { return b.get() == body; }),
+                mBodies.end());
+}
+
+ICamera *SoftScene::addCamera(uint32_t width, uint32_t height, float fovy, float near, float far,
+                              std::string const &shaderDir) {
+  if (!shaderDir.empty()) {
+    spdlog::get("SAPIEN")->warn("the soft renderer does not use shaders, {} is ignored",
+                                shaderDir);
+  }
+  mCameras.push_back(std::make_unique<SoftCamera>(this, width, height, fovy, near, far));
+  return mCameras.back().get();
+}
+
+void SoftScene::removeCamera(ICamera *camera) {
+  mCameras.erase(std::remove_if(mCameras.begin(), mCameras.end(),
+                                [camera](auto &c) { return c.get() == camera; }),
+                 mCameras.end());
+}
+
+std::vector<ICamera *> SoftScene::getCameras() {
+  std::vector<ICamera *> cameras;
+  for (auto &camera : mCameras) {
+    cameras.push_back(camera.get());
+  }
+  return cameras;
+}
+
+IPointLight *SoftScene::addPointLight(std::array<float, 3> const &position,
+                                      std::array<float, 3> const &color, bool enableShadow,
+                                      float shadowNear, float shadowFar, uint32_t shadowMapSize) {
+  auto light = std::make_unique<SoftPointLight>(
+      physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+IDirectionalLight *SoftScene::addDirectionalLight(
+    std::array<float, 3> const &direction, std::array<float, 3> const &color, bool enableShadow,
+    std::array<float, 3> const &position, float shadowScale, float shadowNear, float shadowFar,
+    uint32_t shadowMapSize) {
+  auto light = std::make_unique<SoftDirectionalLight>(
+      physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow,
+      physx::PxVec3{direction[0], direction[1], direction[2]}, shadowScale, shadowNear,
+      shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+ISpotLight *SoftScene::addSpotLight(std::array<float, 3> const &position,
+                                    std::array<float, 3> const &direction, float fovInner,
+                                    float fovOuter, std::array<float, 3> const &color,
+                                    bool enableShadow, float shadowNear, float shadowFar,
+                                    uint32_t shadowMapSize) {
+  auto light = std::make_unique<SoftSpotLight>(
+      physx::PxTransform(physx::PxVec3{position[0], position[1], position[2]}),
+      physx::PxVec3{color[0], color[1], color[2]}, enableShadow,
+      physx::PxVec3{direction[0], direction[1], direction[2]}, fovOuter, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+IActiveLight *SoftScene::addActiveLight(physx::PxTransform const &pose,
+                                        std::array<float, 3> const &color, float fov,
+                                        std::string_view texPath, float shadowNear,
+                                        float shadowFar, uint32_t shadowMapSize) {
+  auto light = std::make_unique<SoftActiveLight>(
+      pose, physx::PxVec3{color[0], color[1], color[2]}, fov, texPath, shadowNear, shadowFar);
+  auto result = light.get();
+  mLights.push_back(std::move(light));
+  return result;
+}
+
+void SoftScene::removeLight(ILight *light) {
+  mLights.erase(std::remove_if(mLights.begin(), mLights.end(),
+                               [light](auto &l) { return l.get() == light; }),
+                mLights.end());
+}
+
+void SoftScene::updateRenderAndTakePictures(std::vector<ICamera *> const &cameras) {
+  for (auto camera : cameras) {
+    camera->takePicture();
+  }
+}
+
+void SoftScene::destroy() { mRenderer->removeScene(this); }
+
+void SoftScene::render(SoftCamera &camera) {
+  if (!camera.mBuffers) {
+    camera.mBuffers = std::make_unique<SoftRasterBuffers>();
+  }
+  auto &buffers = *camera.mBuffers;
+  auto &scheduler = TaskScheduler::Get();
+  int width = camera.mWidth;
+  int height = camera.mHeight;
+  Projection proj{camera.mFx,   camera.mFy,  camera.mCx, camera.mCy, camera.mSkew,
+                  camera.mNear, camera.mFar, width,      height};
+  auto view = camera.mPose.getInverse();
+
+  buffers.items.clear();
+  for (auto &body : mBodies) {
+    if (body->getVisibility() <= 0.f) {
+      continue;
+    }
+    auto modelView = view * body->getPose();
+    for (auto &shape : body->getShapes()) {
+      auto material = shape->getMaterial();
+      buffers.items.push_back({&shape->mesh(), modelView, body->getRenderScale(),
+                               material ? material->getBaseColor()
+                                        : std::array<float, 4>{1.f, 1.f, 1.f, 1.f},
+                               body->getUniqueId(), body->getSegmentationId(),
+                               body->getShadeFlat()});
+    }
+  }
+
+  // vertex stage, one task per shape
+  auto &items = buffers.items;
+  if (buffers.itemTriangles.size() < items.size()) {
+    buffers.itemTriangles.resize(items.size());
+  }
+  scheduler.parallelFor(
+      0, items.size(),
+      [&](int64_t i) { setupItem(items[i], i, proj, buffers.itemTriangles[i]); }, 1);
+
+  // binning over chunks of shapes with about the same number of triangles, the chunks keep the
+  // draw order so equal depths resolve the same way every time
+  size_t triangleCount = 0;
+  for (size_t i = 0; i < items.size(); ++i) {
+    triangleCount += buffers.itemTriangles[i].size();
+  }
+  size_t chunkCount = std::clamp<size_t>(triangleCount / 4096, 1,
+                                         4 * (scheduler.getWorkerCount() + 1));
+  std::vector<size_t> chunkStart{0};
+  size_t binned = 0;
+  for (size_t i = 0; i < items.size(); ++i) {
+    binned += buffers.itemTriangles[i].size();
+    if (binned * chunkCount >= triangleCount * chunkStart.size() && i + 1 < items.size()) {
+      chunkStart.push_back(i + 1);
+    }
+  }
+  chunkStart.push_back(items.size());
+  chunkCount = chunkStart.size() - 1;
+
+  int tilesX = (width + kTileSize - 1) / kTileSize;
+  int tilesY = (height + kTileSize - 1) / kTileSize;
+  int tileCount = tilesX * tilesY;
+  buffers.bins.resize(chunkCount);
+  scheduler.parallelFor(
+      0, chunkCount,
+      [&](int64_t chunk) {
+        auto &bins = buffers.bins[chunk];
+        bins.resize(tileCount);
+        for (auto &bin : bins) {
+          bin.clear();
+        }
+        for (size_t i = chunkStart[chunk]; i < chunkStart[chunk + 1]; ++i) {
+          for (auto &t : buffers.itemTriangles[i]) {
+            auto [minX, maxX] = std::minmax({t.x[0], t.x[1], t.x[2]});
+            auto [minY, maxY] = std::minmax({t.y[0], t.y[1], t.y[2]});
+            auto [x0, x1] = pixelRange(minX, maxX, width);
+            auto [y0, y1] = pixelRange(minY, maxY, height);
+            if (x0 >= x1 || y0 >= y1) {
+              continue;
+            }
+            for (int ty = y0 / kTileSize; ty <= (y1 - 1) / kTileSize; ++ty) {
+              for (int tx = x0 / kTileSize; tx <= (x1 - 1) / kTileSize; ++tx) {
+                bins[ty * tilesX + tx].push_back(&t);
+              }
+            }
+          }
+        }
+      },
+      1);
+
+  std::vector<ShadingLight> lights;
+  auto viewRotation = view.q;
+  for (auto &light : mLights) {
+    if (auto l = dynamic_cast<IDirectionalLight *>(light.get())) {
+      lights.push_back({{}, viewRotation.rotate(l->getDirection()).getNormalized(),
+                        l->getColor(), -1.f, true});
+    } else if (auto l = dynamic_cast<IPointLight *>(light.get())) {
+      lights.push_back({view.transform(l->getPosition()), {}, l->getColor(), -2.f, false});
+    } else if (auto l = dynamic_cast<ISpotLight *>(light.get())) {
+      lights.push_back({view.transform(l->getPosition()),
+                        viewRotation.rotate(l->getDirection()).getNormalized(), l->getColor(),
+                        std::cos(l->getFov() / 2.f), false});
+    } else if (auto l = dynamic_cast<IActiveLight *>(light.get())) {
+      auto pose = view * l->getPose();
+      lights.push_back({pose.p, pose.q.rotate({0.f, 0.f, -1.f}), l->getColor(),
+                        std::cos(l->getFov() / 2.f), false});
+    }
+  }
+  physx::PxVec3 ambient{mAmbientLight[0], mAmbientLight[1], mAmbientLight[2]};
+
+  size_t pixelCount = static_cast<size_t>(width) * height;
+  camera.mPosition.resize(pixelCount * 4);
+  camera.mSegmentation.resize(pixelCount * 4);
+  camera.mNormal.resize(pixelCount * 4);
+  camera.mAlbedo.resize(pixelCount * 4);
+  camera.mColor.resize(pixelCount * 4);
+  camera.mDepth.resize(pixelCount);
+
+  // Vulkan depth range of the projection
+  float depthScale = proj.far / (proj.far - proj.near);
+
+  scheduler.parallelFor(
+      0, tileCount,
+      [&](int64_t tileIndex) {
+        int tileX = (tileIndex % tilesX) * kTileSize;
+        int tileY = (tileIndex / tilesX) * kTileSize;
+        int tileW = std::min(kTileSize, width - tileX);
+        int tileH = std::min(kTileSize, height - tileY);
+
+        thread_local TileBuffer tile;
+        thread_local std::vector<Triangle const *> tileTriangles;
+        std::fill(std::begin(tile.depth), std::end(tile.depth), proj.far);
+        std::fill(std::begin(tile.triangle), std::end(tile.triangle), kNoTriangle);
+        tileTriangles.clear();
+        for (auto &bins : buffers.bins) {
+          for (auto triangle : bins[tileIndex]) {
+            rasterizeTriangle(*triangle, tileTriangles.size(), tileX, tileY, tileW, tileH, tile);
+            tileTriangles.push_back(triangle);
+          }
+        }
+
+        // attributes are resolved once per pixel for the visible triangle only
+        for (int y = 0; y < tileH; ++y) {
+          for (int x = 0; x < tileW; ++x) {
+            int i = y * kTileSize + x;
+            size_t p = static_cast<size_t>(tileY + y) * width + tileX + x;
+            float *position = &camera.mPosition[4 * p];
+            uint32_t *segmentation = &camera.mSegmentation[4 * p];
+            float *normal = &camera.mNormal[4 * p];
+            float *albedo = &camera.mAlbedo[4 * p];
+            float *color = &camera.mColor[4 * p];
+            uint32_t index = tile.triangle[i];
+            if (index == kNoTriangle) {
+              std::fill(position, position + 4, 0.f);
+              position[3] = 1.f;
+              std::fill(segmentation, segmentation + 4, 0u);
+              std::fill(normal, normal + 4, 0.f);
+              std::fill(albedo, albedo + 4, 0.f);
+              std::fill(color, color + 4, 0.f);
+              camera.mDepth[p] = 0.f;
+              continue;
+            }
+
+            auto &t = *tileTriangles[index];
+            auto &item = items[t.item];
+            float w1 = tile.weight1[i];
+            float w2 = tile.weight2[i];
+            float w0 = 1.f - w1 - w2;
+            float z = tile.depth[i];
+            auto pos = t.position[0] * w0 + t.position[1] * w1 + t.position[2] * w2;
+            auto n = (t.normal[0] * w0 + t.normal[1] * w1 + t.normal[2] * w2).getNormalized();
+
+            physx::PxVec3 light = ambient;
+            for (auto &l : lights) {
+              if (l.directional) {
+                light += l.color * std::max(0.f, -n.dot(l.direction));
+                continue;
+              }
+              auto toLight = l.position - pos;
+              float distance2 = toLight.magnitudeSquared();
+              toLight *= 1.f / std::sqrt(distance2);
+              if (-toLight.dot(l.direction) < l.cosCutoff) {
+                continue;
+              }
+              light += l.color * (std::max(0.f, n.dot(toLight)) / distance2);
+            }
+
+            position[0] = pos.x;
+            position[1] = pos.y;
+            position[2] = pos.z;
+            position[3] = depthScale * (z - proj.near) / z;
+            segmentation[0] = item.uniqueId;
+            segmentation[1] = item.segmentationId;
+            segmentation[2] = 0;
+            segmentation[3] = 0;
+            normal[0] = n.x;
+            normal[1] = n.y;
+            normal[2] = n.z;
+            normal[3] = 0.f;
+            std::copy(item.color.begin(), item.color.end(), albedo);
+            color[0] = item.color[0] * light.x;
+            color[1] = item.color[1] * light.y;
+            color[2] = item.color[2] * light.z;
+            color[3] = item.color[3];
+            camera.mDepth[p] = z;
+          }
+        }
+      },
+      1);
+}
+
+//========== Renderer ==========//
+SoftRenderer::SoftRenderer()
+    : mCube(createCube()), mSphere(createSphere(32, 16)), mPlane(createYZPlane()) {}
+
+IPxrScene *SoftRenderer::createScene(std::string const &name) {
+  mScenes.push_back(std::make_unique<SoftScene>(this, name));
+  return mScenes.back().get();
+}
+
+void SoftRenderer::removeScene(IPxrScene *scene) {
+  mScenes.erase(std::remove_if(mScenes.begin(), mScenes.end(),
+                               [scene](auto &s) { return s.get() == scene; }),
+                mScenes.end());
+}
+
+std::shared_ptr<IPxrMaterial> SoftRenderer::createMaterial() {
+  return std::make_shared<SoftMaterial>();
+}
+
+std::shared_ptr<IRenderMesh> SoftRenderer::createMesh(std::vector<float> const &vertices,
+                                                      std::vector<uint32_t> const &indices) {
+  return std::make_shared<SoftMesh>(vertices, std::vector<float>{}, indices);
+}
+
+std::shared_ptr<SoftMesh> SoftRenderer::getPrimitiveMesh(physx::PxGeometryType::Enum type,
+                                                         physx::PxVec3 const &scale) {
+  switch (type) {
+  case physx::PxGeometryType::eBOX:
+    return mCube;
+  case physx::PxGeometryType::eSPHERE:
+    return mSphere;
+  case physx::PxGeometryType::ePLANE:
+    return mPlane;
+  case physx::PxGeometryType::eCAPSULE:
+    return createCapsule(scale.y, scale.x, 32, 8);
+  default:
+    throw std::runtime_error("failed to add rigidbody: unsupported render body type");
+  }
+}
+
+std::vector<std::shared_ptr<SoftShape>> SoftRenderer::loadFile(std::string const &filename) {
+  std::lock_guard lock(mFileMutex);
+  auto it = mFiles.find(filename);
+  if (it == mFiles.end()) {
+    Assimp::Importer importer;
+    uint32_t flags = aiProcess_Triangulate | aiProcess_PreTransformVertices | aiProcess_GenNormals;
+    const aiScene *scene = importer.ReadFile(filename, flags);
+    if (!scene) {
+      throw std::runtime_error("failed to load mesh file " + filename + ": " +
+                               importer.GetErrorString());
+    }
+    std::vector<std::pair<std::shared_ptr<SoftMesh>, std::array<float, 4>>> meshes;
+    for (uint32_t i = 0; i < scene->mNumMeshes; ++i) {
+      auto mesh = scene->mMeshes[i];
+      std::vector<float> vertices;
+      std::vector<float> normals;
+      std::vector<uint32_t> indices;
+      for (uint32_t v = 0; v < mesh->mNumVertices; ++v) {
+        vertices.insert(vertices.end(),
+                        {mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z});
+        if (mesh->HasNormals()) {
+          normals.insert(normals.end(),
+                         {mesh->mNormals[v].x, mesh->mNormals[v].y, mesh->mNormals[v].z});
+        }
+      }
+      for (uint32_t f = 0; f < mesh->mNumFaces; ++f) {
+        if (mesh->mFaces[f].mNumIndices == 3) {
+          indices.insert(indices.end(), mesh->mFaces[f].mIndices, mesh->mFaces[f].mIndices + 3);
+        }
+      }
+      std::array<float, 4> color{1.f, 1.f, 1.f, 1.f};
+      aiColor4D diffuse;
+      if (scene->mMaterials[mesh->mMaterialIndex]->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse) ==
+          AI_SUCCESS) {
+        color = {diffuse.r, diffuse.g, diffuse.b, diffuse.a};
+      }
+      meshes.push_back({std::make_shared<SoftMesh>(vertices, normals, indices), color});
+    }
+    it = mFiles.emplace(filename, std::move(meshes)).first;
+  }
+
+  std::vector<std::shared_ptr<SoftShape>> shapes;
+  for (auto &[mesh, color] : it->second) {
+    auto material = createMaterial();
+    material->setBaseColor(color);
+    shapes.push_back(std::make_shared<SoftShape>(mesh, material));
+  }
+  return shapes;
+}
+
+} // namespace Renderer
+} // namespace sapien
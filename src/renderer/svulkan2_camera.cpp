@@ -72,7 +72,7 @@ void SVulkan2Camera::takePicture() {
 
 #ifdef SAPIEN_DLPACK
 std::shared_ptr<IAwaitable<std::vector<DLManagedTensor *>>>
-SVulkan2Camera::takePictureAndGetDLTensorsAsync(ThreadPool &thread,
+SVulkan2Camera::takePictureAndGetDLTensorsAsync(TaskQueue &thread,
                                                 std::vector<std::string> const &names) {
   auto context = mScene->getParentRenderer()->getContext();
   mFrameCounter++;
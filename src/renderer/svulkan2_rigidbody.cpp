@@ -97,6 +97,14 @@ bool SVulkan2Rigidbody::getShadeFlat() { return mObjects.at(0)->getShadeFlat();
 
 physx::PxVec3 SVulkan2Rigidbody::getScale() const { return mScale; }
 
+void SVulkan2Rigidbody::rescale(float factor) {
+  for (auto obj : mObjects) {
+    obj->setScale(obj->getScale() * factor);
+  }
+  mInitialPose.p *= factor;
+  mScale *= factor;
+}
+
 std::vector<std::shared_ptr<IPxrRenderShape>> SVulkan2Rigidbody::getRenderShapes() {
   auto objects = getVisualObjects();
   std::vector<std::shared_ptr<IPxrRenderShape>> result;
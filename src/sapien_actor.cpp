@@ -21,7 +21,10 @@ EActorType SActor::getType() const {
                                                                         : EActorType::DYNAMIC;
 }
 
-void SActor::setPose(PxTransform const &pose) { getPxActor()->setGlobalPose(pose); }
+void SActor::setPose(PxTransform const &pose) {
+  getPxActor()->setGlobalPose(pose);
+  markPoseChanged();
+}
 
 void SActor::setKinematicTarget(PxTransform const &pose) { mActor->setKinematicTarget(pose); }
 PxTransform SActor::getKinematicTarget() const {
@@ -33,8 +36,14 @@ PxTransform SActor::getKinematicTarget() const {
       "Failed to get kinematic target. No target set or actor is not kinematic.");
 }
 
-void SActor::setVelocity(PxVec3 const &v) { getPxActor()->setLinearVelocity(v); }
-void SActor::setAngularVelocity(PxVec3 const &v) { getPxActor()->setAngularVelocity(v); }
+void SActor::setVelocity(PxVec3 const &v) {
+  getPxActor()->setLinearVelocity(v);
+  markPoseChanged();
+}
+void SActor::setAngularVelocity(PxVec3 const &v) {
+  getPxActor()->setAngularVelocity(v);
+  markPoseChanged();
+}
 void SActor::lockMotion(bool x, bool y, bool z, bool ax, bool ay, bool az) {
   auto flags = PxRigidDynamicLockFlags();
   if (x) {
@@ -118,6 +127,7 @@ void SActor::unpackData(std::vector<PxReal> const &data) {
     getPxActor()->setGlobalPose(
         {{data[0], data[1], data[2]}, {data[3], data[4], data[5], data[6]}});
   }
+  markPoseChanged();
 }
 
 SActorStatic::SActorStatic(PxRigidStatic *actor, physx_id_t id, SScene *scene,
@@ -131,7 +141,10 @@ PxRigidActor *SActorStatic::getPxActor() const { return mActor; }
 
 void SActorStatic::destroy() { mParentScene->removeActor(this); }
 
-void SActorStatic::setPose(PxTransform const &pose) { getPxActor()->setGlobalPose(pose); }
+void SActorStatic::setPose(PxTransform const &pose) {
+  getPxActor()->setGlobalPose(pose);
+  markPoseChanged();
+}
 
 std::vector<PxReal> SActorStatic::packData() {
   std::vector<PxReal> data;
@@ -154,6 +167,7 @@ void SActorStatic::unpackData(std::vector<PxReal> const &data) {
     return;
   }
   getPxActor()->setGlobalPose({{data[0], data[1], data[2]}, {data[3], data[4], data[5], data[6]}});
+  markPoseChanged();
 }
 
 } // namespace sapien
@@ -24,6 +24,8 @@ std::vector<Renderer::IPxrRigidbody *> SActorBase::getCollisionBodies() {
 
 void SActorBase::renderCollisionBodies(bool collision) {
   collisionRender = collision;
+  // collision bodies of a resting actor have not been updated
+  markPoseChanged();
   for (auto body : mRenderBodies) {
     body->setVisibility((!collision) * mDisplayVisibility);
   }
@@ -35,6 +37,7 @@ void SActorBase::renderCollisionBodies(bool collision) {
 bool SActorBase::isRenderingCollision() const { return collisionRender; }
 
 void SActorBase::hideVisual() {
+  mHidden = true;
   for (auto body : mRenderBodies) {
     body->setVisible(false);
   }
@@ -43,6 +46,7 @@ void SActorBase::hideVisual() {
   }
 }
 void SActorBase::unhideVisual() {
+  mHidden = false;
   for (auto body : mRenderBodies) {
     body->setVisibility(mDisplayVisibility);
   }
@@ -56,6 +60,8 @@ void SActorBase::prestep() {
   EventEmitter<EventActorStep>::emit(s);
 }
 
+void SActorBase::markPoseChanged() { mParentScene->markActorMoved(this); }
+
 void SActorBase::updateRender(PxTransform const &pose) {
   for (auto body : mRenderBodies) {
     body->update(pose);
@@ -101,6 +107,19 @@ SActorBase::SActorBase(physx_id_t id, SScene *scene,
     : SEntity(scene), mId(id), mParentScene(scene), mRenderBodies(renderBodies),
       mCollisionBodies(collisionBodies) {}
 
+void SActorBase::rescale(PxReal factor) {
+  for (auto &shape : mCollisionShapes) {
+    shape->rescale(factor);
+  }
+  for (auto body : mRenderBodies) {
+    body->rescale(factor);
+  }
+  for (auto body : mCollisionBodies) {
+    body->rescale(factor);
+  }
+  mScale *= factor;
+}
+
 PxTransform SActorBase::getPose() const { return getPxActor()->getGlobalPose(); }
 
 PxVec3 SActorDynamicBase::getVelocity() { return getPxActor()->getLinearVelocity(); }
@@ -134,4 +153,16 @@ bool SActorDynamicBase::getCCDEnabled() const {
   return getPxActor()->getRigidBodyFlags() | PxRigidBodyFlag::eENABLE_CCD;
 }
 
+void SActorDynamicBase::rescale(PxReal factor) {
+  SActorBase::rescale(factor);
+  // uniform density: mass grows with volume, inertia with volume times area
+  auto actor = getPxActor();
+  auto cmass = actor->getCMassLocalPose();
+  cmass.p *= factor;
+  actor->setCMassLocalPose(cmass);
+  actor->setMass(actor->getMass() * factor * factor * factor);
+  actor->setMassSpaceInertiaTensor(actor->getMassSpaceInertiaTensor() * factor * factor * factor *
+                                   factor * factor);
+}
+
 } // namespace sapien
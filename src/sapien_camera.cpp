@@ -30,11 +30,17 @@ void SCamera::setParent(SActorBase *actor, bool keepPose) {
   }
 }
 
-void SCamera::update() {
+void SCamera::update() { updateRender(updatePose()); }
+
+PxTransform SCamera::updatePose() {
   mPose = getParentPose() * mLocalPose;
+  return mPose;
+}
+
+void SCamera::updateRender(PxTransform const &pose) {
   if (mCamera) {
     static PxTransform gl2ros({0, 0, 0}, {-0.5, 0.5, 0.5, -0.5});
-    mCamera->setPose(mPose * gl2ros);
+    mCamera->setPose(pose * gl2ros);
   }
 }
 
@@ -47,9 +47,11 @@ void SLight::setParent(SActorBase *actor, bool keepPose) {
   }
 }
 
-void SLight::update() {
+void SLight::update() { updateRender(getPose()); }
+
+void SLight::updateRender(PxTransform const &pose) {
   static PxTransform gl2ros({0, 0, 0}, {-0.5, 0.5, 0.5, -0.5});
-  getRendererLight()->setPose(getParentPose() * mLocalPose * gl2ros);
+  getRendererLight()->setPose(pose * gl2ros);
 }
 
 } // namespace sapien
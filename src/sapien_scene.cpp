@@ -7,6 +7,7 @@
 #include "sapien/articulation/sapien_kinematic_joint.h"
 #include "sapien/articulation/sapien_link.h"
 #include "sapien/articulation/urdf_loader.h"
+#include "sapien/broadphase_region_manager.h"
 #include "sapien/filter_shader.h"
 #include "sapien/renderer/render_interface.h"
 #include "sapien/sapien_actor.h"
@@ -14,6 +15,7 @@
 #include "sapien/sapien_drive.h"
 #include "sapien/sapien_entity_particle.h"
 #include "sapien/sapien_gear.h"
+#include "sapien/sapien_shape.h"
 #include "sapien/simulation.h"
 #include <algorithm>
 #include <spdlog/spdlog.h>
@@ -22,11 +24,38 @@
 
 namespace sapien {
 
+namespace {
+
+/** runs the PhysX tasks of a step on the task scheduler, allocations go to the scene arena */
+class TaskSchedulerCpuDispatcher : public PxCpuDispatcher {
+public:
+  TaskSchedulerCpuDispatcher(uint32_t workerCount, ArenaAllocator::Arena *arena)
+      : mWorkerCount(workerCount), mArena(arena) {}
+
+  void submitTask(PxBaseTask &task) override {
+    TaskScheduler::Get().spawn([arena = mArena, &task]() {
+      ArenaAllocator::Scope allocationScope(arena);
+      task.run();
+      task.release();
+    });
+  }
+
+  uint32_t getWorkerCount() const override { return mWorkerCount; }
+
+private:
+  uint32_t mWorkerCount;
+  ArenaAllocator::Arena *mArena;
+};
+
+} // namespace
+
 /************************************************
  * Basic
  ***********************************************/
 SScene::SScene(std::shared_ptr<Simulation> sim, SceneConfig const &config)
     : mSimulationShared(sim), mSimulationCallback(this), mRendererScene(nullptr), mConfig(config) {
+  mArena = ArenaAllocator::Get().createArena("scene");
+  ArenaAllocator::Scope allocationScope(mArena);
 
   PxSceneDesc sceneDesc(sim->mPhysicsSDK->getTolerancesScale());
   sceneDesc.gravity = PxVec3({config.gravity.x(), config.gravity.y(), config.gravity.z()});
@@ -34,6 +63,21 @@ SScene::SScene(std::shared_ptr<Simulation> sim, SceneConfig const &config)
   sceneDesc.solverType = config.enableTGS ? PxSolverType::eTGS : PxSolverType::ePGS;
   sceneDesc.bounceThresholdVelocity = config.bounceThreshold;
 
+  if (config.broadPhase == "sap") {
+    sceneDesc.broadPhaseType = PxBroadPhaseType::eSAP;
+  } else if (config.broadPhase == "abp") {
+    sceneDesc.broadPhaseType = PxBroadPhaseType::eABP;
+  } else if (config.broadPhase == "mbp") {
+    sceneDesc.broadPhaseType = PxBroadPhaseType::eMBP;
+    mBroadPhaseRegions = std::make_unique<BroadPhaseRegionManager>(
+        PxBounds3({config.mbpWorldLower.x(), config.mbpWorldLower.y(), config.mbpWorldLower.z()},
+                  {config.mbpWorldUpper.x(), config.mbpWorldUpper.y(), config.mbpWorldUpper.z()}),
+        config.mbpSubdivisions);
+    sceneDesc.broadPhaseCallback = mBroadPhaseRegions.get();
+  } else {
+    throw std::runtime_error("invalid broadphase type: " + config.broadPhase);
+  }
+
   PxSceneFlags sceneFlags;
   if (config.enableEnhancedDeterminism) {
     sceneFlags |= PxSceneFlag::eENABLE_ENHANCED_DETERMINISM;
@@ -50,16 +94,27 @@ SScene::SScene(std::shared_ptr<Simulation> sim, SceneConfig const &config)
   if (config.enableAdaptiveForce) {
     sceneFlags |= PxSceneFlag::eADAPTIVE_FORCE;
   }
+  // updateRender and packSceneIncremental only visit the bodies PhysX moved
+  sceneFlags |= PxSceneFlag::eENABLE_ACTIVE_ACTORS;
   sceneDesc.flags = sceneFlags;
 
-  mCpuDispatcher = PxDefaultCpuDispatcherCreate(0);
-  if (!mCpuDispatcher) {
-    spdlog::get("SAPIEN")->critical("Failed to create PhysX CPU dispatcher");
-    throw std::runtime_error("Scene Creation Failed");
+  if (sim->getThreadCount() > 0) {
+    mTaskDispatcher = std::make_unique<TaskSchedulerCpuDispatcher>(
+        std::min(sim->getThreadCount(), TaskScheduler::Get().getWorkerCount()), mArena);
+    sceneDesc.cpuDispatcher = mTaskDispatcher.get();
+  } else {
+    mCpuDispatcher = PxDefaultCpuDispatcherCreate(0);
+    if (!mCpuDispatcher) {
+      spdlog::get("SAPIEN")->critical("Failed to create PhysX CPU dispatcher");
+      throw std::runtime_error("Scene Creation Failed");
+    }
+    sceneDesc.cpuDispatcher = mCpuDispatcher;
   }
-  sceneDesc.cpuDispatcher = mCpuDispatcher;
 
   mPxScene = mSimulationShared->mPhysicsSDK->createScene(sceneDesc);
+  if (mBroadPhaseRegions) {
+    mBroadPhaseRegions->attach(mPxScene);
+  }
 
   // default parameters for physical materials, contact solver, etc.
   mDefaultMaterial =
@@ -79,41 +134,77 @@ SScene::SScene(std::shared_ptr<Simulation> sim, SceneConfig const &config)
 }
 
 SScene::~SScene() {
-  mDefaultMaterial.reset();
-
-  for (auto &actor : mActors) {
-    actor->getPxActor()->release();
-  }
-  for (auto &articulation : mArticulations) {
-    articulation->getPxArticulation()->release();
-  }
-  for (auto &ka : mKinematicArticulations) {
-    for (auto &link : ka->getBaseLinks()) {
-      link->getPxActor()->release();
+  mRunnerQueue.wait();
+  mRenderQueue.wait();
+  {
+    // the scope must close before the arena is released, releasing may delete it
+    ArenaAllocator::Scope allocationScope(mArena);
+    mDefaultMaterial.reset();
+
+    for (auto &actor : mActors) {
+      actor->getPxActor()->release();
     }
-  }
-  for (auto &drive : mDrives) {
-    drive->getPxJoint()->release();
-  }
-  for (auto &gear : mGears) {
-    gear->mGearJoint->release();
-  }
-  mPxScene->release();
+    for (auto &articulation : mArticulations) {
+      articulation->getPxArticulation()->release();
+    }
+    for (auto &ka : mKinematicArticulations) {
+      for (auto &link : ka->getBaseLinks()) {
+        link->getPxActor()->release();
+      }
+    }
+    for (auto &drive : mDrives) {
+      drive->getPxJoint()->release();
+    }
+    for (auto &gear : mGears) {
+      gear->mGearJoint->release();
+    }
+    for (auto &[tag, actors] : mParkedActors) {
+      for (auto &actor : actors) {
+        actor->getPxActor()->release();
+      }
+    }
+    for (auto &[tag, articulations] : mParkedArticulations) {
+      for (auto &articulation : articulations) {
+        articulation->getPxArticulation()->release();
+      }
+    }
+    for (auto &[actor, aggregate] : mActorAggregates) {
+      aggregate->release();
+    }
+    for (auto &[articulation, aggregate] : mArticulationAggregates) {
+      aggregate->release();
+    }
+    mPxScene->release();
 
-  // TODO: check whether we implement mXXX.release() to replace the workaround
-  mActors.clear();
-  mArticulations.clear();
-  mKinematicArticulations.clear();
+    // TODO: check whether we implement mXXX.release() to replace the workaround
+    mActors.clear();
+    mArticulations.clear();
+    mKinematicArticulations.clear();
+    mParkedActors.clear();
+    mParkedArticulations.clear();
 
-  if (mRendererScene) {
-    mSimulationShared->getRenderer()->removeScene(mRendererScene);
-  }
+    if (mRendererScene) {
+      mSimulationShared->getRenderer()->removeScene(mRendererScene);
+    }
 
-  mCpuDispatcher->release();
+    if (mCpuDispatcher) {
+      mCpuDispatcher->release();
+    }
+  }
+  ArenaAllocator::Get().releaseArena(mArena);
   // Finally, release the shared pointer to simulation
   mSimulationShared.reset();
 }
 
+void SScene::setName(std::string const &name) {
+  mName = name;
+  ArenaAllocator::Get().setArenaName(mArena, name);
+}
+
+ArenaMemoryStats SScene::getMemoryStats() const {
+  return ArenaAllocator::Get().getArenaStats(mArena);
+}
+
 /************************************************
  * Create objects
  ***********************************************/
@@ -137,6 +228,7 @@ std::unique_ptr<URDF::URDFLoader> SScene::createURDFLoader() {
 
 SDrive6D *SScene::createDrive(SActorBase *actor1, PxTransform const &pose1, SActorBase *actor2,
                               PxTransform const &pose2) {
+  ArenaAllocator::Scope allocationScope(mArena);
   mDrives.push_back(std::unique_ptr<SDrive6D>(new SDrive6D(this, actor1, pose1, actor2, pose2)));
   auto drive = mDrives.back().get();
   wakeUpActor(actor1);
@@ -146,32 +238,118 @@ SDrive6D *SScene::createDrive(SActorBase *actor1, PxTransform const &pose1, SAct
 
 SGear *SScene::createGear(SActorDynamicBase *actor1, PxTransform const &pose1,
                           SActorDynamicBase *actor2, PxTransform const &pose2) {
+  ArenaAllocator::Scope allocationScope(mArena);
   mGears.push_back(std::make_unique<SGear>(this, actor1, pose1, actor2, pose2));
   return mGears.back().get();
 }
 
-void SScene::addActor(std::unique_ptr<SActorBase> actor) {
-  mPxScene->addActor(*actor->getPxActor());
+void SScene::addActor(std::unique_ptr<SActorBase> actor, bool aggregate) {
+  ArenaAllocator::Scope allocationScope(mArena);
+  if (aggregate) {
+    // shapes of one actor never collide with each other
+    auto pxAggregate = mSimulationShared->mPhysicsSDK->createAggregate(1, false);
+    pxAggregate->addActor(*actor->getPxActor());
+    mPxScene->addAggregate(*pxAggregate);
+    mActorAggregates[actor.get()] = pxAggregate;
+  } else {
+    mPxScene->addActor(*actor->getPxActor());
+  }
+  if (mBroadPhaseRegions) {
+    mBroadPhaseRegions->include(*actor->getPxActor());
+  }
   mActorId2Actor[actor->getId()] = actor.get();
+  markActorMoved(actor.get());
   mActors.push_back(std::move(actor));
 }
 
-void SScene::addArticulation(std::unique_ptr<SArticulation> articulation) {
+/** whether any 2 links not connected by a joint may collide according to their collision groups */
+static bool hasSelfCollision(SArticulation &articulation) {
+  auto links = articulation.getSLinks();
+  std::vector<std::vector<bool>> adjacent(links.size(), std::vector<bool>(links.size(), false));
+  for (auto joint : articulation.getSJoints()) {
+    if (joint->getParentLink()) {
+      auto p = joint->getParentLink()->getIndex();
+      auto c = joint->getChildLink()->getIndex();
+      adjacent[p][c] = adjacent[c][p] = true;
+    }
+  }
+  for (size_t i = 0; i < links.size(); ++i) {
+    for (size_t j = i + 1; j < links.size(); ++j) {
+      if (adjacent[i][j]) {
+        continue;
+      }
+      for (auto s0 : links[i]->getCollisionShapes()) {
+        for (auto s1 : links[j]->getCollisionShapes()) {
+          if (collisionGroupsMayCollide(s0->getPxShape()->getSimulationFilterData(),
+                                        s1->getPxShape()->getSimulationFilterData())) {
+            return true;
+          }
+        }
+      }
+    }
+  }
+  return false;
+}
+
+void SScene::addArticulation(std::unique_ptr<SArticulation> articulation, bool aggregate) {
+  ArenaAllocator::Scope allocationScope(mArena);
   for (auto link : articulation->getBaseLinks()) {
     mActorId2Link[link->getId()] = link;
+    markActorMoved(link);
+  }
+  PxAggregate *pxAggregate{};
+  if (aggregate) {
+    // the self-collision flag is fixed here, PhysX cannot change it on an existing aggregate
+    pxAggregate = mSimulationShared->mPhysicsSDK->createAggregate(
+        articulation->getBaseLinks().size(), hasSelfCollision(*articulation));
+    if (!pxAggregate) {
+      spdlog::get("SAPIEN")->warn("Failed to create aggregate for an articulation of {} links, "
+                                  "adding it without aggregate.",
+                                  articulation->getBaseLinks().size());
+    }
+  }
+  if (pxAggregate) {
+    pxAggregate->addArticulation(*articulation->getPxArticulation());
+    mPxScene->addAggregate(*pxAggregate);
+    mArticulationAggregates[articulation.get()] = pxAggregate;
+  } else {
+    mPxScene->addArticulation(*articulation->getPxArticulation());
+  }
+  if (mBroadPhaseRegions) {
+    for (auto link : articulation->getBaseLinks()) {
+      mBroadPhaseRegions->include(*link->getPxActor());
+    }
   }
-  mPxScene->addArticulation(*articulation->getPxArticulation());
   mArticulations.push_back(std::move(articulation));
 }
 
 void SScene::addKinematicArticulation(std::unique_ptr<SKArticulation> articulation) {
+  ArenaAllocator::Scope allocationScope(mArena);
   for (auto link : articulation->getBaseLinks()) {
     mActorId2Link[link->getId()] = link;
+    markActorMoved(link);
     mPxScene->addActor(*link->getPxActor());
+    if (mBroadPhaseRegions) {
+      mBroadPhaseRegions->include(*link->getPxActor());
+    }
   }
   mKinematicArticulations.push_back(std::move(articulation));
 }
 
+void SScene::updateBroadPhaseRegions() {
+  if (mBroadPhaseRegions) {
+    mBroadPhaseRegions->update();
+  }
+}
+
+uint32_t SScene::getBroadPhaseRegionCount() const {
+  return mBroadPhaseRegions ? mBroadPhaseRegions->getRegionCount() : 0;
+}
+
+PxBounds3 SScene::getBroadPhaseWorldBounds() const {
+  return mBroadPhaseRegions ? mBroadPhaseRegions->getWorldBounds() : PxBounds3::empty();
+}
+
 void SScene::removeCleanUp() {
   // advance the destroyed stage to 2
 
@@ -187,7 +365,16 @@ void SScene::removeCleanUp() {
     // release actors
     for (auto &a : mActors) {
       if (a->getDestroyedState() == 1) {
+        forgetMovedActor(a.get());
         a->getPxActor()->userData = nullptr;
+        auto it = mActorAggregates.find(a.get());
+        if (it != mActorAggregates.end()) {
+          mPxScene->removeAggregate(*it->second);
+          a->getPxActor()->release();
+          it->second->release();
+          mActorAggregates.erase(it);
+          continue;
+        }
         mPxScene->removeActor(*a->getPxActor());
         // a->setDestroyedState(2);
         a->getPxActor()->release();
@@ -199,10 +386,20 @@ void SScene::removeCleanUp() {
       if (a->getDestroyedState() == 1) {
 
         for (auto l : a->getSLinks()) {
+          forgetMovedActor(l);
           l->getPxActor()->userData = nullptr;
         }
         a->getPxArticulation()->userData = nullptr;
 
+        auto it = mArticulationAggregates.find(a.get());
+        if (it != mArticulationAggregates.end()) {
+          mPxScene->removeAggregate(*it->second);
+          a->getPxArticulation()->release();
+          it->second->release();
+          mArticulationAggregates.erase(it);
+          continue;
+        }
+
         mPxScene->removeArticulation(*a->getPxArticulation());
         // a->setDestroyedState(2);
 
@@ -214,6 +411,7 @@ void SScene::removeCleanUp() {
     for (auto &a : mKinematicArticulations) {
       if (a->getDestroyedState() == 1) {
         for (auto l : a->getBaseLinks()) {
+          forgetMovedActor(l);
           l->getPxActor()->userData = nullptr;
           mPxScene->removeActor(*l->getPxActor());
           // l->setDestroyedState(2);
@@ -236,19 +434,7 @@ void SScene::removeCleanUp() {
   }
 }
 
-void SScene::removeActor(SActorBase *actor) {
-  if (actor->isBeingDestroyed()) {
-    return;
-  }
-  mRequiresRemoveCleanUp = true;
-  // predestroy event
-  EventActorPreDestroy e;
-  e.actor = actor;
-  actor->EventEmitter<EventActorPreDestroy>::emit(e);
-
-  mActorId2Actor.erase(actor->getId());
-
-  // remove drives
+void SScene::removeDrivesAndGears(SActorBase *actor) {
   for (auto it = mDrives.begin(); it != mDrives.end();) {
     if ((*it)->getActor1() == actor || (*it)->getActor2() == actor) {
       wakeUpActor((*it)->getActor1());
@@ -270,6 +456,40 @@ void SScene::removeActor(SActorBase *actor) {
       ++it;
     }
   }
+}
+
+void SScene::removeActor(SActorBase *actor) {
+  if (actor->isBeingDestroyed()) {
+    return;
+  }
+  // a parked actor is only in the pool, release it there
+  for (auto &[tag, actors] : mParkedActors) {
+    auto it = std::find_if(actors.begin(), actors.end(),
+                           [=](auto &a) { return a.get() == actor; });
+    if (it == actors.end()) {
+      continue;
+    }
+    EventActorPreDestroy e;
+    e.actor = actor;
+    actor->EventEmitter<EventActorPreDestroy>::emit(e);
+    removeParkedCameras(actor);
+    releaseParkedActor(actor);
+    actors.erase(it);
+    return;
+  }
+  waitForRenderSnapshots();
+  mRequiresRemoveCleanUp = true;
+  // predestroy event
+  EventActorPreDestroy e;
+  e.actor = actor;
+  actor->EventEmitter<EventActorPreDestroy>::emit(e);
+
+  mActorId2Actor.erase(actor->getId());
+  forgetMovedActor(actor);
+  forgetSnapshotEntity(actor);
+
+  // remove drives
+  removeDrivesAndGears(actor);
 
   // remove camera
   removeCameraByParent(actor);
@@ -291,6 +511,26 @@ void SScene::removeArticulation(SArticulation *articulation) {
   if (articulation->isBeingDestroyed()) {
     return;
   }
+  for (auto &[tag, articulations] : mParkedArticulations) {
+    auto it = std::find_if(articulations.begin(), articulations.end(),
+                           [=](auto &a) { return a.get() == articulation; });
+    if (it == articulations.end()) {
+      continue;
+    }
+    EventArticulationPreDestroy e;
+    e.articulation = articulation;
+    articulation->EventEmitter<EventArticulationPreDestroy>::emit(e);
+    for (auto link : articulation->getBaseLinks()) {
+      EventActorPreDestroy e;
+      e.actor = link;
+      link->EventEmitter<EventActorPreDestroy>::emit(e);
+      removeParkedCameras(link);
+    }
+    releaseParkedArticulation(articulation);
+    articulations.erase(it);
+    return;
+  }
+  waitForRenderSnapshots();
   mRequiresRemoveCleanUp = true;
 
   EventArticulationPreDestroy e;
@@ -304,26 +544,7 @@ void SScene::removeArticulation(SArticulation *articulation) {
     link->EventEmitter<EventActorPreDestroy>::emit(e);
 
     // remove drives
-    for (auto it = mDrives.begin(); it != mDrives.end();) {
-      if ((*it)->getActor1() == link || (*it)->getActor2() == link) {
-        wakeUpActor((*it)->getActor1());
-        wakeUpActor((*it)->getActor2());
-        (*it)->getPxJoint()->release();
-        it = mDrives.erase(it);
-      } else {
-        ++it;
-      }
-    }
-    for (auto it = mGears.begin(); it != mGears.end();) {
-      if ((*it)->getActor1() == link || (*it)->getActor2() == link) {
-        wakeUpActor((*it)->getActor1());
-        wakeUpActor((*it)->getActor2());
-        (*it)->getGearJoint()->release();
-        it = mGears.erase(it);
-      } else {
-        ++it;
-      }
-    }
+    removeDrivesAndGears(link);
 
     // remove camera
     removeCameraByParent(link);
@@ -340,6 +561,8 @@ void SScene::removeArticulation(SArticulation *articulation) {
 
     // remove reference
     mActorId2Link.erase(link->getId());
+    forgetMovedActor(link);
+    forgetSnapshotEntity(link);
   }
 
   // mark removed
@@ -350,6 +573,7 @@ void SScene::removeKinematicArticulation(SKArticulation *articulation) {
   if (articulation->isBeingDestroyed()) {
     return;
   }
+  waitForRenderSnapshots();
   mRequiresRemoveCleanUp = true;
 
   EventArticulationPreDestroy e;
@@ -363,27 +587,7 @@ void SScene::removeKinematicArticulation(SKArticulation *articulation) {
     link->EventEmitter<EventActorPreDestroy>::emit(e);
 
     // remove drives
-    for (auto it = mDrives.begin(); it != mDrives.end();) {
-      if ((*it)->getActor1() == link || (*it)->getActor2() == link) {
-        wakeUpActor((*it)->getActor1());
-        wakeUpActor((*it)->getActor2());
-        (*it)->getPxJoint()->release();
-        it = mDrives.erase(it);
-      } else {
-        ++it;
-      }
-    }
-
-    for (auto it = mGears.begin(); it != mGears.end();) {
-      if ((*it)->getActor1() == link || (*it)->getActor2() == link) {
-        wakeUpActor((*it)->getActor1());
-        wakeUpActor((*it)->getActor2());
-        (*it)->getGearJoint()->release();
-        it = mGears.erase(it);
-      } else {
-        ++it;
-      }
-    }
+    removeDrivesAndGears(link);
 
     // remove camera
     removeCameraByParent(link);
@@ -399,6 +603,8 @@ void SScene::removeKinematicArticulation(SKArticulation *articulation) {
 
     // remove reference
     mActorId2Link.erase(link->getId());
+    forgetMovedActor(link);
+    forgetSnapshotEntity(link);
 
     // remove actor
     mPxScene->removeActor(*link->getPxActor());
@@ -407,6 +613,277 @@ void SScene::removeKinematicArticulation(SKArticulation *articulation) {
   articulation->markDestroyed();
 }
 
+// parking hides the bodies without changing isHidingVisual, which tells unparking what to restore
+static void hideParkedVisual(SActorBase *actor) {
+  for (auto body : actor->getRenderBodies()) {
+    body->setVisible(false);
+  }
+  for (auto body : actor->getCollisionBodies()) {
+    body->setVisible(false);
+  }
+}
+
+static void showUnparkedVisual(SActorBase *actor) {
+  if (!actor->isHidingVisual()) {
+    actor->setDisplayVisibility(actor->getDisplayVisibility());
+  }
+}
+
+void SScene::parkCameras(SActorBase *actor) {
+  for (auto &camera : mCameras) {
+    if (camera->getParent() == actor) {
+      mParkedCameras[actor].push_back(
+          {camera.get(), actor->getPose().getInverse() * camera->getPose()});
+      camera->setParent(nullptr, true);
+    }
+  }
+}
+
+void SScene::unparkCameras(SActorBase *actor) {
+  auto it = mParkedCameras.find(actor);
+  if (it == mParkedCameras.end()) {
+    return;
+  }
+  for (auto &[camera, localPose] : it->second) {
+    // the user mounted it somewhere else in the meantime
+    if (camera->getParent()) {
+      continue;
+    }
+    camera->setParent(actor);
+    camera->setLocalPose(localPose);
+  }
+  mParkedCameras.erase(it);
+}
+
+void SScene::parkActor(SActorBase *actor, std::string const &tag) {
+  auto type = actor->getType();
+  if (type == EActorType::ARTICULATION_LINK ||
+      type == EActorType::KINEMATIC_ARTICULATION_LINK) {
+    throw std::runtime_error("failed to park actor: articulation links cannot be parked");
+  }
+  auto it = std::find_if(mActors.begin(), mActors.end(),
+                         [=](auto &a) { return a.get() == actor && !a->isBeingDestroyed(); });
+  if (it == mActors.end()) {
+    throw std::runtime_error("failed to park actor: actor is not in this scene");
+  }
+  waitForRenderSnapshots();
+
+  removeDrivesAndGears(actor);
+  std::erase_if(mContacts, [=](const auto &item) {
+    auto const &[key, value] = item;
+    return value->actors[0] == actor || value->actors[1] == actor;
+  });
+
+  auto aggregate = mActorAggregates.find(actor);
+  if (aggregate != mActorAggregates.end()) {
+    mPxScene->removeAggregate(*aggregate->second);
+  } else {
+    mPxScene->removeActor(*actor->getPxActor());
+  }
+  hideParkedVisual(actor);
+  parkCameras(actor);
+  forgetMovedActor(actor);
+  forgetSnapshotEntity(actor);
+
+  mActorId2Actor.erase(actor->getId());
+  mParkedActors[tag].push_back(std::move(*it));
+  mActors.erase(it);
+}
+
+SActorBase *SScene::unparkActor(std::string const &tag, PxTransform const &pose, PxReal scale,
+                                std::shared_ptr<SPhysicalMaterial> material) {
+  ArenaAllocator::Scope allocationScope(mArena);
+  auto parked = mParkedActors.find(tag);
+  if (parked == mParkedActors.end() || parked->second.empty()) {
+    return nullptr;
+  }
+  waitForRenderSnapshots();
+  auto actor = std::move(parked->second.back());
+  parked->second.pop_back();
+
+  if (scale != actor->getScale()) {
+    actor->rescale(scale / actor->getScale());
+  }
+  if (material) {
+    for (auto shape : actor->getCollisionShapes()) {
+      shape->setPhysicalMaterial(material);
+    }
+  }
+  actor->getPxActor()->setGlobalPose(pose);
+  markActorMoved(actor.get());
+
+  auto aggregate = mActorAggregates.find(actor.get());
+  if (aggregate != mActorAggregates.end()) {
+    mPxScene->addAggregate(*aggregate->second);
+  } else {
+    mPxScene->addActor(*actor->getPxActor());
+  }
+  if (mBroadPhaseRegions) {
+    mBroadPhaseRegions->include(*actor->getPxActor());
+  }
+  if (actor->getType() == EActorType::DYNAMIC) {
+    auto body = static_cast<SActorDynamicBase *>(actor.get())->getPxActor();
+    body->setLinearVelocity({0, 0, 0});
+    body->setAngularVelocity({0, 0, 0});
+  }
+
+  showUnparkedVisual(actor.get());
+  actor->updateRender(pose);
+  unparkCameras(actor.get());
+
+  auto result = actor.get();
+  mActorId2Actor[result->getId()] = result;
+  mActors.push_back(std::move(actor));
+  return result;
+}
+
+void SScene::parkArticulation(SArticulation *articulation, std::string const &tag) {
+  auto it = std::find_if(mArticulations.begin(), mArticulations.end(), [=](auto &a) {
+    return a.get() == articulation && !a->isBeingDestroyed();
+  });
+  if (it == mArticulations.end()) {
+    throw std::runtime_error("failed to park articulation: articulation is not in this scene");
+  }
+  waitForRenderSnapshots();
+
+  auto links = articulation->getBaseLinks();
+  for (auto link : links) {
+    removeDrivesAndGears(link);
+    hideParkedVisual(link);
+    parkCameras(link);
+    forgetMovedActor(link);
+    forgetSnapshotEntity(link);
+    mActorId2Link.erase(link->getId());
+  }
+  std::erase_if(mContacts, [&](const auto &item) {
+    auto const &[key, value] = item;
+    return std::find(links.begin(), links.end(), value->actors[0]) != links.end() ||
+           std::find(links.begin(), links.end(), value->actors[1]) != links.end();
+  });
+
+  auto aggregate = mArticulationAggregates.find(articulation);
+  if (aggregate != mArticulationAggregates.end()) {
+    mPxScene->removeAggregate(*aggregate->second);
+  } else {
+    mPxScene->removeArticulation(*articulation->getPxArticulation());
+  }
+
+  mParkedArticulations[tag].push_back(std::move(*it));
+  mArticulations.erase(it);
+}
+
+SArticulation *SScene::unparkArticulation(std::string const &tag, PxTransform const &pose) {
+  ArenaAllocator::Scope allocationScope(mArena);
+  auto parked = mParkedArticulations.find(tag);
+  if (parked == mParkedArticulations.end() || parked->second.empty()) {
+    return nullptr;
+  }
+  waitForRenderSnapshots();
+  auto articulation = std::move(parked->second.back());
+  parked->second.pop_back();
+
+  auto aggregate = mArticulationAggregates.find(articulation.get());
+  if (aggregate != mArticulationAggregates.end()) {
+    mPxScene->addAggregate(*aggregate->second);
+  } else {
+    mPxScene->addArticulation(*articulation->getPxArticulation());
+  }
+
+  articulation->setRootPose(pose);
+  articulation->setRootVelocity({0, 0, 0});
+  articulation->setRootAngularVelocity({0, 0, 0});
+  articulation->setQvel(std::vector<PxReal>(articulation->dof(), 0.f));
+
+  for (auto link : articulation->getBaseLinks()) {
+    if (mBroadPhaseRegions) {
+      mBroadPhaseRegions->include(*link->getPxActor());
+    }
+    showUnparkedVisual(link);
+    link->updateRender(link->getPose());
+    unparkCameras(link);
+    mActorId2Link[link->getId()] = link;
+  }
+
+  auto result = articulation.get();
+  mArticulations.push_back(std::move(articulation));
+  return result;
+}
+
+uint32_t SScene::getParkedCount(std::string const &tag) const {
+  uint32_t count = 0;
+  if (auto it = mParkedActors.find(tag); it != mParkedActors.end()) {
+    count += it->second.size();
+  }
+  if (auto it = mParkedArticulations.find(tag); it != mParkedArticulations.end()) {
+    count += it->second.size();
+  }
+  return count;
+}
+
+void SScene::removeParkedCameras(SActorBase *actor) {
+  auto it = mParkedCameras.find(actor);
+  if (it == mParkedCameras.end()) {
+    return;
+  }
+  auto cameras = std::move(it->second);
+  mParkedCameras.erase(it);
+  for (auto &[camera, pose] : cameras) {
+    removeCamera(camera);
+  }
+}
+
+void SScene::releaseParkedActor(SActorBase *actor) {
+  actor->getPxActor()->userData = nullptr;
+  auto aggregate = mActorAggregates.find(actor);
+  actor->getPxActor()->release();
+  if (aggregate != mActorAggregates.end()) {
+    aggregate->second->release();
+    mActorAggregates.erase(aggregate);
+  }
+  for (auto body : actor->getRenderBodies()) {
+    body->destroy();
+  }
+  for (auto body : actor->getCollisionBodies()) {
+    body->destroy();
+  }
+}
+
+void SScene::releaseParkedArticulation(SArticulation *articulation) {
+  auto aggregate = mArticulationAggregates.find(articulation);
+  for (auto link : articulation->getSLinks()) {
+    link->getPxActor()->userData = nullptr;
+    for (auto body : link->getRenderBodies()) {
+      body->destroy();
+    }
+    for (auto body : link->getCollisionBodies()) {
+      body->destroy();
+    }
+  }
+  articulation->getPxArticulation()->userData = nullptr;
+  articulation->getPxArticulation()->release();
+  if (aggregate != mArticulationAggregates.end()) {
+    aggregate->second->release();
+    mArticulationAggregates.erase(aggregate);
+  }
+}
+
+void SScene::clearActorPool() {
+  for (auto &[tag, actors] : mParkedActors) {
+    for (auto &actor : actors) {
+      releaseParkedActor(actor.get());
+    }
+  }
+  for (auto &[tag, articulations] : mParkedArticulations) {
+    for (auto &articulation : articulations) {
+      releaseParkedArticulation(articulation.get());
+    }
+  }
+  // cameras of released objects stay where they are
+  mParkedCameras.clear();
+  mParkedActors.clear();
+  mParkedArticulations.clear();
+}
+
 void SScene::removeDrive(SDrive *drive) {
   if (drive->mScene != this) {
     spdlog::get("SAPIEN")->error("Failed to remove drive: drive is not in this scene.");
@@ -480,6 +957,11 @@ SCamera *SScene::addCamera(std::string const &name, uint32_t width, uint32_t hei
 }
 
 void SScene::removeCamera(SCamera *cam) {
+  waitForRenderSnapshots();
+  forgetSnapshotEntity(cam);
+  for (auto &[actor, cameras] : mParkedCameras) {
+    std::erase_if(cameras, [cam](auto &c) { return c.first == cam; });
+  }
   if (mRendererScene) {
     mRendererScene->removeCamera(cam->getRendererCamera());
   }
@@ -489,35 +971,55 @@ void SScene::removeCamera(SCamera *cam) {
 }
 
 void SScene::step() {
+  ArenaAllocator::Scope allocationScope(mArena);
   EASY_BLOCK("Pre-step processing", profiler::colors::Blue);
 
-  for (auto &a : mActors) {
-    if (!a->isBeingDestroyed())
-      a->prestep();
-  }
-  for (auto &a : mArticulations) {
-    if (!a->isBeingDestroyed())
-      a->prestep();
-  }
-  for (auto &a : mKinematicArticulations) {
-    if (!a->isBeingDestroyed())
-      a->prestep();
+  {
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::ePRESTEP);
+    for (auto &a : mActors) {
+      if (!a->isBeingDestroyed())
+        a->prestep();
+    }
+    for (auto &a : mArticulations) {
+      if (!a->isBeingDestroyed())
+        a->prestep();
+    }
+    for (auto &a : mKinematicArticulations) {
+      if (!a->isBeingDestroyed())
+        a->prestep();
+    }
   }
 
   // confirm removal of marked objects
-  removeCleanUp();
+  {
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eCLEANUP);
+    removeCleanUp();
+    updateBroadPhaseRegions();
+  }
 
   EASY_END_BLOCK;
   EASY_BLOCK("PhysX scene Step", profiler::colors::Red);
 
-  mPxScene->simulate(mTimestep);
-  while (!mPxScene->fetchResults(true)) {
-    // contact callback can happen here
-    // the callbacks may remove objects, which are not actually removed in this step
+  {
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eSIMULATE);
+    mPxScene->simulate(mTimestep);
+  }
+  {
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eFETCH_RESULTS);
+    fetchResults();
+  }
+  for (auto &a : mArticulations) {
+    a->markStateChanged();
+  }
+  collectMovedActors();
+  mTelemetry.endStep(*mPxScene);
+  if (mRenderPipelining) {
+    captureRenderSnapshot();
   }
 
   EASY_END_BLOCK;
 
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eEVENT_DISPATCH);
   EventSceneStep event;
   event.scene = this;
   event.timeStep = getTimestep();
@@ -526,34 +1028,56 @@ void SScene::step() {
 
 std::future<void> SScene::stepAsync() {
   return getThread().submit([this]() {
+    ArenaAllocator::Scope allocationScope(mArena);
     EASY_BLOCK("Scene preprocess")
-    for (auto &a : mActors) {
-      if (!a->isBeingDestroyed())
-        a->prestep();
-    }
-    for (auto &a : mArticulations) {
-      if (!a->isBeingDestroyed())
-        a->prestep();
+    {
+      SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::ePRESTEP);
+      for (auto &a : mActors) {
+        if (!a->isBeingDestroyed())
+          a->prestep();
+      }
+      for (auto &a : mArticulations) {
+        if (!a->isBeingDestroyed())
+          a->prestep();
+      }
+      for (auto &a : mKinematicArticulations) {
+        if (!a->isBeingDestroyed())
+          a->prestep();
+      }
     }
-    for (auto &a : mKinematicArticulations) {
-      if (!a->isBeingDestroyed())
-        a->prestep();
+    {
+      SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eCLEANUP);
+      removeCleanUp();
+      updateBroadPhaseRegions();
     }
-    removeCleanUp();
     EASY_END_BLOCK
 
     EASY_BLOCK("PhysX scene simulate", profiler::colors::Red);
-    mPxScene->simulate(mTimestep);
+    {
+      SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eSIMULATE);
+      mPxScene->simulate(mTimestep);
+    }
     EASY_END_BLOCK
 
     EASY_BLOCK("PhysX scene fetch", profiler::colors::Red);
-    while (!mPxScene->fetchResults(true)) {
+    {
+      SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eFETCH_RESULTS);
+      fetchResults();
     }
     EASY_END_BLOCK
+    for (auto &a : mArticulations) {
+      a->markStateChanged();
+    }
+    collectMovedActors();
+    mTelemetry.endStep(*mPxScene);
+    if (mRenderPipelining) {
+      captureRenderSnapshot();
+    }
 
     EASY_BLOCK("Scene postprocess");
     // removeCleanUp2();
 
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eEVENT_DISPATCH);
     EventSceneStep event;
     event.scene = this;
     event.timeStep = getTimestep();
@@ -564,6 +1088,7 @@ std::future<void> SScene::stepAsync() {
 
 std::future<void> SScene::multistepAsync(int steps, SceneMultistepCallback *callback) {
   return getThread().submit([this, steps, callback]() {
+    ArenaAllocator::Scope allocationScope(mArena);
     {
       EASY_BLOCK("BeforeMultistep")
       callback->beforeMultistep();
@@ -577,30 +1102,43 @@ std::future<void> SScene::multistepAsync(int steps, SceneMultistepCallback *call
 
       {
         EASY_BLOCK("Scene preprocess")
-        for (auto &a : mActors) {
-          if (!a->isBeingDestroyed())
-            a->prestep();
-        }
-        for (auto &a : mArticulations) {
-          if (!a->isBeingDestroyed())
-            a->prestep();
-        }
-        for (auto &a : mKinematicArticulations) {
-          if (!a->isBeingDestroyed())
-            a->prestep();
+        {
+          SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::ePRESTEP);
+          for (auto &a : mActors) {
+            if (!a->isBeingDestroyed())
+              a->prestep();
+          }
+          for (auto &a : mArticulations) {
+            if (!a->isBeingDestroyed())
+              a->prestep();
+          }
+          for (auto &a : mKinematicArticulations) {
+            if (!a->isBeingDestroyed())
+              a->prestep();
+          }
         }
+        SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eCLEANUP);
         removeCleanUp();
+        updateBroadPhaseRegions();
       }
 
       {
         EASY_BLOCK("PhysX scene simulate", profiler::colors::Red);
+        SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eSIMULATE);
         mPxScene->simulate(mTimestep);
       }
 
       {
         EASY_BLOCK("PhysX scene fetch", profiler::colors::Red);
-        while (!mPxScene->fetchResults(true)) {
+        {
+          SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eFETCH_RESULTS);
+          fetchResults();
+        }
+        for (auto &a : mArticulations) {
+          a->markStateChanged();
         }
+        collectMovedActors();
+        mTelemetry.endStep(*mPxScene);
       }
 
       {
@@ -612,7 +1150,11 @@ std::future<void> SScene::multistepAsync(int steps, SceneMultistepCallback *call
       EASY_BLOCK("AfterMultistep")
       callback->afterMultistep();
     }
+    if (mRenderPipelining) {
+      captureRenderSnapshot();
+    }
 
+    SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eEVENT_DISPATCH);
     EventSceneStep event;
     event.scene = this;
     event.timeStep = getTimestep();
@@ -629,33 +1171,18 @@ std::future<void> SScene::multistepAsync(int steps, SceneMultistepCallback *call
 
 void SScene::updateRender() {
   EASY_FUNCTION("Update Render", profiler::colors::Magenta);
+  if (mRenderPipelining) {
+    throw std::runtime_error(
+        "failed to update render: render pipelining is enabled, use renderSnapshotAsync");
+  }
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eUPDATE_RENDER);
   std::lock_guard lock(mUpdateRenderMutex);
 
   if (!mRendererScene) {
     spdlog::get("SAPIEN")->error("Failed to update render: renderer is not added.");
     return;
   }
-  for (auto &actor : mActors) {
-    if (!actor->isBeingDestroyed()) {
-      actor->updateRender(actor->getPxActor()->getGlobalPose());
-    }
-  }
-
-  for (auto &articulation : mArticulations) {
-    for (auto &link : articulation->getBaseLinks()) {
-      if (!articulation->isBeingDestroyed()) {
-        link->updateRender(link->getPxActor()->getGlobalPose());
-      }
-    }
-  }
-
-  for (auto &articulation : mKinematicArticulations) {
-    for (auto &link : articulation->getBaseLinks()) {
-      if (!articulation->isBeingDestroyed()) {
-        link->updateRender(link->getPxActor()->getGlobalPose());
-      }
-    }
-  }
+  updateMovedRenderBodies();
 
   for (auto &cam : mCameras) {
     cam->update();
@@ -669,47 +1196,181 @@ void SScene::updateRender() {
 }
 
 void SScene::updateRenderAndTakePictures(std::vector<SCamera *> const &cameras) {
+  if (mRenderPipelining) {
+    throw std::runtime_error(
+        "failed to update render: render pipelining is enabled, use renderSnapshotAsync");
+  }
   std::lock_guard lock(mUpdateRenderMutex);
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eUPDATE_RENDER);
 
   if (!mRendererScene) {
     spdlog::get("SAPIEN")->error("Failed to update render: renderer is not added.");
     return;
   }
-  for (auto &actor : mActors) {
+  updateMovedRenderBodies();
+
+  for (auto &cam : mCameras) {
+    cam->update();
+  }
+
+  std::vector<Renderer::ICamera *> rcams;
+  for (auto cam : cameras) {
+    rcams.push_back(cam->getRendererCamera());
+  }
+  getRendererScene()->updateRenderAndTakePictures(rcams);
+}
+
+void SScene::updateMovedRenderBodies() {
+  for (auto actor : mRenderDirtyActors) {
+    actor->setPoseDirtyFlags(actor->getPoseDirtyFlags() & ~SActorBase::eRENDER);
     if (!actor->isBeingDestroyed()) {
       actor->updateRender(actor->getPxActor()->getGlobalPose());
     }
   }
+  mRenderDirtyActors.clear();
+}
 
-  for (auto &articulation : mArticulations) {
-    for (auto &link : articulation->getBaseLinks()) {
-      if (!articulation->isBeingDestroyed()) {
-        link->updateRender(link->getPxActor()->getGlobalPose());
+std::future<void> SScene::updateRenderAsync() {
+  return getThread().submit([this]() { updateRender(); });
+}
+
+void SScene::setRenderPipelining(bool enabled) {
+  if (!enabled) {
+    waitForRenderSnapshots();
+    // bodies of a snapshot no frame rendered go back to the moved list for updateRender
+    auto &front = mRenderSnapshots[mFrontRenderSnapshot];
+    if (!front.submitted) {
+      for (auto &[actor, pose] : front.bodies) {
+        auto flags = actor->getPoseDirtyFlags();
+        if (!(flags & SActorBase::eRENDER)) {
+          actor->setPoseDirtyFlags(flags | SActorBase::eRENDER);
+          mRenderDirtyActors.push_back(actor);
+        }
       }
     }
+    for (auto &snapshot : mRenderSnapshots) {
+      snapshot = {};
+    }
   }
+  mRenderPipelining = enabled;
+}
 
-  for (auto &articulation : mKinematicArticulations) {
-    for (auto &link : articulation->getBaseLinks()) {
-      if (!articulation->isBeingDestroyed()) {
-        link->updateRender(link->getPxActor()->getGlobalPose());
+void SScene::captureRenderSnapshot() {
+  std::unique_lock lock(mRenderSnapshotMutex);
+  auto &front = mRenderSnapshots[mFrontRenderSnapshot];
+  auto &back = mRenderSnapshots[mFrontRenderSnapshot ^ 1];
+
+  // a front snapshot no frame was submitted for has no readers, it is updated in place keeping
+  // the bodies that did not move again. Otherwise the back one is rewritten once the frames
+  // submitted two captures ago are done with it
+  bool inPlace = !front.submitted;
+  auto &snapshot = inPlace ? front : back;
+  if (inPlace) {
+    std::erase_if(front.bodies, [](auto const &body) {
+      return body.first->getPoseDirtyFlags() & SActorBase::eRENDER;
+    });
+  } else {
+    // a scheduler worker runs pending tasks meanwhile since the frame may be queued behind it
+    auto &scheduler = TaskScheduler::Get();
+    if (scheduler.getCurrentWorkerIndex() >= 0) {
+      while (back.readers) {
+        lock.unlock();
+        if (!scheduler.runPendingTask()) {
+          std::this_thread::yield();
+        }
+        lock.lock();
       }
+    } else {
+      mRenderSnapshotReleased.wait(lock, [&]() { return back.readers == 0; });
     }
+    back.bodies.clear();
   }
 
+  for (auto actor : mRenderDirtyActors) {
+    actor->setPoseDirtyFlags(actor->getPoseDirtyFlags() & ~SActorBase::eRENDER);
+    if (!actor->isBeingDestroyed()) {
+      snapshot.bodies.push_back({actor, actor->getPxActor()->getGlobalPose()});
+    }
+  }
+  mRenderDirtyActors.clear();
+
+  snapshot.cameras.clear();
   for (auto &cam : mCameras) {
-    cam->update();
+    snapshot.cameras.push_back({cam.get(), cam->updatePose()});
+  }
+  snapshot.lights.clear();
+  for (auto &light : mLights) {
+    snapshot.lights.push_back({light.get(), light->getPose()});
   }
 
+  snapshot.number = ++mRenderSnapshotCount;
+  snapshot.submitted = false;
+  if (!inPlace) {
+    mFrontRenderSnapshot ^= 1;
+  }
+}
+
+std::future<uint64_t> SScene::renderSnapshotAsync(std::vector<SCamera *> const &cameras) {
+  if (!mRendererScene) {
+    throw std::runtime_error("failed to render snapshot: renderer is not added");
+  }
   std::vector<Renderer::ICamera *> rcams;
   for (auto cam : cameras) {
     rcams.push_back(cam->getRendererCamera());
   }
-  getRendererScene()->updateRenderAndTakePictures(rcams);
+
+  RenderSnapshot *snapshot;
+  uint64_t number;
+  {
+    std::lock_guard lock(mRenderSnapshotMutex);
+    snapshot = &mRenderSnapshots[mFrontRenderSnapshot];
+    snapshot->readers += 1;
+    snapshot->submitted = true;
+    number = snapshot->number;
+  }
+
+  return mRenderQueue.submit([this, snapshot, number, rcams = std::move(rcams)]() {
+    auto release = [&]() {
+      std::lock_guard lock(mRenderSnapshotMutex);
+      snapshot->readers -= 1;
+      mRenderSnapshotReleased.notify_all();
+    };
+    try {
+      for (auto &[actor, pose] : snapshot->bodies) {
+        actor->updateRender(pose);
+      }
+      for (auto &[cam, pose] : snapshot->cameras) {
+        cam->updateRender(pose);
+      }
+      for (auto &[light, pose] : snapshot->lights) {
+        light->updateRender(pose);
+      }
+      mRendererScene->updateRender();
+      for (auto cam : rcams) {
+        cam->takePicture();
+      }
+    } catch (...) {
+      release();
+      throw;
+    }
+    release();
+    return number;
+  });
 }
 
-std::future<void> SScene::updateRenderAsync() {
-  return getThread().submit([this]() { updateRender(); });
+void SScene::waitForRenderSnapshots() { mRenderQueue.wait(); }
+
+uint64_t SScene::getRenderSnapshotCount() {
+  std::lock_guard lock(mRenderSnapshotMutex);
+  return mRenderSnapshotCount;
+}
+
+void SScene::forgetSnapshotEntity(SEntity *entity) {
+  for (auto &snapshot : mRenderSnapshots) {
+    std::erase_if(snapshot.bodies, [=](auto const &body) { return body.first == entity; });
+    std::erase_if(snapshot.cameras, [=](auto const &cam) { return cam.first == entity; });
+    std::erase_if(snapshot.lights, [=](auto const &light) { return light.first == entity; });
+  }
 }
 
 SActorStatic *SScene::addGround(PxReal altitude, bool render,
@@ -801,6 +1462,7 @@ std::map<physx_id_t, std::string> SScene::findRenderId2VisualName() const {
 }
 
 SceneData SScene::packScene() {
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::ePACK_SCENE);
   SceneData data;
   for (auto &actor : mActors) {
     data.mActorData[actor->getId()] = actor->packData();
@@ -817,7 +1479,31 @@ SceneData SScene::packScene() {
   return data;
 }
 
+SceneData SScene::packSceneIncremental() {
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::ePACK_SCENE);
+  SceneData data;
+  for (auto actor : mPackDirtyActors) {
+    actor->setPoseDirtyFlags(actor->getPoseDirtyFlags() & ~SActorBase::ePACK);
+    if (actor->isBeingDestroyed()) {
+      continue;
+    }
+    if (actor->getType() == EActorType::ARTICULATION_LINK) {
+      auto articulation = static_cast<SLink *>(actor)->getArticulation();
+      auto id = articulation->getRootLink()->getId();
+      if (!data.mArticulationData.contains(id)) {
+        data.mArticulationData[id] = articulation->packData();
+        data.mArticulationDriveData[id] = articulation->packDrive();
+      }
+    } else {
+      data.mActorData[actor->getId()] = actor->packData();
+    }
+  }
+  mPackDirtyActors.clear();
+  return data;
+}
+
 void SScene::unpackScene(SceneData const &data) {
+  SceneTelemetry::Timer timer(mTelemetry, TelemetryPhase::eUNPACK_SCENE);
   for (auto &actor : mActors) {
     auto it = data.mActorData.find(actor->getId());
     if (it != data.mActorData.end()) {
@@ -912,6 +1598,8 @@ SActiveLight *SScene::addActiveLight(PxTransform const &pose, PxVec3 const &colo
 }
 
 void SScene::removeLight(SLight *light) {
+  waitForRenderSnapshots();
+  forgetSnapshotEntity(light);
   if (light && light->getRendererLight()) {
     mRendererScene->removeLight(light->getRendererLight());
   }
@@ -935,6 +1623,10 @@ void SScene::removeCameraByParent(SActorBase *actor) {
       std::remove_if(mCameras.begin(), mCameras.end(),
                      [actor](std::unique_ptr<SCamera> &mc) { return mc->getParent() == actor; });
   for (auto it = start; it != mCameras.end(); ++it) {
+    forgetSnapshotEntity(it->get());
+    for (auto &[parked, cameras] : mParkedCameras) {
+      std::erase_if(cameras, [&](auto &c) { return c.first == it->get(); });
+    }
     mRendererScene->removeCamera((*it)->getRendererCamera());
   }
   mCameras.erase(start, mCameras.end());
@@ -957,10 +1649,60 @@ void SScene::removeParticleEntity(SEntityParticle *entity) {
   mParticlesEntities.erase(start, mParticlesEntities.end());
 }
 
-ThreadPool &SScene::getThread() {
-  if (!mRunnerThread.running()) {
-    mRunnerThread.init();
+TaskQueue &SScene::getThread() { return mRunnerQueue; }
+
+void SScene::markActorMoved(SActorBase *actor) {
+  auto flags = actor->getPoseDirtyFlags();
+  if (!(flags & SActorBase::eRENDER)) {
+    mRenderDirtyActors.push_back(actor);
+  }
+  if (!(flags & SActorBase::ePACK)) {
+    mPackDirtyActors.push_back(actor);
+  }
+  actor->setPoseDirtyFlags(SActorBase::eRENDER | SActorBase::ePACK);
+}
+
+void SScene::forgetMovedActor(SActorBase *actor) {
+  auto flags = actor->getPoseDirtyFlags();
+  if (flags & SActorBase::eRENDER) {
+    std::erase(mRenderDirtyActors, actor);
+  }
+  if (flags & SActorBase::ePACK) {
+    std::erase(mPackDirtyActors, actor);
+  }
+  actor->setPoseDirtyFlags(0);
+}
+
+void SScene::collectMovedActors() {
+  PxU32 count;
+  PxActor **actors = mPxScene->getActiveActors(count);
+  for (PxU32 i = 0; i < count; ++i) {
+    if (auto actor = static_cast<SActorBase *>(actors[i]->userData)) {
+      markActorMoved(actor);
+    }
+  }
+  // articulation links are not guaranteed to be reported as active actors
+  for (auto &a : mArticulations) {
+    if (!a->isBeingDestroyed() && !a->getPxArticulation()->isSleeping()) {
+      for (auto link : a->getSLinks()) {
+        markActorMoved(link);
+      }
+    }
+  }
+}
+
+void SScene::fetchResults() {
+  auto &scheduler = TaskScheduler::Get();
+  if (mTaskDispatcher && scheduler.getCurrentWorkerIndex() >= 0) {
+    while (!mPxScene->checkResults(false)) {
+      if (!scheduler.runPendingTask()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  while (!mPxScene->fetchResults(true)) {
+    // contact callback can happen here
+    // the callbacks may remove objects, which are not actually removed in this step
   }
-  return mRunnerThread;
 }
 }; // namespace sapien
@@ -91,6 +91,37 @@ std::string SCollisionShape::getType() const {
   throw std::runtime_error("unsupported shape type");
 }
 
+void SCollisionShape::rescale(PxReal factor) {
+  PxGeometryHolder geometry = mPxShape->getGeometry();
+  switch (geometry.getType()) {
+  case PxGeometryType::eBOX:
+    geometry.box().halfExtents *= factor;
+    break;
+  case PxGeometryType::eSPHERE:
+    geometry.sphere().radius *= factor;
+    break;
+  case PxGeometryType::eCAPSULE:
+    geometry.capsule().radius *= factor;
+    geometry.capsule().halfHeight *= factor;
+    break;
+  case PxGeometryType::eCONVEXMESH:
+    geometry.convexMesh().scale.scale *= factor;
+    break;
+  case PxGeometryType::eTRIANGLEMESH:
+    geometry.triangleMesh().scale.scale *= factor;
+    break;
+  case PxGeometryType::ePLANE:
+    return;
+  default:
+    throw std::runtime_error("rescale: unsupported geometry type");
+  }
+  mPxShape->setGeometry(geometry.any());
+
+  auto pose = mPxShape->getLocalPose();
+  pose.p *= factor;
+  mPxShape->setLocalPose(pose);
+}
+
 std::shared_ptr<SGeometry> SCollisionShape::getGeometry() const {
   switch (mPxShape->getGeometryType()) {
   case PxGeometryType::eBOX: {
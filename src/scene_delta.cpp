@@ -0,0 +1,307 @@
+#include "sapien/scene_delta.h"
+#include "sapien/articulation/sapien_articulation.h"
+#include "sapien/articulation/sapien_link.h"
+#include "sapien/sapien_scene.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace sapien {
+
+namespace {
+
+constexpr uint8_t kMagic[4] = {'S', 'D', 'L', 'T'};
+constexpr uint8_t kVersion = 1;
+
+enum DeltaFlag : uint8_t { eQUANTIZED = 1, ePOSE_ONLY = 2 };
+
+enum RecordKind : uint8_t {
+  eACTOR_POSE = 0,
+  eACTOR_POSE_VELOCITY = 1,
+  eARTICULATION_POSE = 2,
+  eARTICULATION_FULL = 3
+};
+
+constexpr float kQuatScale = 32767.f * 1.41421356f;
+
+template <typename T> void put(std::vector<uint8_t> &out, T value) {
+  auto offset = out.size();
+  out.resize(offset + sizeof(T));
+  std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+void putFloats(std::vector<uint8_t> &out, PxReal const *values, size_t count) {
+  auto offset = out.size();
+  out.resize(offset + count * sizeof(PxReal));
+  std::memcpy(out.data() + offset, values, count * sizeof(PxReal));
+}
+
+/** pose as p.xyz, q.xyzw */
+void putPose(std::vector<uint8_t> &out, PxReal const *pose, SceneDeltaConfig const &config) {
+  if (!config.quantize) {
+    putFloats(out, pose, 7);
+    return;
+  }
+  for (int i = 0; i < 3; ++i) {
+    double v = std::round(pose[i] / config.positionResolution);
+    v = std::clamp<double>(v, std::numeric_limits<int32_t>::min(),
+                           std::numeric_limits<int32_t>::max());
+    put<int32_t>(out, static_cast<int32_t>(v));
+  }
+  // smallest three: drop the largest component, it follows from the unit norm
+  PxReal const *q = pose + 3;
+  uint8_t largest = 0;
+  for (uint8_t i = 1; i < 4; ++i) {
+    if (std::abs(q[i]) > std::abs(q[largest])) {
+      largest = i;
+    }
+  }
+  PxReal sign = q[largest] < 0 ? -1.f : 1.f;
+  put<uint8_t>(out, largest);
+  for (uint8_t i = 0; i < 4; ++i) {
+    if (i != largest) {
+      put<int16_t>(out, static_cast<int16_t>(
+                            std::clamp(std::round(q[i] * sign * kQuatScale), -32767.f, 32767.f)));
+    }
+  }
+}
+
+class Reader {
+public:
+  Reader(uint8_t const *data, size_t size) : mData(data), mSize(size) {}
+
+  template <typename T> T get() {
+    T value;
+    read(&value, sizeof(T));
+    return value;
+  }
+
+  void getFloats(PxReal *values, size_t count) { read(values, count * sizeof(PxReal)); }
+
+  void getPose(PxReal *pose, bool quantized, PxReal resolution) {
+    if (!quantized) {
+      getFloats(pose, 7);
+      return;
+    }
+    for (int i = 0; i < 3; ++i) {
+      pose[i] = get<int32_t>() * resolution;
+    }
+    PxReal *q = pose + 3;
+    uint8_t largest = get<uint8_t>();
+    if (largest > 3) {
+      throw std::runtime_error("failed to apply scene delta: invalid rotation");
+    }
+    PxReal sum = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (i != largest) {
+        q[i] = get<int16_t>() / kQuatScale;
+        sum += q[i] * q[i];
+      }
+    }
+    q[largest] = std::sqrt(std::max(0.f, 1.f - sum));
+  }
+
+  inline bool done() const { return mOffset == mSize; }
+
+private:
+  void read(void *out, size_t bytes) {
+    if (mOffset + bytes > mSize) {
+      throw std::runtime_error("failed to apply scene delta: data is truncated");
+    }
+    std::memcpy(out, mData + mOffset, bytes);
+    mOffset += bytes;
+  }
+
+  uint8_t const *mData;
+  size_t mSize;
+  size_t mOffset{0};
+};
+
+inline uint64_t recordKey(bool articulation, physx_id_t id) {
+  return (static_cast<uint64_t>(articulation) << 32) | id;
+}
+
+} // namespace
+
+SceneDeltaEncoder::SceneDeltaEncoder(SScene &scene, SceneDeltaConfig const &config)
+    : mScene(scene), mConfig(config) {
+  if (config.quantize && !(config.positionResolution > 0)) {
+    throw std::runtime_error("failed to create scene delta encoder: invalid position resolution");
+  }
+  // start from the full state, pending incremental changes are part of it
+  mScene.packSceneIncremental();
+  mGeneration = 1;
+  ingest(mScene.packScene());
+}
+
+uint64_t SceneDeltaEncoder::capture() {
+  ++mGeneration;
+  ingest(mScene.packSceneIncremental());
+  return mGeneration;
+}
+
+void SceneDeltaEncoder::update(uint64_t key, std::vector<uint8_t> bytes) {
+  auto it = mRecordIndex.find(key);
+  if (it != mRecordIndex.end()) {
+    if (it->second->bytes == bytes) {
+      return;
+    }
+    it->second->bytes = std::move(bytes);
+    it->second->generation = mGeneration;
+    mRecords.splice(mRecords.end(), mRecords, it->second);
+  } else {
+    mRecords.push_back({mGeneration, std::move(bytes)});
+    mRecordIndex[key] = std::prev(mRecords.end());
+  }
+  ++mLastChangedCount;
+}
+
+void SceneDeltaEncoder::ingest(SceneData const &data) {
+  mLastChangedCount = 0;
+  for (auto &[id, values] : data.mActorData) {
+    if (values.size() < 7) {
+      continue;
+    }
+    bool velocity = !mConfig.poseOnly && values.size() == 13;
+    std::vector<uint8_t> bytes;
+    put<uint8_t>(bytes, velocity ? eACTOR_POSE_VELOCITY : eACTOR_POSE);
+    put<physx_id_t>(bytes, id);
+    putPose(bytes, values.data(), mConfig);
+    if (velocity) {
+      putFloats(bytes, values.data() + 7, 6);
+    }
+    update(recordKey(false, id), std::move(bytes));
+  }
+
+  for (auto &[id, values] : data.mArticulationData) {
+    auto drive = data.mArticulationDriveData.find(id);
+    if (drive == data.mArticulationDriveData.end() || values.size() < 19) {
+      continue;
+    }
+    std::vector<uint8_t> bytes;
+    if (mConfig.poseOnly) {
+      // packData starts with qpos and ends with the 19 root values, packDrive has 5 per dof
+      uint32_t dof = drive->second.size() / 5;
+      put<uint8_t>(bytes, eARTICULATION_POSE);
+      put<physx_id_t>(bytes, id);
+      putPose(bytes, values.data() + values.size() - 19, mConfig);
+      put<uint16_t>(bytes, dof);
+      putFloats(bytes, values.data(), dof);
+    } else {
+      put<uint8_t>(bytes, eARTICULATION_FULL);
+      put<physx_id_t>(bytes, id);
+      put<uint32_t>(bytes, values.size());
+      putFloats(bytes, values.data(), values.size());
+      put<uint32_t>(bytes, drive->second.size());
+      putFloats(bytes, drive->second.data(), drive->second.size());
+    }
+    update(recordKey(true, id), std::move(bytes));
+  }
+}
+
+std::vector<uint8_t> SceneDeltaEncoder::encode(uint64_t base) const {
+  if (base > mGeneration) {
+    throw std::runtime_error("failed to encode scene delta: generation " + std::to_string(base) +
+                             " has not been captured");
+  }
+  std::vector<uint8_t> out(kMagic, kMagic + 4);
+  put<uint8_t>(out, kVersion);
+  put<uint8_t>(out, (mConfig.quantize ? eQUANTIZED : 0) | (mConfig.poseOnly ? ePOSE_ONLY : 0));
+  put<PxReal>(out, mConfig.positionResolution);
+  put<uint64_t>(out, base);
+  put<uint64_t>(out, mGeneration);
+  auto countOffset = out.size();
+  put<uint32_t>(out, 0);
+
+  uint32_t count = 0;
+  for (auto it = mRecords.rbegin(); it != mRecords.rend() && it->generation > base; ++it) {
+    out.insert(out.end(), it->bytes.begin(), it->bytes.end());
+    ++count;
+  }
+  std::memcpy(out.data() + countOffset, &count, sizeof(count));
+  return out;
+}
+
+uint64_t applySceneDelta(SScene &scene, uint8_t const *data, size_t size) {
+  SceneTelemetry::Timer timer(scene.getTelemetry(), TelemetryPhase::eUNPACK_SCENE);
+  Reader reader(data, size);
+  uint8_t magic[4];
+  for (auto &m : magic) {
+    m = reader.get<uint8_t>();
+  }
+  if (!std::equal(magic, magic + 4, kMagic) || reader.get<uint8_t>() != kVersion) {
+    throw std::runtime_error("failed to apply scene delta: unknown format");
+  }
+  uint8_t flags = reader.get<uint8_t>();
+  bool quantized = flags & eQUANTIZED;
+  PxReal resolution = reader.get<PxReal>();
+  reader.get<uint64_t>(); // base generation
+  uint64_t generation = reader.get<uint64_t>();
+  uint32_t count = reader.get<uint32_t>();
+
+  std::vector<PxReal> values;
+  std::vector<PxReal> drive;
+  for (uint32_t r = 0; r < count; ++r) {
+    auto kind = reader.get<uint8_t>();
+    auto id = reader.get<physx_id_t>();
+    switch (kind) {
+    case eACTOR_POSE:
+    case eACTOR_POSE_VELOCITY: {
+      values.assign(13, 0.f);
+      reader.getPose(values.data(), quantized, resolution);
+      if (kind == eACTOR_POSE_VELOCITY) {
+        reader.getFloats(values.data() + 7, 6);
+      }
+      SActorBase *actor = scene.findActorById(id);
+      if (!actor) {
+        // kinematic articulation links are packed as actors
+        actor = scene.findArticulationLinkById(id);
+      }
+      if (actor) {
+        values.resize(actor->getType() == EActorType::DYNAMIC ? 13 : 7);
+        actor->unpackData(values);
+      }
+      break;
+    }
+    case eARTICULATION_POSE: {
+      PxReal pose[7];
+      reader.getPose(pose, quantized, resolution);
+      values.resize(reader.get<uint16_t>());
+      reader.getFloats(values.data(), values.size());
+      auto link = scene.findArticulationLinkById(id);
+      if (link && link->getArticulation()->getType() == EArticulationType::DYNAMIC) {
+        auto articulation = static_cast<SArticulation *>(link->getArticulation());
+        articulation->setRootPose({{pose[0], pose[1], pose[2]},
+                                   {pose[3], pose[4], pose[5], pose[6]}});
+        // qpos comes from packData, in internal order
+        articulation->unpackQpos(values);
+      }
+      break;
+    }
+    case eARTICULATION_FULL: {
+      values.resize(reader.get<uint32_t>());
+      reader.getFloats(values.data(), values.size());
+      drive.resize(reader.get<uint32_t>());
+      reader.getFloats(drive.data(), drive.size());
+      auto link = scene.findArticulationLinkById(id);
+      if (link && link->getArticulation()->getType() == EArticulationType::DYNAMIC) {
+        auto articulation = static_cast<SArticulation *>(link->getArticulation());
+        articulation->unpackData(values);
+        articulation->unpackDrive(drive);
+      }
+      break;
+    }
+    default:
+      throw std::runtime_error("failed to apply scene delta: unknown record " +
+                               std::to_string(kind));
+    }
+  }
+  if (!reader.done()) {
+    throw std::runtime_error("failed to apply scene delta: trailing data");
+  }
+  return generation;
+}
+
+} // namespace sapien
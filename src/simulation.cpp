@@ -4,14 +4,13 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include "sapien/arena_allocator.h"
 #include "sapien/filter_shader.h"
 #include "sapien/simulation.h"
 
 #include <easy/profiler.h>
 
 namespace sapien {
-static PxDefaultAllocator gDefaultAllocatorCallback;
-
 void SapienErrorCallback::reportError(PxErrorCode::Enum code, const char *message,
                                       const char *file, int line) {
   mLastErrorCode = code;
@@ -42,7 +41,9 @@ Simulation::Simulation(uint32_t nthread, PxReal toleranceLength, PxReal toleranc
   }
 
   // TODO(fanbo): figure out what "track allocation" means in the PhysX doc
-  mFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gDefaultAllocatorCallback, mErrorCallback);
+  mFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, ArenaAllocator::Get(), mErrorCallback);
+  // type names let the allocator tell the categories apart
+  mFoundation->setReportAllocationNames(true);
 
   PxTolerancesScale toleranceScale;
   toleranceScale.length = toleranceLength;
@@ -103,6 +104,8 @@ Simulation::~Simulation() {
   }
 }
 
+MemoryStats Simulation::getMemoryStats() const { return ArenaAllocator::Get().getMemoryStats(); }
+
 std::unique_ptr<SScene> Simulation::createScene(SceneConfig const &config) {
   return std::make_unique<SScene>(this->shared_from_this(), config);
 }
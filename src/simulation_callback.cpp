@@ -9,6 +9,13 @@ namespace sapien {
 
 void DefaultEventCallback::onContact(const PxContactPairHeader &pairHeader,
                                      const PxContactPair *pairs, PxU32 nbPairs) {
+  if (mScene->getTelemetry().isEnabled()) {
+    uint64_t points = 0;
+    for (uint32_t i = 0; i < nbPairs; ++i) {
+      points += pairs[i].contactCount;
+    }
+    mScene->getTelemetry().addContacts(nbPairs, points);
+  }
   for (uint32_t i = 0; i < nbPairs; ++i) {
     void *a0 = pairHeader.actors[0]->userData;
     void *a1 = pairHeader.actors[1]->userData;
@@ -0,0 +1,422 @@
+#include "sapien/task_scheduler.h"
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace sapien {
+
+namespace {
+
+/** Chase-Lev deque of tasks (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+ *  Models"). push and pop are called by the owning worker only, steal by any thread. */
+class WorkStealingDeque {
+  struct Ring {
+    explicit Ring(int64_t capacity)
+        : capacity(capacity), mask(capacity - 1),
+          data(std::make_unique<std::atomic<Task *>[]>(capacity)) {}
+
+    inline Task *get(int64_t i) const { return data[i & mask].load(std::memory_order_relaxed); }
+    inline void put(int64_t i, Task *task) {
+      data[i & mask].store(task, std::memory_order_relaxed);
+    }
+
+    int64_t capacity;
+    int64_t mask;
+    std::unique_ptr<std::atomic<Task *>[]> data;
+  };
+
+public:
+  WorkStealingDeque() : mRing(new Ring(256)) {}
+  ~WorkStealingDeque() { delete mRing.load(); }
+
+  void push(Task *task) {
+    int64_t b = mBottom.load(std::memory_order_relaxed);
+    int64_t t = mTop.load(std::memory_order_acquire);
+    Ring *ring = mRing.load(std::memory_order_relaxed);
+    if (b - t > ring->capacity - 1) {
+      // thieves may still read the old ring, it is kept until the deque is destroyed
+      auto larger = new Ring(ring->capacity * 2);
+      for (int64_t i = t; i < b; ++i) {
+        larger->put(i, ring->get(i));
+      }
+      mRetired.emplace_back(ring);
+      ring = larger;
+      mRing.store(ring, std::memory_order_release);
+    }
+    ring->put(b, task);
+    mBottom.store(b + 1, std::memory_order_release);
+  }
+
+  Task *pop() {
+    int64_t b = mBottom.load(std::memory_order_relaxed) - 1;
+    Ring *ring = mRing.load(std::memory_order_relaxed);
+    mBottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = mTop.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      mBottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Task *task = ring->get(b);
+    if (t == b) {
+      // last task, race against thieves
+      if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      mBottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  Task *steal() {
+    int64_t t = mTop.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = mBottom.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    Task *task = mRing.load(std::memory_order_acquire)->get(t);
+    if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+private:
+  alignas(64) std::atomic<int64_t> mTop{0};
+  alignas(64) std::atomic<int64_t> mBottom{0};
+  std::atomic<Ring *> mRing;
+  std::vector<std::unique_ptr<Ring>> mRetired;
+};
+
+/** task nodes are recycled per thread so spawning does not go through malloc */
+class TaskNodeCache {
+  static constexpr size_t kCapacity = 256;
+
+public:
+  ~TaskNodeCache() {
+    for (auto node : mNodes) {
+      delete node;
+    }
+  }
+
+  Task *allocate(Task task) {
+    if (mNodes.empty()) {
+      return new Task(std::move(task));
+    }
+    Task *node = mNodes.back();
+    mNodes.pop_back();
+    *node = std::move(task);
+    return node;
+  }
+
+  void free(Task *node) {
+    node->reset();
+    if (mNodes.size() < kCapacity) {
+      mNodes.push_back(node);
+    } else {
+      delete node;
+    }
+  }
+
+private:
+  std::vector<Task *> mNodes;
+};
+
+thread_local TaskNodeCache gNodeCache;
+thread_local TaskScheduler const *gCurrentScheduler = nullptr;
+thread_local int gCurrentWorker = -1;
+
+inline uint32_t nextRandom() {
+  thread_local uint32_t state =
+      static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+void runTask(Task *task) {
+  try {
+    (*task)();
+  } catch (std::exception const &e) {
+    // submit and TaskGroup capture exceptions, only spawned tasks end up here
+    if (auto logger = spdlog::get("SAPIEN")) {
+      logger->error("Uncaught exception in task: {}", e.what());
+    }
+  } catch (...) {
+    if (auto logger = spdlog::get("SAPIEN")) {
+      logger->error("Uncaught exception in task");
+    }
+  }
+  gNodeCache.free(task);
+}
+
+std::mutex gInstanceMutex;
+TaskSchedulerConfig gInstanceConfig;
+std::atomic<TaskScheduler *> gInstance{nullptr};
+
+} // namespace
+
+struct TaskScheduler::Worker {
+  WorkStealingDeque deque;
+  std::thread thread;
+};
+
+struct TaskScheduler::Queue {
+  std::mutex mutex;
+  std::deque<Task *> tasks;
+  std::atomic<size_t> size{0};
+
+  void push(Task *task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(task);
+    size.fetch_add(1, std::memory_order_release);
+  }
+
+  Task *pop() {
+    if (!size.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tasks.empty()) {
+      return nullptr;
+    }
+    Task *task = tasks.front();
+    tasks.pop_front();
+    size.fetch_sub(1, std::memory_order_release);
+    return task;
+  }
+};
+
+TaskScheduler &TaskScheduler::Get() {
+  if (auto scheduler = gInstance.load(std::memory_order_acquire)) {
+    return *scheduler;
+  }
+  std::lock_guard<std::mutex> lock(gInstanceMutex);
+  if (!gInstance.load(std::memory_order_relaxed)) {
+    gInstance.store(new TaskScheduler(gInstanceConfig), std::memory_order_release);
+  }
+  return *gInstance.load(std::memory_order_relaxed);
+}
+
+void TaskScheduler::Configure(TaskSchedulerConfig const &config) {
+  std::lock_guard<std::mutex> lock(gInstanceMutex);
+  if (gInstance.load(std::memory_order_relaxed)) {
+    throw std::runtime_error("failed to configure task scheduler: it is already running");
+  }
+  gInstanceConfig = config;
+}
+
+TaskScheduler::TaskScheduler(TaskSchedulerConfig const &config)
+    : mInjection(std::make_unique<Queue>()) {
+  uint32_t count = config.threadCount;
+  if (count == 0) {
+    count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    mWorkers.push_back(std::make_unique<Worker>());
+  }
+  // workers steal from each other, so all deques exist before any thread starts
+  for (uint32_t i = 0; i < count; ++i) {
+    mWorkers[i]->thread = std::thread(&TaskScheduler::workerMain, this, i);
+#ifdef __linux__
+    if (config.pinThreads) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(i % std::max(1u, std::thread::hardware_concurrency()), &cpus);
+      pthread_setaffinity_np(mWorkers[i]->thread.native_handle(), sizeof(cpus), &cpus);
+    }
+#endif
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  mStop.store(true);
+  mEpoch.fetch_add(1);
+  mEpoch.notify_all();
+  for (auto &worker : mWorkers) {
+    worker->thread.join();
+  }
+  // tasks that never ran
+  for (auto &worker : mWorkers) {
+    while (Task *task = worker->deque.steal()) {
+      delete task;
+    }
+  }
+  while (Task *task = mInjection->pop()) {
+    delete task;
+  }
+}
+
+int TaskScheduler::getCurrentWorkerIndex() const {
+  return gCurrentScheduler == this ? gCurrentWorker : -1;
+}
+
+void TaskScheduler::spawn(Task task) {
+  Task *node = gNodeCache.allocate(std::move(task));
+  int self = getCurrentWorkerIndex();
+  if (self >= 0) {
+    mWorkers[self]->deque.push(node);
+  } else {
+    mInjection->push(node);
+  }
+  wake();
+}
+
+void TaskScheduler::wake() {
+  mEpoch.fetch_add(1);
+  if (mSleeping.load()) {
+    mEpoch.notify_one();
+  }
+}
+
+Task *TaskScheduler::findTask(int self) {
+  if (self >= 0) {
+    if (Task *task = mWorkers[self]->deque.pop()) {
+      return task;
+    }
+  }
+  if (Task *task = mInjection->pop()) {
+    return task;
+  }
+  uint32_t count = mWorkers.size();
+  uint32_t start = nextRandom() % count;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t victim = (start + i) % count;
+    if (static_cast<int>(victim) == self) {
+      continue;
+    }
+    if (Task *task = mWorkers[victim]->deque.steal()) {
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+bool TaskScheduler::runPendingTask() {
+  Task *task = findTask(getCurrentWorkerIndex());
+  if (!task) {
+    return false;
+  }
+  runTask(task);
+  return true;
+}
+
+void TaskScheduler::workerMain(uint32_t index) {
+  gCurrentScheduler = this;
+  gCurrentWorker = index;
+
+  constexpr int kSpinCount = 64;
+  while (!mStop.load(std::memory_order_relaxed)) {
+    Task *task = nullptr;
+    for (int i = 0; i < kSpinCount && !task; ++i) {
+      task = findTask(index);
+      if (!task) {
+        std::this_thread::yield();
+      }
+    }
+    if (task) {
+      runTask(task);
+      continue;
+    }
+
+    // a spawn after the epoch is read changes the epoch, so the wait returns immediately
+    uint32_t epoch = mEpoch.load();
+    mSleeping.fetch_add(1);
+    task = findTask(index);
+    if (!task && !mStop.load()) {
+      mEpoch.wait(epoch);
+    }
+    mSleeping.fetch_sub(1);
+    if (task) {
+      runTask(task);
+    }
+  }
+}
+
+void TaskGroup::finish(std::exception_ptr exception) {
+  // notified under the lock, so wait() cannot return while this task still uses the group
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (exception && !mException) {
+    mException = exception;
+  }
+  if (mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    mDone.notify_all();
+  }
+}
+
+void TaskGroup::waitNoThrow() {
+  bool worker = mScheduler.getCurrentWorkerIndex() >= 0;
+  while (mPending.load(std::memory_order_acquire)) {
+    if (worker) {
+      // keep the worker busy, the tasks of this group may be queued behind it
+      if (!mScheduler.runPendingTask()) {
+        std::this_thread::yield();
+      }
+    } else {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mDone.wait(lock, [this]() { return mPending.load(std::memory_order_acquire) == 0; });
+    }
+  }
+  std::lock_guard<std::mutex> lock(mMutex);
+}
+
+void TaskGroup::wait() {
+  waitNoThrow();
+  std::exception_ptr exception;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::swap(exception, mException);
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void TaskQueue::wait() {
+  std::unique_lock<std::mutex> lock(mMutex);
+  mIdle.wait(lock, [this]() { return !mRunning; });
+}
+
+size_t TaskQueue::getPendingCount() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mTasks.size();
+}
+
+void TaskQueue::enqueue(Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTasks.push_back(std::move(task));
+    if (mRunning) {
+      return;
+    }
+    mRunning = true;
+  }
+  mScheduler.spawn([this]() { drain(); });
+}
+
+void TaskQueue::drain() {
+  while (true) {
+    Task task;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (mTasks.empty()) {
+        mRunning = false;
+        mIdle.notify_all();
+        return;
+      }
+      task = std::move(mTasks.front());
+      mTasks.pop_front();
+    }
+    task();
+  }
+}
+
+} // namespace sapien
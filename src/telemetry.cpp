@@ -0,0 +1,209 @@
+#include "sapien/telemetry.h"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+
+namespace sapien {
+
+static constexpr std::array<char const *, static_cast<size_t>(TelemetryPhase::eCOUNT)>
+    kPhaseNames = {"prestep",        "cleanup",       "simulate",   "fetch_results",
+                   "event_dispatch", "update_render", "pack_scene", "unpack_scene"};
+
+char const *getTelemetryPhaseName(TelemetryPhase phase) {
+  return kPhaseNames.at(static_cast<size_t>(phase));
+}
+
+TelemetryPhase getTelemetryPhaseByName(std::string const &name) {
+  for (size_t i = 0; i < kPhaseNames.size(); ++i) {
+    if (name == kPhaseNames[i]) {
+      return static_cast<TelemetryPhase>(i);
+    }
+  }
+  throw std::runtime_error("invalid telemetry phase: " + name);
+}
+
+SceneTelemetry::SceneTelemetry() : mEpoch(Clock::now()) {}
+
+void SceneTelemetry::setEnabled(bool enabled, bool trace) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mTrace = enabled && trace;
+  if (mTrace && mTraceEvents.empty()) {
+    mTraceEvents.reserve(kTraceCapacity);
+  }
+  mEnabled = enabled;
+}
+
+void SceneTelemetry::reset() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mPhases = {};
+  mSteps = 0;
+  mContactPairs = mContactPoints = 0;
+  mStepContactPairs = mStepContactPoints = 0;
+  mLastStepContactPairs = mLastStepContactPoints = 0;
+  mSimulationStatistics = {};
+  mTraceEvents.clear();
+  mTraceNext = 0;
+  mEpoch = Clock::now();
+}
+
+void SceneTelemetry::record(TelemetryPhase phase, Clock::time_point start,
+                            Clock::time_point end) {
+  uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto &data = mPhases[static_cast<size_t>(phase)];
+  data.stats.count += 1;
+  data.stats.totalNs += duration;
+  data.stats.lastNs = duration;
+  data.stats.maxNs = std::max(data.stats.maxNs, duration);
+  data.window[data.windowNext] = duration;
+  data.windowNext = (data.windowNext + 1) % kWindowSize;
+  data.windowSize = std::min(data.windowSize + 1, kWindowSize);
+
+  if (mTrace) {
+    TraceEvent event{
+        phase, static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())),
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(start - mEpoch).count()),
+        duration};
+    if (mTraceEvents.size() < kTraceCapacity) {
+      mTraceEvents.push_back(event);
+    } else {
+      mTraceEvents[mTraceNext] = event;
+    }
+    mTraceNext = (mTraceNext + 1) % kTraceCapacity;
+  }
+}
+
+void SceneTelemetry::endStep(physx::PxScene &scene) {
+  if (!isEnabled()) {
+    return;
+  }
+  physx::PxSimulationStatistics statistics;
+  scene.getSimulationStatistics(statistics);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  mSteps += 1;
+  mContactPairs += mStepContactPairs;
+  mContactPoints += mStepContactPoints;
+  mLastStepContactPairs = mStepContactPairs;
+  mLastStepContactPoints = mStepContactPoints;
+  mStepContactPairs = mStepContactPoints = 0;
+  mSimulationStatistics = statistics;
+}
+
+TelemetrySnapshot SceneTelemetry::getSnapshot() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  TelemetrySnapshot snapshot;
+  snapshot.steps = mSteps;
+  snapshot.contactPairs = mContactPairs;
+  snapshot.contactPoints = mContactPoints;
+  snapshot.lastStepContactPairs = mLastStepContactPairs;
+  snapshot.lastStepContactPoints = mLastStepContactPoints;
+
+  for (size_t i = 0; i < mPhases.size(); ++i) {
+    auto &data = mPhases[i];
+    auto stats = data.stats;
+    if (data.windowSize) {
+      std::vector<uint64_t> window(data.window.begin(), data.window.begin() + data.windowSize);
+      std::sort(window.begin(), window.end());
+      auto percentile = [&](double p) {
+        return window[std::min<size_t>(window.size() - 1, p * window.size())];
+      };
+      stats.p50Ns = percentile(0.5);
+      stats.p90Ns = percentile(0.9);
+      stats.p99Ns = percentile(0.99);
+    }
+    snapshot.phases[kPhaseNames[i]] = stats;
+  }
+
+  auto &s = mSimulationStatistics;
+  snapshot.simulationStatistics = {
+      {"active_constraints", s.nbActiveConstraints},
+      {"active_dynamic_bodies", s.nbActiveDynamicBodies},
+      {"active_kinematic_bodies", s.nbActiveKinematicBodies},
+      {"static_bodies", s.nbStaticBodies},
+      {"dynamic_bodies", s.nbDynamicBodies},
+      {"kinematic_bodies", s.nbKinematicBodies},
+      {"aggregates", s.nbAggregates},
+      {"articulations", s.nbArticulations},
+      {"axis_solver_constraints", s.nbAxisSolverConstraints},
+      {"compressed_contact_size", s.compressedContactSize},
+      {"required_contact_constraint_memory", s.requiredContactConstraintMemory},
+      {"peak_constraint_memory", s.peakConstraintMemory},
+      {"discrete_contact_pairs", s.nbDiscreteContactPairsTotal},
+      {"discrete_contact_pairs_cache_hits", s.nbDiscreteContactPairsWithCacheHits},
+      {"discrete_contact_pairs_with_contacts", s.nbDiscreteContactPairsWithContacts},
+      {"new_pairs", s.nbNewPairs},
+      {"lost_pairs", s.nbLostPairs},
+      {"new_touches", s.nbNewTouches},
+      {"lost_touches", s.nbLostTouches},
+      {"partitions", s.nbPartitions},
+      {"broadphase_adds", s.getNbBroadPhaseAdds()},
+      {"broadphase_removes", s.getNbBroadPhaseRemoves()}};
+  return snapshot;
+}
+
+std::vector<uint64_t> SceneTelemetry::getHistogram(TelemetryPhase phase) const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto &data = mPhases[static_cast<size_t>(phase)];
+  std::vector<uint64_t> histogram(kHistogramBuckets, 0);
+  for (uint32_t i = 0; i < data.windowSize; ++i) {
+    uint32_t bucket = data.window[i] ? std::bit_width(data.window[i]) - 1 : 0;
+    histogram[std::min(bucket, kHistogramBuckets - 1)] += 1;
+  }
+  return histogram;
+}
+
+// quotes, backslashes and control characters would break the JSON string they go into
+static std::string jsonEscape(std::string const &text) {
+  std::string escaped;
+  for (unsigned char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (c < 0x20) {
+      char code[8];
+      std::snprintf(code, sizeof(code), "\\u%04x", c);
+      escaped += code;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void SceneTelemetry::exportChromeTrace(std::string const &filename,
+                                       std::string const &processName) const {
+  std::ofstream file(filename);
+  if (!file) {
+    throw std::runtime_error("failed to open " + filename);
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  file << std::fixed << std::setprecision(3);
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\""
+       << jsonEscape(processName) << "\"}}";
+  std::array<std::string, kPhaseNames.size()> names;
+  for (size_t i = 0; i < names.size(); ++i) {
+    names[i] = jsonEscape(kPhaseNames[i]);
+  }
+  // oldest event first once the ring buffer wrapped
+  size_t begin = mTraceEvents.size() == kTraceCapacity ? mTraceNext : 0;
+  for (size_t i = 0; i < mTraceEvents.size(); ++i) {
+    auto &event = mTraceEvents[(begin + i) % mTraceEvents.size()];
+    file << ",\n{\"name\":\"" << names[static_cast<size_t>(event.phase)]
+         << "\",\"cat\":\"sapien\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+         << ",\"ts\":" << event.startNs / 1000.0 << ",\"dur\":" << event.durationNs / 1000.0
+         << "}";
+  }
+  file << "\n]}\n";
+}
+
+} // namespace sapien
@@ -2,6 +2,8 @@ import unittest
 import sapien.core as sapien
 import numpy as np
 import os
+import shutil
+import tempfile
 
 
 class TestArticulation(unittest.TestCase):
@@ -5687,3 +5689,285 @@ class TestArticulation(unittest.TestCase):
                 ],
             )
         )
+
+    def test_kinematics_cache(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+
+        robot.set_qpos([0.1] * robot.dof)
+        robot.reset_kinematics_cache_stats()
+        J0 = robot.compute_world_cartesian_jacobian()
+        J1 = robot.compute_world_cartesian_jacobian()
+        self.assertTrue(np.allclose(J0, J1))
+        self.assertEqual(robot.get_kinematics_cache_stats(), {"hits": 1, "misses": 1})
+
+        robot.set_qpos([0.2] * robot.dof)
+        J2 = robot.compute_world_cartesian_jacobian()
+        self.assertEqual(robot.get_kinematics_cache_stats()["misses"], 2)
+
+        robot.kinematics_cache_enabled = False
+        self.assertTrue(np.allclose(robot.compute_world_cartesian_jacobian(), J2))
+
+        robot.kinematics_cache_enabled = True
+        scene.step()
+        robot.reset_kinematics_cache_stats()
+        robot.compute_passive_force()
+        robot.compute_passive_force()
+        self.assertEqual(robot.get_kinematics_cache_stats(), {"hits": 2, "misses": 2})
+
+        # the Jacobian computed inside the pseudo inverse is not counted on its own
+        robot.set_qpos([0.3] * robot.dof)
+        robot.reset_kinematics_cache_stats()
+        robot.compute_cartesian_diff_ik(np.ones(6), 5)
+        self.assertEqual(robot.get_kinematics_cache_stats(), {"hits": 0, "misses": 1})
+        robot.compute_cartesian_diff_ik(np.ones(6), 5)
+        robot.compute_world_cartesian_jacobian()
+        self.assertEqual(robot.get_kinematics_cache_stats(), {"hits": 2, "misses": 1})
+
+    def test_analytic_ik(self):
+        axes = ["0 0 1", "0 1 0", "0 1 0", "0 0 1", "0 1 0", "0 0 1"]
+        origins = ["0 0 0.3", "0 0.1 0", "0.4 -0.05 0.02", "0.05 0 0.35", "0 0 0", "0 0 0"]
+        inertial = '<inertial><mass value="1"/><inertia ixx="0.01" iyy="0.01" izz="0.01" ixy="0" ixz="0" iyz="0"/></inertial>'
+        urdf = '<robot name="arm"><link name="base">{}</link>'.format(inertial)
+        for i in range(6):
+            urdf += '<link name="l{}">{}</link>'.format(i, inertial)
+            urdf += '<joint name="j{}" type="revolute"><parent link="{}"/><child link="l{}"/><origin xyz="{}"/><axis xyz="{}"/><limit lower="-3" upper="3" effort="10" velocity="1"/></joint>'.format(
+                i, "base" if i == 0 else "l{}".format(i - 1), i, origins[i], axes[i]
+            )
+        urdf += "</robot>"
+
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        loader = scene.create_urdf_loader()
+        loader.fix_root_link = True
+        robot = loader.load_from_string(urdf, "")
+        model = robot.create_pinocchio_model()
+        ee = len(robot.get_links()) - 1
+        self.assertEqual(model.get_ik_solver_name(ee), "wrist_partitioned")
+        self.assertEqual(model.get_ik_solver_name(0), "clik")
+
+        qpos = np.array([0.3, -0.5, 0.8, 0.2, 1.0, -0.4])
+        model.compute_forward_kinematics(qpos)
+        target = model.get_link_pose(ee)
+        for analytic in [True, False]:
+            model.analytic_ik_enabled = analytic
+            result, success, error = model.compute_inverse_kinematics(ee, target, qpos + 0.1)
+            self.assertTrue(success)
+            model.compute_forward_kinematics(result)
+            pose = model.get_link_pose(ee)
+            self.assertTrue(np.allclose(pose.p, target.p, atol=1e-3))
+            # q and -q are the same rotation
+            self.assertGreater(abs(np.dot(pose.q, target.q)), 1 - 1e-5)
+
+    def test_fixed_dof_kernel(self):
+        axes = ["0 0 1", "0 1 0", "0 0 1", "0 1 0", "0 0 1", "0 1 0", "0 0 1"]
+        types = ["revolute", "revolute", "continuous", "revolute", "continuous", "revolute", "continuous"]
+        inertial = '<inertial><mass value="1"/><inertia ixx="0.01" iyy="0.01" izz="0.01" ixy="0" ixz="0" iyz="0"/></inertial>'
+        urdf = '<robot name="arm"><link name="base">{}</link>'.format(inertial)
+        for i in range(7):
+            limit = '<limit lower="-2.5" upper="2.5" effort="10" velocity="1"/>' if types[i] == "revolute" else ""
+            urdf += '<link name="l{}">{}</link>'.format(i, inertial)
+            urdf += '<joint name="j{}" type="{}"><parent link="{}"/><child link="l{}"/><origin xyz="0.02 0 0.15" rpy="0.1 0 0"/><axis xyz="{}"/>{}</joint>'.format(
+                i, types[i], "base" if i == 0 else "l{}".format(i - 1), i, axes[i], limit
+            )
+        urdf += "</robot>"
+
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        loader = scene.create_urdf_loader()
+        loader.fix_root_link = True
+        robot = loader.load_from_string(urdf, "")
+        model = robot.create_pinocchio_model()
+        model.analytic_ik_enabled = False
+        self.assertEqual(model.kinematics_kernel, "pinocchio")
+
+        n = len(robot.get_links())
+        qpos = np.array([0.3, -0.5, 2.8, 0.2, -3.0, 0.7, 1.5])
+
+        def evaluate():
+            model.compute_forward_kinematics(qpos)
+            poses = [model.get_link_pose(i) for i in range(n)]
+            model.compute_full_jacobian(qpos)
+            world = [model.get_link_jacobian(i, local=False) for i in range(n)]
+            local = [model.get_link_jacobian(i, local=True) for i in range(n)]
+            single = [model.compute_single_link_local_jacobian(qpos, i) for i in range(n)]
+            return poses, world, local, single
+
+        expected = evaluate()
+        model.set_fixed_dof_kernel_enabled(True)
+        self.assertEqual(model.kinematics_kernel, "fixed<7, double>")
+        actual = evaluate()
+
+        for p0, p1 in zip(expected[0], actual[0]):
+            self.assertTrue(np.allclose(p0.p, p1.p, atol=1e-8))
+            self.assertTrue(np.allclose(p0.q, p1.q, atol=1e-8) or np.allclose(p0.q, -p1.q, atol=1e-8))
+        for J0s, J1s in zip(expected[1:], actual[1:]):
+            for J0, J1 in zip(J0s, J1s):
+                self.assertTrue(np.allclose(J0, J1, atol=1e-8))
+
+        ee = n - 1
+        model.compute_forward_kinematics(qpos)
+        target = model.get_link_pose(ee)
+        result, success, error = model.compute_inverse_kinematics(ee, target, qpos + 0.1)
+        self.assertTrue(success)
+        self.assertTrue(np.all(np.abs(result[[2, 4, 6]]) <= np.pi))
+        model.set_fixed_dof_kernel_enabled(False)
+        model.compute_forward_kinematics(result)
+        pose = model.get_link_pose(ee)
+        self.assertTrue(np.allclose(pose.p, target.p, atol=1e-3))
+
+    def test_disabled_collision_pairs(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+
+        pairs = robot.generate_disabled_collision_pairs(sample_count=200, thread_count=2)
+        self.assertEqual(pairs.sample_count, 200)
+        self.assertGreater(len(pairs.adjacent), 0)
+        disabled = len(pairs.always_colliding) + len(pairs.never_colliding)
+        self.assertLessEqual(disabled, pairs.candidate_pairs)
+
+        self.assertEqual(robot.apply_disabled_collision_pairs(pairs), pairs.disabled_pairs)
+        self.assertLessEqual(pairs.disabled_pairs, disabled)
+
+        parsed = sapien.DisabledCollisionPairs.from_srdf(pairs.to_srdf(robot.name))
+        self.assertEqual(parsed.never_colliding, pairs.never_colliding)
+
+        def group2(robot):
+            return [
+                s.get_collision_groups()[2]
+                for link in robot.get_links()
+                for s in link.get_collision_shapes()
+            ]
+
+        urdf = os.path.join(os.path.dirname(__file__), "movo_simple.urdf")
+        plain = loader.load(urdf)
+        self.assertFalse(any(group2(plain)))
+
+        # groups set by the user are kept, pairs of that link stay enabled
+        user = loader.load(urdf)
+        l1, l2 = pairs.never_colliding[0]
+        link = next(l for l in user.get_links() if l.name == l1)
+        for s in link.get_collision_shapes():
+            s.set_collision_groups(1, 1, 4, 7)
+        user.apply_disabled_collision_pairs(pairs)
+        for s in link.get_collision_shapes():
+            self.assertEqual(list(s.get_collision_groups()), [1, 1, 4, 7])
+        self.assertLess(pairs.disabled_pairs, disabled)
+
+        loader.auto_disable_collisions = True
+        loader.collision_sample_count = 200
+        robot2 = loader.load(urdf)
+        self.assertTrue(any(group2(robot2)))
+        # the second load hits the cache
+        robot3 = loader.load(urdf)
+        self.assertEqual(group2(robot3), group2(robot2))
+        scene.step()
+
+    def test_srdf_collision_pairs(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        loader = scene.create_urdf_loader()
+        urdf = os.path.join(os.path.dirname(__file__), "movo_simple.urdf")
+        robot = loader.load(urdf)
+        pairs = robot.generate_disabled_collision_pairs(sample_count=200)
+        self.assertGreater(len(pairs.never_colliding), 0)
+
+        def groups(robot):
+            return {
+                link.name: [s.get_collision_groups() for s in link.get_collision_shapes()]
+                for link in robot.get_links()
+            }
+
+        def ignored(robot, l1, l2):
+            g = groups(robot)
+            return all(
+                (a[2] & b[2]) and (a[3] & 0xFFFF) == (b[3] & 0xFFFF) for a in g[l1] for b in g[l2]
+            )
+
+        # what applying the pairs directly gives
+        expected = loader.load(urdf)
+        expected.apply_disabled_collision_pairs(pairs)
+
+        with tempfile.TemporaryDirectory() as d:
+            copy = os.path.join(d, "movo_simple.urdf")
+            shutil.copy(urdf, copy)
+            with open(os.path.join(d, "movo_simple.srdf"), "w") as f:
+                f.write(pairs.to_srdf(robot.name))
+
+            for auto in [False, True]:
+                loader.auto_disable_collisions = auto
+                loaded = loader.load(copy)
+                for l1, l2 in pairs.never_colliding + pairs.always_colliding:
+                    self.assertEqual(ignored(loaded, l1, l2), ignored(expected, l1, l2))
+                self.assertTrue(any(ignored(loaded, l1, l2) for l1, l2 in pairs.never_colliding))
+                # adjacent links are left to PhysX
+                g = groups(loaded)
+                l1, l2 = next((a, b) for a, b in pairs.adjacent if g[a] and g[b])
+                self.assertFalse(ignored(loaded, l1, l2))
+        scene.step()
+
+    def test_controllers(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        scene.set_timestep(1 / 200)
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+        dof = robot.dof
+
+        positions = np.array([np.zeros(dof), np.full(dof, 0.2), np.full(dof, 0.1)])
+        trajectory = sapien.JointTrajectory([0, 0.5, 1], positions)
+        self.assertEqual(trajectory.dof, dof)
+        q, v, a = trajectory.sample(0.5)
+        self.assertTrue(np.allclose(q, 0.2))
+        q, v, a = trajectory.sample(2)
+        self.assertTrue(np.allclose(q, 0.1))
+        self.assertTrue(np.allclose(v, 0))
+        with self.assertRaises(RuntimeError):
+            sapien.JointTrajectory([1, 0], positions[:2])
+        with self.assertRaises(RuntimeError):
+            robot.set_controller(
+                sapien.TrajectoryController(sapien.JointTrajectory([0, 1, 2], positions[:, :1]))
+            )
+
+        # waypoint tracking through the joint drives
+        for j in robot.get_active_joints():
+            j.set_drive_property(1000, 100)
+        controller = sapien.TrajectoryController(trajectory)
+        robot.set_controller(controller)
+        for _ in range(100):
+            scene.step()
+        self.assertAlmostEqual(controller.time, 0.5, places=4)
+        self.assertTrue(np.allclose(robot.get_drive_target(), 0.2, atol=1e-3))
+        for _ in range(120):
+            scene.step()
+        self.assertTrue(controller.finished)
+        self.assertTrue(np.allclose(robot.get_drive_target(), 0.1))
+
+        # torque controllers take over from the drives
+        for j in robot.get_active_joints():
+            j.set_drive_property(0, 0)
+        robot.set_qpos(np.zeros(dof))
+        robot.set_qvel(np.zeros(dof))
+        target = sapien.JointTrajectory([0], np.full((1, dof), 0.1))
+        robot.set_controller(
+            sapien.JointImpedanceController(target, np.full(dof, 1000), np.full(dof, 100))
+        )
+        for _ in range(400):
+            scene.step()
+        self.assertLess(np.abs(robot.get_qpos() - 0.1).max(), 0.05)
+
+        robot.set_qpos(np.zeros(dof))
+        robot.set_qvel(np.zeros(dof))
+        robot.set_controller(
+            sapien.ComputedTorqueController(trajectory, np.full(dof, 400), np.full(dof, 40))
+        )
+        for _ in range(400):
+            scene.step()
+        self.assertLess(np.abs(robot.get_qpos() - 0.1).max(), 0.05)
+
+        robot.set_controller(None)
+        self.assertIsNone(robot.get_controller())
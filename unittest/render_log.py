@@ -0,0 +1,65 @@
+import os
+import tempfile
+import unittest
+
+import numpy as np
+import sapien.core as sapien
+
+
+class TestRenderLog(unittest.TestCase):
+    def test_record_replay(self):
+        half = 0.1
+        distances = [1.0, 1.5, 2.0, 2.5]
+        log = os.path.join(tempfile.mkdtemp(), "render_log.bin")
+
+        engine = sapien.Engine()
+        recorder = sapien.RenderLogRecorder(log)
+        engine.set_renderer(recorder)
+        scene = engine.create_scene()
+        other = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_visual(half_size=[half] * 3, color=[1, 0, 0])
+        box = builder.build_kinematic()
+        camera = scene.add_camera("cam", 32, 32, 1, 0.01, 10)
+        other_camera = other.add_camera("cam", 32, 32, 1, 0.01, 10)
+
+        # a material of another renderer is rejected before anything is written
+        builder = scene.create_actor_builder()
+        builder.add_box_visual(
+            half_size=[half] * 3, material=sapien.SoftRenderer().create_material()
+        )
+        with self.assertRaises(RuntimeError):
+            builder.build_kinematic()
+
+        for d in distances:
+            box.set_pose(sapien.Pose([d, 0, 0]))
+            # a camera of another scene is rejected without dropping the moved box
+            with self.assertRaises(RuntimeError):
+                scene._update_render_and_take_pictures([other_camera])
+            scene.update_render()
+            camera.take_picture()
+
+        actor_id = box.get_id()
+        visual_id = box.get_visual_bodies()[0].get_visual_id()
+        scene = None
+        other = None
+        recorder.flush()
+
+        replayer = sapien.RenderLogReplayer(log, sapien.SoftRenderer())
+        pictures = []
+
+        def on_picture(scene_index, camera_index, frame):
+            position = replayer.get_float_texture(scene_index, camera_index, "Position")
+            seg = replayer.get_uint32_texture(scene_index, camera_index, "Segmentation")
+            pictures.append((scene_index, camera_index, -position[16, 16, 2], seg[16, 16, :2]))
+
+        replayer.set_picture_callback(on_picture)
+        replayer.run()
+
+        self.assertEqual(len(pictures), len(distances))
+        for (scene_index, camera_index, depth, seg), d in zip(pictures, distances):
+            self.assertEqual((scene_index, camera_index), (0, 0))
+            self.assertAlmostEqual(depth, d - half, places=4)
+            self.assertEqual(list(seg), [visual_id, actor_id])
+
+        os.remove(log)
@@ -1,3 +1,6 @@
+import json
+import os
+import tempfile
 import unittest
 import sapien.core as sapien
 from common import *
@@ -162,3 +165,473 @@ class TestScene(unittest.TestCase):
         )
 
         # TODO: check details of the built shapes
+
+    def test_aggregate(self):
+        engine = sapien.Engine()
+        config = sapien.SceneConfig()
+        config.aggregate_articulations = True
+        config.aggregate_shape_threshold = 3
+        scene = engine.create_scene(config)
+
+        builder = scene.create_actor_builder()
+        for i in range(3):
+            builder.add_box_collision(sapien.Pose([i, 0, 0]))
+        actor = builder.build()
+        builder.set_use_aggregate(False)
+        builder.build()
+        self.assertEqual(scene.aggregate_count, 1)
+
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+        self.assertEqual(scene.aggregate_count, 2)
+        scene.step()
+
+        scene.remove_actor(actor)
+        scene.remove_articulation(robot)
+        scene.step()
+        self.assertEqual(scene.aggregate_count, 0)
+
+    def test_actor_pool(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_collision(half_size=[0.1, 0.1, 0.1])
+        actor = builder.build()
+        mass = actor.mass
+        n_actors = len(scene.get_all_actors())
+
+        scene.park_actor(actor, "box")
+        self.assertEqual(len(scene.get_all_actors()), n_actors - 1)
+        self.assertEqual(scene.get_parked_count("box"), 1)
+        self.assertIsNone(scene.unpark_actor("sphere", sapien.Pose()))
+        scene.step()
+
+        material = scene.create_physical_material(0.9, 0.8, 0)
+        reused = scene.unpark_actor("box", sapien.Pose([1, 2, 3]), 2, material)
+        self.assertEqual(reused.id, actor.id)
+        self.assertEqual(scene.get_parked_count("box"), 0)
+        self.assertAlmostEqual(reused.scale, 2)
+        self.assertAlmostEqual(reused.mass, mass * 8, places=3)
+        shape = reused.get_collision_shapes()[0]
+        self.assertTrue(np.allclose(shape.geometry.half_lengths, [0.2, 0.2, 0.2]))
+        self.assertAlmostEqual(shape.get_physical_material().static_friction, 0.9)
+        self.assertTrue(np.allclose(reused.pose.p, [1, 2, 3]))
+        scene.step()
+
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+        scene.park_articulation(robot, "movo")
+        self.assertEqual(len(scene.get_all_articulations()), 0)
+        scene.step()
+        reused = scene.unpark_articulation("movo", sapien.Pose([0, 1, 0]))
+        self.assertTrue(np.allclose(reused.get_root_pose().p, [0, 1, 0]))
+        scene.step()
+
+        scene.park_articulation(reused, "movo")
+        scene.clear_actor_pool()
+        self.assertEqual(scene.get_parked_count("movo"), 0)
+
+    def test_remove_parked(self):
+        engine = sapien.Engine()
+        engine.set_renderer(sapien.SoftRenderer())
+        scene = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_collision(half_size=[0.1, 0.1, 0.1])
+        first = builder.build()
+        second = builder.build()
+        n_cameras = len(scene.get_cameras())
+        camera = scene.add_camera("cam", 16, 16, 1, 0.01, 10)
+        camera.set_parent(first, keep_pose=False)
+
+        # a removed actor leaves the pool together with its mounted cameras
+        scene.park_actor(second, "box")
+        scene.park_actor(first, "box")
+        scene.remove_actor(first)
+        self.assertEqual(scene.get_parked_count("box"), 1)
+        self.assertEqual(len(scene.get_cameras()), n_cameras)
+        self.assertEqual(scene.unpark_actor("box", sapien.Pose()).id, second.id)
+        self.assertIsNone(scene.unpark_actor("box", sapien.Pose()))
+        scene.step()
+
+        scene.park_actor(second, "box")
+        scene.remove_actor(second)
+        scene.clear_actor_pool()
+        scene.step()
+
+        loader = scene.create_urdf_loader()
+        robot = loader.load(os.path.join(os.path.dirname(__file__), "movo_simple.urdf"))
+        scene.park_articulation(robot, "movo")
+        scene.remove_articulation(robot)
+        self.assertEqual(scene.get_parked_count("movo"), 0)
+        self.assertIsNone(scene.unpark_articulation("movo", sapien.Pose()))
+        scene.clear_actor_pool()
+        scene.step()
+
+    def test_actor_pool_render(self):
+        engine = sapien.Engine()
+        engine.set_renderer(sapien.SoftRenderer())
+        scene = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_collision(half_size=[0.1, 0.1, 0.1])
+        builder.add_box_visual(half_size=[0.1, 0.1, 0.1])
+        mount = builder.build_kinematic()
+        box = builder.build_kinematic()
+        mount.set_pose(sapien.Pose([0, 0, -1]))
+        box.set_pose(sapien.Pose([1, 0, 0]))
+        camera = scene.add_camera("cam", 16, 16, 1, 0.01, 10)
+        camera.set_parent(mount, keep_pose=False)
+        camera.set_local_pose(sapien.Pose([-1, 0, 1]))
+
+        def visible_ids():
+            scene.update_render()
+            camera.take_picture()
+            return set(np.unique(camera.get_uint32_texture("Segmentation")[..., 1]))
+
+        self.assertIn(box.id, visible_ids())
+        box.hide_visual()
+        self.assertNotIn(box.id, visible_ids())
+
+        # the camera stays where it was while its actor is parked
+        scene.park_actor(mount, "mount")
+        scene.park_actor(box, "box")
+        self.assertIsNone(camera.parent)
+        self.assertTrue(np.allclose(camera.get_pose().p, [-1, 0, 0]))
+
+        # hidden visuals stay hidden, the camera is mounted again
+        box = scene.unpark_actor("box", sapien.Pose([1, 0, 0]))
+        self.assertTrue(box.is_hiding_visual())
+        self.assertNotIn(box.id, visible_ids())
+        box.unhide_visual()
+        self.assertIn(box.id, visible_ids())
+
+        mount = scene.unpark_actor("mount", sapien.Pose([0, 0, 1]))
+        self.assertEqual(camera.parent.id, mount.id)
+        self.assertTrue(np.allclose(camera.get_pose().p, [-1, 0, 2]))
+
+    def test_render_pipelining(self):
+        half = 0.1
+        engine = sapien.Engine()
+        engine.set_renderer(sapien.SoftRenderer())
+        scene = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_visual(half_size=[half] * 3)
+        box = builder.build_kinematic()
+        box.set_pose(sapien.Pose([3, 0, 0]))
+        other = builder.build_kinematic()
+        other.set_pose(sapien.Pose([0, 0, -5]))
+        # at the origin looking along +x, one per frame in flight and one being read
+        cameras = [scene.add_camera("cam{}".format(i), 16, 16, 1, 0.01, 10) for i in range(3)]
+
+        def center(camera):
+            return camera.get_float_texture("Depth")[8, 8]
+
+        scene.render_pipelining = True
+        with self.assertRaises(RuntimeError):
+            scene.update_render()
+
+        # without a frame the front snapshot is updated in place and keeps bodies that moved
+        # in an earlier step only
+        other.set_pose(sapien.Pose([1, 0, 0]))
+        scene.step()
+        box.set_pose(sapien.Pose([4, 0, 0]))
+        scene.step()
+        scene.step()
+        count = scene.render_snapshot_count
+        self.assertEqual(scene.render_snapshot_async([cameras[0]]).wait(), count)
+        self.assertAlmostEqual(center(cameras[0]), 1 - half, places=4)
+        other.set_pose(sapien.Pose([0, 0, -5]))
+
+        # each step waits for the frame of two snapshots ago before rewriting its snapshot,
+        # frames still render the poses of their own snapshot
+        xs = []
+        pending = []
+        for frame in range(8):
+            xs.append(1 + 0.25 * frame)
+            box.set_pose(sapien.Pose([xs[-1], 0, 0]))
+            scene.step()
+            pending.append(scene.render_snapshot_async([cameras[frame % 3]]))
+            if frame >= 2:
+                k = frame - 2
+                self.assertEqual(pending[k].wait(), count + k + 1)
+                self.assertAlmostEqual(center(cameras[k % 3]), xs[k] - half, places=4)
+
+        # a snapshot no frame rendered goes back to update_render
+        box.set_pose(sapien.Pose([2, 0, 0]))
+        scene.step()
+        scene.render_pipelining = False
+        scene.update_render()
+        cameras[0].take_picture()
+        self.assertAlmostEqual(center(cameras[0]), 2 - half, places=4)
+
+    def test_memory_stats(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        builder = scene.create_actor_builder()
+        builder.add_box_collision()
+        for i in range(10):
+            builder.build().set_pose(sapien.Pose([0, 0, i * 2.1]))
+        scene.step()
+
+        stats = scene.get_memory_stats()
+        self.assertGreater(stats.bytes_in_use, 0)
+        self.assertGreaterEqual(stats.peak_bytes_in_use, stats.bytes_in_use)
+        self.assertGreaterEqual(stats.bytes_reserved, stats.bytes_in_use)
+        self.assertEqual(sum(stats.bytes_by_category.values()), stats.bytes_in_use)
+
+        total = engine.get_memory_stats()
+        self.assertEqual(total.arenas[0].name, "global")
+        self.assertGreaterEqual(total.bytes_in_use, stats.bytes_in_use)
+
+        del builder
+        del scene
+        self.assertLess(engine.get_memory_stats().bytes_in_use, total.bytes_in_use)
+
+    def test_step_async(self):
+        engine = sapien.Engine()
+        scenes = [engine.create_scene() for _ in range(4)]
+        for scene in scenes:
+            scene.add_ground(0)
+            builder = scene.create_actor_builder()
+            builder.add_box_collision()
+            builder.build().set_pose(sapien.Pose([0, 0, 2]))
+
+        for _ in range(100):
+            scenes[0].step()
+            for f in [scene.step_async() for scene in scenes[1:]]:
+                f.wait()
+        for scene in scenes[1:]:
+            self.assertTrue(
+                np.allclose(scene.get_all_actors()[1].pose.p, scenes[0].get_all_actors()[1].pose.p)
+            )
+
+        with self.assertRaises(RuntimeError):
+            sapien.configure_task_scheduler(2)
+
+    def test_telemetry(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        scene.add_ground(0)
+        builder = scene.create_actor_builder()
+        builder.add_box_collision()
+        builder.build().set_pose(sapien.Pose([0, 0, 1]))
+
+        scene.step()
+        self.assertEqual(scene.get_telemetry().steps, 0)
+
+        scene.enable_telemetry(trace=True)
+        for _ in range(500):
+            scene.step()
+        telemetry = scene.get_telemetry()
+        self.assertEqual(telemetry.steps, 500)
+        self.assertGreater(telemetry.contact_points, 0)
+        simulate = telemetry.phases["simulate"]
+        self.assertEqual(simulate.count, 500)
+        self.assertLessEqual(simulate.p50_ns, simulate.p99_ns)
+        self.assertLessEqual(simulate.p99_ns, simulate.max_ns)
+        self.assertEqual(sum(scene.get_telemetry_histogram("simulate")), 500)
+        self.assertEqual(telemetry.simulation_statistics["dynamic_bodies"], 1)
+        with self.assertRaises(RuntimeError):
+            scene.get_telemetry_histogram("render")
+
+        with tempfile.TemporaryDirectory() as d:
+            filename = os.path.join(d, "trace.json")
+            scene.export_chrome_trace(filename)
+            with open(filename) as f:
+                events = json.load(f)["traceEvents"]
+        self.assertEqual(len([e for e in events if e["name"] == "simulate"]), 500)
+
+        scene.reset_telemetry()
+        self.assertEqual(scene.get_telemetry().steps, 0)
+
+    def test_pack_incremental(self):
+        engine = sapien.Engine()
+        scene = engine.create_scene()
+        scene.add_ground(0)
+        builder = scene.create_actor_builder()
+        builder.add_box_collision(half_size=[0.05, 0.05, 0.05])
+        boxes = [builder.build() for _ in range(10)]
+        for i, box in enumerate(boxes):
+            box.set_pose(sapien.Pose([i * 0.2, 0, 0.05]))
+
+        # new bodies are packed by the first call
+        data = scene.pack_incremental()
+        self.assertEqual(set(data["actor"]), set(scene.pack()["actor"]))
+        self.assertGreaterEqual(scene.moved_actor_count, len(boxes))
+
+        for _ in range(500):
+            scene.step()
+        scene.pack_incremental()
+        scene.step()
+        self.assertEqual(len(scene.pack_incremental()["actor"]), 0)
+
+        boxes[3].set_pose(sapien.Pose([0.6, 0, 1]))
+        data = scene.pack_incremental()
+        self.assertEqual(list(data["actor"]), [boxes[3].id])
+
+        scene.step()
+        data = scene.pack_incremental()
+        self.assertEqual(list(data["actor"]), [boxes[3].id])
+
+        full = scene.pack()
+        scene2 = engine.create_scene()
+        scene2.add_ground(0)
+        builder = scene2.create_actor_builder()
+        builder.add_box_collision(half_size=[0.05, 0.05, 0.05])
+        for _ in range(10):
+            builder.build()
+        scene2.unpack(full)
+        boxes[3].set_pose(sapien.Pose([0.6, 0, 2]))
+        scene2.unpack(scene.pack_incremental())
+        self.assertTrue(np.allclose(scene2.get_all_actors()[4].pose.p, [0.6, 0, 2]))
+
+    def test_scene_delta(self):
+        engine = sapien.Engine()
+        urdf = os.path.join(os.path.dirname(__file__), "movo_simple.urdf")
+
+        def create():
+            scene = engine.create_scene()
+            scene.add_ground(0)
+            builder = scene.create_actor_builder()
+            builder.add_box_collision(half_size=[0.05, 0.05, 0.05])
+            boxes = [builder.build() for _ in range(5)]
+            for i, box in enumerate(boxes):
+                box.set_pose(sapien.Pose([i * 0.2, 1, 0.05]))
+            robot = scene.create_urdf_loader().load(urdf)
+            return scene, boxes, robot
+
+        scene0, boxes0, robot0 = create()
+        scene1, boxes1, robot1 = create()
+        encoder = sapien.SceneDeltaEncoder(scene0)
+        self.assertEqual(encoder.generation, 1)
+
+        for _ in range(500):
+            scene0.step()
+        self.assertEqual(scene1.apply_delta(encoder.encode(0)), 1)
+        self.assertEqual(encoder.capture(), 2)
+        full = encoder.encode(0)
+
+        # a receiver that is up to date gets an empty diff
+        empty = encoder.encode(encoder.generation)
+        self.assertLess(len(empty), 32)
+        self.assertEqual(scene1.apply_delta(empty), encoder.generation)
+
+        boxes0[2].set_pose(sapien.Pose([0.4, 1, 1]))
+        robot0.set_qpos(np.full(robot0.dof, 0.1))
+        encoder.capture()
+        self.assertEqual(encoder.last_changed_count, 2)
+        delta = encoder.encode(2)
+        self.assertLess(len(delta), len(full))
+
+        scene1.apply_delta(full)
+        self.assertEqual(scene1.apply_delta(delta), encoder.generation)
+        self.assertTrue(np.allclose(boxes1[2].pose.p, [0.4, 1, 1]))
+        self.assertTrue(np.allclose(robot1.get_qpos(), robot0.get_qpos()))
+
+        # distinct joint values catch a joint order mixup between packData and set_qpos
+        qpos = np.linspace(-0.3, 0.3, robot1.dof)
+        robot1.set_qpos(qpos)
+        quantized = sapien.SceneDeltaEncoder(scene1, quantize=True, pose_only=True)
+        scene0.apply_delta(quantized.encode(0))
+        self.assertTrue(np.allclose(boxes0[2].pose.p, [0.4, 1, 1], atol=1e-4))
+        self.assertTrue(np.allclose(robot0.get_qpos(), qpos, atol=1e-4))
+        self.assertLess(len(quantized.encode(0)), len(encoder.encode(0)))
+
+        with self.assertRaises(RuntimeError):
+            encoder.encode(encoder.generation + 1)
+        with self.assertRaises(RuntimeError):
+            scene1.apply_delta(delta[:-1])
+
+    def test_control_step(self):
+        engine = sapien.Engine()
+        urdf = os.path.join(os.path.dirname(__file__), "movo_simple.urdf")
+
+        def create():
+            scene = engine.create_scene()
+            scene.add_ground(0)
+            robot = scene.create_urdf_loader().load(urdf)
+            for j in robot.get_active_joints():
+                j.set_drive_property(1000, 100)
+            return scene, robot
+
+        scene0, robot0 = create()
+        scene1, robot1 = create()
+        target = np.full(robot0.dof, 0.1)
+
+        # hold matches setting the target and stepping from python
+        robot0.set_drive_target(target)
+        for _ in range(10):
+            scene0.step()
+        result = scene1.control_step(
+            [sapien.ArticulationAction(robot1, target)],
+            substeps=10,
+            observe_root_pose=True,
+            observe_contact_forces=True,
+        )
+        self.assertEqual(result.substeps, 10)
+        observation = result.articulations[0]
+        self.assertTrue(np.allclose(observation.qpos, robot0.get_qpos()))
+        self.assertTrue(np.allclose(observation.qvel, robot0.get_qvel()))
+        self.assertTrue(np.allclose(observation.root_pose.p, robot0.get_root_pose().p))
+        self.assertEqual(observation.link_contact_forces.shape, (len(robot1.get_links()), 3))
+
+        # linear reaches the target at the last substep
+        target = np.full(robot1.dof, 0.2)
+        result = scene1.control_step(
+            [sapien.ArticulationAction(robot1, target)], substeps=5, interpolation="linear"
+        ).articulations[0]
+        self.assertTrue(np.allclose(robot1.get_drive_target(), target))
+        self.assertEqual(len(result.qpos), robot1.dof)
+
+        result = scene1.control_step_async(
+            [sapien.ArticulationAction(robot1, target)], substeps=2, interpolation="cubic"
+        ).wait()
+        self.assertEqual(result.substeps, 2)
+
+        with self.assertRaises(RuntimeError):
+            scene1.control_step([sapien.ArticulationAction(robot1, target)], interpolation="x")
+        with self.assertRaises(RuntimeError):
+            scene1.control_step([sapien.ArticulationAction(robot0, target)])
+        with self.assertRaises(RuntimeError):
+            scene1.control_step([sapien.ArticulationAction(robot1, target[:1])])
+
+    def test_broadphase(self):
+        engine = sapien.Engine()
+        for broadphase in ["sap", "abp"]:
+            config = sapien.SceneConfig()
+            config.broadphase = broadphase
+            scene = engine.create_scene(config)
+            self.assertEqual(scene.broadphase_region_count, 0)
+
+        config = sapien.SceneConfig()
+        config.broadphase = "invalid"
+        with self.assertRaises(RuntimeError):
+            engine.create_scene(config)
+
+        config = sapien.SceneConfig()
+        config.broadphase = "mbp"
+        config.mbp_world_lower = [-10, -10, -10]
+        config.mbp_world_upper = [10, 10, 10]
+        config.mbp_subdivisions = 4
+        scene = engine.create_scene(config)
+        scene.add_ground(0)
+        self.assertEqual(scene.broadphase_region_count, 16)
+
+        builder = scene.create_actor_builder()
+        builder.add_box_collision()
+        far = builder.build()
+        far.set_pose(sapien.Pose([100, 0, 1]))
+        builder.build().set_pose(sapien.Pose([0, 0, 1]))
+        # the moved actor is reported out of bounds by the first step
+        scene.step()
+        scene.step()
+        lower, upper = scene.get_broadphase_world_bounds()
+        self.assertGreater(upper[0], 100)
+        self.assertEqual(scene.broadphase_region_count, 16)
+
+        # an actor leaving the world grows it during the next step
+        far.set_velocity([0, 2000, 0])
+        scene.step()
+        far.set_velocity([0, 0, 0])
+        scene.step()
+        lower, upper = scene.get_broadphase_world_bounds()
+        self.assertGreater(upper[1], far.pose.p[1])
@@ -0,0 +1,97 @@
+import unittest
+
+import sapien.core as sapien
+
+ADDRESSES = ["shard0:15003", "shard1:15003", "shard2:15003", "shard3:15003"]
+
+
+class FakeShard:
+    def __init__(self):
+        self.scenes = []
+        self.down = False
+
+    def create_scene(self, key):
+        if self.down:
+            raise RuntimeError("unreachable")
+        self.scenes.append(key)
+
+
+class TestShardPlacement(unittest.TestCase):
+    def setUp(self):
+        # the engine sets up the logger that reports failed shards
+        self.engine = sapien.Engine()
+
+    def place(self, placer, shards, key):
+        load = [(len(s.scenes), 0) for s in shards]
+        return placer.place(key, load, lambda index: shards[index].create_scene(key))
+
+    def test_least_loaded(self):
+        placer = sapien.ShardPlacer(ADDRESSES[:3], "least_loaded")
+        self.assertEqual(placer.order("a", [(2, 0), (0, 5), (0, 1)]), [2, 1, 0])
+        # equal load keeps the address order
+        self.assertEqual(placer.order("a", [(1, 1)] * 3), [0, 1, 2])
+
+        shards = [FakeShard() for _ in range(3)]
+        for i in range(9):
+            self.place(placer, shards, str(i))
+        self.assertEqual([len(s.scenes) for s in shards], [3, 3, 3])
+
+    def test_least_loaded_failover(self):
+        placer = sapien.ShardPlacer(ADDRESSES[:3], "least_loaded")
+        shards = [FakeShard() for _ in range(3)]
+        shards[0].down = True
+        self.assertEqual(self.place(placer, shards, "a"), 1)
+        self.assertFalse(placer.is_healthy(0))
+
+        # an unhealthy shard is skipped even when it is reachable again
+        shards[0].down = False
+        self.assertEqual(self.place(placer, shards, "b"), 2)
+        self.assertEqual(shards[0].scenes, [])
+        placer.set_healthy(0, True)
+        self.assertEqual(self.place(placer, shards, "c"), 0)
+
+        for s in shards:
+            s.down = True
+        with self.assertRaises(RuntimeError):
+            self.place(placer, shards, "d")
+        self.assertFalse(any(placer.is_healthy(i) for i in range(placer.shard_count)))
+
+    def test_consistent_hash(self):
+        keys = ["scene{}".format(i) for i in range(200)]
+        placer = sapien.ShardPlacer(ADDRESSES, "consistent_hash")
+        shards = [FakeShard() for _ in ADDRESSES]
+        home = {k: self.place(placer, shards, k) for k in keys}
+        # every shard gets some scenes and the order tries each shard once
+        self.assertTrue(all(len(s.scenes) > 0 for s in shards))
+        for k in keys[:10]:
+            order = placer.order(k, [])
+            self.assertEqual(sorted(order), list(range(len(ADDRESSES))))
+            self.assertEqual(order[0], home[k])
+
+        # placement does not depend on load or on the placer instance
+        other = sapien.ShardPlacer(ADDRESSES, "consistent_hash")
+        for k in keys:
+            self.assertEqual(other.order(k, [(100, 100)] * len(ADDRESSES))[0], home[k])
+
+        # adding a shard only moves scenes onto the new shard
+        grown = sapien.ShardPlacer(ADDRESSES + ["shard4:15003"], "consistent_hash")
+        moved = [k for k in keys if grown.order(k, [])[0] != home[k]]
+        self.assertTrue(0 < len(moved) < len(keys) / 2)
+        self.assertTrue(all(grown.order(k, [])[0] == len(ADDRESSES) for k in moved))
+
+    def test_consistent_hash_failover(self):
+        keys = ["scene{}".format(i) for i in range(200)]
+        placer = sapien.ShardPlacer(ADDRESSES, "consistent_hash")
+        home = {k: placer.order(k, [])[0] for k in keys}
+
+        shards = [FakeShard() for _ in ADDRESSES]
+        shards[1].down = True
+        for k in keys:
+            index = self.place(placer, shards, k)
+            if home[k] == 1:
+                # scenes of the failed shard go to the next shard on the ring
+                self.assertEqual(index, placer.order(k, [])[1])
+            else:
+                self.assertEqual(index, home[k])
+        self.assertFalse(placer.is_healthy(1))
+        self.assertEqual(shards[1].scenes, [])
@@ -0,0 +1,80 @@
+import os
+import sys
+import unittest
+
+import numpy as np
+import sapien.core as sapien
+
+
+@unittest.skipUnless(sys.platform.startswith("linux"), "shared memory transport is Linux only")
+class TestShmRing(unittest.TestCase):
+    def setUp(self):
+        self.name = "/sapien_test_{}_{}".format(os.getpid(), self.id().split(".")[-1])
+        self.ring = sapien.ShmRing.create(self.name, 2, 8, 2)
+        self.received = []
+
+        def handler(frame, body_poses, camera_poses, picture_ids):
+            if len(body_poses) == 3:
+                raise ValueError("rejected")
+            self.received.append((frame, body_poses, camera_poses, picture_ids))
+
+        self.server = sapien.ShmRingServer(self.name, handler)
+        # both sides have it mapped
+        self.ring.unlink()
+
+    def tearDown(self):
+        self.server = None
+        self.ring = None
+
+    def send(self, bodies, cameras, pictures, wait=True):
+        n = self.ring.begin_frame(1000)
+        self.ring.write_frame(n, bodies, cameras, np.array(pictures, dtype=np.uint64))
+        self.ring.end_frame(n)
+        if wait:
+            self.ring.wait_completed(n, 1000)
+        return n
+
+    def test_round_trip(self):
+        rng = np.random.default_rng(0)
+        for i in range(5):
+            bodies = rng.random((i + 1, 7), dtype=np.float32)
+            cameras = rng.random((2, 7), dtype=np.float32)
+            n = self.send(bodies, cameras, [7, i])
+            self.assertEqual(n, i + 1)
+            self.assertEqual(self.ring.completed, n)
+
+            frame, b, c, p = self.received[-1]
+            self.assertEqual(frame, n)
+            self.assertTrue(np.array_equal(b, bodies))
+            self.assertTrue(np.array_equal(c, cameras))
+            self.assertEqual(list(p), [7, i])
+        self.assertEqual(len(self.received), 5)
+
+    def test_frames_in_flight(self):
+        zero = np.zeros((0, 7), dtype=np.float32)
+        # two slots, the second frame is written while the first may still be served
+        first = self.send(np.ones((1, 7)), zero, [], wait=False)
+        second = self.send(np.full((2, 7), 2), zero, [])
+        self.ring.wait_completed(first, 1000)
+        self.assertEqual([r[0] for r in self.received], [first, second])
+        self.assertTrue(np.array_equal(self.received[0][1], np.ones((1, 7))))
+        self.assertTrue(np.array_equal(self.received[1][1], np.full((2, 7), 2)))
+
+    def test_failed_frame(self):
+        zero = np.zeros((0, 7), dtype=np.float32)
+        with self.assertRaises(RuntimeError):
+            self.send(np.zeros((3, 7)), zero, [])
+        # the failed frame is completed and later frames are not affected
+        n = self.send(np.zeros((1, 7)), zero, [])
+        self.assertEqual(self.ring.completed, n)
+        self.assertEqual(self.received[-1][0], n)
+
+    def test_invalid(self):
+        n = self.ring.begin_frame(1000)
+        with self.assertRaises(ValueError):
+            self.ring.write_frame(n, np.zeros((9, 7)), np.zeros((0, 7)), np.zeros(0, np.uint64))
+        with self.assertRaises(ValueError):
+            self.ring.write_frame(n, np.zeros((1, 3)), np.zeros((0, 7)), np.zeros(0, np.uint64))
+        # the name is gone once both sides mapped it
+        with self.assertRaises(RuntimeError):
+            sapien.ShmRing.open(self.name)
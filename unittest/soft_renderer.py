@@ -0,0 +1,42 @@
+import unittest
+
+import numpy as np
+import sapien.core as sapien
+
+
+class TestSoftRenderer(unittest.TestCase):
+    def test_box(self):
+        near, far = 0.1, 10
+        half, distance = 0.25, 2
+        engine = sapien.Engine()
+        engine.set_renderer(sapien.SoftRenderer())
+        scene = engine.create_scene()
+
+        builder = scene.create_actor_builder()
+        builder.add_box_visual(half_size=[half] * 3, color=[1, 0, 0])
+        box = builder.build_kinematic()
+        box.set_pose(sapien.Pose([distance, 0, 0]))
+        # at the origin looking along +x
+        camera = scene.add_camera("cam", 32, 32, 1, near, far)
+
+        scene.update_render()
+        camera.take_picture()
+
+        z = distance - half
+        depth = camera.get_float_texture("Depth")
+        self.assertAlmostEqual(depth[16, 16], z, places=4)
+        self.assertEqual(depth[0, 0], 0)
+
+        position = camera.get_float_texture("Position")
+        self.assertAlmostEqual(position[16, 16, 2], -z, places=4)
+        self.assertAlmostEqual(position[16, 16, 3], far / (far - near) * (z - near) / z, places=5)
+        self.assertEqual(position[0, 0, 3], 1)
+
+        seg = camera.get_uint32_texture("Segmentation")
+        self.assertEqual(seg[16, 16, 0], box.get_visual_bodies()[0].get_visual_id())
+        self.assertEqual(seg[16, 16, 1], box.id)
+        self.assertEqual(list(seg[0, 0, :2]), [0, 0])
+
+        # the face toward the camera points back along the view axis
+        normal = camera.get_float_texture("Normal")
+        self.assertTrue(np.allclose(normal[16, 16, :3], [0, 0, 1], atol=1e-4))